@@ -0,0 +1,145 @@
+#include "firmware/app/control/bangbang_trajectory.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "firmware/shared/physics.h"
+
+// The number of bisection iterations used to find how to split the linear limits
+// between the x and y axes. Each iteration halves the range of angles, so this gives
+// a split accurate to roughly (pi/2) / 2^20 radians.
+#define NUM_ACCELERATION_SPLIT_ITERATIONS 20
+
+/**
+ * Plans a 1D bang-bang profile that comes to a stop after travelling the given
+ * distance
+ *
+ * @param profile [out] The profile to plan
+ * @param distance The distance to travel
+ * @param initial_velocity The velocity at the start of the profile
+ * @param max_acceleration The maximum acceleration allowed along the profile
+ * @param max_speed The maximum speed allowed along the profile
+ */
+static void app_bangbang_trajectory_planProfile(BBProfile* profile, float distance,
+                                                float initial_velocity,
+                                                float max_acceleration, float max_speed)
+{
+    // The planner leaves the profile times untouched if it cannot find a solution
+    memset(profile, 0, sizeof(BBProfile));
+    app_bangbang_prepareTrajectoryMaxV(profile, distance, initial_velocity, 0.0f,
+                                       max_acceleration, max_speed);
+    app_bangbang_planTrajectory(profile);
+}
+
+/**
+ * Returns the duration of the given profile
+ *
+ * @param profile [in] A planned profile
+ *
+ * @return the duration of the profile, in seconds
+ */
+static float app_bangbang_trajectory_getProfileDuration(const BBProfile* profile)
+{
+    return profile->t1 + profile->t2 + profile->t3;
+}
+
+/**
+ * Plans the x and y profiles of a trajectory with the linear limits split between the
+ * axes according to the given angle. The x axis gets cos(angle) of each limit and the
+ * y axis gets sin(angle) of each limit.
+ *
+ * @param parameters [in] The parameters of the trajectory
+ * @param angle The angle to split the limits by, in radians in the range (0, pi/2)
+ * @param trajectory [out] The trajectory to plan the x and y profiles of
+ */
+static void app_bangbang_trajectory_planLinearProfiles(
+    const BangBangTrajectoryParameters_t* parameters, float angle,
+    BangBangTrajectory_t* trajectory)
+{
+    const float x_fraction = cosf(angle);
+    const float y_fraction = sinf(angle);
+
+    app_bangbang_trajectory_planProfile(
+        &(trajectory->x_profile),
+        parameters->destination.x - parameters->initial_position.x,
+        parameters->initial_velocity.x,
+        parameters->max_allowable_linear_acceleration * x_fraction,
+        parameters->max_allowable_linear_speed * x_fraction);
+    app_bangbang_trajectory_planProfile(
+        &(trajectory->y_profile),
+        parameters->destination.y - parameters->initial_position.y,
+        parameters->initial_velocity.y,
+        parameters->max_allowable_linear_acceleration * y_fraction,
+        parameters->max_allowable_linear_speed * y_fraction);
+}
+
+void app_bangbang_trajectory_generate(const BangBangTrajectoryParameters_t* parameters,
+                                      BangBangTrajectory_t* trajectory)
+{
+    trajectory->initial_position    = parameters->initial_position;
+    trajectory->initial_orientation = parameters->initial_orientation;
+
+    // Giving an axis a larger share of the limits makes its profile shorter, so we
+    // bisect to find the split where both axes finish at the same time. The end points
+    // of the range are never evaluated, so neither axis is ever given zero
+    // acceleration.
+    float min_angle = 0.0f;
+    float max_angle = P_PI / 2.0f;
+    for (unsigned int i = 0; i < NUM_ACCELERATION_SPLIT_ITERATIONS; i++)
+    {
+        const float angle = (min_angle + max_angle) / 2.0f;
+        app_bangbang_trajectory_planLinearProfiles(parameters, angle, trajectory);
+
+        if (app_bangbang_trajectory_getProfileDuration(&(trajectory->x_profile)) >
+            app_bangbang_trajectory_getProfileDuration(&(trajectory->y_profile)))
+        {
+            // The x axis needs a larger share of the limits
+            max_angle = angle;
+        }
+        else
+        {
+            min_angle = angle;
+        }
+    }
+    app_bangbang_trajectory_planLinearProfiles(parameters, (min_angle + max_angle) / 2.0f,
+                                               trajectory);
+
+    app_bangbang_trajectory_planProfile(
+        &(trajectory->orientation_profile),
+        min_angle_delta(parameters->initial_orientation, parameters->final_orientation),
+        parameters->initial_angular_velocity,
+        parameters->max_allowable_angular_acceleration,
+        parameters->max_allowable_angular_speed);
+}
+
+float app_bangbang_trajectory_getDuration(const BangBangTrajectory_t* trajectory)
+{
+    return fmaxf(
+        fmaxf(app_bangbang_trajectory_getProfileDuration(&(trajectory->x_profile)),
+              app_bangbang_trajectory_getProfileDuration(&(trajectory->y_profile))),
+        app_bangbang_trajectory_getProfileDuration(&(trajectory->orientation_profile)));
+}
+
+void app_bangbang_trajectory_getState(const BangBangTrajectory_t* trajectory, float time,
+                                      BangBangTrajectoryState_t* state)
+{
+    // Each profile is held at its final state once it ends, rather than coasting at
+    // whatever small velocity is left over from rounding errors
+    float x_displacement, y_displacement, orientation_displacement;
+    app_bangbang_getState(
+        &(trajectory->x_profile),
+        fminf(time, app_bangbang_trajectory_getProfileDuration(&(trajectory->x_profile))),
+        &x_displacement, &(state->velocity.x));
+    app_bangbang_getState(
+        &(trajectory->y_profile),
+        fminf(time, app_bangbang_trajectory_getProfileDuration(&(trajectory->y_profile))),
+        &y_displacement, &(state->velocity.y));
+    app_bangbang_getState(&(trajectory->orientation_profile),
+                          fminf(time, app_bangbang_trajectory_getProfileDuration(
+                                          &(trajectory->orientation_profile))),
+                          &orientation_displacement, &(state->angular_velocity));
+
+    state->position.x  = trajectory->initial_position.x + x_displacement;
+    state->position.y  = trajectory->initial_position.y + y_displacement;
+    state->orientation = trajectory->initial_orientation + orientation_displacement;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "firmware/app/control/bangbang.h"
+#include "firmware/shared/math/vector_2d.h"
+
+/*
+ * This file implements a closed-form, time-optimal trajectory for a robot moving in a
+ * straight line to a destination while rotating to a final orientation. Unlike the
+ * trajectories created by trajectory_planner.h, which are discretized into up to
+ * TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS elements, a BangBangTrajectory_t is made up of
+ * one bang-bang profile (see bangbang.h) per axis. It therefore takes constant memory
+ * and the state at any time can be computed in constant time.
+ *
+ * The x and y profiles are synchronized so that they finish at the same time, which
+ * keeps the robot close to the straight line between its start and destination. This
+ * is done by splitting the linear acceleration and speed limits between the two axes
+ * as described in "Trajectory generation and control for four wheeled omnidirectional
+ * vehicles" by Purwin and D'Andrea.
+ *
+ * NOTE: Trajectories are time-optimal assuming INFINITE JERK capability of the robot,
+ * and always come to a stop at the destination. If the initial velocity along an axis
+ * is faster than that axis' share of the maximum speed, the robot may briefly exceed
+ * the maximum linear speed while slowing down along that axis.
+ */
+
+typedef struct BangBangTrajectoryParameters
+{
+    // The position of the robot at the start of the trajectory [m]
+    Vector2d_t initial_position;
+    // The velocity of the robot at the start of the trajectory [m/s]
+    Vector2d_t initial_velocity;
+    // The position the robot should stop at [m]
+    Vector2d_t destination;
+    // The orientation of the robot at the start of the trajectory [rad]
+    float initial_orientation;
+    // The angular velocity of the robot at the start of the trajectory [rad/s]
+    float initial_angular_velocity;
+    // The orientation the robot should have at the end of the trajectory [rad]
+    float final_orientation;
+    // The maximum linear acceleration allowed at any point along the trajectory
+    // [m/s^2]. Must be positive.
+    float max_allowable_linear_acceleration;
+    // The maximum linear speed allowed at any point along the trajectory [m/s]. Must
+    // be positive.
+    float max_allowable_linear_speed;
+    // The maximum angular acceleration allowed at any point along the trajectory
+    // [rad/s^2]. Must be positive.
+    float max_allowable_angular_acceleration;
+    // The maximum angular speed allowed at any point along the trajectory [rad/s]. Must
+    // be positive.
+    float max_allowable_angular_speed;
+} BangBangTrajectoryParameters_t;
+
+typedef struct BangBangTrajectory
+{
+    // The position and orientation the profiles are relative to
+    Vector2d_t initial_position;
+    float initial_orientation;
+
+    // The profiles followed along each axis
+    BBProfile x_profile;
+    BBProfile y_profile;
+    BBProfile orientation_profile;
+} BangBangTrajectory_t;
+
+typedef struct BangBangTrajectoryState
+{
+    Vector2d_t position;
+    Vector2d_t velocity;
+    float orientation;
+    float angular_velocity;
+} BangBangTrajectoryState_t;
+
+/**
+ * Generates a time-optimal trajectory with the given parameters
+ *
+ * @param parameters [in] The parameters of the trajectory to generate
+ * @param trajectory [out] The trajectory to generate
+ */
+void app_bangbang_trajectory_generate(const BangBangTrajectoryParameters_t* parameters,
+                                      BangBangTrajectory_t* trajectory);
+
+/**
+ * Returns the time it takes to follow the given trajectory to its end
+ *
+ * @param trajectory [in] The trajectory
+ *
+ * @return the duration of the trajectory, in seconds
+ */
+float app_bangbang_trajectory_getDuration(const BangBangTrajectory_t* trajectory);
+
+/**
+ * Computes the expected state of a robot following the given trajectory. This takes
+ * constant time regardless of the length of the trajectory.
+ *
+ * @param trajectory [in] The trajectory being followed
+ * @param time The time since the start of the trajectory, in seconds. If this is after
+ * the end of the trajectory the final state of the trajectory is returned.
+ * @param state [out] The state of the robot at the given time
+ */
+void app_bangbang_trajectory_getState(const BangBangTrajectory_t* trajectory, float time,
+                                      BangBangTrajectoryState_t* state);
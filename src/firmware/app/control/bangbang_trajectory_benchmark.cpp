@@ -0,0 +1,134 @@
+extern "C"
+{
+#include "firmware/app/control/bangbang_trajectory.h"
+#include "firmware/app/control/trajectory_planner.h"
+}
+
+#include <benchmark/benchmark.h>
+
+// The discretized trajectories are far too large to put on the stack
+static PositionTrajectory_t position_trajectory;
+
+static const BangBangTrajectoryParameters_t BANGBANG_TRAJECTORY_PARAMETERS = {
+    .initial_position                   = {.x = -4.0f, .y = -2.0f},
+    .initial_velocity                   = {.x = 0.5f, .y = -0.5f},
+    .destination                        = {.x = 3.0f, .y = 1.5f},
+    .initial_orientation                = 0.0f,
+    .initial_angular_velocity           = 0.0f,
+    .final_orientation                  = 2.0f,
+    .max_allowable_linear_acceleration  = 3.0f,
+    .max_allowable_linear_speed         = 3.0f,
+    .max_allowable_angular_acceleration = 10.0f,
+    .max_allowable_angular_speed        = 10.0f,
+};
+
+/**
+ * Creates the parameters for a discretized trajectory along the same straight line as
+ * BANGBANG_TRAJECTORY_PARAMETERS
+ *
+ * @param num_elements The number of elements in the trajectory
+ *
+ * @return the path parameters for the discretized trajectory
+ */
+static FirmwareRobotPathParameters_t createPathParameters(unsigned int num_elements)
+{
+    const BangBangTrajectoryParameters_t& parameters = BANGBANG_TRAJECTORY_PARAMETERS;
+    const Vector2d_t start                           = parameters.initial_position;
+    const Vector2d_t destination                     = parameters.destination;
+    const float orientation_change =
+        parameters.final_orientation - parameters.initial_orientation;
+
+    return {
+        .path =
+            {
+                .x = {.coefficients = {0, 0, destination.x - start.x, start.x}},
+                .y = {.coefficients = {0, 0, destination.y - start.y, start.y}},
+            },
+        .orientation_profile               = {.coefficients = {0, 0, orientation_change,
+                                                 parameters.initial_orientation}},
+        .t_start                           = 0,
+        .t_end                             = 1,
+        .num_elements                      = num_elements,
+        .max_allowable_linear_acceleration = parameters.max_allowable_linear_acceleration,
+        .max_allowable_linear_speed        = parameters.max_allowable_linear_speed,
+        .max_allowable_angular_acceleration =
+            parameters.max_allowable_angular_acceleration,
+        .max_allowable_angular_speed = parameters.max_allowable_angular_speed,
+        .initial_linear_speed        = 0,
+        .final_linear_speed          = 0,
+    };
+}
+
+static void BM_generateBangBangTrajectory(benchmark::State& state)
+{
+    BangBangTrajectory_t trajectory;
+    for (auto _ : state)
+    {
+        app_bangbang_trajectory_generate(&BANGBANG_TRAJECTORY_PARAMETERS, &trajectory);
+        benchmark::DoNotOptimize(trajectory);
+    }
+}
+BENCHMARK(BM_generateBangBangTrajectory);
+
+static void BM_getBangBangTrajectoryState(benchmark::State& state)
+{
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&BANGBANG_TRAJECTORY_PARAMETERS, &trajectory);
+    const float duration = app_bangbang_trajectory_getDuration(&trajectory);
+
+    float time = 0.0f;
+    BangBangTrajectoryState_t trajectory_state;
+    for (auto _ : state)
+    {
+        app_bangbang_trajectory_getState(&trajectory, time, &trajectory_state);
+        benchmark::DoNotOptimize(trajectory_state);
+        time = time > duration ? 0.0f : time + 0.005f;
+    }
+}
+BENCHMARK(BM_getBangBangTrajectoryState);
+
+static void BM_generateDiscretizedTrajectory(benchmark::State& state)
+{
+    FirmwareRobotPathParameters_t path_parameters =
+        createPathParameters(static_cast<unsigned int>(state.range(0)));
+    for (auto _ : state)
+    {
+        app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+            path_parameters, &position_trajectory);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_generateDiscretizedTrajectory)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS);
+
+static void BM_getDiscretizedTrajectoryState(benchmark::State& state)
+{
+    const unsigned int num_elements = static_cast<unsigned int>(state.range(0));
+    app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+        createPathParameters(num_elements), &position_trajectory);
+    const float duration = position_trajectory.time_profile[num_elements - 1];
+
+    // Look up the trajectory element for a time the same way the move primitive does
+    // when it is started from scratch
+    float time = 0.0f;
+    for (auto _ : state)
+    {
+        size_t trajectory_index = 1;
+        while (trajectory_index < num_elements - 1 &&
+               position_trajectory.time_profile[trajectory_index] < time)
+        {
+            trajectory_index++;
+        }
+        benchmark::DoNotOptimize(position_trajectory.x_position[trajectory_index]);
+        benchmark::DoNotOptimize(position_trajectory.y_position[trajectory_index]);
+        time = time > duration ? 0.0f : time + 0.005f;
+    }
+}
+BENCHMARK(BM_getDiscretizedTrajectoryState)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS);
@@ -0,0 +1,229 @@
+extern "C"
+{
+#include "firmware/app/control/bangbang_trajectory.h"
+
+#include "firmware/app/control/trajectory_planner.h"
+}
+
+#include <gtest/gtest.h>
+#include <math.h>
+
+class BangBangTrajectoryTest : public testing::Test
+{
+   protected:
+    virtual void SetUp()
+    {
+        parameters = {
+            .initial_position                   = {.x = 0.0f, .y = 0.0f},
+            .initial_velocity                   = {.x = 0.0f, .y = 0.0f},
+            .destination                        = {.x = 3.0f, .y = 1.0f},
+            .initial_orientation                = 0.0f,
+            .initial_angular_velocity           = 0.0f,
+            .final_orientation                  = 0.0f,
+            .max_allowable_linear_acceleration  = 3.0f,
+            .max_allowable_linear_speed         = 2.0f,
+            .max_allowable_angular_acceleration = 10.0f,
+            .max_allowable_angular_speed        = 5.0f,
+        };
+    }
+
+    /**
+     * Generates a trajectory along the same straight line as the given bang-bang
+     * trajectory parameters with the discretized trajectory planner
+     *
+     * @param parameters The parameters of a bang-bang trajectory that starts at rest
+     * and does not rotate
+     * @param num_elements The number of elements to discretize the trajectory into
+     * @param trajectory [out] The discretized trajectory
+     */
+    static void generateDiscretizedTrajectory(
+        const BangBangTrajectoryParameters_t& parameters, unsigned int num_elements,
+        PositionTrajectory_t* trajectory)
+    {
+        const Vector2d_t start       = parameters.initial_position;
+        const Vector2d_t destination = parameters.destination;
+
+        FirmwareRobotPathParameters_t path_parameters = {
+            .path =
+                {
+                    .x = {.coefficients = {0, 0, destination.x - start.x, start.x}},
+                    .y = {.coefficients = {0, 0, destination.y - start.y, start.y}},
+                },
+            .orientation_profile = {.coefficients = {0, 0, 0, 0}},
+            .t_start             = 0,
+            .t_end               = 1,
+            .num_elements        = num_elements,
+            .max_allowable_linear_acceleration =
+                parameters.max_allowable_linear_acceleration,
+            .max_allowable_linear_speed = parameters.max_allowable_linear_speed,
+            .max_allowable_angular_acceleration =
+                parameters.max_allowable_angular_acceleration,
+            .max_allowable_angular_speed = parameters.max_allowable_angular_speed,
+            .initial_linear_speed        = 0,
+            .final_linear_speed          = 0,
+        };
+
+        ASSERT_EQ(
+            OK, app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
+                    path_parameters, trajectory));
+    }
+
+    BangBangTrajectoryParameters_t parameters;
+};
+
+TEST_F(BangBangTrajectoryTest, trajectory_starts_at_initial_state)
+{
+    parameters.initial_velocity         = {.x = -1.0f, .y = 0.5f};
+    parameters.initial_orientation      = 1.0f;
+    parameters.initial_angular_velocity = 2.0f;
+
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    BangBangTrajectoryState_t state;
+    app_bangbang_trajectory_getState(&trajectory, 0.0f, &state);
+    EXPECT_FLOAT_EQ(0.0f, state.position.x);
+    EXPECT_FLOAT_EQ(0.0f, state.position.y);
+    EXPECT_FLOAT_EQ(-1.0f, state.velocity.x);
+    EXPECT_FLOAT_EQ(0.5f, state.velocity.y);
+    EXPECT_FLOAT_EQ(1.0f, state.orientation);
+    EXPECT_FLOAT_EQ(2.0f, state.angular_velocity);
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_stops_at_destination)
+{
+    parameters.initial_velocity  = {.x = -1.0f, .y = 0.5f};
+    parameters.final_orientation = 2.0f;
+
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    BangBangTrajectoryState_t state;
+    const float duration = app_bangbang_trajectory_getDuration(&trajectory);
+    for (float time : {duration, duration + 1.0f})
+    {
+        app_bangbang_trajectory_getState(&trajectory, time, &state);
+        EXPECT_NEAR(3.0f, state.position.x, 1e-4);
+        EXPECT_NEAR(1.0f, state.position.y, 1e-4);
+        EXPECT_NEAR(0.0f, state.velocity.x, 1e-4);
+        EXPECT_NEAR(0.0f, state.velocity.y, 1e-4);
+        EXPECT_NEAR(2.0f, state.orientation, 1e-4);
+        EXPECT_NEAR(0.0f, state.angular_velocity, 1e-4);
+    }
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_rotates_the_short_way_around)
+{
+    parameters.initial_orientation = 3.0f;
+    parameters.final_orientation   = -3.0f;
+
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    BangBangTrajectoryState_t state;
+    app_bangbang_trajectory_getState(
+        &trajectory, app_bangbang_trajectory_getDuration(&trajectory), &state);
+    EXPECT_NEAR(2 * M_PI - 3.0f, state.orientation, 1e-4);
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_respects_limits)
+{
+    parameters.initial_velocity  = {.x = 1.2f, .y = 0.4f};
+    parameters.final_orientation = 2.0f;
+
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    const float duration = app_bangbang_trajectory_getDuration(&trajectory);
+    const float dt       = 0.001f;
+    BangBangTrajectoryState_t previous_state;
+    app_bangbang_trajectory_getState(&trajectory, 0.0f, &previous_state);
+    for (float time = dt; time < duration; time += dt)
+    {
+        BangBangTrajectoryState_t state;
+        app_bangbang_trajectory_getState(&trajectory, time, &state);
+
+        EXPECT_LE(hypotf(state.velocity.x, state.velocity.y),
+                  parameters.max_allowable_linear_speed + 1e-3);
+        EXPECT_LE(fabsf(state.angular_velocity),
+                  parameters.max_allowable_angular_speed + 1e-3);
+
+        // The acceleration of a bang-bang profile is constant except at the switching
+        // times, so a finite difference is exact apart from over those times
+        const float linear_acceleration =
+            hypotf(state.velocity.x - previous_state.velocity.x,
+                   state.velocity.y - previous_state.velocity.y) /
+            dt;
+        const float angular_acceleration =
+            fabsf(state.angular_velocity - previous_state.angular_velocity) / dt;
+        EXPECT_LE(linear_acceleration,
+                  parameters.max_allowable_linear_acceleration + 1e-2);
+        EXPECT_LE(angular_acceleration,
+                  parameters.max_allowable_angular_acceleration + 1e-2);
+
+        previous_state = state;
+    }
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_from_rest_follows_straight_line)
+{
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    // Both axes should finish at the same time, which keeps the robot on the line
+    // from its start to its destination
+    const float duration = app_bangbang_trajectory_getDuration(&trajectory);
+    for (float time = 0.0f; time < duration; time += 0.01f)
+    {
+        BangBangTrajectoryState_t state;
+        app_bangbang_trajectory_getState(&trajectory, time, &state);
+        EXPECT_NEAR(state.position.x / 3.0f, state.position.y / 1.0f, 1e-3);
+    }
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_with_no_distance_to_travel)
+{
+    parameters.destination = parameters.initial_position;
+
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+
+    EXPECT_FLOAT_EQ(0.0f, app_bangbang_trajectory_getDuration(&trajectory));
+
+    BangBangTrajectoryState_t state;
+    app_bangbang_trajectory_getState(&trajectory, 1.0f, &state);
+    EXPECT_FLOAT_EQ(0.0f, state.position.x);
+    EXPECT_FLOAT_EQ(0.0f, state.position.y);
+}
+
+TEST_F(BangBangTrajectoryTest, trajectory_matches_discretized_trajectory_planner)
+{
+    // The discretized planner converges to the time-optimal trajectory as the number
+    // of elements increases, so the closed-form trajectory should be (slightly) faster
+    // than any discretized trajectory and agree closely with a finely discretized one
+    BangBangTrajectory_t trajectory;
+    app_bangbang_trajectory_generate(&parameters, &trajectory);
+    const float duration = app_bangbang_trajectory_getDuration(&trajectory);
+
+    static PositionTrajectory_t discretized_trajectory;
+    for (unsigned int num_elements : {10u, 100u, 1000u, 9000u})
+    {
+        generateDiscretizedTrajectory(parameters, num_elements, &discretized_trajectory);
+        const float discretized_duration =
+            discretized_trajectory.time_profile[num_elements - 1];
+        EXPECT_LE(duration, discretized_duration + 1e-3);
+    }
+
+    const unsigned int num_elements = TRAJECTORY_PLANNER_MAX_NUM_ELEMENTS;
+    EXPECT_NEAR(duration, discretized_trajectory.time_profile[num_elements - 1], 0.01);
+    for (unsigned int i = 0; i < num_elements; i += 100)
+    {
+        BangBangTrajectoryState_t state;
+        app_bangbang_trajectory_getState(&trajectory,
+                                         discretized_trajectory.time_profile[i], &state);
+        EXPECT_NEAR(discretized_trajectory.x_position[i], state.position.x, 0.01);
+        EXPECT_NEAR(discretized_trajectory.y_position[i], state.position.y, 0.01);
+        EXPECT_NEAR(discretized_trajectory.linear_speed[i],
+                    hypotf(state.velocity.x, state.velocity.y), 0.05);
+    }
+}
@@ -245,16 +245,16 @@ app_trajectory_planner_interpolateConstantPeriodPositionTrajectory(
 }
 
 void app_trajectory_planner_generateVelocityTrajectory(
-    PositionTrajectory_t* position_trajectory, unsigned int num_elements,
+    const PositionTrajectory_t* position_trajectory, unsigned int num_elements,
     VelocityTrajectory_t* velocity_trajectory)
 {
     // Assign local variables to make code more legible
-    float* x_positions           = position_trajectory->x_position;
-    float* y_positions           = position_trajectory->y_position;
-    float* orientations          = position_trajectory->orientation;
-    float* linear_speeds         = position_trajectory->linear_speed;
-    float* angular_speeds        = position_trajectory->angular_speed;
-    float* position_time_profile = position_trajectory->time_profile;
+    const float* x_positions           = position_trajectory->x_position;
+    const float* y_positions           = position_trajectory->y_position;
+    const float* orientations          = position_trajectory->orientation;
+    const float* linear_speeds         = position_trajectory->linear_speed;
+    const float* angular_speeds        = position_trajectory->angular_speed;
+    const float* position_time_profile = position_trajectory->time_profile;
 
     float* x_velocity            = velocity_trajectory->x_velocity;
     float* y_velocity            = velocity_trajectory->y_velocity;
@@ -207,5 +207,5 @@ app_trajectory_planner_generateConstantPeriodPositionTrajectory(
  * as the input position trajectory.
  */
 void app_trajectory_planner_generateVelocityTrajectory(
-    PositionTrajectory_t *position_trajectory, unsigned int num_elements,
+    const PositionTrajectory_t *position_trajectory, unsigned int num_elements,
     VelocityTrajectory_t *velocity_trajectory);
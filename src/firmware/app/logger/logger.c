@@ -18,7 +18,16 @@ typedef struct Logger
 // However, the logger is the _only_ exception to that rule, as dependency injecting
 // the logger into every object that wants to log, is simply overkill. Ontop of that,
 // we cannot have useful log macros like TLOG_WARN(...), TLOG_ERROR(...), etc...
+//
+// When running in the simulator, the logger is thread local so that separate
+// simulations can run in separate threads.
+#ifdef __arm__
 static Logger_t logger;
+#elif __unix__
+static _Thread_local Logger_t logger;
+#else
+#error "Could not determine what CPU this is being compiled for."
+#endif
 
 void app_logger_init(unsigned robot_id,
                      void (*robot_log_msg_handler)(TbotsProto_RobotLog log_msg))
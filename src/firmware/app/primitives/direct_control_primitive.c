@@ -13,6 +13,7 @@ typedef struct DirectControlPrimitiveState
     float direct_target_velocity_angular;
 } DirectControlPrimitiveState_t;
 DEFINE_PRIMITIVE_STATE_CREATE_AND_DESTROY_FUNCTIONS(DirectControlPrimitiveState_t)
+DEFINE_PRIMITIVE_STATE_SAVE_AND_RESTORE_FUNCTIONS(DirectControlPrimitiveState_t)
 
 void app_direct_control_primitive_start(TbotsProto_DirectControlPrimitive prim_msg,
                                         void* void_state_ptr, FirmwareWorld_t* world)
@@ -125,7 +126,10 @@ static void app_direct_control_primitive_tick(void* void_state_ptr,
  * \brief The direct control primitive.
  */
 const primitive_t DIRECT_CONTROL_PRIMITIVE = {
-    .direct        = true,
-    .tick          = &app_direct_control_primitive_tick,
-    .create_state  = &createDirectControlPrimitiveState_t,
-    .destroy_state = &destroyDirectControlPrimitiveState_t};
+    .direct               = true,
+    .tick                 = &app_direct_control_primitive_tick,
+    .create_state         = &createDirectControlPrimitiveState_t,
+    .destroy_state        = &destroyDirectControlPrimitiveState_t,
+    .get_saved_state_size = &getSavedDirectControlPrimitiveState_tSize,
+    .save_state           = &saveDirectControlPrimitiveState_t,
+    .restore_state        = &restoreDirectControlPrimitiveState_t};
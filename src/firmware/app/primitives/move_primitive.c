@@ -2,6 +2,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -18,22 +19,251 @@
 // so that the axes would never have to compete for resources
 #define TIME_HORIZON 0.05f  // s
 
+// The number of elements in a trajectory is sized to the length of the path (and the
+// change in orientation along it), so that short moves are cheaper to plan and track
+#define TRAJECTORY_SEGMENT_LENGTH_METERS 0.1f
+#define TRAJECTORY_SEGMENT_ANGLE_RADIANS 0.5f
+#define MIN_NUM_TRAJECTORY_ELEMENTS 4
+#define MAX_NUM_TRAJECTORY_ELEMENTS 10
+
+// The number of arrays of elements in a PositionTrajectory_t
+#define NUM_POSITION_TRAJECTORY_ARRAYS 6
+
+// A new move primitive keeps following the current trajectory instead of planning a
+// new one if its parameters are within these tolerances of the parameters the
+// trajectory was planned for, and the robot is still close to the trajectory
+#define TRAJECTORY_REUSE_DESTINATION_TOLERANCE_METERS 0.01f
+#define TRAJECTORY_REUSE_ORIENTATION_TOLERANCE_RADIANS 0.01f
+#define TRAJECTORY_REUSE_SPEED_TOLERANCE_M_PER_S 0.01f
+#define TRAJECTORY_REUSE_SPIN_TOLERANCE_REV_PER_S 0.01f
+#define TRAJECTORY_REUSE_TRACKING_TOLERANCE_METERS 0.05f
+
 typedef struct MoveState
 {
-    // The trajectory we're tracking
-    PositionTrajectory_t position_trajectory;
-
     // The number of elements in the trajectory we're tracking
     unsigned int num_trajectory_elems;
 
+    // The index of the trajectory element executed on the last tick, which is where
+    // the search for the element to execute on the next tick starts
+    size_t trajectory_index;
+
     // The start time of this primitive, in seconds
     float primitive_start_time_seconds;
 
     // The maximum speed of the move primitive
     float max_speed_m_per_s;
 
+    // Whether a trajectory has been planned, and the primitive message it was planned
+    // for. The state is kept when a move primitive is restarted, so this is used to
+    // avoid planning the same trajectory again
+    bool has_trajectory;
+    TbotsProto_MovePrimitive trajectory_prim_msg;
+
+    // The trajectory we're tracking. This is the last member so that everything before
+    // it can be saved in one piece, followed by only the elements of the trajectory
+    // that are in use.
+    PositionTrajectory_t position_trajectory;
 } MoveState_t;
-DEFINE_PRIMITIVE_STATE_CREATE_AND_DESTROY_FUNCTIONS(MoveState_t);
+
+static void* createMoveState_t(void)
+{
+    MoveState_t* state    = (MoveState_t*)malloc(sizeof(MoveState_t));
+    state->has_trajectory = false;
+    return state;
+}
+
+static void destroyMoveState_t(void* state)
+{
+    free((MoveState_t*)state);
+}
+
+/**
+ * Returns the number of elements of the trajectory in the given state that are in use
+ *
+ * @param state [in] The state of the move primitive
+ *
+ * @return the number of elements of the trajectory that are in use
+ */
+static size_t app_move_primitive_getNumTrajectoryElementsInUse(const MoveState_t* state)
+{
+    return state->has_trajectory ? state->num_trajectory_elems : 0;
+}
+
+static size_t getSavedMoveState_tSize(const void* void_state_ptr)
+{
+    const MoveState_t* state = (const MoveState_t*)void_state_ptr;
+    return offsetof(MoveState_t, position_trajectory) +
+           NUM_POSITION_TRAJECTORY_ARRAYS *
+               app_move_primitive_getNumTrajectoryElementsInUse(state) * sizeof(float);
+}
+
+static void saveMoveState_t(const void* void_state_ptr, uint8_t* buffer)
+{
+    const MoveState_t* state = (const MoveState_t*)void_state_ptr;
+
+    const size_t header_size = offsetof(MoveState_t, position_trajectory);
+    memcpy(buffer, state, header_size);
+    buffer += header_size;
+
+    const size_t array_size =
+        app_move_primitive_getNumTrajectoryElementsInUse(state) * sizeof(float);
+    const PositionTrajectory_t* trajectory = &(state->position_trajectory);
+    const float* const arrays[NUM_POSITION_TRAJECTORY_ARRAYS] = {
+        trajectory->x_position,   trajectory->y_position,    trajectory->orientation,
+        trajectory->linear_speed, trajectory->angular_speed, trajectory->time_profile};
+    for (unsigned int i = 0; i < NUM_POSITION_TRAJECTORY_ARRAYS; i++)
+    {
+        memcpy(buffer, arrays[i], array_size);
+        buffer += array_size;
+    }
+}
+
+static void restoreMoveState_t(void* void_state_ptr, const uint8_t* buffer)
+{
+    MoveState_t* state = (MoveState_t*)void_state_ptr;
+
+    const size_t header_size = offsetof(MoveState_t, position_trajectory);
+    memcpy(state, buffer, header_size);
+    buffer += header_size;
+
+    const size_t array_size =
+        app_move_primitive_getNumTrajectoryElementsInUse(state) * sizeof(float);
+    PositionTrajectory_t* trajectory                    = &(state->position_trajectory);
+    float* const arrays[NUM_POSITION_TRAJECTORY_ARRAYS] = {
+        trajectory->x_position,   trajectory->y_position,    trajectory->orientation,
+        trajectory->linear_speed, trajectory->angular_speed, trajectory->time_profile};
+    for (unsigned int i = 0; i < NUM_POSITION_TRAJECTORY_ARRAYS; i++)
+    {
+        memcpy(arrays[i], buffer, array_size);
+        buffer += array_size;
+    }
+}
+
+/**
+ * Finds the index of the trajectory element that should be executed at the given
+ * time. This is the first element (after the first one) whose preceding element is
+ * not scheduled before the given time, or the last element if there is no such
+ * element.
+ *
+ * Time only moves forwards while a trajectory is being tracked, so the search starts
+ * from the index found on the previous call instead of the start of the trajectory.
+ *
+ * @param state [in/out] The move primitive state containing the trajectory
+ * @param time_since_start_seconds The time since the trajectory was started
+ *
+ * @return the index of the trajectory element to execute
+ */
+static size_t app_move_primitive_getTrajectoryIndex(MoveState_t* state,
+                                                    float time_since_start_seconds)
+{
+    const float* time_profile = state->position_trajectory.time_profile;
+
+    size_t trajectory_index = state->trajectory_index;
+    if (trajectory_index < 1 ||
+        (trajectory_index > 1 &&
+         time_profile[trajectory_index - 2] >= time_since_start_seconds))
+    {
+        // Time went backwards, so the search has to start from the beginning
+        trajectory_index = 1;
+    }
+
+    while (trajectory_index < state->num_trajectory_elems - 1 &&
+           time_profile[trajectory_index - 1] < time_since_start_seconds)
+    {
+        trajectory_index++;
+    }
+
+    state->trajectory_index = trajectory_index;
+    return trajectory_index;
+}
+
+/**
+ * Returns the number of elements to plan a trajectory with
+ *
+ * @param distance_to_destination The length of the path, in meters
+ * @param change_in_orientation The change in orientation along the path, in radians
+ *
+ * @return the number of elements to plan the trajectory with
+ */
+static unsigned int app_move_primitive_getNumTrajectoryElements(
+    float distance_to_destination, float change_in_orientation)
+{
+    const float num_segments =
+        fmaxf(distance_to_destination / TRAJECTORY_SEGMENT_LENGTH_METERS,
+              fabsf(change_in_orientation) / TRAJECTORY_SEGMENT_ANGLE_RADIANS);
+
+    float num_elements = ceilf(num_segments) + 1.0f;
+    clamp(&num_elements, (float)MIN_NUM_TRAJECTORY_ELEMENTS,
+          (float)MAX_NUM_TRAJECTORY_ELEMENTS);
+    return (unsigned int)num_elements;
+}
+
+/**
+ * Checks if the robot can keep following the trajectory in the given state instead of
+ * planning a new trajectory for the given primitive message
+ *
+ * @param state [in/out] The move primitive state containing the current trajectory
+ * @param prim_msg [in] The new move primitive message
+ * @param world [in] The world the primitive is running in
+ *
+ * @return true if the current trajectory can be reused, false otherwise
+ */
+static bool app_move_primitive_canReuseTrajectory(
+    MoveState_t* state, const TbotsProto_MovePrimitive* prim_msg, FirmwareWorld_t* world)
+{
+    if (!state->has_trajectory)
+    {
+        return false;
+    }
+
+    const TbotsProto_MovePrimitive* old_msg = &(state->trajectory_prim_msg);
+    const bool parameters_unchanged =
+        norm2(prim_msg->destination.x_meters - old_msg->destination.x_meters,
+              prim_msg->destination.y_meters - old_msg->destination.y_meters) <=
+            TRAJECTORY_REUSE_DESTINATION_TOLERANCE_METERS &&
+        fabsf(min_angle_delta(prim_msg->final_angle.radians,
+                              old_msg->final_angle.radians)) <=
+            TRAJECTORY_REUSE_ORIENTATION_TOLERANCE_RADIANS &&
+        fabsf(prim_msg->final_speed_m_per_s - old_msg->final_speed_m_per_s) <=
+            TRAJECTORY_REUSE_SPEED_TOLERANCE_M_PER_S &&
+        fabsf(prim_msg->max_speed_m_per_s - old_msg->max_speed_m_per_s) <=
+            TRAJECTORY_REUSE_SPEED_TOLERANCE_M_PER_S &&
+        fabsf(prim_msg->target_spin_rev_per_s - old_msg->target_spin_rev_per_s) <=
+            TRAJECTORY_REUSE_SPIN_TOLERANCE_REV_PER_S;
+    if (!parameters_unchanged)
+    {
+        return false;
+    }
+
+    // The robot should be somewhere on the segment of the trajectory it is currently
+    // executing. If it is not (ie. it was bumped) a new trajectory has to be planned
+    // from where the robot actually is
+    const FirmwareRobot_t* robot  = app_firmware_world_getRobot(world);
+    const size_t trajectory_index = app_move_primitive_getTrajectoryIndex(
+        state,
+        app_firmware_world_getCurrentTime(world) - state->primitive_start_time_seconds);
+
+    const PositionTrajectory_t* trajectory = &(state->position_trajectory);
+    const float segment_start[2] = {trajectory->x_position[trajectory_index - 1],
+                                    trajectory->y_position[trajectory_index - 1]};
+    float segment[2] = {trajectory->x_position[trajectory_index] - segment_start[0],
+                        trajectory->y_position[trajectory_index] - segment_start[1]};
+    float start_to_robot[2] = {app_firmware_robot_getPositionX(robot) - segment_start[0],
+                               app_firmware_robot_getPositionY(robot) - segment_start[1]};
+
+    const float segment_length_squared = dot2D(segment, segment);
+    float fraction_along_segment       = 0.0f;
+    if (segment_length_squared > 0.0f)
+    {
+        fraction_along_segment = dot2D(start_to_robot, segment) / segment_length_squared;
+        clamp(&fraction_along_segment, 0.0f, 1.0f);
+    }
+
+    const float tracking_error =
+        norm2(start_to_robot[0] - fraction_along_segment * segment[0],
+              start_to_robot[1] - fraction_along_segment * segment[1]);
+    return tracking_error <= TRAJECTORY_REUSE_TRACKING_TOLERANCE_METERS;
+}
 
 void app_move_primitive_start(TbotsProto_MovePrimitive prim_msg, void* void_state_ptr,
                               FirmwareWorld_t* world)
@@ -66,6 +296,12 @@ void app_move_primitive_start(TbotsProto_MovePrimitive prim_msg, void* void_stat
     /* Handle robot movement */
     MoveState_t* state = (MoveState_t*)void_state_ptr;
 
+    if (app_move_primitive_canReuseTrajectory(state, &prim_msg, world))
+    {
+        // Keep following the current trajectory, from where we currently are on it
+        return;
+    }
+
     // parameters from the primitive message
     const float destination_x           = prim_msg.destination.x_meters;
     const float destination_y           = prim_msg.destination.y_meters;
@@ -91,18 +327,19 @@ void app_move_primitive_start(TbotsProto_MovePrimitive prim_msg, void* void_stat
     const float net_change_in_orientation =
         min_angle_delta(current_orientation, destination_orientation);
 
+    const float change_in_orientation =
+        net_change_in_orientation + (float)revolutions_to_spin * 2.0f * (float)M_PI;
+
     // Plan a trajectory to move to the target position/orientation
     FirmwareRobotPathParameters_t path_parameters = {
         .path = {.x = {.coefficients = {0, 0, destination_x - current_x, current_x}},
                  .y = {.coefficients = {0, 0, destination_y - current_y, current_y}}},
-        .orientation_profile = {.coefficients = {0, 0,
-                                                 net_change_in_orientation +
-                                                     (float)revolutions_to_spin * 2.0f *
-                                                         (float)M_PI,
+        .orientation_profile = {.coefficients = {0, 0, change_in_orientation,
                                                  current_orientation}},
         .t_start             = 0,
         .t_end               = 1.0f,
-        .num_elements        = 10,
+        .num_elements        = app_move_primitive_getNumTrajectoryElements(
+            distance_to_destination, change_in_orientation),
         .max_allowable_linear_acceleration =
             (float)ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED,
         .max_allowable_linear_speed = max_speed_m_per_s,
@@ -112,8 +349,11 @@ void app_move_primitive_start(TbotsProto_MovePrimitive prim_msg, void* void_stat
         .initial_linear_speed        = current_speed,
         .final_linear_speed          = speed_at_dest_m_per_s};
     state->num_trajectory_elems = path_parameters.num_elements;
+    state->trajectory_index     = 1;
     app_trajectory_planner_generateConstantParameterizationPositionTrajectory(
         path_parameters, &(state->position_trajectory));
+    state->has_trajectory      = true;
+    state->trajectory_prim_msg = prim_msg;
 
     // NOTE: We set this after doing the trajectory generation in case the generation
     //       took a while, since we're going to use this as our reference time when
@@ -129,16 +369,11 @@ static void app_move_primitive_tick(void* void_state_ptr, FirmwareWorld_t* world
     const FirmwareRobot_t* robot = app_firmware_world_getRobot(world);
 
     // Figure out the index of the trajectory element we should be executing
-    size_t trajectory_index  = 1;
-    const float current_time = app_firmware_world_getCurrentTime(world);
-    while (trajectory_index < state->num_trajectory_elems - 1 &&
-           state->position_trajectory.time_profile[trajectory_index - 1] <
-               current_time - state->primitive_start_time_seconds)
-    {
-        trajectory_index++;
-    }
+    const float current_time      = app_firmware_world_getCurrentTime(world);
+    const size_t trajectory_index = app_move_primitive_getTrajectoryIndex(
+        state, current_time - state->primitive_start_time_seconds);
 
-    app_firmware_robot_followPosTrajectory(robot, state->position_trajectory,
+    app_firmware_robot_followPosTrajectory(robot, &(state->position_trajectory),
                                            state->num_trajectory_elems, trajectory_index,
                                            state->max_speed_m_per_s);
 }
@@ -146,7 +381,10 @@ static void app_move_primitive_tick(void* void_state_ptr, FirmwareWorld_t* world
 /**
  * \brief The autochip move primitive.
  */
-const primitive_t MOVE_PRIMITIVE = {.direct        = false,
-                                    .tick          = &app_move_primitive_tick,
-                                    .create_state  = &createMoveState_t,
-                                    .destroy_state = &destroyMoveState_t};
+const primitive_t MOVE_PRIMITIVE = {.direct               = false,
+                                    .tick                 = &app_move_primitive_tick,
+                                    .create_state         = &createMoveState_t,
+                                    .destroy_state        = &destroyMoveState_t,
+                                    .get_saved_state_size = &getSavedMoveState_tSize,
+                                    .save_state           = &saveMoveState_t,
+                                    .restore_state        = &restoreMoveState_t};
@@ -2,8 +2,153 @@ extern "C"
 {
 #include "move_primitive.h"
 }
+#include <array>
+#include <vector>
+
 #include "firmware/app/primitives/test_util_world.h"
 
+namespace VelocityWheelTestUtil
+{
+    // Mock fake velocity wheel functions
+    FAKE_VOID_FUNC(set_target_rpm_front_right, float);
+    FAKE_VOID_FUNC(set_target_rpm_front_left, float);
+    FAKE_VOID_FUNC(set_target_rpm_back_right, float);
+    FAKE_VOID_FUNC(set_target_rpm_back_left, float);
+    FAKE_VALUE_FUNC(float, get_motor_speed_rpm);
+    FAKE_VOID_FUNC(brake);
+    FAKE_VOID_FUNC(coast);
+};  // namespace VelocityWheelTestUtil
+
+// Mock velocity wheel state
+VelocityWheelConstants_t velocity_wheel_constants = {
+    .motor_current_per_unit_torque       = 1.1f,
+    .motor_phase_resistance              = 1.2f,
+    .motor_back_emf_per_rpm              = 1.3f,
+    .motor_max_voltage_before_wheel_slip = 1.4f,
+    .wheel_radius                        = 1.5f,
+    .wheel_rotations_per_motor_rotation  = 0.5f};
+
+/**
+ * A fixture with a robot that has velocity wheels. The target wheel speeds such a
+ * robot is given depend directly on the trajectory it is following, which makes it
+ * possible to check which trajectory a move primitive is following.
+ */
+class MovePrimitiveVelocityWheelTest : public FirmwareTestUtilWorld
+{
+   protected:
+    virtual void SetUp(void)
+    {
+        FirmwareTestUtilWorld::SetUp();
+
+        RESET_FAKE(VelocityWheelTestUtil::set_target_rpm_front_right);
+        RESET_FAKE(VelocityWheelTestUtil::set_target_rpm_front_left);
+        RESET_FAKE(VelocityWheelTestUtil::set_target_rpm_back_right);
+        RESET_FAKE(VelocityWheelTestUtil::set_target_rpm_back_left);
+        RESET_FAKE(VelocityWheelTestUtil::get_motor_speed_rpm);
+        RESET_FAKE(VelocityWheelTestUtil::brake);
+        RESET_FAKE(VelocityWheelTestUtil::coast);
+
+        initial_controller_state = controller_state;
+
+        front_right_velocity_wheel = app_velocity_wheel_create(
+            &(VelocityWheelTestUtil::set_target_rpm_front_right),
+            &(VelocityWheelTestUtil::get_motor_speed_rpm),
+            &(VelocityWheelTestUtil::brake), &(VelocityWheelTestUtil::coast),
+            velocity_wheel_constants);
+        front_left_velocity_wheel = app_velocity_wheel_create(
+            &(VelocityWheelTestUtil::set_target_rpm_front_left),
+            &(VelocityWheelTestUtil::get_motor_speed_rpm),
+            &(VelocityWheelTestUtil::brake), &(VelocityWheelTestUtil::coast),
+            velocity_wheel_constants);
+        back_right_velocity_wheel = app_velocity_wheel_create(
+            &(VelocityWheelTestUtil::set_target_rpm_back_right),
+            &(VelocityWheelTestUtil::get_motor_speed_rpm),
+            &(VelocityWheelTestUtil::brake), &(VelocityWheelTestUtil::coast),
+            velocity_wheel_constants);
+        back_left_velocity_wheel = app_velocity_wheel_create(
+            &(VelocityWheelTestUtil::set_target_rpm_back_left),
+            &(VelocityWheelTestUtil::get_motor_speed_rpm),
+            &(VelocityWheelTestUtil::brake), &(VelocityWheelTestUtil::coast),
+            velocity_wheel_constants);
+
+        velocity_wheel_robot = app_firmware_robot_velocity_wheels_create(
+            charger, chicker, dribbler, &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property),
+            &(FirmwareTestUtil::get_robot_property), front_right_velocity_wheel,
+            front_left_velocity_wheel, back_right_velocity_wheel,
+            back_left_velocity_wheel, &controller_state, robot_constants);
+
+        velocity_wheel_world = app_firmware_world_create(
+            velocity_wheel_robot, ball, FirmwareTestUtil::get_current_time_seconds);
+    }
+
+    virtual void TearDown(void)
+    {
+        app_firmware_robot_velocity_wheels_destroy(velocity_wheel_robot);
+        app_firmware_robot_destroy(velocity_wheel_robot);
+        app_firmware_world_destroy(velocity_wheel_world);
+
+        FirmwareTestUtilWorld::TearDown();
+    }
+
+    /**
+     * Creates a primitive message for a move primitive to the given destination
+     *
+     * @param destination_x The x coordinate of the destination, in meters
+     * @param destination_y The y coordinate of the destination, in meters
+     *
+     * @return a primitive message for a move primitive to the given destination
+     */
+    static TbotsProto_Primitive createMovePrimitiveMsg(float destination_x,
+                                                       float destination_y)
+    {
+        TbotsProto_Primitive primitive_msg          = TbotsProto_Primitive_init_zero;
+        primitive_msg.which_primitive               = TbotsProto_Primitive_move_tag;
+        TbotsProto_MovePrimitive move_primitive_msg = TbotsProto_MovePrimitive_init_zero;
+        move_primitive_msg.destination.x_meters     = destination_x;
+        move_primitive_msg.destination.y_meters     = destination_y;
+        move_primitive_msg.max_speed_m_per_s        = 2.0;
+        primitive_msg.primitive.move                = move_primitive_msg;
+        return primitive_msg;
+    }
+
+    /**
+     * Runs the current primitive of the given manager once at the given time. The
+     * controller state is reset first so that the result only depends on the
+     * trajectory being followed.
+     *
+     * @param manager The primitive manager to run
+     * @param time_seconds The time to run the primitive at
+     *
+     * @return the target speeds, in rpm, that the front right, front left, back right
+     * and back left wheels were set to
+     */
+    std::array<float, 4> runPrimitiveAndGetWheelSpeeds(PrimitiveManager_t* manager,
+                                                       float time_seconds)
+    {
+        controller_state = initial_controller_state;
+        FirmwareTestUtil::get_current_time_seconds_fake.return_val = time_seconds;
+        app_primitive_manager_runCurrentPrimitive(manager, velocity_wheel_world);
+
+        return {VelocityWheelTestUtil::set_target_rpm_front_right_fake.arg0_val,
+                VelocityWheelTestUtil::set_target_rpm_front_left_fake.arg0_val,
+                VelocityWheelTestUtil::set_target_rpm_back_right_fake.arg0_val,
+                VelocityWheelTestUtil::set_target_rpm_back_left_fake.arg0_val};
+    }
+
+    ControllerState_t initial_controller_state;
+    FirmwareWorld_t* velocity_wheel_world;
+    FirmwareRobot_t* velocity_wheel_robot;
+    VelocityWheel_t* front_right_velocity_wheel;
+    VelocityWheel_t* front_left_velocity_wheel;
+    VelocityWheel_t* back_right_velocity_wheel;
+    VelocityWheel_t* back_left_velocity_wheel;
+};
+
 TEST_F(FirmwareTestUtilWorld, app_move_primitive_test_autochip)
 {
     TbotsProto_Primitive primitive_msg;
@@ -47,3 +192,159 @@ TEST_F(FirmwareTestUtilWorld, app_move_primitive_test_autokick)
     ASSERT_EQ(FirmwareTestUtil::enable_auto_kick_fake.arg0_val, 3.0);
     app_primitive_manager_destroy(manager);
 }
+
+TEST_F(MovePrimitiveVelocityWheelTest, restart_with_same_parameters_keeps_trajectory)
+{
+    PrimitiveManager_t* manager = app_primitive_manager_create();
+
+    // Restarting with a destination within tolerance of the current one should keep
+    // following the trajectory to the original destination
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.005f, 0.0f));
+    std::array<float, 4> restarted_speeds = runPrimitiveAndGetWheelSpeeds(manager, 0.3f);
+
+    PrimitiveManager_t* original_manager = app_primitive_manager_create();
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(original_manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    std::array<float, 4> original_speeds =
+        runPrimitiveAndGetWheelSpeeds(original_manager, 0.3f);
+
+    PrimitiveManager_t* new_manager = app_primitive_manager_create();
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(new_manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.005f, 0.0f));
+    std::array<float, 4> new_destination_speeds =
+        runPrimitiveAndGetWheelSpeeds(new_manager, 0.3f);
+
+    EXPECT_EQ(original_speeds, restarted_speeds);
+    EXPECT_NE(new_destination_speeds, restarted_speeds);
+
+    app_primitive_manager_destroy(manager);
+    app_primitive_manager_destroy(original_manager);
+    app_primitive_manager_destroy(new_manager);
+}
+
+TEST_F(MovePrimitiveVelocityWheelTest, restart_with_new_destination_plans_new_trajectory)
+{
+    PrimitiveManager_t* manager = app_primitive_manager_create();
+
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(0.0f, 1.0f));
+    std::array<float, 4> restarted_speeds = runPrimitiveAndGetWheelSpeeds(manager, 0.3f);
+
+    PrimitiveManager_t* new_manager = app_primitive_manager_create();
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(new_manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(0.0f, 1.0f));
+    std::array<float, 4> new_destination_speeds =
+        runPrimitiveAndGetWheelSpeeds(new_manager, 0.3f);
+
+    EXPECT_EQ(new_destination_speeds, restarted_speeds);
+
+    app_primitive_manager_destroy(manager);
+    app_primitive_manager_destroy(new_manager);
+}
+
+TEST_F(MovePrimitiveVelocityWheelTest,
+       restart_after_leaving_trajectory_plans_new_trajectory)
+{
+    PrimitiveManager_t* manager = app_primitive_manager_create();
+
+    // Start the trajectory with the robot at the origin, then move the robot well away
+    // from the trajectory before restarting the primitive
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    FirmwareTestUtil::get_robot_property_fake.return_val       = 0.0f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    FirmwareTestUtil::get_robot_property_fake.return_val = 0.5f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    std::array<float, 4> restarted_speeds = runPrimitiveAndGetWheelSpeeds(manager, 0.3f);
+
+    PrimitiveManager_t* new_manager = app_primitive_manager_create();
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(new_manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    std::array<float, 4> replanned_speeds =
+        runPrimitiveAndGetWheelSpeeds(new_manager, 0.3f);
+
+    EXPECT_EQ(replanned_speeds, restarted_speeds);
+
+    app_primitive_manager_destroy(manager);
+    app_primitive_manager_destroy(new_manager);
+}
+
+TEST_F(MovePrimitiveVelocityWheelTest, trajectory_index_follows_time)
+{
+    PrimitiveManager_t* manager = app_primitive_manager_create();
+
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+
+    // Running the primitive at an earlier time than the last run should give the same
+    // result as running it at that time in the first place
+    std::array<float, 4> early_speeds = runPrimitiveAndGetWheelSpeeds(manager, 0.1f);
+    std::array<float, 4> late_speeds  = runPrimitiveAndGetWheelSpeeds(manager, 0.6f);
+    EXPECT_NE(early_speeds, late_speeds);
+    EXPECT_EQ(early_speeds, runPrimitiveAndGetWheelSpeeds(manager, 0.1f));
+
+    app_primitive_manager_destroy(manager);
+}
+
+TEST_F(MovePrimitiveVelocityWheelTest, restored_primitive_follows_saved_trajectory)
+{
+    PrimitiveManager_t* manager = app_primitive_manager_create();
+
+    FirmwareTestUtil::get_current_time_seconds_fake.return_val = 0.0f;
+    app_primitive_manager_startNewPrimitive(manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(1.0f, 0.0f));
+    runPrimitiveAndGetWheelSpeeds(manager, 0.1f);
+
+    std::vector<uint8_t> saved_state(app_primitive_manager_getSavedStateSize(manager));
+    app_primitive_manager_saveState(manager, saved_state.data());
+    std::array<float, 4> original_speeds = runPrimitiveAndGetWheelSpeeds(manager, 0.3f);
+
+    // Restore into a manager running a different primitive, which should be replaced
+    PrimitiveManager_t* restored_manager = app_primitive_manager_create();
+    app_primitive_manager_startNewPrimitive(restored_manager, velocity_wheel_world,
+                                            createMovePrimitiveMsg(0.0f, 1.0f));
+    app_primitive_manager_restoreState(restored_manager, saved_state.data());
+    std::array<float, 4> restored_speeds =
+        runPrimitiveAndGetWheelSpeeds(restored_manager, 0.3f);
+
+    EXPECT_EQ(original_speeds, restored_speeds);
+    // Only the elements of the trajectory that are in use are saved
+    EXPECT_LT(saved_state.size(), sizeof(PositionTrajectory_t));
+
+    app_primitive_manager_destroy(manager);
+    app_primitive_manager_destroy(restored_manager);
+}
+
+TEST_F(FirmwareTestUtilWorld, restoring_saved_idle_manager_ends_current_primitive)
+{
+    PrimitiveManager_t* idle_manager = app_primitive_manager_create();
+    std::vector<uint8_t> saved_state(
+        app_primitive_manager_getSavedStateSize(idle_manager));
+    app_primitive_manager_saveState(idle_manager, saved_state.data());
+    EXPECT_EQ(1u, saved_state.size());
+
+    PrimitiveManager_t* manager        = app_primitive_manager_create();
+    TbotsProto_Primitive primitive_msg = TbotsProto_Primitive_init_zero;
+    primitive_msg.which_primitive      = TbotsProto_Primitive_move_tag;
+    app_primitive_manager_startNewPrimitive(manager, firmware_world, primitive_msg);
+    EXPECT_GT(app_primitive_manager_getSavedStateSize(manager), 1u);
+
+    app_primitive_manager_restoreState(manager, saved_state.data());
+    EXPECT_EQ(1u, app_primitive_manager_getSavedStateSize(manager));
+
+    app_primitive_manager_destroy(idle_manager);
+    app_primitive_manager_destroy(manager);
+}
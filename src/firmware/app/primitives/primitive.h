@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "firmware/app/world/firmware_world.h"
 #include "shared/proto/primitive.nanopb.h"
@@ -36,6 +37,10 @@ typedef struct
 
     /**
      * Allocate a "state" variable that will be passed into all the primitive functions
+     *
+     * NOTE: when the same primitive is started several times in a row, the state
+     * allocated for the first start is reused for the following ones
+     *
      * @return A pointer to a "state" object, ie. whatever this primitive wants to store
      *         in terms of stateful information.
      */
@@ -47,6 +52,34 @@ typedef struct
      */
     void (*destroy_state)(void* state);
 
+    /**
+     * Returns the number of bytes `save_state` writes for the given state object
+     *
+     * @param state_void_ptr [in] A pointer to the state object to save
+     *
+     * @return the number of bytes needed to save the given state object
+     */
+    size_t (*get_saved_state_size)(const void* state_void_ptr);
+
+    /**
+     * Saves the given state object, so that it can be restored later with
+     * `restore_state`. This lets a simulation be checkpointed and resumed.
+     *
+     * @param state_void_ptr [in] A pointer to the state object to save
+     * @param buffer [out] The buffer to save the state object into, which must be at
+     *                     least `get_saved_state_size` bytes long
+     */
+    void (*save_state)(const void* state_void_ptr, uint8_t* buffer);
+
+    /**
+     * Restores the given state object from a buffer it was saved into by `save_state`
+     *
+     * @param state_void_ptr [out] A pointer to the state object to restore, as
+     *                             allocated by the `create_state` function
+     * @param buffer [in] The buffer the state object was saved into
+     */
+    void (*restore_state)(void* state_void_ptr, const uint8_t* buffer);
+
 } primitive_t;
 
 /**
@@ -67,6 +100,29 @@ typedef struct
         free((STATE_TYPE*)state);                                                        \
     }
 
+/**
+ * Implements save and restore methods for the given state object type, by copying the
+ * whole state object
+ *
+ * This should be used to implement the `get_saved_state_size`, `save_state` and
+ * `restore_state` functions in each primitive whose state does not contain pointers
+ *
+ * @param STATE_TYPE The type of the state object
+ */
+#define DEFINE_PRIMITIVE_STATE_SAVE_AND_RESTORE_FUNCTIONS(STATE_TYPE)                    \
+    size_t getSaved##STATE_TYPE##Size(const void* state)                                 \
+    {                                                                                    \
+        return sizeof(STATE_TYPE);                                                       \
+    }                                                                                    \
+    void save##STATE_TYPE(const void* state, uint8_t* buffer)                            \
+    {                                                                                    \
+        memcpy(buffer, state, sizeof(STATE_TYPE));                                       \
+    }                                                                                    \
+    void restore##STATE_TYPE(void* state, const uint8_t* buffer)                         \
+    {                                                                                    \
+        memcpy(state, buffer, sizeof(STATE_TYPE));                                       \
+    }
+
 /**
  * Stop the robot by disabling all motors and disabling autokicking and autochipping
  *
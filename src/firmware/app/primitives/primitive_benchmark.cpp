@@ -0,0 +1,285 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+
+#include "firmware/app/primitives/test_util_world.h"
+
+extern "C"
+{
+#include "firmware/app/control/control.h"
+#include "firmware/app/control/physbot.h"
+#include "firmware/app/control/trajectory_planner.h"
+#include "firmware/app/control/wheel_controller.h"
+#include "firmware/app/world/firmware_robot.h"
+}
+
+// The firmware is linked with --wrap=malloc so that every heap allocation it makes
+// goes through __wrap_malloc. Allocations are counted because the firmware should not
+// allocate on every tick.
+static std::atomic<size_t> num_allocations(0);
+
+extern "C" void *__real_malloc(size_t size);
+extern "C" void *__wrap_malloc(size_t size)
+{
+    num_allocations++;
+    return __real_malloc(size);
+}
+
+// The period of the primitive tick on the robot, in seconds
+static constexpr float TICK_PERIOD_SECONDS = 1.0f / 200.0f;
+
+/**
+ * Runs the firmware against the same stub world as the primitive tests, so that the
+ * time spent in the firmware itself can be measured without any hardware
+ */
+class PrimitiveBenchmark : public benchmark::Fixture, public FirmwareTestUtilWorld
+{
+   public:
+    void SetUp(const benchmark::State &) override
+    {
+        FirmwareTestUtilWorld::SetUp();
+        primitive_manager = app_primitive_manager_create();
+        current_time      = 0.0f;
+        FirmwareTestUtil::get_current_time_seconds_fake.return_val = current_time;
+    }
+
+    void TearDown(const benchmark::State &) override
+    {
+        app_primitive_manager_destroy(primitive_manager);
+        FirmwareTestUtilWorld::TearDown();
+    }
+
+   protected:
+    // FirmwareTestUtilWorld is a gtest fixture, so it requires a test body even though
+    // it is never run as a test here
+    void TestBody() override {}
+
+    /**
+     * Advances the current time of the world by one tick
+     */
+    void advanceTime()
+    {
+        current_time += TICK_PERIOD_SECONDS;
+        FirmwareTestUtil::get_current_time_seconds_fake.return_val = current_time;
+    }
+
+    /**
+     * Starts recording the number of allocations made while benchmarking
+     */
+    void startCountingAllocations()
+    {
+        allocations_at_start = num_allocations;
+    }
+
+    /**
+     * Reports the average number of allocations made per iteration of the benchmark
+     *
+     * @param state The state of the benchmark
+     */
+    void reportAllocations(benchmark::State &state)
+    {
+        state.counters["allocs_per_iteration"] = benchmark::Counter(
+            static_cast<double>(num_allocations - allocations_at_start),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    /**
+     * Creates a primitive message for a move primitive to the given destination
+     *
+     * @param destination_x The x coordinate of the destination, in meters
+     * @param destination_y The y coordinate of the destination, in meters
+     *
+     * @return a primitive message for a move primitive to the given destination
+     */
+    static TbotsProto_Primitive createMovePrimitiveMsg(float destination_x,
+                                                       float destination_y)
+    {
+        TbotsProto_Primitive primitive_msg          = TbotsProto_Primitive_init_zero;
+        primitive_msg.which_primitive               = TbotsProto_Primitive_move_tag;
+        TbotsProto_MovePrimitive move_primitive_msg = TbotsProto_MovePrimitive_init_zero;
+        move_primitive_msg.destination.x_meters     = destination_x;
+        move_primitive_msg.destination.y_meters     = destination_y;
+        move_primitive_msg.final_angle.radians      = 1.0f;
+        move_primitive_msg.max_speed_m_per_s        = 3.0f;
+        primitive_msg.primitive.move                = move_primitive_msg;
+        return primitive_msg;
+    }
+
+    /**
+     * Creates a primitive message for a stop primitive
+     *
+     * @return a primitive message for a stop primitive
+     */
+    static TbotsProto_Primitive createStopPrimitiveMsg()
+    {
+        TbotsProto_Primitive primitive_msg     = TbotsProto_Primitive_init_zero;
+        primitive_msg.which_primitive          = TbotsProto_Primitive_stop_tag;
+        primitive_msg.primitive.stop.stop_type = TbotsProto_StopPrimitive_StopType_BRAKE;
+        return primitive_msg;
+    }
+
+    /**
+     * Creates a primitive message for a direct control primitive that tracks a
+     * velocity and autokicks
+     *
+     * @return a primitive message for a direct control primitive
+     */
+    static TbotsProto_Primitive createDirectVelocityControlPrimitiveMsg()
+    {
+        TbotsProto_Primitive primitive_msg = TbotsProto_Primitive_init_zero;
+        primitive_msg.which_primitive      = TbotsProto_Primitive_direct_control_tag;
+        TbotsProto_DirectControlPrimitive &direct_control_msg =
+            primitive_msg.primitive.direct_control;
+        direct_control_msg.which_wheel_control =
+            TbotsProto_DirectControlPrimitive_direct_velocity_control_tag;
+        direct_control_msg.wheel_control.direct_velocity_control.velocity
+            .x_component_meters = 1.0f;
+        direct_control_msg.wheel_control.direct_velocity_control.angular_velocity
+            .radians_per_second = 1.0f;
+        direct_control_msg.which_chick_command =
+            TbotsProto_DirectControlPrimitive_autokick_speed_m_per_s_tag;
+        direct_control_msg.chick_command.autokick_speed_m_per_s = 3.0f;
+        return primitive_msg;
+    }
+
+    PrimitiveManager_t *primitive_manager;
+    float current_time;
+    size_t allocations_at_start;
+};
+
+BENCHMARK_F(PrimitiveBenchmark, BM_startMovePrimitive)(benchmark::State &state)
+{
+    // Alternate between destinations so that every start plans a new trajectory
+    TbotsProto_Primitive primitive_msgs[] = {createMovePrimitiveMsg(2.0f, 1.0f),
+                                             createMovePrimitiveMsg(-2.0f, -1.0f)};
+    size_t iteration                      = 0;
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        app_primitive_manager_startNewPrimitive(primitive_manager, firmware_world,
+                                                primitive_msgs[iteration++ % 2]);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_tickMovePrimitive)(benchmark::State &state)
+{
+    app_primitive_manager_startNewPrimitive(primitive_manager, firmware_world,
+                                            createMovePrimitiveMsg(2.0f, 1.0f));
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        advanceTime();
+        app_primitive_manager_runCurrentPrimitive(primitive_manager, firmware_world);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_tickStopPrimitive)(benchmark::State &state)
+{
+    app_primitive_manager_startNewPrimitive(primitive_manager, firmware_world,
+                                            createStopPrimitiveMsg());
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        advanceTime();
+        app_primitive_manager_runCurrentPrimitive(primitive_manager, firmware_world);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_tickDirectControlPrimitive)(benchmark::State &state)
+{
+    app_primitive_manager_startNewPrimitive(primitive_manager, firmware_world,
+                                            createDirectVelocityControlPrimitiveMsg());
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        advanceTime();
+        app_primitive_manager_runCurrentPrimitive(primitive_manager, firmware_world);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_followPosTrajectory)(benchmark::State &state)
+{
+    // A straight line trajectory to (2, 1), like the one the move primitive plans
+    static PositionTrajectory_t position_trajectory;
+    const unsigned int num_elements = 10;
+    for (unsigned int i = 0; i < num_elements; i++)
+    {
+        const float fraction                 = static_cast<float>(i) / (num_elements - 1);
+        position_trajectory.x_position[i]    = 2.0f * fraction;
+        position_trajectory.y_position[i]    = 1.0f * fraction;
+        position_trajectory.orientation[i]   = 1.0f * fraction;
+        position_trajectory.linear_speed[i]  = 1.0f;
+        position_trajectory.angular_speed[i] = 1.0f;
+        position_trajectory.time_profile[i]  = 2.0f * fraction;
+    }
+
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        app_firmware_robot_followPosTrajectory(robot, &position_trajectory, num_elements,
+                                               1, 3.0f);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_physbotPlanMove)(benchmark::State &state)
+{
+    float destination[3]  = {2.0f, 1.0f, 1.0f};
+    float major_vec[2]    = {0.894f, 0.447f};
+    float minor_vec[2]    = {-0.447f, 0.894f};
+    float major_params[3] = {1.0f, 3.0f, 3.0f};
+    float minor_params[3] = {0.0f, 1.5f, 1.5f};
+
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        PhysBot pb = app_physbot_create(0.5f, 0.0f, 0.0f, 0.0f, 0.0f, destination,
+                                        major_vec, minor_vec);
+        app_physbot_planMove(&pb.maj, major_params);
+        app_physbot_planMove(&pb.min, minor_params);
+
+        float accel[3] = {0, 0, 0};
+        app_physbot_computeAccelInLocalCoordinates(accel, pb, 0.0f, major_vec, minor_vec);
+        benchmark::DoNotOptimize(accel);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_controlApplyAccel)(benchmark::State &state)
+{
+    ForceWheel_t *force_wheels[4] = {front_left_wheel, back_left_wheel, back_right_wheel,
+                                     front_right_wheel};
+
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        app_control_applyAccel(robot_constants, &controller_state, 16.0f, force_wheels,
+                               1.0f, 0.5f, 2.0f);
+    }
+    reportAllocations(state);
+}
+
+BENCHMARK_F(PrimitiveBenchmark, BM_wheelControllerFilter)(benchmark::State &state)
+{
+    float command_coefficients[]        = {1, 2, 3, 4, 5};
+    float output_sample_coefficients[]  = {6, 7, 8, 9, 10};
+    WheelController_t *wheel_controller = app_wheel_controller_create(
+        command_coefficients, 5, output_sample_coefficients, 5);
+
+    startCountingAllocations();
+    for (auto _ : state)
+    {
+        app_wheel_controller_pushNewCommand(wheel_controller, 1.0f);
+        app_wheel_controller_pushNewSampleOutput(wheel_controller, 0.9f);
+        benchmark::DoNotOptimize(
+            app_wheel_controller_getWheelVoltageToApply(wheel_controller));
+    }
+    reportAllocations(state);
+
+    app_wheel_controller_destroy(wheel_controller);
+}
@@ -21,6 +21,13 @@
 #include "firmware/app/primitives/primitive.h"
 #include "firmware/app/primitives/stop_primitive.h"
 
+// The primitives a PrimitiveManager can run. A saved PrimitiveManager records the
+// index of its current primitive in this list, where 0 means no primitive is running.
+static const primitive_t *const SAVABLE_PRIMITIVES[] = {
+    NULL, &STOP_PRIMITIVE, &MOVE_PRIMITIVE, &DIRECT_CONTROL_PRIMITIVE};
+#define NUM_SAVABLE_PRIMITIVES                                                           \
+    (sizeof(SAVABLE_PRIMITIVES) / sizeof(SAVABLE_PRIMITIVES[0]))
+
 struct PrimitiveManager
 {
 // The mutex that prevents multiple entries into the same primitive at the same time.
@@ -100,6 +107,38 @@ void app_primitive_manager_destroy(PrimitiveManager_t *manager)
     free(manager);
 }
 
+/**
+ * Makes the given primitive the current primitive, creating a state object for it
+ *
+ * If the given primitive is already the current primitive its state is kept, so that
+ * restarting a primitive (ie. with slightly different parameters every AI tick) does
+ * not reallocate the state, and the primitive can reuse work from its previous run.
+ * The primitive's start function is responsible for re-initializing its state.
+ *
+ * @param manager [in/out] The primitive manager to set the current primitive for
+ * @param primitive [in] The primitive to make the current primitive
+ */
+static void app_primitive_manager_setCurrentPrimitive(PrimitiveManager_t *manager,
+                                                      const primitive_t *primitive)
+{
+    if (manager->current_primitive == primitive && manager->current_primitive_state)
+    {
+        return;
+    }
+
+    if (manager->current_primitive)
+    {
+        if (manager->current_primitive_state)
+        {
+            manager->current_primitive->destroy_state(manager->current_primitive_state);
+            manager->current_primitive_state = NULL;
+        }
+    }
+
+    manager->current_primitive       = primitive;
+    manager->current_primitive_state = primitive->create_state();
+}
+
 void app_primitive_manager_startNewPrimitive(PrimitiveManager_t *manager,
                                              FirmwareWorld_t *world,
                                              TbotsProto_Primitive primitive_msg)
@@ -111,40 +150,28 @@ void app_primitive_manager_startNewPrimitive(PrimitiveManager_t *manager,
 
     app_primitive_manager_lockPrimitiveMutex(manager);
 
-    app_primitive_manager_endCurrentPrimitive(manager, world);
-
-    if (manager->current_primitive)
-    {
-        if (manager->current_primitive_state)
-        {
-            manager->current_primitive->destroy_state(manager->current_primitive_state);
-            manager->current_primitive_state = NULL;
-        }
-    }
+    app_primitive_stopRobot(world, false);
 
     // Figure out which primitive we're running and start it
     switch (primitive_msg.which_primitive)
     {
         case TbotsProto_Primitive_stop_tag:
         {
-            manager->current_primitive       = &STOP_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            app_primitive_manager_setCurrentPrimitive(manager, &STOP_PRIMITIVE);
             app_stop_primitive_start(primitive_msg.primitive.stop,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_move_tag:
         {
-            manager->current_primitive       = &MOVE_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            app_primitive_manager_setCurrentPrimitive(manager, &MOVE_PRIMITIVE);
             app_move_primitive_start(primitive_msg.primitive.move,
                                      manager->current_primitive_state, world);
             break;
         }
         case TbotsProto_Primitive_direct_control_tag:
         {
-            manager->current_primitive       = &DIRECT_CONTROL_PRIMITIVE;
-            manager->current_primitive_state = manager->current_primitive->create_state();
+            app_primitive_manager_setCurrentPrimitive(manager, &DIRECT_CONTROL_PRIMITIVE);
             app_direct_control_primitive_start(primitive_msg.primitive.direct_control,
                                                manager->current_primitive_state, world);
             break;
@@ -152,7 +179,9 @@ void app_primitive_manager_startNewPrimitive(PrimitiveManager_t *manager,
         default:
         {
             // the estop case is handled here
+            app_primitive_manager_endCurrentPrimitive(manager, world);
             app_primitive_makeRobotSafe(world);
+            app_primitive_manager_unlockPrimitiveMutex(manager);
             return;
         }
     }
@@ -193,3 +222,68 @@ void app_primitive_manager_endCurrentPrimitive(PrimitiveManager_t *manager,
 
     app_primitive_stopRobot(world, false);
 }
+
+size_t app_primitive_manager_getSavedStateSize(PrimitiveManager_t *manager)
+{
+    app_primitive_manager_lockPrimitiveMutex(manager);
+
+    size_t size = sizeof(uint8_t);
+    if (manager->current_primitive)
+    {
+        size += manager->current_primitive->get_saved_state_size(
+            manager->current_primitive_state);
+    }
+
+    app_primitive_manager_unlockPrimitiveMutex(manager);
+
+    return size;
+}
+
+void app_primitive_manager_saveState(PrimitiveManager_t *manager, uint8_t *buffer)
+{
+    app_primitive_manager_lockPrimitiveMutex(manager);
+
+    uint8_t primitive_index = 0;
+    for (uint8_t i = 1; i < NUM_SAVABLE_PRIMITIVES; i++)
+    {
+        if (manager->current_primitive == SAVABLE_PRIMITIVES[i])
+        {
+            primitive_index = i;
+        }
+    }
+    assert(primitive_index != 0 || manager->current_primitive == NULL);
+
+    buffer[0] = primitive_index;
+    if (manager->current_primitive)
+    {
+        manager->current_primitive->save_state(manager->current_primitive_state,
+                                               buffer + sizeof(uint8_t));
+    }
+
+    app_primitive_manager_unlockPrimitiveMutex(manager);
+}
+
+void app_primitive_manager_restoreState(PrimitiveManager_t *manager,
+                                        const uint8_t *buffer)
+{
+    app_primitive_manager_lockPrimitiveMutex(manager);
+
+    const uint8_t primitive_index = buffer[0];
+    assert(primitive_index < NUM_SAVABLE_PRIMITIVES);
+
+    const primitive_t *primitive = SAVABLE_PRIMITIVES[primitive_index];
+    if (primitive)
+    {
+        app_primitive_manager_setCurrentPrimitive(manager, primitive);
+        primitive->restore_state(manager->current_primitive_state,
+                                 buffer + sizeof(uint8_t));
+    }
+    else if (manager->current_primitive)
+    {
+        manager->current_primitive->destroy_state(manager->current_primitive_state);
+        manager->current_primitive_state = NULL;
+        manager->current_primitive       = NULL;
+    }
+
+    app_primitive_manager_unlockPrimitiveMutex(manager);
+}
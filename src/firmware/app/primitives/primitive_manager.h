@@ -44,3 +44,36 @@ void app_primitive_manager_runCurrentPrimitive(PrimitiveManager_t *manager,
  */
 void app_primitive_manager_endCurrentPrimitive(PrimitiveManager_t *manager,
                                                FirmwareWorld_t *world);
+
+/**
+ * Returns the number of bytes `app_primitive_manager_saveState` writes for the given
+ * PrimitiveManager
+ *
+ * @param manager [in] The PrimitiveManager to save
+ *
+ * @return the number of bytes needed to save the given PrimitiveManager
+ */
+size_t app_primitive_manager_getSavedStateSize(PrimitiveManager_t *manager);
+
+/**
+ * Saves the primitive the given PrimitiveManager is currently running (if there is one
+ * running) and its state, so that it can be restored later with
+ * `app_primitive_manager_restoreState`
+ *
+ * @param manager [in] The PrimitiveManager to save
+ * @param buffer [out] The buffer to save the PrimitiveManager into, which must be at
+ *                     least `app_primitive_manager_getSavedStateSize` bytes long
+ */
+void app_primitive_manager_saveState(PrimitiveManager_t *manager, uint8_t *buffer);
+
+/**
+ * Makes the given PrimitiveManager run the primitive it was running when it was saved,
+ * with the same state. Unlike starting a new primitive, this does not change the state
+ * of the robot.
+ *
+ * @param manager [in/out] The PrimitiveManager to restore
+ * @param buffer [in] The buffer a PrimitiveManager was saved into by
+ *                    `app_primitive_manager_saveState`
+ */
+void app_primitive_manager_restoreState(PrimitiveManager_t *manager,
+                                        const uint8_t *buffer);
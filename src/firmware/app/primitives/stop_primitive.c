@@ -5,6 +5,7 @@ typedef struct StopPrimitiveState
     TbotsProto_StopPrimitive_StopType stop_type;
 } StopPrimitiveState_t;
 DEFINE_PRIMITIVE_STATE_CREATE_AND_DESTROY_FUNCTIONS(StopPrimitiveState_t)
+DEFINE_PRIMITIVE_STATE_SAVE_AND_RESTORE_FUNCTIONS(StopPrimitiveState_t)
 
 void app_stop_primitive_start(TbotsProto_StopPrimitive prim_msg, void* void_state_ptr,
                               FirmwareWorld_t* world)
@@ -23,7 +24,11 @@ static void app_stop_primitive_tick(void* void_state_ptr, FirmwareWorld_t* world
 /**
  * \brief The stop movement primitive.
  */
-const primitive_t STOP_PRIMITIVE = {.direct        = false,
-                                    .tick          = &app_stop_primitive_tick,
-                                    .create_state  = &createStopPrimitiveState_t,
-                                    .destroy_state = &destroyStopPrimitiveState_t};
+const primitive_t STOP_PRIMITIVE = {
+    .direct               = false,
+    .tick                 = &app_stop_primitive_tick,
+    .create_state         = &createStopPrimitiveState_t,
+    .destroy_state        = &destroyStopPrimitiveState_t,
+    .get_saved_state_size = &getSavedStopPrimitiveState_tSize,
+    .save_state           = &saveStopPrimitiveState_t,
+    .restore_state        = &restoreStopPrimitiveState_t};
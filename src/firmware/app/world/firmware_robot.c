@@ -9,7 +9,7 @@
 #define TIME_HORIZON 0.05f  // s
 
 // Function pointer definition for the robot to follow the provided position trajectory
-typedef void (*TrajectoryFollower_t)(const FirmwareRobot_t*, PositionTrajectory_t,
+typedef void (*TrajectoryFollower_t)(const FirmwareRobot_t*, const PositionTrajectory_t*,
                                      unsigned int, size_t, float);
 // Set the robot's per wheel power given the DirectPerWheelControl message
 typedef void (*ApplyDirectPerWheelPower_t)(
@@ -80,7 +80,7 @@ void plan_move_rotation(PhysBot* pb, float avel)
 }
 
 void force_wheels_followPosTrajectory(const FirmwareRobot_t* robot,
-                                      PositionTrajectory_t pos_trajectory,
+                                      const PositionTrajectory_t* pos_trajectory,
                                       unsigned int num_elements, size_t trajectory_index,
                                       float max_speed_m_per_s)
 {
@@ -97,9 +97,9 @@ void force_wheels_followPosTrajectory(const FirmwareRobot_t* robot,
     const float curr_vy         = app_firmware_robot_getVelocityY(robot);
     const float orientation     = app_firmware_robot_getOrientation(robot);
 
-    const float dest_x           = pos_trajectory.x_position[trajectory_index];
-    const float dest_y           = pos_trajectory.y_position[trajectory_index];
-    const float dest_orientation = pos_trajectory.orientation[trajectory_index];
+    const float dest_x           = pos_trajectory->x_position[trajectory_index];
+    const float dest_y           = pos_trajectory->y_position[trajectory_index];
+    const float dest_orientation = pos_trajectory->orientation[trajectory_index];
     float dest[3]                = {dest_x, dest_y, dest_orientation};
 
     const float curr_x = app_firmware_robot_getPositionX(robot);
@@ -117,7 +117,7 @@ void force_wheels_followPosTrajectory(const FirmwareRobot_t* robot,
     PhysBot pb = app_physbot_create(curr_vx, curr_vy, curr_x, curr_y, orientation, dest,
                                     major_vec, minor_vec);
 
-    const float dest_speed = pos_trajectory.linear_speed[trajectory_index];
+    const float dest_speed = pos_trajectory->linear_speed[trajectory_index];
 
     // plan major axis movement
     const double ROBOT_MAX_ACCELERATION_METERS_PER_SECOND_SQUARED = 3.0;
@@ -151,12 +151,12 @@ void force_wheels_followPosTrajectory(const FirmwareRobot_t* robot,
 }
 
 void velocity_wheels_followPosTrajectory(const FirmwareRobot_t* robot,
-                                         PositionTrajectory_t pos_trajectory,
+                                         const PositionTrajectory_t* pos_trajectory,
                                          unsigned int num_elements,
                                          size_t trajectory_index, float max_speed_m_per_s)
 {
     VelocityTrajectory_t velocity_trajectory;
-    app_trajectory_planner_generateVelocityTrajectory(&pos_trajectory, num_elements,
+    app_trajectory_planner_generateVelocityTrajectory(pos_trajectory, num_elements,
                                                       &velocity_trajectory);
 
     float global_robot_velocity[2];
@@ -566,7 +566,7 @@ void app_firmware_robot_trackVelocityInRobotFrame(const FirmwareRobot_t* robot,
 }
 
 void app_firmware_robot_followPosTrajectory(const FirmwareRobot_t* robot,
-                                            PositionTrajectory_t pos_trajectory,
+                                            const PositionTrajectory_t* pos_trajectory,
                                             unsigned int num_elements,
                                             size_t trajectory_index,
                                             float max_speed_m_per_s)
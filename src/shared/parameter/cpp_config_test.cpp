@@ -2,7 +2,9 @@
 #include <gtest/gtest.h>
 
 #include <boost/filesystem.hpp>
+#include <limits>
 #include <set>
+#include <thread>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "shared/parameter/parameter.h"
@@ -471,3 +473,93 @@ TEST_F(TestParameterMutation, DynamicParametersTest)
     mutate_all_parameters(MutableDynamicParameters);
     assert_mutation(DynamicParameters, config_yaml);
 }
+
+TEST(ConfigSnapshotTest, snapshot_matches_initial_parameter_values)
+{
+    const auto passing_config = std::make_shared<const PassingConfig>();
+
+    std::shared_ptr<const PassingConfig::Snapshot> snapshot =
+        passing_config->getSnapshot();
+    EXPECT_EQ(passing_config->getMinPassSpeedMPerS()->value(),
+              snapshot->min_pass_speed_m_per_s);
+    EXPECT_EQ(passing_config->getMaxPassSpeedMPerS()->value(),
+              snapshot->max_pass_speed_m_per_s);
+    EXPECT_EQ(passing_config->getEnemyReactionTime()->value(),
+              snapshot->enemy_reaction_time);
+}
+
+TEST(ConfigSnapshotTest, snapshot_is_republished_when_parameter_changes)
+{
+    const auto passing_config = std::make_shared<PassingConfig>();
+
+    std::shared_ptr<const PassingConfig::Snapshot> old_snapshot =
+        passing_config->getSnapshot();
+    double old_min_pass_speed = old_snapshot->min_pass_speed_m_per_s;
+
+    passing_config->getMutableMinPassSpeedMPerS()->setValue(old_min_pass_speed + 0.5);
+
+    std::shared_ptr<const PassingConfig::Snapshot> new_snapshot =
+        passing_config->getSnapshot();
+    EXPECT_DOUBLE_EQ(old_min_pass_speed + 0.5, new_snapshot->min_pass_speed_m_per_s);
+
+    // Snapshots that have already been read are never modified
+    EXPECT_DOUBLE_EQ(old_min_pass_speed, old_snapshot->min_pass_speed_m_per_s);
+}
+
+TEST(ConfigSnapshotTest, old_snapshot_is_freed_once_no_longer_read)
+{
+    const auto passing_config = std::make_shared<PassingConfig>();
+
+    std::weak_ptr<const PassingConfig::Snapshot> old_snapshot =
+        passing_config->getSnapshot();
+    passing_config->getMutableMinPassSpeedMPerS()->setValue(
+        old_snapshot.lock()->min_pass_speed_m_per_s + 0.5);
+
+    // The cache of this thread holds on to the old snapshot until the new one is read
+    passing_config->getSnapshot();
+    EXPECT_TRUE(old_snapshot.expired());
+}
+
+TEST(ConfigSnapshotTest, snapshot_is_read_from_other_threads)
+{
+    const auto passing_config = std::make_shared<PassingConfig>();
+    double min_pass_speed     = passing_config->getSnapshot()->min_pass_speed_m_per_s;
+
+    std::thread([&]() {
+        EXPECT_DOUBLE_EQ(min_pass_speed,
+                         passing_config->getSnapshot()->min_pass_speed_m_per_s);
+    }).join();
+
+    passing_config->getMutableMinPassSpeedMPerS()->setValue(min_pass_speed + 0.5);
+
+    std::thread([&]() {
+        EXPECT_DOUBLE_EQ(min_pass_speed + 0.5,
+                         passing_config->getSnapshot()->min_pass_speed_m_per_s);
+    }).join();
+}
+
+TEST(ConfigSnapshotTest, snapshots_of_different_configs_are_not_mixed_up)
+{
+    const auto passing_config       = std::make_shared<PassingConfig>();
+    const auto other_passing_config = std::make_shared<PassingConfig>();
+    double min_pass_speed = passing_config->getSnapshot()->min_pass_speed_m_per_s;
+
+    other_passing_config->getMutableMinPassSpeedMPerS()->setValue(min_pass_speed + 0.5);
+
+    EXPECT_DOUBLE_EQ(min_pass_speed + 0.5,
+                     other_passing_config->getSnapshot()->min_pass_speed_m_per_s);
+    EXPECT_DOUBLE_EQ(min_pass_speed,
+                     passing_config->getSnapshot()->min_pass_speed_m_per_s);
+}
+
+TEST(ConfigSnapshotTest, rejected_value_does_not_change_snapshot)
+{
+    const auto passing_config = std::make_shared<PassingConfig>();
+    double min_pass_speed     = passing_config->getSnapshot()->min_pass_speed_m_per_s;
+
+    passing_config->getMutableMinPassSpeedMPerS()->setValue(
+        std::numeric_limits<double>::max());
+
+    EXPECT_DOUBLE_EQ(min_pass_speed,
+                     passing_config->getSnapshot()->min_pass_speed_m_per_s);
+}
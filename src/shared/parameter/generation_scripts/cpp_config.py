@@ -67,6 +67,16 @@ IMMUTABLE_PARAMETER_LIST_CONFIG_ENTRY = (
 CONFIG_CLASS = """class {config_name} : public Config
 {{
    public:
+    /**
+     * An immutable copy of the values of all the parameters directly in this config.
+     * Reading a Snapshot requires no synchronization, so it should be preferred over
+     * Parameter::value() in code that reads parameters at a high rate.
+     */
+    struct Snapshot
+    {{
+        {snapshot_struct_entries}
+    }};
+
     {config_constructor_header}
     {{
         {constructor_entries}
@@ -76,10 +86,28 @@ CONFIG_CLASS = """class {config_name} : public Config
         immutable_internal_param_list = {{
             {immutable_parameter_list_entries}
         }};
+
+        publishSnapshot();
+        {register_snapshot_callback_entries}
     }}
 
     {public_entries}
 
+    /**
+     * Returns a snapshot of the current values of the parameters in this config. A new
+     * snapshot is published whenever one of the parameters changes; a snapshot that has
+     * been returned is never changed.
+     *
+     * The returned reference is only valid until the next call to getSnapshot() on the
+     * same thread, so copy the shared pointer to keep the snapshot for longer.
+     *
+     * @return a snapshot of the parameters in this config
+     */
+    const std::shared_ptr<const Snapshot>& getSnapshot() const
+    {{
+        return snapshot_publisher.get();
+    }}
+
     const std::string name() const
     {{
         return "{config_name}";
@@ -119,9 +147,19 @@ CONFIG_CLASS = """class {config_name} : public Config
     }}
 
    private:
+    void publishSnapshot()
+    {{
+        snapshot_publisher.publish([this]() {{
+            return Snapshot{{
+                {snapshot_initializer_entries}
+            }};
+        }});
+    }}
+
     MutableParameterList mutable_internal_param_list;
     ParameterList immutable_internal_param_list;
     {private_entries}
+    SnapshotPublisher<Snapshot> snapshot_publisher;
 }};
 """
 
@@ -225,6 +263,9 @@ class CppConfig(object):
             parse_command_line_args_function_contents=self.parse_command_line_args_function_contents,
             command_line_arg_structs=self.command_line_arg_structs,
             load_command_line_args_into_config_contents=self.load_command_line_args_into_config_contents,
+            snapshot_struct_entries=self.snapshot_struct_entries,
+            snapshot_initializer_entries=self.snapshot_initializer_entries,
+            register_snapshot_callback_entries=self.register_snapshot_callback_entries,
         )
 
     @property
@@ -432,3 +473,27 @@ class CppConfig(object):
             + self.included_config_load_command_line_args_into_config_contents,
             2,
         )
+
+    @property
+    def snapshot_struct_entries(self):
+        return CppConfig.join_with_tabs(
+            "\n", [param.snapshot_struct_entry for param in self.parameters], 2
+        )
+
+    @property
+    def snapshot_initializer_entries(self):
+        return CppConfig.join_with_tabs(
+            ",\n", [param.snapshot_initializer_entry for param in self.parameters], 4
+        )
+
+    @property
+    def register_snapshot_callback_entries(self):
+        return CppConfig.join_with_tabs(
+            "\n",
+            [
+                param.register_snapshot_callback_entry
+                for param in self.parameters
+                if not param.is_constant
+            ],
+            2,
+        )
@@ -42,6 +42,12 @@ COMMAND_LINE_ARG_ENTRY = "{param_type} {param_name} = {quote}{value}{quote};"
 
 LOAD_COMMAND_LINE_ARG_INTO_CONFIG = "this->{dependencies}getMutable{param_accessor_name}()->setValue(args.{arg_prefix}{param_name});"
 
+SNAPSHOT_STRUCT_ENTRY = "{type} {param_name};"
+
+SNAPSHOT_INITIALIZER_ENTRY = "{param_variable_name}->value()"
+
+REGISTER_SNAPSHOT_CALLBACK_ENTRY = "{param_variable_name}->registerCallbackFunction([this]({type}) {{ publishSnapshot(); }});"
+
 
 class CppParameter(object):
     def __init__(self, param_type: str, param_metadata: dict):
@@ -243,3 +249,21 @@ class CppParameter(object):
             dependencies="",
             arg_prefix="",
         )
+
+    @property
+    def snapshot_struct_entry(self):
+        return SNAPSHOT_STRUCT_ENTRY.format(
+            type=self.cpp_type, param_name=self.param_name
+        )
+
+    @property
+    def snapshot_initializer_entry(self):
+        return SNAPSHOT_INITIALIZER_ENTRY.format(
+            param_variable_name=self.param_variable_name
+        )
+
+    @property
+    def register_snapshot_callback_entry(self):
+        return REGISTER_SNAPSHOT_CALLBACK_ENTRY.format(
+            param_variable_name=self.param_variable_name, type=self.cpp_type
+        )
@@ -38,6 +38,7 @@ CONFIG_H = (
     '#include "shared/parameter/config.h"\n'
     '#include "shared/parameter/enumerated_parameter.h"\n'
     '#include "shared/parameter/numeric_parameter.h"\n'
+    '#include "shared/parameter/snapshot_publisher.h"\n'
     '#include "software/util/design_patterns/generic_factory.h"\n'
     "\n"
     "{include_headers}\n"
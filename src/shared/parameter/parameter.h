@@ -53,9 +53,13 @@ class Parameter
      */
     virtual bool setValue(const T new_value)
     {
-        std::scoped_lock value_lock(this->value_mutex_);
-        this->value_ = new_value;
+        {
+            std::scoped_lock value_lock(this->value_mutex_);
+            this->value_ = new_value;
+        }
 
+        // The value lock is released before calling the callbacks so that they can
+        // read this parameter (ie. to publish a new config snapshot)
         std::scoped_lock callback_lock(this->callback_mutex_);
         for (auto callback_func : callback_functions)
         {
@@ -226,3 +226,17 @@ TEST(ParameterTest, register_callback_on_const_parameter)
     test_param->setValue(1);
     EXPECT_EQ(test_value, 2);
 }
+
+TEST(ParameterTest, callback_can_read_parameter_value_test)
+{
+    Parameter<int> test_param = Parameter<int>("test_param", 0);
+    int test_value            = 0;
+
+    // Callbacks must be able to read the parameter they are registered on without
+    // deadlocking
+    auto callback = [&test_param, &test_value](int) { test_value = test_param.value(); };
+    test_param.registerCallbackFunction(callback);
+
+    test_param.setValue(7);
+    EXPECT_EQ(7, test_value);
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+/**
+ * Publishes immutable snapshots of some value so that readers never have to take the
+ * lock of every value they read. This is a read-copy-update scheme: writers build a
+ * complete new snapshot and publish it under a new version number, while readers keep
+ * a copy of the latest snapshot they have seen in a thread local cache.
+ *
+ * Reading is a single atomic load of the version number as long as nothing new has
+ * been published. Only the first read on each thread after a publish takes the publish
+ * lock, to copy the new snapshot into the cache of that thread.
+ *
+ * Readers share ownership of the snapshots they copy, so a snapshot stays valid for as
+ * long as someone holds it even if newer snapshots are published afterwards, and is
+ * freed once the publisher and every thread have moved on to a newer snapshot.
+ *
+ * @tparam T The type of snapshot being published
+ */
+template <typename T>
+class SnapshotPublisher
+{
+   public:
+    /**
+     * Creates a new SnapshotPublisher. Nothing can be read from it until the first
+     * snapshot is published.
+     */
+    explicit SnapshotPublisher() : current_snapshot_(nullptr), current_version_(0) {}
+
+    SnapshotPublisher(const SnapshotPublisher&) = delete;
+    SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+    /**
+     * Returns the most recently published snapshot
+     *
+     * The returned reference points into the cache of the calling thread, and is only
+     * valid until the next call to get() on this thread. Copy the shared pointer to
+     * keep the snapshot for longer.
+     *
+     * @pre A snapshot has been published
+     *
+     * @return the most recently published snapshot
+     */
+    const std::shared_ptr<const T>& get() const
+    {
+        static thread_local CachedSnapshot cache;
+
+        std::uint64_t version = current_version_.load(std::memory_order_acquire);
+        if (cache.version != version)
+        {
+            std::scoped_lock publish_lock(publish_mutex_);
+            cache.snapshot = current_snapshot_;
+            cache.version  = current_version_.load(std::memory_order_relaxed);
+        }
+        return cache.snapshot;
+    }
+
+    /**
+     * Builds and publishes a new snapshot. The snapshot is built while holding the
+     * publish lock, so concurrent publishers can never overwrite a newer snapshot
+     * with one built from older values.
+     *
+     * @param create_snapshot A callable that takes no arguments and returns the new
+     * snapshot
+     */
+    template <typename SnapshotCreator>
+    void publish(SnapshotCreator create_snapshot)
+    {
+        std::scoped_lock publish_lock(publish_mutex_);
+        current_snapshot_ = std::make_shared<const T>(create_snapshot());
+        current_version_.store(next_version_.fetch_add(1, std::memory_order_relaxed),
+                               std::memory_order_release);
+    }
+
+   private:
+    // The latest snapshot a thread has read, and the version it was published as
+    struct CachedSnapshot
+    {
+        std::uint64_t version = 0;
+        std::shared_ptr<const T> snapshot;
+    };
+
+    // Versions are unique across all publishers of the same type, so that the cache of
+    // a thread can never mistake a snapshot from another publisher for the current one
+    inline static std::atomic<std::uint64_t> next_version_{1};
+
+    std::shared_ptr<const T> current_snapshot_;
+    std::atomic<std::uint64_t> current_version_;
+    mutable std::mutex publish_mutex_;
+};
@@ -6,10 +6,21 @@
 #include "software/ai/hl/stp/stp.h"
 #include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
 #include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/proto/message_translation/tbots_protobuf.h"
+#include "software/util/profiler/profiler.h"
 
 AI::AI(std::shared_ptr<const AiConfig> ai_config,
        std::shared_ptr<const AiControlConfig> control_config,
        std::shared_ptr<const PlayConfig> play_config)
+    // We use the current time in nanoseconds to initialize STP with a "random" seed
+    : AI(ai_config, control_config, play_config,
+         std::chrono::system_clock::now().time_since_epoch().count())
+{
+}
+
+AI::AI(std::shared_ptr<const AiConfig> ai_config,
+       std::shared_ptr<const AiControlConfig> control_config,
+       std::shared_ptr<const PlayConfig> play_config, long random_seed)
     : navigator(std::make_shared<Navigator>(
           std::make_unique<VelocityObstaclePathManager>(
               std::make_unique<ThetaStarPathPlanner>(),
@@ -17,19 +28,42 @@ AI::AI(std::shared_ptr<const AiConfig> ai_config,
                   ai_config->getRobotNavigationObstacleConfig())),
           RobotNavigationObstacleFactory(ai_config->getRobotNavigationObstacleConfig()),
           ai_config->getNavigatorConfig())),
-      // We use the current time in nanoseconds to initialize STP with a "random" seed
       high_level(std::make_unique<STP>(
           [play_config]() { return std::make_unique<HaltPlay>(play_config); },
-          control_config, play_config,
-          std::chrono::system_clock::now().time_since_epoch().count()))
+          control_config, play_config, random_seed))
 {
 }
 
-std::unique_ptr<TbotsProto::PrimitiveSet> AI::getPrimitives(const World &world) const
+std::unique_ptr<TbotsProto::PrimitiveSet> AI::getPrimitives(const World& world) const
 {
+    PROFILE_SCOPE("AI::getPrimitives");
+
+    double ai_start_time_seconds = createCurrentTimestamp()->epoch_timestamp_seconds();
+
     std::vector<std::unique_ptr<Intent>> assigned_intents = high_level->getIntents(world);
+    double stp_time_seconds = createCurrentTimestamp()->epoch_timestamp_seconds();
+
+    std::unique_ptr<TbotsProto::PrimitiveSet> primitive_set =
+        navigator->getAssignedPrimitives(world, assigned_intents);
+    double navigator_time_seconds = createCurrentTimestamp()->epoch_timestamp_seconds();
+
+    // Only the primitives created from a traced World are traced
+    const WorldLatencyTrace& world_latency_trace = world.getLatencyTrace();
+    if (world_latency_trace.backend_received_time_seconds != 0)
+    {
+        TbotsProto::LatencyTrace* latency_trace = primitive_set->mutable_latency_trace();
+        latency_trace->set_camera_capture_time_seconds(
+            world_latency_trace.camera_capture_time_seconds);
+        latency_trace->set_backend_received_time_seconds(
+            world_latency_trace.backend_received_time_seconds);
+        latency_trace->set_sensor_fusion_time_seconds(
+            world_latency_trace.sensor_fusion_time_seconds);
+        latency_trace->set_ai_start_time_seconds(ai_start_time_seconds);
+        latency_trace->set_stp_time_seconds(stp_time_seconds);
+        latency_trace->set_navigator_time_seconds(navigator_time_seconds);
+    }
 
-    return navigator->getAssignedPrimitives(world, assigned_intents);
+    return primitive_set;
 }
 
 PlayInfo AI::getPlayInfo() const
@@ -24,6 +24,21 @@ class AI final
                 std::shared_ptr<const AiControlConfig> control_config,
                 std::shared_ptr<const PlayConfig> play_config);
 
+    /**
+     * Create an AI with given configurations, whose random decisions are made with
+     * the given seed. AIs created with the same seed make the same decisions given the
+     * same Worlds.
+     *
+     * @param ai_config The AI configuration
+     * @param control_config The AI Control configuration
+     * @param play_config The Play configuration
+     * @param random_seed The seed of the random number generator used to make random
+     * decisions
+     */
+    explicit AI(std::shared_ptr<const AiConfig> ai_config,
+                std::shared_ptr<const AiControlConfig> control_config,
+                std::shared_ptr<const PlayConfig> play_config, long random_seed);
+
     /**
      * Calculates the Primitives that should be run by our Robots given the current
      * state of the world.
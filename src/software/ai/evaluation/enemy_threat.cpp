@@ -7,6 +7,7 @@
 #include "software/ai/evaluation/intercept.h"
 #include "software/ai/evaluation/possession.h"
 #include "software/geom/algorithms/intersects.h"
+#include "software/util/profiler/profiler.h"
 #include "software/world/team.h"
 
 std::map<Robot, std::vector<Robot>, Robot::cmpRobotByID> findAllReceiverPasserPairs(
@@ -84,18 +85,19 @@ std::optional<std::pair<int, std::optional<Robot>>> getNumPassesToRobot(
     // are on the "frontier" of the graph search
     std::vector<Robot> current_passers{initial_passer};
     // The remaining robots we haven't checked yet
-    std::vector<Robot> unvisited_robots = passing_team.getAllRobots();
+    const TeamRobots &passing_robots = passing_team.getAllRobots();
+    std::vector<Robot> unvisited_robots(passing_robots.begin(), passing_robots.end());
     // Remove the initial passer since we already start off visiting it, and don't need
     // to again
     unvisited_robots.erase(
         std::remove(unvisited_robots.begin(), unvisited_robots.end(), initial_passer),
         unvisited_robots.end());
-    std::vector<Robot> all_robots   = passing_team.getAllRobots();
-    std::vector<Robot> other_robots = other_team.getAllRobots();
+    std::vector<Robot> all_robots(passing_robots.begin(), passing_robots.end());
     // TODO: possibly re-enable using friendly robots as obstacles if we can find a way to
     // stop defenders from oscillating between positions See
     // https://github.com/UBC-Thunderbots/Software/issues/642
-    // all_robots.insert(all_robots.end(), other_robots.begin(), other_robots.end());
+    // all_robots.insert(all_robots.end(), other_team.getAllRobots().begin(),
+    //                   other_team.getAllRobots().end());
 
     // On each iteration, check what robots can be passed to. These receivers will
     // become the passers on the next iteration. This is like expanding the frontier
@@ -222,6 +224,8 @@ std::vector<EnemyThreat> getAllEnemyThreats(const Field &field, const Team &frie
                                             Team enemy_team, const Ball &ball,
                                             bool include_goalie)
 {
+    PROFILE_SCOPE("getAllEnemyThreats");
+
     if (!include_goalie && enemy_team.getGoalieId())
     {
         enemy_team.removeRobotWithId(*enemy_team.getGoalieId());
@@ -1,9 +1,19 @@
 #include "software/ai/evaluation/find_open_areas.h"
 
+#include <unordered_set>
+
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/geom/algorithms/find_open_circles.h"
 
-std::vector<Circle> findGoodChipTargets(const World& world)
+/**
+ * Gets the area to look for chip targets in
+ *
+ * @param world The world. We assume the ball is being chipped from its current
+ * position
+ *
+ * @return a rectangle from the ball to the enemy's end of the field
+ */
+static Rectangle getChipTargetArea(const World& world)
 {
     double inset     = 0.3;  // Determined experimentally to be a reasonable value
     double ballX     = world.ball().position().x();
@@ -13,14 +23,58 @@ std::vector<Circle> findGoodChipTargets(const World& world)
 
     // A rectangle from the ball to the enemy's end of the field, inset by a small amount
     // to give us enough space to catch the ball before it goes out of bounds
-    Rectangle target_area_rectangle =
-        Rectangle(Point(ballX, negFieldY), Point(fieldX, posFieldY));
+    return Rectangle(Point(ballX, negFieldY), Point(fieldX, posFieldY));
+}
 
+EnemyOpenAreas::EnemyOpenAreas(const Field& field)
+    : field(field), enemy_triangulation(field.fieldBoundary())
+{
+}
+
+void EnemyOpenAreas::update(const Team& enemy_team)
+{
+    std::unordered_set<unsigned int> enemy_robot_ids;
+    for (const Robot& robot : enemy_team.getAllRobots())
+    {
+        enemy_triangulation.updatePoint(robot.id(), robot.position());
+        enemy_robot_ids.insert(robot.id());
+    }
+
+    for (unsigned int point_id : enemy_triangulation.getPointIds())
+    {
+        if (enemy_robot_ids.find(point_id) == enemy_robot_ids.end())
+        {
+            enemy_triangulation.removePoint(point_id);
+        }
+    }
+}
+
+const Field& EnemyOpenAreas::getField() const
+{
+    return field;
+}
+
+std::vector<Circle> EnemyOpenAreas::findLargestOpenAreas(const Rectangle& region,
+                                                         unsigned int max_num_areas) const
+{
+    return enemy_triangulation.findLargestOpenCircles(region, max_num_areas);
+}
+
+std::vector<Circle> findGoodChipTargets(const World& world)
+{
     std::vector<Point> enemy_locations;
     for (Robot robot : world.enemyTeam().getAllRobots())
     {
         enemy_locations.emplace_back(robot.position());
     }
 
-    return findOpenCircles(target_area_rectangle, enemy_locations);
+    return findOpenCircles(getChipTargetArea(world), enemy_locations);
+}
+
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const EnemyOpenAreas& enemy_open_areas,
+                                        unsigned int max_num_targets)
+{
+    return enemy_open_areas.findLargestOpenAreas(getChipTargetArea(world),
+                                                 max_num_targets);
 }
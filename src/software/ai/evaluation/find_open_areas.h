@@ -1,8 +1,59 @@
 #pragma once
 
+#include "software/geom/algorithms/delaunay_triangulation.h"
 #include "software/geom/circle.h"
 #include "software/world/world.h"
 
+/**
+ * Keeps track of the open areas between the enemy robots as they move, so that the
+ * open areas do not need to be recalculated from scratch every time they are needed.
+ *
+ * STP keeps one of these across ticks and updates it with the latest enemy team at the
+ * start of each tick, and Plays get it with Play::getEnemyOpenAreas.
+ */
+class EnemyOpenAreas
+{
+   public:
+    /**
+     * Creates an empty set of open areas for the given field
+     *
+     * @param field The field the enemy robots are on
+     */
+    explicit EnemyOpenAreas(const Field& field);
+
+    /**
+     * Updates the open areas with the positions of the enemy robots. Robots that are not
+     * in the given team are removed.
+     *
+     * @param enemy_team The enemy team
+     */
+    void update(const Team& enemy_team);
+
+    /**
+     * Gets the field the enemy robots are on
+     *
+     * @return the field the enemy robots are on
+     */
+    const Field& getField() const;
+
+    /**
+     * Finds the largest open areas in the given region, between all the enemy robots
+     * including those outside the region
+     *
+     * @param region The region to find open areas in
+     * @param max_num_areas The maximum number of open areas to find
+     *
+     * @return circles whose centres are in the region and whose radii are the distance
+     * to the nearest enemy, sorted in descending order of radius
+     */
+    std::vector<Circle> findLargestOpenAreas(const Rectangle& region,
+                                             unsigned int max_num_areas) const;
+
+   private:
+    Field field;
+    DelaunayTriangulation enemy_triangulation;
+};
+
 /**
  * Finds good points to chip the ball to
  *
@@ -13,3 +64,21 @@
  *         radius is the distance to the nearest enemy
  */
 std::vector<Circle> findGoodChipTargets(const World& world);
+
+/**
+ * Finds the best points to chip the ball to, using open areas that are kept up to date
+ * across ticks
+ *
+ * @param world The world. We assume the ball is being chipped from its current
+ * position
+ * @param enemy_open_areas The open areas between the enemy robots, already updated
+ * with the enemy team in the world
+ * @param max_num_targets The maximum number of chip targets to find
+ *
+ * @return a vector of circles where the center is a good point to chip to, and the
+ *         radius is the distance to the nearest enemy, sorted in descending order of
+ *         radius
+ */
+std::vector<Circle> findGoodChipTargets(const World& world,
+                                        const EnemyOpenAreas& enemy_open_areas,
+                                        unsigned int max_num_targets);
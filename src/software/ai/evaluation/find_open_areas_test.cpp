@@ -0,0 +1,53 @@
+#include "software/ai/evaluation/find_open_areas.h"
+
+#include <gtest/gtest.h>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/test_util/test_util.h"
+
+TEST(FindOpenAreasTest, test_chip_targets_are_away_from_enemies)
+{
+    World world = ::TestUtil::createBlankTestingWorld();
+    world.updateBall(Ball(BallState(Point(0, 0), Vector()), Timestamp::fromSeconds(0)));
+    world.updateEnemyTeamState(::TestUtil::setRobotPositionsHelper(
+        world.enemyTeam(), {Point(1, 1), Point(1, -1), Point(3, 0), Point(-2, 0)},
+        Timestamp::fromSeconds(0)));
+
+    EnemyOpenAreas enemy_open_areas(world.field());
+    enemy_open_areas.update(world.enemyTeam());
+    std::vector<Circle> chip_targets = findGoodChipTargets(world, enemy_open_areas, 3);
+
+    ASSERT_EQ(3, chip_targets.size());
+    for (const Circle& chip_target : chip_targets)
+    {
+        EXPECT_GE(chip_target.origin().x(), world.ball().position().x());
+        EXPECT_TRUE(contains(world.field().fieldLines(), chip_target.origin()));
+        for (const Robot& enemy : world.enemyTeam().getAllRobots())
+        {
+            EXPECT_LE(chip_target.radius(),
+                      distance(chip_target.origin(), enemy.position()) + 1e-9);
+        }
+    }
+}
+
+TEST(FindOpenAreasTest, test_open_areas_follow_enemy_team)
+{
+    EnemyOpenAreas enemy_open_areas(Field::createSSLDivisionBField());
+    Rectangle region(Point(-1, -1), Point(1, 1));
+
+    enemy_open_areas.update(::TestUtil::setRobotPositionsHelper(
+        Team(Duration::fromSeconds(1)), {Point(-1, -1), Point(1, 1), Point(0, 0)},
+        Timestamp::fromSeconds(0)));
+    std::vector<Circle> open_areas = enemy_open_areas.findLargestOpenAreas(region, 1);
+    ASSERT_EQ(1, open_areas.size());
+    EXPECT_NEAR(std::sqrt(2), open_areas[0].radius(), 1e-6);
+
+    // With the robot in the middle gone, the middle of the region is open
+    enemy_open_areas.update(::TestUtil::setRobotPositionsHelper(
+        Team(Duration::fromSeconds(1)), {Point(-1, -1), Point(1, 1)},
+        Timestamp::fromSeconds(1)));
+    open_areas = enemy_open_areas.findLargestOpenAreas(region, 1);
+    ASSERT_EQ(1, open_areas.size());
+    EXPECT_NEAR(2, open_areas[0].radius(), 1e-6);
+}
@@ -78,7 +78,8 @@ class Action
     virtual ~Action() = default;
 
    protected:
-    // The coroutine that sequentially returns the Intents the Action wants to run
+    // The coroutine that sequentially returns the Intents the Action wants to run. Its
+    // stack comes from the pool shared by the AI.
     IntentCoroutine::pull_type intent_sequence;
     // The robot performing this Action
     std::optional<Robot> robot;
@@ -1,10 +1,15 @@
 #include "software/ai/hl/stp/play/play.h"
 
+#include "software/util/coroutine_stack_pool/coroutine_stack_pool.h"
+#include "software/util/profiler/profiler.h"
+
 Play::Play(std::shared_ptr<const PlayConfig> play_config, bool requires_goalie)
     : play_config(play_config),
       requires_goalie(requires_goalie),
-      tactic_sequence(boost::bind(&Play::getNextTacticsWrapper, this, _1)),
-      world(std::nullopt)
+      tactic_sequence(CoroutineStackAllocator(),
+                      boost::bind(&Play::getNextTacticsWrapper, this, _1)),
+      world(std::nullopt),
+      enemy_open_areas(nullptr)
 {
 }
 
@@ -17,6 +22,9 @@ bool Play::done() const
 
 PriorityTacticVector Play::getTactics(const World &world)
 {
+    // This includes the time spent in the Play's coroutine
+    PROFILE_SCOPE("Play::getTactics");
+
     // Update the member variable that stores the world. This will be used by the
     // getNextTacticsWrapper function (inside the coroutine) to pass the World data to
     // the getNextTactics function. This is easier than directly passing the World data
@@ -47,8 +55,10 @@ PriorityTacticVector Play::getTactics(const World &world)
 
 std::vector<std::unique_ptr<Intent>> Play::get(
     RobotToTacticAssignmentFunction robot_to_tactic_assignment_algorithm,
-    MotionConstraintBuildFunction motion_constraint_builder, const World &new_world)
+    MotionConstraintBuildFunction motion_constraint_builder, const World &new_world,
+    std::shared_ptr<const EnemyOpenAreas> enemy_open_areas)
 {
+    this->enemy_open_areas = std::move(enemy_open_areas);
     std::vector<std::unique_ptr<Intent>> intents;
     PriorityTacticVector priority_tactics = getTactics(new_world);
     ConstPriorityTacticVector const_priority_tactics;
@@ -80,6 +90,11 @@ std::vector<std::unique_ptr<Intent>> Play::get(
     return intents;
 }
 
+const EnemyOpenAreas &Play::getEnemyOpenAreas() const
+{
+    return *enemy_open_areas;
+}
+
 void Play::getNextTacticsWrapper(TacticCoroutine::push_type &yield)
 {
     // Yield an empty vector the very first time the function is called. This value will
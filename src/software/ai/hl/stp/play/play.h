@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/ai/evaluation/find_open_areas.h"
 #include "software/ai/hl/stp/tactic/tactic.h"
 
 using TacticVector              = std::vector<std::shared_ptr<Tactic>>;
@@ -95,16 +96,27 @@ class Play
      * tactics
      * @param motion_constraint_builder Builds motion constraints from tactics
      * @param world The updated world
+     * @param enemy_open_areas The open areas between the enemy robots, updated with the
+     * enemy team in the updated world
      *
      * @return the vector of intents to execute
      */
     std::vector<std::unique_ptr<Intent>> get(
         RobotToTacticAssignmentFunction robot_to_tactic_assignment_algorithm,
-        MotionConstraintBuildFunction motion_constraint_builder, const World& new_world);
+        MotionConstraintBuildFunction motion_constraint_builder, const World& new_world,
+        std::shared_ptr<const EnemyOpenAreas> enemy_open_areas);
 
     virtual ~Play() = default;
 
    protected:
+    /**
+     * Gets the open areas between the enemy robots on this tick, which are shared with
+     * everything else in the AI that needs them
+     *
+     * @return the open areas between the enemy robots
+     */
+    const EnemyOpenAreas& getEnemyOpenAreas() const;
+
     // The Play configuration
     std::shared_ptr<const PlayConfig> play_config;
 
@@ -161,9 +173,14 @@ class Play
     // Whether this plays requires a goalie
     const bool requires_goalie;
 
-    // The coroutine that sequentially returns the Tactics the Play wants to run
+    // The coroutine that sequentially returns the Tactics the Play wants to run. Its
+    // stack comes from the pool shared by the AI, so transitioning between Plays
+    // doesn't allocate a new stack.
     TacticCoroutine::pull_type tactic_sequence;
 
     // The Play's knowledge of the most up-to-date World
     std::optional<World> world;
+
+    // The open areas between the enemy robots in the most up-to-date World
+    std::shared_ptr<const EnemyOpenAreas> enemy_open_areas;
 };
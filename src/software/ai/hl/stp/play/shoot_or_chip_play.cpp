@@ -86,7 +86,9 @@ void ShootOrChipPlay::getNextTactics(TacticCoroutine::push_type &yield,
         {
             enemy_robot_points.emplace_back(robot.position());
         }
-        std::vector<Circle> chip_targets = findGoodChipTargets(world);
+        std::vector<Circle> chip_targets = findGoodChipTargets(
+            world, getEnemyOpenAreas(),
+            static_cast<unsigned int>(move_to_open_area_tactics.size()));
         for (unsigned i = 0;
              i < chip_targets.size() && i < move_to_open_area_tactics.size(); i++)
         {
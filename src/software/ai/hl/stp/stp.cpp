@@ -17,6 +17,7 @@
 #include "software/ai/motion_constraint/motion_constraint_set_builder.h"
 #include "software/logger/logger.h"
 #include "software/util/design_patterns/generic_factory.h"
+#include "software/util/profiler/profiler.h"
 #include "software/util/typename/typename.h"
 
 STP::STP(std::function<std::unique_ptr<Play>()> default_play_constructor,
@@ -45,9 +46,19 @@ STP::STP(std::function<std::unique_ptr<Play>()> default_play_constructor,
 void STP::updateSTPState(const World& world)
 {
     updateGameState(world);
+    updateEnemyOpenAreas(world);
     updateAIPlay(world);
 }
 
+void STP::updateEnemyOpenAreas(const World& world)
+{
+    if (!enemy_open_areas || enemy_open_areas->getField() != world.field())
+    {
+        enemy_open_areas = std::make_shared<EnemyOpenAreas>(world.field());
+    }
+    enemy_open_areas->update(world.enemyTeam());
+}
+
 void STP::updateGameState(const World& world)
 {
     current_game_state = world.gameState();
@@ -88,11 +99,13 @@ std::vector<std::unique_ptr<Intent>> STP::getIntentsFromCurrentPlay(const World&
         [this](const Tactic& tactic) {
             return buildMotionConstraintSet(current_game_state, tactic);
         },
-        world);
+        world, enemy_open_areas);
 }
 
 std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
 {
+    PROFILE_SCOPE("STP::getIntents");
+
     updateSTPState(world);
     auto intents = getIntentsFromCurrentPlay(world);
 
@@ -115,6 +128,8 @@ std::vector<std::unique_ptr<Intent>> STP::getIntents(const World& world)
 
 std::unique_ptr<Play> STP::calculateNewPlay(const World& world)
 {
+    PROFILE_SCOPE("STP::calculateNewPlay");
+
     std::vector<std::unique_ptr<Play>> applicable_plays;
     for (const auto& play_constructor :
          GenericFactory<std::string, Play, PlayConfig>::getRegisteredConstructors())
@@ -209,10 +224,13 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
     ConstPriorityTacticVector tactics, const World& world,
     bool automatically_assign_goalie)
 {
+    PROFILE_SCOPE("STP::assignRobotsToTactics");
+
     robot_tactic_assignment.clear();
 
     std::optional<Robot> goalie_robot = world.friendlyTeam().goalie();
-    std::vector<Robot> robots         = world.friendlyTeam().getAllRobots();
+    const TeamRobots& friendly_robots = world.friendlyTeam().getAllRobots();
+    std::vector<Robot> robots(friendly_robots.begin(), friendly_robots.end());
 
     if (goalie_robot && automatically_assign_goalie)
     {
@@ -275,17 +293,12 @@ std::map<std::shared_ptr<const Tactic>, Robot> STP::assignRobotsToTactics(
                 std::shared_ptr<const Tactic>& tactic = tactic_vector.at(col);
                 double robot_cost_for_tactic = tactic->calculateRobotCost(robot, world);
 
-                std::set<RobotCapability> required_capabilities =
-                    tactic->robotCapabilityRequirements();
-                std::set<RobotCapability> robot_capabilities =
-                    robot.getAvailableCapabilities();
-                std::set<RobotCapability> missing_capabilities;
-                std::set_difference(
-                    required_capabilities.begin(), required_capabilities.end(),
-                    robot_capabilities.begin(), robot_capabilities.end(),
-                    std::inserter(missing_capabilities, missing_capabilities.begin()));
-
-                if (missing_capabilities.size() > 0)
+                RobotCapabilityMask required_capabilities(
+                    tactic->robotCapabilityRequirements());
+                RobotCapabilityMask missing_capabilities =
+                    required_capabilities & robot.getUnavailableCapabilityMask();
+
+                if (!missing_capabilities.empty())
                 {
                     matrix(row, col) = robot_cost_for_tactic + 10.0f;
                 }
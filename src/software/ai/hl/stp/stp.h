@@ -180,6 +180,14 @@ class STP : public HL
      */
     void updateGameState(const World &world);
 
+    /**
+     * Updates the open areas between the enemy robots with the enemy team in the world.
+     * The open areas are kept across ticks, and only recreated if the field changes.
+     *
+     * @param world
+     */
+    void updateEnemyOpenAreas(const World &world);
+
     /**
      * Updates the current AI play based on the state of the world
      *
@@ -206,6 +214,9 @@ class STP : public HL
     std::function<std::unique_ptr<Play>()> default_play_constructor;
     // The Play that is currently running
     std::unique_ptr<Play> current_play;
+    // The open areas between the enemy robots, updated once per tick and shared by
+    // everything that needs them on that tick
+    std::shared_ptr<EnemyOpenAreas> enemy_open_areas;
     std::map<std::shared_ptr<const Tactic>, Robot> robot_tactic_assignment;
     // The random number generator
     std::mt19937 random_number_generator;
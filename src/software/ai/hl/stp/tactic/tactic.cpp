@@ -2,10 +2,12 @@
 
 #include "software/ai/intent/stop_intent.h"
 #include "software/logger/logger.h"
+#include "software/util/coroutine_stack_pool/coroutine_stack_pool.h"
 #include "software/util/typename/typename.h"
 
 Tactic::Tactic(bool loop_forever, const std::set<RobotCapability> &capability_reqs_)
-    : action_sequence(boost::bind(&Tactic::calculateNextActionWrapper, this, _1)),
+    : action_sequence(CoroutineStackAllocator(),
+                      boost::bind(&Tactic::calculateNextActionWrapper, this, _1)),
       done_(false),
       intent(),
       loop_forever(loop_forever),
@@ -52,6 +54,7 @@ std::shared_ptr<Action> Tactic::getNextAction(void)
         {
             // Re-start the action sequence by re-creating it
             action_sequence = ActionCoroutine::pull_type(
+                CoroutineStackAllocator(),
                 boost::bind(&Tactic::calculateNextActionWrapper, this, _1));
             next_action = getNextActionHelper();
         }
@@ -198,7 +198,9 @@ class Tactic
     std::shared_ptr<Action> getNextActionHelper();
 
     // TODO (#1888): remove this field
-    // The coroutine that sequentially returns the Actions the Tactic wants to run
+    // The coroutine that sequentially returns the Actions the Tactic wants to run. Its
+    // stack comes from the pool shared by the AI, so constructing a Tactic doesn't
+    // allocate a new stack.
     ActionCoroutine::pull_type action_sequence;
 
     // TODO (#1888): remove this field
@@ -5,6 +5,7 @@
 #include "software/logger/logger.h"
 #include "software/proto/message_translation/tbots_protobuf.h"
 #include "software/proto/primitive/primitive_msg_factory.h"
+#include "software/util/profiler/profiler.h"
 
 Navigator::Navigator(std::unique_ptr<PathManager> path_manager,
                      RobotNavigationObstacleFactory robot_navigation_obstacle_factory,
@@ -30,6 +31,8 @@ void Navigator::visit(const MoveIntent &intent)
 std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     const World &world, const std::vector<std::unique_ptr<Intent>> &intents)
 {
+    PROFILE_SCOPE("Navigator::getAssignedPrimitives");
+
     // Initialize variables
     navigating_intents.clear();
     planned_paths.clear();
@@ -46,11 +49,16 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
     // Plan paths
     Rectangle navigable_area = world.field().fieldBoundary();
     auto path_objectives     = createPathObjectives(world);
-    auto robot_id_to_path =
-        path_manager->getManagedPaths(path_objectives, navigable_area);
+    std::map<RobotId, std::optional<Path>> robot_id_to_path;
+    {
+        PROFILE_SCOPE("PathManager::getManagedPaths");
+        robot_id_to_path = path_manager->getManagedPaths(path_objectives, navigable_area);
+    }
 
     // Add primitives from navigating intents
     auto &robot_primitives_map = *primitive_set_msg->mutable_robot_primitives();
+    const auto enemy_robot_obstacles =
+        robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam());
     for (const auto &intent : navigating_intents)
     {
         unsigned int robot_id      = intent->getRobotId();
@@ -61,8 +69,7 @@ std::unique_ptr<TbotsProto::PrimitiveSet> Navigator::getAssignedPrimitives(
             planned_paths.push_back(robot_id_to_path_iter->second->getKnots());
             robot_primitives_map[robot_id] =
                 NavigatingPrimitiveCreator(config).createNavigatingPrimitive(
-                    *intent, *(robot_id_to_path_iter->second),
-                    robot_navigation_obstacle_factory.createFromTeam(world.enemyTeam()));
+                    *intent, *(robot_id_to_path_iter->second), enemy_robot_obstacles);
         }
         else
         {
@@ -138,7 +145,7 @@ std::unordered_set<PathObjective> Navigator::createPathObjectives(
     return path_objectives;
 }
 
-std::vector<std::vector<Point>> Navigator::getPlannedPathPoints()
+const std::vector<std::vector<Point>> &Navigator::getPlannedPathPoints() const
 {
     return planned_paths;
 }
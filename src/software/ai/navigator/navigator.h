@@ -46,7 +46,7 @@ class Navigator : public IntentVisitor
      *
      * @return planned paths
      */
-    std::vector<std::vector<Point>> getPlannedPathPoints();
+    const std::vector<std::vector<Point>> &getPlannedPathPoints() const;
 
     /**
      * Get the obstacles for navigation
@@ -0,0 +1,154 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "software/ai/intent/all_intents.h"
+#include "software/ai/navigator/navigator.h"
+#include "software/ai/navigator/path_manager/velocity_obstacle_path_manager.h"
+#include "software/ai/navigator/path_planner/theta_star_path_planner.h"
+#include "software/test_util/test_util.h"
+
+// The global operator new is replaced so that we can report how many heap allocations
+// the navigator makes per tick
+static std::atomic<size_t> num_allocations(0);
+
+void *operator new(size_t size)
+{
+    num_allocations++;
+    if (void *ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// The number of robots on each team in a division A game
+static constexpr unsigned int NUM_ROBOTS = 11;
+
+/**
+ * Creates a world with a full team of friendly and enemy robots spread over the field
+ *
+ * @param offset How far to move the enemy robots and the ball from their usual
+ * positions
+ *
+ * @return a world with a full team of friendly and enemy robots
+ */
+static World createWorld(const Vector &offset)
+{
+    std::vector<Point> friendly_robot_positions;
+    std::vector<Point> enemy_robot_positions;
+    for (unsigned int i = 0; i < NUM_ROBOTS; i++)
+    {
+        const double y = -2.5 + 5.0 * i / (NUM_ROBOTS - 1);
+        friendly_robot_positions.emplace_back(-3.0 + 0.2 * i, y);
+        enemy_robot_positions.push_back(Point(1.0 + 0.2 * i, -y) + offset);
+    }
+
+    World world = ::TestUtil::createBlankTestingWorld();
+    world       = ::TestUtil::setFriendlyRobotPositions(world, friendly_robot_positions,
+                                                  Timestamp::fromSeconds(0));
+    world       = ::TestUtil::setEnemyRobotPositions(world, enemy_robot_positions,
+                                               Timestamp::fromSeconds(0));
+    world =
+        ::TestUtil::setBallPosition(world, Point() + offset, Timestamp::fromSeconds(0));
+    return world;
+}
+
+/**
+ * Creates a MoveIntent for every friendly robot to the opposite side of the field,
+ * with the motion constraints most plays use
+ *
+ * @return a MoveIntent for every friendly robot
+ */
+static std::vector<std::unique_ptr<Intent>> createIntents()
+{
+    std::vector<std::unique_ptr<Intent>> intents;
+    for (unsigned int i = 0; i < NUM_ROBOTS; i++)
+    {
+        auto intent = std::make_unique<MoveIntent>(
+            i, Point(2.5, 2.5 - 5.0 * i / (NUM_ROBOTS - 1)), Angle::zero(), 0,
+            DribblerMode::OFF, BallCollisionType::AVOID,
+            AutoChipOrKick{AutoChipOrKickMode::OFF, 0},
+            MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+        intent->setMotionConstraints({MotionConstraint::ENEMY_ROBOTS_COLLISION,
+                                      MotionConstraint::FRIENDLY_DEFENSE_AREA,
+                                      MotionConstraint::ENEMY_DEFENSE_AREA});
+        intents.emplace_back(std::move(intent));
+    }
+    return intents;
+}
+
+/**
+ * Creates a navigator that plans paths the same way as the AI
+ *
+ * @return a navigator
+ */
+static Navigator createNavigator()
+{
+    RobotNavigationObstacleFactory robot_navigation_obstacle_factory(
+        std::make_shared<const RobotNavigationObstacleConfig>());
+    return Navigator(
+        std::make_unique<VelocityObstaclePathManager>(
+            std::make_unique<ThetaStarPathPlanner>(), robot_navigation_obstacle_factory),
+        robot_navigation_obstacle_factory, std::make_shared<const NavigatorConfig>());
+}
+
+/**
+ * Reports the average number of allocations made per iteration of the benchmark
+ *
+ * @param state The state of the benchmark
+ * @param allocations_at_start The number of allocations made before the benchmark
+ * started
+ */
+static void reportAllocations(benchmark::State &state, size_t allocations_at_start)
+{
+    state.counters["allocs_per_iteration"] =
+        benchmark::Counter(static_cast<double>(num_allocations - allocations_at_start),
+                           benchmark::Counter::kAvgIterations);
+}
+
+static void BM_getAssignedPrimitivesStaticWorld(benchmark::State &state)
+{
+    Navigator navigator = createNavigator();
+    const World world   = createWorld(Vector());
+    const auto intents  = createIntents();
+
+    const size_t allocations_at_start = num_allocations;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(navigator.getAssignedPrimitives(world, intents));
+    }
+    reportAllocations(state, allocations_at_start);
+}
+BENCHMARK(BM_getAssignedPrimitivesStaticWorld);
+
+static void BM_getAssignedPrimitivesMovingEnemies(benchmark::State &state)
+{
+    // Alternate between worlds so that the obstacles around the enemy robots have to be
+    // recreated every tick, as they do in a real game
+    Navigator navigator  = createNavigator();
+    const World worlds[] = {createWorld(Vector()), createWorld(Vector(0.1, 0.05))};
+    const auto intents   = createIntents();
+    size_t iteration     = 0;
+
+    const size_t allocations_at_start = num_allocations;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            navigator.getAssignedPrimitives(worlds[iteration++ % 2], intents));
+    }
+    reportAllocations(state, allocations_at_start);
+}
+BENCHMARK(BM_getAssignedPrimitivesMovingEnemies);
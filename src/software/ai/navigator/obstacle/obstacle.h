@@ -49,6 +49,14 @@ class Obstacle
      */
     virtual std::string toString(void) const = 0;
 
+    /**
+     * Hashes the shape of the obstacle. Unlike toString, this does not allocate, so it
+     * can be used to tell whether an obstacle has changed on every tick.
+     *
+     * @return a hash of the shape of the obstacle
+     */
+    virtual std::size_t hash(void) const = 0;
+
     /**
      * Accepts an Obstacle Visitor and calls the visit function
      *
@@ -66,14 +74,16 @@ class GeomObstacle : public Obstacle
     /**
      * Construct a GeomObstacle with GEOM_TYPE
      *
-     * @param geom GEOM_TYPE to make obstacle with
+     * @param geom GEOM_TYPE to make obstacle with. This is moved into the obstacle, so
+     * polygons built for a new obstacle are not copied.
      */
-    explicit GeomObstacle(const GEOM_TYPE& geom);
+    explicit GeomObstacle(GEOM_TYPE geom);
 
     bool contains(const Point& p) const override;
     double distance(const Point& p) const override;
     bool intersects(const Segment& segment) const override;
     std::string toString(void) const override;
+    std::size_t hash(void) const override;
     void accept(ObstacleVisitor& visitor) const override;
 
     /**
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <utility>
+
 #include "software/ai/navigator/obstacle/obstacle.h"
 #include "software/geom/algorithms/contains.h"
 
 template <typename GEOM_TYPE>
-GeomObstacle<GEOM_TYPE>::GeomObstacle(const GEOM_TYPE& geom) : geom_(geom)
+GeomObstacle<GEOM_TYPE>::GeomObstacle(GEOM_TYPE geom) : geom_(std::move(geom))
 {
 }
 
@@ -34,6 +36,12 @@ std::string GeomObstacle<GEOM_TYPE>::toString(void) const
     return ss.str();
 }
 
+template <typename GEOM_TYPE>
+std::size_t GeomObstacle<GEOM_TYPE>::hash(void) const
+{
+    return std::hash<GEOM_TYPE>()(geom_);
+}
+
 template <typename GEOM_TYPE>
 const GEOM_TYPE GeomObstacle<GEOM_TYPE>::getGeom(void) const
 {
@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
+#include "software/test_util/test_util.h"
+
+// Benchmarks checking points and segments against the polygon obstacles that the
+// navigator builds, which is most of the work of planning a path. The points and
+// segments are spread over the whole field like the ones the path planner checks, so
+// most of them are far from any one obstacle.
+
+// The number of points and segments checked against an obstacle in each iteration
+static constexpr unsigned int NUM_QUERIES = 1024;
+
+/**
+ * The polygon obstacles the navigator builds
+ */
+enum class ObstacleShape
+{
+    // The obstacle in front of a moving robot
+    MOVING_ROBOT,
+    // The enemy defense area, which is a rectangle
+    ENEMY_DEFENSE_AREA,
+    // The friendly half of the field, which is a rectangle that covers many points
+    FRIENDLY_HALF,
+    // A triangle expanded by the size of a robot
+    EXPANDED_TRIANGLE,
+};
+
+/**
+ * Creates an obstacle with the given shape, the same way the navigator does
+ *
+ * @param shape The shape of the obstacle
+ *
+ * @return the obstacle
+ */
+static ObstaclePtr createObstacle(ObstacleShape shape)
+{
+    RobotNavigationObstacleFactory factory(
+        std::make_shared<RobotNavigationObstacleConfig>());
+    World world = ::TestUtil::createBlankTestingWorld();
+    switch (shape)
+    {
+        case ObstacleShape::MOVING_ROBOT:
+            return factory.createFromRobot(Robot(0, Point(1, -0.5), Vector(2, 1),
+                                                 Angle::zero(), AngularVelocity::zero(),
+                                                 Timestamp::fromSeconds(0)));
+        case ObstacleShape::ENEMY_DEFENSE_AREA:
+            return factory.createFromMotionConstraint(
+                MotionConstraint::ENEMY_DEFENSE_AREA, world)[0];
+        case ObstacleShape::FRIENDLY_HALF:
+            return factory.createFromMotionConstraint(MotionConstraint::FRIENDLY_HALF,
+                                                      world)[0];
+        case ObstacleShape::EXPANDED_TRIANGLE:
+            return factory.createFromShape(
+                Polygon({Point(-1, -1), Point(1, -0.5), Point(0, 1)}));
+    }
+    throw std::invalid_argument("Unknown obstacle shape");
+}
+
+/**
+ * Creates random points over a division B field, including the boundary
+ *
+ * @param num_points The number of points to create
+ *
+ * @return the random points
+ */
+static std::vector<Point> createRandomPoints(unsigned int num_points)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> x_distribution(-5, 5);
+    std::uniform_real_distribution<double> y_distribution(-3.5, 3.5);
+    std::vector<Point> points;
+    for (unsigned int i = 0; i < num_points; i++)
+    {
+        points.emplace_back(x_distribution(random_engine), y_distribution(random_engine));
+    }
+    return points;
+}
+
+static void benchmarkObstacleContains(benchmark::State &state)
+{
+    ObstaclePtr obstacle = createObstacle(static_cast<ObstacleShape>(state.range(0)));
+    std::vector<Point> points = createRandomPoints(NUM_QUERIES);
+
+    for (auto _ : state)
+    {
+        for (const Point &point : points)
+        {
+            benchmark::DoNotOptimize(obstacle->contains(point));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_QUERIES);
+}
+
+static void benchmarkObstacleDistance(benchmark::State &state)
+{
+    ObstaclePtr obstacle = createObstacle(static_cast<ObstacleShape>(state.range(0)));
+    std::vector<Point> points = createRandomPoints(NUM_QUERIES);
+
+    for (auto _ : state)
+    {
+        for (const Point &point : points)
+        {
+            benchmark::DoNotOptimize(obstacle->distance(point));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_QUERIES);
+}
+
+static void benchmarkObstacleIntersects(benchmark::State &state)
+{
+    ObstaclePtr obstacle = createObstacle(static_cast<ObstacleShape>(state.range(0)));
+    std::vector<Point> points = createRandomPoints(NUM_QUERIES + 1);
+    // Short segments, like the edges between nearby nodes the path planner checks
+    std::vector<Segment> segments;
+    for (unsigned int i = 0; i < NUM_QUERIES; i++)
+    {
+        segments.emplace_back(points[i], points[i] + (points[i + 1] - points[i]) / 10);
+    }
+
+    for (auto _ : state)
+    {
+        for (const Segment &segment : segments)
+        {
+            benchmark::DoNotOptimize(obstacle->intersects(segment));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * NUM_QUERIES);
+}
+
+static void benchmarkPolygonConstruction(benchmark::State &state)
+{
+    // The obstacles of moving robots are built for every robot on every tick
+    Robot robot(0, Point(1, -0.5), Vector(2, 1), Angle::zero(), AngularVelocity::zero(),
+                Timestamp::fromSeconds(0));
+    RobotNavigationObstacleFactory factory(
+        std::make_shared<RobotNavigationObstacleConfig>());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(factory.createFromRobot(robot));
+    }
+}
+
+/**
+ * Runs a benchmark with every obstacle shape
+ *
+ * @param benchmark The benchmark to set the arguments of
+ */
+static void obstacleShapeArguments(benchmark::internal::Benchmark *benchmark)
+{
+    benchmark->ArgName("shape");
+    for (ObstacleShape shape :
+         {ObstacleShape::MOVING_ROBOT, ObstacleShape::ENEMY_DEFENSE_AREA,
+          ObstacleShape::FRIENDLY_HALF, ObstacleShape::EXPANDED_TRIANGLE})
+    {
+        benchmark->Arg(static_cast<int>(shape));
+    }
+}
+
+BENCHMARK(benchmarkObstacleContains)->Apply(obstacleShapeArguments);
+BENCHMARK(benchmarkObstacleDistance)->Apply(obstacleShapeArguments);
+BENCHMARK(benchmarkObstacleIntersects)->Apply(obstacleShapeArguments);
+BENCHMARK(benchmarkPolygonConstruction);
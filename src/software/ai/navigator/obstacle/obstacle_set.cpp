@@ -0,0 +1,446 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "software/ai/navigator/obstacle/obstacle_visitor.h"
+
+// A coordinate far enough outside the field that nothing near the field ever reaches
+// it, but small enough that squaring it does not overflow
+static constexpr double FAR_AWAY_COORDINATE = 1e100;
+
+// A block of values of obstacles that are operated on together, using GCC's vector
+// extensions. Arithmetic and comparisons on a Block apply to each of its values, and
+// are compiled to a SIMD instruction for whichever instruction set is targeted (ie. SSE2
+// or AVX on x86), so nothing here depends on a specific instruction set. Comparisons give
+// a BlockMask, with each value set to all ones (-1) where the comparison is true and 0
+// where it is false.
+typedef double Block
+    __attribute__((vector_size(ObstacleSet::BLOCK_SIZE * sizeof(double))));
+typedef int64_t BlockMask
+    __attribute__((vector_size(ObstacleSet::BLOCK_SIZE * sizeof(int64_t))));
+
+/**
+ * Loads a block of values from an array
+ *
+ * @param array The array to load from, whose size is a multiple of BLOCK_SIZE
+ * @param begin The index of the first value to load, which is a multiple of BLOCK_SIZE
+ *
+ * @return the values in [begin, begin + BLOCK_SIZE) of the array
+ */
+static inline Block loadBlock(const std::vector<double> &array, size_t begin)
+{
+    Block block;
+    std::memcpy(&block, array.data() + begin, sizeof(Block));
+    return block;
+}
+
+/**
+ * Returns a block with every value set to the given value
+ *
+ * @param value The value
+ *
+ * @return a block with every value set to the given value
+ */
+static inline Block broadcast(double value)
+{
+    return Block{} + value;
+}
+
+/**
+ * Returns whether any value of the given mask is set
+ *
+ * @param mask The mask
+ *
+ * @return whether any value of the mask is set
+ */
+static inline bool any(const BlockMask &mask)
+{
+    int64_t result = 0;
+    for (size_t i = 0; i < ObstacleSet::BLOCK_SIZE; i++)
+    {
+        result |= mask[i];
+    }
+    return result != 0;
+}
+
+static inline Block min(const Block &block, double value)
+{
+    return block < value ? block : broadcast(value);
+}
+
+static inline Block max(const Block &block, double value)
+{
+    return block > value ? block : broadcast(value);
+}
+
+static inline Block clamp(const Block &block, double low, double high)
+{
+    return min(max(block, low), high);
+}
+
+static inline Block abs(const Block &block)
+{
+    return block < 0 ? -block : block;
+}
+
+class ObstacleSet::ObstacleSorter : public ObstacleVisitor
+{
+   public:
+    explicit ObstacleSorter(ObstacleSet &obstacle_set) : obstacle_set(obstacle_set) {}
+
+    void visit(const GeomObstacle<Circle> &geom_obstacle) override
+    {
+        obstacle_set.addCircle(geom_obstacle.getGeom());
+    }
+
+    void visit(const GeomObstacle<Polygon> &geom_obstacle) override
+    {
+        obstacle_set.addPolygon(geom_obstacle.getGeom());
+    }
+
+   private:
+    ObstacleSet &obstacle_set;
+};
+
+ObstacleSet::ObstacleSet()
+    : obstacles(),
+      num_circles(0),
+      circle_x(),
+      circle_y(),
+      circle_radius_squared(),
+      num_rectangles(0),
+      rectangle_min_x(),
+      rectangle_min_y(),
+      rectangle_max_x(),
+      rectangle_max_y(),
+      num_polygon_edges(0),
+      polygon_edge_start_x(),
+      polygon_edge_start_y(),
+      polygon_edge_end_x(),
+      polygon_edge_end_y(),
+      polygon_edges_begin({0})
+{
+}
+
+ObstacleSet::ObstacleSet(const std::vector<ObstaclePtr> &obstacles) : ObstacleSet()
+{
+    add(obstacles);
+}
+
+void ObstacleSet::add(const ObstaclePtr &obstacle)
+{
+    ObstacleSorter sorter(*this);
+    obstacle->accept(sorter);
+    obstacles.push_back(obstacle);
+}
+
+void ObstacleSet::add(const std::vector<ObstaclePtr> &obstacles)
+{
+    for (const auto &obstacle : obstacles)
+    {
+        add(obstacle);
+    }
+}
+
+void ObstacleSet::clear()
+{
+    obstacles.clear();
+
+    num_circles = 0;
+    circle_x.clear();
+    circle_y.clear();
+    circle_radius_squared.clear();
+
+    num_rectangles = 0;
+    rectangle_min_x.clear();
+    rectangle_min_y.clear();
+    rectangle_max_x.clear();
+    rectangle_max_y.clear();
+
+    num_polygon_edges = 0;
+    polygon_edge_start_x.clear();
+    polygon_edge_start_y.clear();
+    polygon_edge_end_x.clear();
+    polygon_edge_end_y.clear();
+    polygon_edges_begin.assign(1, 0);
+}
+
+bool ObstacleSet::contains(const Point &point) const
+{
+    const Block px = broadcast(point.x());
+    const Block py = broadcast(point.y());
+
+    for (size_t i = 0; i < circle_x.size(); i += BLOCK_SIZE)
+    {
+        const Block dx = px - loadBlock(circle_x, i);
+        const Block dy = py - loadBlock(circle_y, i);
+        if (any(dx * dx + dy * dy <= loadBlock(circle_radius_squared, i)))
+        {
+            return true;
+        }
+    }
+
+    for (size_t i = 0; i < rectangle_min_x.size(); i += BLOCK_SIZE)
+    {
+        // The bottom and left sides of a rectangle are inside it and the top and right
+        // sides are not, the same as contains(Polygon, Point)
+        const BlockMask hits =
+            (loadBlock(rectangle_min_x, i) <= px) & (px < loadBlock(rectangle_max_x, i)) &
+            (loadBlock(rectangle_min_y, i) <= py) & (py < loadBlock(rectangle_max_y, i));
+        if (any(hits))
+        {
+            return true;
+        }
+    }
+
+    for (size_t polygon = 0; polygon + 1 < polygon_edges_begin.size(); polygon++)
+    {
+        if (polygonContains(polygon, point))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ObstacleSet::intersects(const Segment &segment) const
+{
+    const double start_x = segment.getStart().x();
+    const double start_y = segment.getStart().y();
+    const double end_x   = segment.getEnd().x();
+    const double end_y   = segment.getEnd().y();
+    const Block dir_x    = broadcast(end_x - start_x);
+    const Block dir_y    = broadcast(end_y - start_y);
+
+    // The closest point on the segment to a circle's origin is found by projecting the
+    // origin onto the segment. A segment with no length is just its start point.
+    const double length_squared =
+        (end_x - start_x) * (end_x - start_x) + (end_y - start_y) * (end_y - start_y);
+    const Block inverse_length_squared =
+        broadcast(length_squared > 0 ? 1.0 / length_squared : 0.0);
+    for (size_t i = 0; i < circle_x.size(); i += BLOCK_SIZE)
+    {
+        const Block to_origin_x = loadBlock(circle_x, i) - start_x;
+        const Block to_origin_y = loadBlock(circle_y, i) - start_y;
+        const Block t =
+            clamp((to_origin_x * dir_x + to_origin_y * dir_y) * inverse_length_squared,
+                  0.0, 1.0);
+        const Block dx = to_origin_x - t * dir_x;
+        const Block dy = to_origin_y - t * dir_y;
+        if (any(dx * dx + dy * dy <= loadBlock(circle_radius_squared, i)))
+        {
+            return true;
+        }
+    }
+
+    // A segment intersects a rectangle if neither the x axis, the y axis, nor the
+    // normal of the segment separate them (ie. by the separating axis theorem)
+    const Block segment_min_x = broadcast(std::min(start_x, end_x));
+    const Block segment_max_x = broadcast(std::max(start_x, end_x));
+    const Block segment_min_y = broadcast(std::min(start_y, end_y));
+    const Block segment_max_y = broadcast(std::max(start_y, end_y));
+    const Block abs_dir_x     = abs(dir_x);
+    const Block abs_dir_y     = abs(dir_y);
+    for (size_t i = 0; i < rectangle_min_x.size(); i += BLOCK_SIZE)
+    {
+        const Block min_x = loadBlock(rectangle_min_x, i);
+        const Block min_y = loadBlock(rectangle_min_y, i);
+        const Block max_x = loadBlock(rectangle_max_x, i);
+        const Block max_y = loadBlock(rectangle_max_y, i);
+
+        const BlockMask bounds_overlap =
+            (segment_max_x >= min_x) & (segment_min_x <= max_x) &
+            (segment_max_y >= min_y) & (segment_min_y <= max_y);
+
+        // Project the rectangle onto the normal of the segment, relative to the start of
+        // the segment, and check that the projection contains 0
+        const Block half_width       = (max_x - min_x) / 2;
+        const Block half_height      = (max_y - min_y) / 2;
+        const Block centre_x         = min_x + half_width - start_x;
+        const Block centre_y         = min_y + half_height - start_y;
+        const Block projected_centre = dir_x * centre_y - dir_y * centre_x;
+        const Block projected_half_length =
+            abs_dir_x * half_height + abs_dir_y * half_width;
+
+        if (any(bounds_overlap & (abs(projected_centre) <= projected_half_length)))
+        {
+            return true;
+        }
+    }
+
+    // This is the same segment intersection test as intersects(Segment, Segment), with
+    // each edge as the first segment and the given segment as the second, and without
+    // branching
+    for (size_t i = 0; i < polygon_edge_start_x.size(); i += BLOCK_SIZE)
+    {
+        const Block edge_start_x = loadBlock(polygon_edge_start_x, i);
+        const Block edge_start_y = loadBlock(polygon_edge_start_y, i);
+        const Block ax           = loadBlock(polygon_edge_end_x, i) - edge_start_x;
+        const Block ay           = loadBlock(polygon_edge_end_y, i) - edge_start_y;
+        const Block &bx          = dir_x;
+        const Block &by          = dir_y;
+        const Block cx           = edge_start_x - end_x;
+        const Block cy           = edge_start_y - end_y;
+
+        const Block denominator = ay * bx - ax * by;
+        const Block numerator1  = by * cx - bx * cy;
+        const Block numerator2  = ax * cy - ay * cx;
+        const Block lower_bound = min(denominator, 0.0);
+        const Block upper_bound = max(denominator, 0.0);
+        if (any((numerator1 >= lower_bound) & (numerator1 <= upper_bound) &
+                (numerator2 >= lower_bound) & (numerator2 <= upper_bound)))
+        {
+            return true;
+        }
+    }
+
+    // A segment that does not cross any edge of a polygon intersects it only if the
+    // segment is entirely inside it
+    for (size_t polygon = 0; polygon + 1 < polygon_edges_begin.size(); polygon++)
+    {
+        if (polygonContains(polygon, segment.getStart()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const std::vector<ObstaclePtr> &ObstacleSet::getObstacles() const
+{
+    return obstacles;
+}
+
+size_t ObstacleSet::size() const
+{
+    return obstacles.size();
+}
+
+bool ObstacleSet::empty() const
+{
+    return obstacles.empty();
+}
+
+void ObstacleSet::addCircle(const Circle &circle)
+{
+    circle_x.resize(num_circles);
+    circle_y.resize(num_circles);
+    circle_radius_squared.resize(num_circles);
+
+    circle_x.push_back(circle.origin().x());
+    circle_y.push_back(circle.origin().y());
+    circle_radius_squared.push_back(circle.radius() * circle.radius());
+    num_circles++;
+
+    // No point is ever within a negative distance of anything
+    padToBlockSize(num_circles,
+                   {{&circle_x, 0.0}, {&circle_y, 0.0}, {&circle_radius_squared, -1.0}});
+}
+
+void ObstacleSet::addPolygon(const Polygon &polygon)
+{
+    const std::vector<Point> &points = polygon.getPoints();
+
+    // The sides of an axis-aligned rectangle alternate between vertical and horizontal
+    bool is_axis_aligned_rectangle = points.size() == 4;
+    const bool first_side_is_vertical =
+        is_axis_aligned_rectangle && points[0].x() == points[1].x();
+    for (size_t i = 0; i < points.size() && is_axis_aligned_rectangle; i++)
+    {
+        const Point &next           = points[(i + 1) % points.size()];
+        const bool side_is_vertical = (i % 2 == 0) == first_side_is_vertical;
+        is_axis_aligned_rectangle =
+            side_is_vertical ? points[i].x() == next.x() : points[i].y() == next.y();
+    }
+
+    if (is_axis_aligned_rectangle)
+    {
+        rectangle_min_x.resize(num_rectangles);
+        rectangle_min_y.resize(num_rectangles);
+        rectangle_max_x.resize(num_rectangles);
+        rectangle_max_y.resize(num_rectangles);
+
+        rectangle_min_x.push_back(std::min(points[0].x(), points[2].x()));
+        rectangle_min_y.push_back(std::min(points[0].y(), points[2].y()));
+        rectangle_max_x.push_back(std::max(points[0].x(), points[2].x()));
+        rectangle_max_y.push_back(std::max(points[0].y(), points[2].y()));
+        num_rectangles++;
+
+        // An inside out rectangle far away from the field, which does not overlap
+        // anything
+        padToBlockSize(num_rectangles, {{&rectangle_min_x, FAR_AWAY_COORDINATE},
+                                        {&rectangle_min_y, FAR_AWAY_COORDINATE},
+                                        {&rectangle_max_x, -FAR_AWAY_COORDINATE},
+                                        {&rectangle_max_y, -FAR_AWAY_COORDINATE}});
+    }
+    else
+    {
+        polygon_edge_start_x.resize(num_polygon_edges);
+        polygon_edge_start_y.resize(num_polygon_edges);
+        polygon_edge_end_x.resize(num_polygon_edges);
+        polygon_edge_end_y.resize(num_polygon_edges);
+
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            const Point &next = points[(i + 1) % points.size()];
+            polygon_edge_start_x.push_back(points[i].x());
+            polygon_edge_start_y.push_back(points[i].y());
+            polygon_edge_end_x.push_back(next.x());
+            polygon_edge_end_y.push_back(next.y());
+        }
+        num_polygon_edges += points.size();
+        polygon_edges_begin.push_back(num_polygon_edges);
+
+        // A vertical edge far away from the field, which does not cross any segment
+        // near the field. The padding is not part of any polygon, so it does not
+        // affect which points the polygons contain.
+        padToBlockSize(num_polygon_edges, {{&polygon_edge_start_x, FAR_AWAY_COORDINATE},
+                                           {&polygon_edge_start_y, -FAR_AWAY_COORDINATE},
+                                           {&polygon_edge_end_x, FAR_AWAY_COORDINATE},
+                                           {&polygon_edge_end_y, FAR_AWAY_COORDINATE}});
+    }
+}
+
+void ObstacleSet::padToBlockSize(
+    size_t num_elements,
+    std::initializer_list<std::pair<std::vector<double> *, double>> arrays_and_padding)
+{
+    const size_t padded_size = (num_elements + BLOCK_SIZE - 1) / BLOCK_SIZE * BLOCK_SIZE;
+    for (const auto &[array, padding] : arrays_and_padding)
+    {
+        array->resize(padded_size, padding);
+    }
+}
+
+bool ObstacleSet::polygonContains(size_t polygon_index, const Point &point) const
+{
+    // This is the same ray casting test as contains(Polygon, Point), counting the
+    // number of edges a ray in the +x direction from the point crosses without
+    // branching
+    const double px         = point.x();
+    const double py         = point.y();
+    bool point_is_contained = false;
+    for (size_t i = polygon_edges_begin[polygon_index];
+         i < polygon_edges_begin[polygon_index + 1]; i++)
+    {
+        const double pix = polygon_edge_start_x[i];
+        const double piy = polygon_edge_start_y[i];
+        const double pjx = polygon_edge_end_x[i];
+        const double pjy = polygon_edge_end_y[i];
+
+        const bool p_within_edge_y_range = (piy > py) != (pjy > py);
+        // The edge is never crossed when it is horizontal, so its height only needs to
+        // be non-zero to avoid dividing by zero
+        const double edge_height = p_within_edge_y_range ? pjy - piy : 1.0;
+        const bool p_in_half_plane_to_left_of_extended_edge =
+            px < (pjx - pix) * (py - piy) / edge_height + pix;
+
+        point_is_contained ^=
+            p_within_edge_y_range & p_in_half_plane_to_left_of_extended_edge;
+    }
+    return point_is_contained;
+}
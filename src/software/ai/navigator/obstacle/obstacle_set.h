@@ -0,0 +1,186 @@
+#pragma once
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/polygon.h"
+#include "software/geom/segment.h"
+
+/**
+ * An ObstacleSet is a collection of obstacles that can be quickly tested against
+ * points and segments as a whole.
+ *
+ * Testing each ObstaclePtr in a std::vector<ObstaclePtr> means a virtual call on a
+ * separately allocated obstacle for every test, which dominates path planning since the
+ * planner tests thousands of points and segments against the same obstacles. Instead,
+ * an ObstacleSet sorts the obstacles by shape and stores the geometry of each shape in
+ * its own contiguous arrays (ie. one array of the x coordinates of every circle, one
+ * of the y coordinates, etc.). All the obstacles of a shape are tested in fixed size
+ * blocks without branching, so the compiler can vectorize each block, and a test stops
+ * as soon as any block contains a hit.
+ *
+ * Axis-aligned rectangles, which make up most of the obstacles derived from the field,
+ * are stored separately from other polygons since they can be tested much more cheaply.
+ *
+ * Clearing an ObstacleSet keeps its storage, so a set that is cleared and refilled for
+ * every path stops allocating once it has grown large enough.
+ */
+class ObstacleSet
+{
+   public:
+    /**
+     * Creates an empty ObstacleSet
+     */
+    explicit ObstacleSet();
+
+    /**
+     * Creates an ObstacleSet containing the given obstacles
+     *
+     * @param obstacles The obstacles to add to the set
+     */
+    explicit ObstacleSet(const std::vector<ObstaclePtr> &obstacles);
+
+    /**
+     * Adds an obstacle to the set
+     *
+     * @param obstacle The obstacle to add
+     */
+    void add(const ObstaclePtr &obstacle);
+
+    /**
+     * Adds obstacles to the set
+     *
+     * @param obstacles The obstacles to add
+     */
+    void add(const std::vector<ObstaclePtr> &obstacles);
+
+    /**
+     * Removes all the obstacles from the set without releasing its storage
+     */
+    void clear();
+
+    /**
+     * Determines whether the given Point is contained within any obstacle in the set.
+     * This is equivalent to calling Obstacle::contains on every obstacle in the set.
+     *
+     * @param point The point to test
+     *
+     * @return whether the point is contained within any obstacle in the set
+     */
+    bool contains(const Point &point) const;
+
+    /**
+     * Determines whether the given Segment intersects any obstacle in the set. This is
+     * equivalent to calling Obstacle::intersects on every obstacle in the set, apart
+     * from segments that exactly touch the boundary of a rectangle, which always
+     * intersect it.
+     *
+     * @param segment The segment to test
+     *
+     * @return whether the segment intersects any obstacle in the set
+     */
+    bool intersects(const Segment &segment) const;
+
+    /**
+     * Returns the obstacles in the set, in the order they were added
+     *
+     * @return the obstacles in the set
+     */
+    const std::vector<ObstaclePtr> &getObstacles() const;
+
+    /**
+     * Returns the number of obstacles in the set
+     *
+     * @return the number of obstacles in the set
+     */
+    size_t size() const;
+
+    /**
+     * Returns whether the set has no obstacles
+     *
+     * @return whether the set has no obstacles
+     */
+    bool empty() const;
+
+    // The number of obstacles of a shape that are tested together, which is the number
+    // of doubles that fit in a SIMD register of the targeted instruction set
+#ifdef __AVX__
+    static constexpr size_t BLOCK_SIZE = 4;
+#else
+    static constexpr size_t BLOCK_SIZE = 2;
+#endif
+
+   private:
+    // Sorts the obstacles it visits into the arrays of an ObstacleSet
+    class ObstacleSorter;
+
+    /**
+     * Adds a circle to the arrays of circles
+     *
+     * @param circle The circle to add
+     */
+    void addCircle(const Circle &circle);
+
+    /**
+     * Adds a polygon to the arrays of rectangles if it is an axis-aligned rectangle,
+     * otherwise to the arrays of polygons
+     *
+     * @param polygon The polygon to add
+     */
+    void addPolygon(const Polygon &polygon);
+
+    /**
+     * Pads the arrays of a shape so that the number of elements is a multiple of
+     * BLOCK_SIZE. Each array is padded with its padding value, which must be chosen so
+     * that the padding never hits anything.
+     *
+     * @param num_elements The number of elements in the arrays, not including padding
+     * @param arrays_and_padding Pairs of each array and its padding value
+     */
+    static void padToBlockSize(
+        size_t num_elements,
+        std::initializer_list<std::pair<std::vector<double> *, double>>
+            arrays_and_padding);
+
+    /**
+     * Determines whether the given point is contained within the polygon with the given
+     * index
+     *
+     * @param polygon_index The index of the polygon
+     * @param point The point to test
+     *
+     * @return whether the point is contained within the polygon
+     */
+    bool polygonContains(size_t polygon_index, const Point &point) const;
+
+    std::vector<ObstaclePtr> obstacles;
+
+    // The origin and squared radius of each circle
+    size_t num_circles;
+    std::vector<double> circle_x;
+    std::vector<double> circle_y;
+    std::vector<double> circle_radius_squared;
+
+    // The bounds of each axis-aligned rectangle
+    size_t num_rectangles;
+    std::vector<double> rectangle_min_x;
+    std::vector<double> rectangle_min_y;
+    std::vector<double> rectangle_max_x;
+    std::vector<double> rectangle_max_y;
+
+    // The edges of every other polygon, concatenated. Each edge goes from its start to
+    // its end, and the edges of each polygon go around the polygon in order.
+    size_t num_polygon_edges;
+    std::vector<double> polygon_edge_start_x;
+    std::vector<double> polygon_edge_start_y;
+    std::vector<double> polygon_edge_end_x;
+    std::vector<double> polygon_edge_end_y;
+    // The index of the first edge of each polygon, followed by the total number of
+    // edges, so polygon i has the edges in [polygon_edges_begin[i],
+    // polygon_edges_begin[i + 1])
+    std::vector<size_t> polygon_edges_begin;
+};
@@ -0,0 +1,175 @@
+#include "software/ai/navigator/obstacle/obstacle_set.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "software/geom/rectangle.h"
+
+class ObstacleSetTest : public testing::Test
+{
+   protected:
+    /**
+     * Returns whether any of the given obstacles contain the given point, by testing
+     * each obstacle individually
+     */
+    static bool anyContains(const std::vector<ObstaclePtr>& obstacles, const Point& point)
+    {
+        return std::any_of(
+            obstacles.begin(), obstacles.end(),
+            [&](const ObstaclePtr& obstacle) { return obstacle->contains(point); });
+    }
+
+    /**
+     * Returns whether any of the given obstacles intersect the given segment, by
+     * testing each obstacle individually
+     */
+    static bool anyIntersects(const std::vector<ObstaclePtr>& obstacles,
+                              const Segment& segment)
+    {
+        return std::any_of(
+            obstacles.begin(), obstacles.end(),
+            [&](const ObstaclePtr& obstacle) { return obstacle->intersects(segment); });
+    }
+
+    /**
+     * Returns a random point on a division B field
+     */
+    Point randomPoint()
+    {
+        return Point(x_distribution(random_engine), y_distribution(random_engine));
+    }
+
+    std::mt19937 random_engine{0};
+    std::uniform_real_distribution<double> x_distribution{-5.0, 5.0};
+    std::uniform_real_distribution<double> y_distribution{-3.5, 3.5};
+};
+
+TEST_F(ObstacleSetTest, empty_set_does_not_contain_or_intersect_anything)
+{
+    ObstacleSet obstacle_set;
+
+    EXPECT_TRUE(obstacle_set.empty());
+    EXPECT_FALSE(obstacle_set.contains(Point(0, 0)));
+    EXPECT_FALSE(obstacle_set.intersects(Segment(Point(-1, -1), Point(1, 1))));
+}
+
+TEST_F(ObstacleSetTest, get_obstacles_returns_obstacles_in_order_added)
+{
+    std::vector<ObstaclePtr> obstacles = {
+        std::make_shared<GeomObstacle<Polygon>>(Rectangle(Point(0, 0), Point(1, 1))),
+        std::make_shared<GeomObstacle<Circle>>(Circle(Point(2, 2), 0.5)),
+        std::make_shared<GeomObstacle<Polygon>>(
+            Polygon({Point(0, 0), Point(1, 0), Point(0, 1)}))};
+
+    ObstacleSet obstacle_set(obstacles);
+
+    EXPECT_EQ(3, obstacle_set.size());
+    EXPECT_EQ(obstacles, obstacle_set.getObstacles());
+}
+
+TEST_F(ObstacleSetTest, contains_point_in_each_kind_of_obstacle)
+{
+    ObstacleSet obstacle_set(
+        {std::make_shared<GeomObstacle<Circle>>(Circle(Point(2, 2), 0.5)),
+         std::make_shared<GeomObstacle<Polygon>>(Rectangle(Point(-1, -1), Point(0, 0))),
+         std::make_shared<GeomObstacle<Polygon>>(
+             Polygon({Point(3, -3), Point(4, -3), Point(3, -2)}))});
+
+    EXPECT_TRUE(obstacle_set.contains(Point(2.2, 1.9)));
+    EXPECT_TRUE(obstacle_set.contains(Point(-0.5, -0.5)));
+    EXPECT_TRUE(obstacle_set.contains(Point(3.2, -2.9)));
+    EXPECT_FALSE(obstacle_set.contains(Point(1, 1)));
+    EXPECT_FALSE(obstacle_set.contains(Point(3.8, -2.2)));
+}
+
+TEST_F(ObstacleSetTest, intersects_segment_through_each_kind_of_obstacle)
+{
+    ObstacleSet obstacle_set(
+        {std::make_shared<GeomObstacle<Circle>>(Circle(Point(2, 2), 0.5)),
+         std::make_shared<GeomObstacle<Polygon>>(Rectangle(Point(-1, -1), Point(0, 0))),
+         std::make_shared<GeomObstacle<Polygon>>(
+             Polygon({Point(3, -3), Point(4, -3), Point(3, -2)}))});
+
+    EXPECT_TRUE(obstacle_set.intersects(Segment(Point(1, 2), Point(3, 2))));
+    EXPECT_TRUE(obstacle_set.intersects(Segment(Point(-2, -0.5), Point(1, -0.5))));
+    EXPECT_TRUE(obstacle_set.intersects(Segment(Point(3.1, -4), Point(3.1, -1))));
+    EXPECT_FALSE(obstacle_set.intersects(Segment(Point(-3, 3), Point(3, 3))));
+}
+
+TEST_F(ObstacleSetTest, intersects_segment_entirely_inside_obstacle)
+{
+    ObstacleSet obstacle_set(
+        {std::make_shared<GeomObstacle<Polygon>>(Rectangle(Point(-1, -1), Point(1, 1))),
+         std::make_shared<GeomObstacle<Polygon>>(
+             Polygon({Point(3, -3), Point(4, -3), Point(3, -2)}))});
+
+    EXPECT_TRUE(obstacle_set.intersects(Segment(Point(-0.5, 0), Point(0.5, 0))));
+    EXPECT_TRUE(obstacle_set.intersects(Segment(Point(3.1, -2.9), Point(3.2, -2.9))));
+}
+
+TEST_F(ObstacleSetTest, rotated_rectangle_is_not_treated_as_axis_aligned)
+{
+    // A square rotated by 45 degrees, whose bounding box contains the point
+    ObstacleSet obstacle_set({std::make_shared<GeomObstacle<Polygon>>(
+        Polygon({Point(0, -1), Point(1, 0), Point(0, 1), Point(-1, 0)}))});
+
+    EXPECT_TRUE(obstacle_set.contains(Point(0, 0)));
+    EXPECT_FALSE(obstacle_set.contains(Point(0.9, 0.9)));
+    EXPECT_FALSE(obstacle_set.intersects(Segment(Point(0.8, 0.8), Point(2, 2))));
+}
+
+TEST_F(ObstacleSetTest, clear_removes_all_obstacles)
+{
+    ObstacleSet obstacle_set(
+        {std::make_shared<GeomObstacle<Circle>>(Circle(Point(0, 0), 1)),
+         std::make_shared<GeomObstacle<Polygon>>(Rectangle(Point(2, 2), Point(3, 3)))});
+    obstacle_set.clear();
+
+    EXPECT_TRUE(obstacle_set.empty());
+    EXPECT_FALSE(obstacle_set.contains(Point(0, 0)));
+    EXPECT_FALSE(obstacle_set.contains(Point(2.5, 2.5)));
+
+    obstacle_set.add(std::make_shared<GeomObstacle<Circle>>(Circle(Point(2.5, 2.5), 1)));
+    EXPECT_EQ(1, obstacle_set.size());
+    EXPECT_FALSE(obstacle_set.contains(Point(0, 0)));
+    EXPECT_TRUE(obstacle_set.contains(Point(2.5, 2.5)));
+}
+
+TEST_F(ObstacleSetTest, matches_testing_each_obstacle_individually)
+{
+    // Use a number of each kind of obstacle that is not a multiple of the block size,
+    // so that the padding is tested too
+    std::vector<ObstaclePtr> obstacles;
+    for (unsigned int i = 0; i < 7; i++)
+    {
+        obstacles.push_back(std::make_shared<GeomObstacle<Circle>>(
+            Circle(randomPoint(), 0.1 + 0.05 * i)));
+    }
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        Point corner = randomPoint();
+        obstacles.push_back(std::make_shared<GeomObstacle<Polygon>>(
+            Rectangle(corner, corner + Vector(0.3 + 0.1 * i, 0.2 + 0.1 * i))));
+    }
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        Point centre = randomPoint();
+        obstacles.push_back(std::make_shared<GeomObstacle<Polygon>>(
+            Polygon({centre + Vector(0.3, 0), centre + Vector(0.1, 0.4),
+                     centre + Vector(-0.2, 0.1), centre + Vector(-0.3, -0.3),
+                     centre + Vector(0.2, -0.2)})));
+    }
+    ObstacleSet obstacle_set(obstacles);
+
+    for (unsigned int i = 0; i < 10000; i++)
+    {
+        Point point = randomPoint();
+        EXPECT_EQ(anyContains(obstacles, point), obstacle_set.contains(point))
+            << "Point " << point;
+
+        Segment segment(point, point + (randomPoint() - Point()) * 0.2);
+        EXPECT_EQ(anyIntersects(obstacles, segment), obstacle_set.intersects(segment))
+            << "Segment from " << segment.getStart() << " to " << segment.getEnd();
+    }
+}
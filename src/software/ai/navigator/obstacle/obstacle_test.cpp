@@ -62,6 +62,28 @@ TEST(NavigatorObstacleTest, circle_obstacle_stream_operator_test)
     EXPECT_TRUE(obstacle->toString().find(circle_ss.str()) != std::string::npos);
 }
 
+TEST(NavigatorObstacleTest, obstacles_with_the_same_shape_have_the_same_hash)
+{
+    ObstaclePtr obstacle(
+        std::make_shared<GeomObstacle<Polygon>>(Rectangle({-1, 1}, {2, -3})));
+    ObstaclePtr same_obstacle(
+        std::make_shared<GeomObstacle<Polygon>>(Rectangle({-1, 1}, {2, -3})));
+    ObstaclePtr moved_obstacle(
+        std::make_shared<GeomObstacle<Polygon>>(Rectangle({-1, 1}, {2, -2})));
+
+    EXPECT_EQ(obstacle->hash(), same_obstacle->hash());
+    EXPECT_NE(obstacle->hash(), moved_obstacle->hash());
+}
+
+TEST(NavigatorObstacleTest, circle_obstacles_with_different_radii_have_different_hashes)
+{
+    ObstaclePtr obstacle(std::make_shared<GeomObstacle<Circle>>(Circle({2, 2}, 3)));
+    ObstaclePtr larger_obstacle(
+        std::make_shared<GeomObstacle<Circle>>(Circle({2, 2}, 4)));
+
+    EXPECT_NE(obstacle->hash(), larger_obstacle->hash());
+}
+
 TEST(NavigatorObstacleTest, rectangle_obstacle_contains)
 {
     Rectangle rectangle({-1, 1}, {2, -3});
@@ -4,7 +4,13 @@ RobotNavigationObstacleFactory::RobotNavigationObstacleFactory(
     std::shared_ptr<const RobotNavigationObstacleConfig> config)
     : config(config),
       robot_radius_expansion_amount(config->getRobotObstacleInflationFactor()->value() *
-                                    ROBOT_MAX_RADIUS_METERS)
+                                    ROBOT_MAX_RADIUS_METERS),
+      cached_field(std::nullopt),
+      cached_enemy_team(std::nullopt),
+      cached_ball_position(std::nullopt),
+      cached_robot_radius_expansion_amount(robot_radius_expansion_amount),
+      cached_motion_constraint_obstacles(),
+      cached_motion_constraints_obstacles()
 {
     config->getRobotObstacleInflationFactor()->registerCallbackFunction(
         [&](double new_value) {
@@ -14,6 +20,23 @@ RobotNavigationObstacleFactory::RobotNavigationObstacleFactory(
 
 std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromMotionConstraint(
     const MotionConstraint &motion_constraint, const World &world) const
+{
+    invalidateOutdatedObstacles(world);
+
+    auto iter = cached_motion_constraint_obstacles.find(motion_constraint);
+    if (iter == cached_motion_constraint_obstacles.end())
+    {
+        iter = cached_motion_constraint_obstacles
+                   .emplace(motion_constraint,
+                            createFromMotionConstraintUncached(motion_constraint, world))
+                   .first;
+    }
+    return iter->second;
+}
+
+std::vector<ObstaclePtr>
+RobotNavigationObstacleFactory::createFromMotionConstraintUncached(
+    const MotionConstraint &motion_constraint, const World &world) const
 {
     std::vector<ObstaclePtr> obstacles;
 
@@ -70,16 +93,73 @@ std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromMotionConstra
 std::vector<ObstaclePtr> RobotNavigationObstacleFactory::createFromMotionConstraints(
     const std::set<MotionConstraint> &motion_constraints, const World &world) const
 {
+    invalidateOutdatedObstacles(world);
+
+    auto iter = cached_motion_constraints_obstacles.find(motion_constraints);
+    if (iter != cached_motion_constraints_obstacles.end())
+    {
+        return iter->second;
+    }
+
     std::vector<ObstaclePtr> obstacles;
     for (auto motion_constraint : motion_constraints)
     {
-        auto new_obstacles = createFromMotionConstraint(motion_constraint, world);
+        const auto &new_obstacles = createFromMotionConstraint(motion_constraint, world);
         obstacles.insert(obstacles.end(), new_obstacles.begin(), new_obstacles.end());
     }
 
+    cached_motion_constraints_obstacles.emplace(motion_constraints, obstacles);
     return obstacles;
 }
 
+void RobotNavigationObstacleFactory::invalidateOutdatedObstacles(const World &world) const
+{
+    const bool field_changed =
+        !cached_field || cached_field.value() != world.field() ||
+        cached_robot_radius_expansion_amount != robot_radius_expansion_amount;
+    const bool enemy_team_changed =
+        !cached_enemy_team || cached_enemy_team.value() != world.enemyTeam();
+    const bool ball_moved =
+        !cached_ball_position || cached_ball_position.value() != world.ball().position();
+
+    // Removes the cached obstacles of the given motion constraint, including from the
+    // sets of motion constraints that contain it
+    auto invalidate_motion_constraint = [this](MotionConstraint motion_constraint) {
+        cached_motion_constraint_obstacles.erase(motion_constraint);
+        for (auto iter = cached_motion_constraints_obstacles.begin();
+             iter != cached_motion_constraints_obstacles.end();)
+        {
+            if (iter->first.count(motion_constraint) > 0)
+            {
+                iter = cached_motion_constraints_obstacles.erase(iter);
+            }
+            else
+            {
+                iter++;
+            }
+        }
+    };
+
+    if (field_changed)
+    {
+        // Every obstacle depends on the robot radius expansion amount
+        cached_motion_constraint_obstacles.clear();
+        cached_motion_constraints_obstacles.clear();
+        cached_field                         = world.field();
+        cached_robot_radius_expansion_amount = robot_radius_expansion_amount;
+    }
+    if (enemy_team_changed)
+    {
+        invalidate_motion_constraint(MotionConstraint::ENEMY_ROBOTS_COLLISION);
+        cached_enemy_team = world.enemyTeam();
+    }
+    if (ball_moved)
+    {
+        invalidate_motion_constraint(MotionConstraint::HALF_METER_AROUND_BALL);
+        cached_ball_position = world.ball().position();
+    }
+}
+
 ObstaclePtr RobotNavigationObstacleFactory::createFromRobot(const Robot &robot) const
 {
     // radius of a hexagonal approximation of a robot
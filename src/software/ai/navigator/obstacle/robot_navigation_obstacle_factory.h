@@ -1,5 +1,9 @@
 #pragma once
 
+#include <map>
+#include <optional>
+#include <set>
+
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/motion_constraint/motion_constraint.h"
 #include "software/ai/navigator/obstacle/obstacle.h"
@@ -11,6 +15,16 @@
  * The RobotNavigationObstacleFactory creates obstacles for navigation with a robot
  * NOTE: All obstacles created include at least an additional robot radius margin on all
  * sides of the obstacle
+ *
+ * Obstacles created from motion constraints are cached, since most robots share the same
+ * motion constraints each tick. Obstacles derived from the field are kept until the
+ * field changes, obstacles derived from the enemy team and the ball are kept until they
+ * move, and the obstacles for each set of motion constraints are kept until any of the
+ * obstacles they are made of change. The returned obstacles are shared between calls,
+ * so they must not be modified.
+ *
+ * NOTE: Because of the cache, a RobotNavigationObstacleFactory must not be used by
+ * multiple threads at once.
  */
 class RobotNavigationObstacleFactory
 {
@@ -105,6 +119,37 @@ class RobotNavigationObstacleFactory
     std::shared_ptr<const RobotNavigationObstacleConfig> config;
     double robot_radius_expansion_amount;
 
+    /**
+     * Create obstacles for the given motion constraint without using the cache
+     *
+     * @param motion_constraint The motion constraint to create obstacles for
+     * @param world World we're enforcing motion constraints in
+     *
+     * @return Obstacles representing the given motion constraint
+     */
+    std::vector<ObstaclePtr> createFromMotionConstraintUncached(
+        const MotionConstraint &motion_constraint, const World &world) const;
+
+    /**
+     * Removes any cached obstacles that are out of date for the given world
+     *
+     * @param world The world obstacles are about to be created in
+     */
+    void invalidateOutdatedObstacles(const World &world) const;
+
+    // What the cached obstacles were created from. The cached obstacles are only valid
+    // while these match the world and config they are requested for.
+    mutable std::optional<Field> cached_field;
+    mutable std::optional<Team> cached_enemy_team;
+    mutable std::optional<Point> cached_ball_position;
+    mutable double cached_robot_radius_expansion_amount;
+
+    // The obstacles for each motion constraint, and for each set of motion constraints
+    mutable std::map<MotionConstraint, std::vector<ObstaclePtr>>
+        cached_motion_constraint_obstacles;
+    mutable std::map<std::set<MotionConstraint>, std::vector<ObstaclePtr>>
+        cached_motion_constraints_obstacles;
+
     /**
      * Returns an obstacle for the field_rectangle expanded on all sides to account for
      * the size of the robot. If a side of the field_rectangle lies along a field line,
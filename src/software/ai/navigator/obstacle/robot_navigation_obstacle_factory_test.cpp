@@ -390,3 +390,118 @@ TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest, enemy_half)
         ADD_FAILURE() << "Polygon Obstacle was not created";
     }
 }
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       obstacles_are_reused_for_unchanged_world)
+{
+    std::set<MotionConstraint> motion_constraints = {
+        MotionConstraint::ENEMY_ROBOTS_COLLISION, MotionConstraint::CENTER_CIRCLE,
+        MotionConstraint::HALF_METER_AROUND_BALL,
+        MotionConstraint::FRIENDLY_DEFENSE_AREA};
+    auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraints(
+        motion_constraints, world);
+    auto reused_obstacles = robot_navigation_obstacle_factory.createFromMotionConstraints(
+        motion_constraints, World(field, ball, friendly_team, enemy_team));
+
+    EXPECT_EQ(obstacles, reused_obstacles);
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       sets_of_motion_constraints_share_obstacles)
+{
+    auto centre_circle_obstacles =
+        robot_navigation_obstacle_factory.createFromMotionConstraint(
+            MotionConstraint::CENTER_CIRCLE, world);
+    auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraints(
+        {MotionConstraint::CENTER_CIRCLE, MotionConstraint::ENEMY_ROBOTS_COLLISION},
+        world);
+
+    ASSERT_EQ(1, centre_circle_obstacles.size());
+    ASSERT_EQ(3, obstacles.size());
+    // The enemy robot obstacles are created first
+    EXPECT_EQ(centre_circle_obstacles[0], obstacles[2]);
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       enemy_robot_obstacles_are_recreated_when_enemy_team_moves)
+{
+    std::set<MotionConstraint> motion_constraints = {
+        MotionConstraint::ENEMY_ROBOTS_COLLISION, MotionConstraint::CENTER_CIRCLE};
+    auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraints(
+        motion_constraints, world);
+
+    Robot moved_enemy_robot = Robot(0, Point(1.5, -2.5), Vector(), Angle::zero(),
+                                    AngularVelocity::zero(), current_time);
+    enemy_team.updateRobots({moved_enemy_robot, *enemy_team.getRobotById(1)});
+    world              = World(field, ball, friendly_team, enemy_team);
+    auto new_obstacles = robot_navigation_obstacle_factory.createFromMotionConstraints(
+        motion_constraints, world);
+
+    // The centre circle is created after the enemy robot obstacles and does not depend
+    // on the enemy team
+    ASSERT_EQ(3, obstacles.size());
+    ASSERT_EQ(3, new_obstacles.size());
+    EXPECT_EQ(obstacles[2], new_obstacles[2]);
+    try
+    {
+        Circle expected({1.5, -2.5}, 0.207);
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*new_obstacles[0]);
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(expected, circle_obstacle.getGeom(),
+                                                   METERS_PER_MILLIMETER));
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "Circle Obstacle was not created for the moved enemy robot";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       ball_obstacle_is_recreated_when_ball_moves)
+{
+    auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraint(
+        MotionConstraint::HALF_METER_AROUND_BALL, world);
+
+    ball               = Ball(Point(-1, 0.5), Vector(), current_time);
+    world              = World(field, ball, friendly_team, enemy_team);
+    auto new_obstacles = robot_navigation_obstacle_factory.createFromMotionConstraint(
+        MotionConstraint::HALF_METER_AROUND_BALL, world);
+
+    ASSERT_EQ(1, new_obstacles.size());
+    EXPECT_NE(obstacles[0], new_obstacles[0]);
+    try
+    {
+        Circle expected({-1, 0.5}, 0.617);
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*new_obstacles[0]);
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(expected, circle_obstacle.getGeom(),
+                                                   METERS_PER_MILLIMETER));
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "Circle Obstacle was not created for the moved ball";
+    }
+}
+
+TEST_F(RobotNavigationObstacleFactoryMotionConstraintTest,
+       obstacles_are_recreated_when_inflation_factor_changes)
+{
+    auto obstacles = robot_navigation_obstacle_factory.createFromMotionConstraint(
+        MotionConstraint::CENTER_CIRCLE, world);
+
+    robot_navigation_obstacle_config->getMutableRobotObstacleInflationFactor()->setValue(
+        2.0);
+    auto new_obstacles = robot_navigation_obstacle_factory.createFromMotionConstraint(
+        MotionConstraint::CENTER_CIRCLE, world);
+
+    ASSERT_EQ(1, new_obstacles.size());
+    try
+    {
+        Circle expected({0, 0}, 0.5 + 2.0 * ROBOT_MAX_RADIUS_METERS);
+        auto circle_obstacle = dynamic_cast<GeomObstacle<Circle>&>(*new_obstacles[0]);
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(expected, circle_obstacle.getGeom(),
+                                                   METERS_PER_MILLIMETER));
+    }
+    catch (std::bad_cast&)
+    {
+        ADD_FAILURE() << "Circle Obstacle was not created";
+    }
+}
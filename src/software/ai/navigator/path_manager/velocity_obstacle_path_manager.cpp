@@ -4,7 +4,9 @@ VelocityObstaclePathManager::VelocityObstaclePathManager(
     std::unique_ptr<PathPlanner> path_planner,
     RobotNavigationObstacleFactory robot_navigation_obstacle_factory)
     : path_planner(std::move(path_planner)),
-      robot_navigation_obstacle_factory(std::move(robot_navigation_obstacle_factory))
+      robot_navigation_obstacle_factory(std::move(robot_navigation_obstacle_factory)),
+      path_planning_obstacles(),
+      path_obstacles()
 {
 }
 
@@ -23,14 +25,14 @@ const std::map<RobotId, std::optional<Path>> VelocityObstaclePathManager::getMan
     for (auto const &current_objective : objectives)
     {
         // find path with relevant obstacles
-        std::vector<ObstaclePtr> path_obstacles =
-            getObstaclesAroundStartOfOtherObjectives(objectives, current_objective);
-        path_obstacles.insert(path_obstacles.end(), current_velocity_obstacles.begin(),
-                              current_velocity_obstacles.end());
-        path_obstacles.insert(path_obstacles.end(), current_objective.obstacles.begin(),
-                              current_objective.obstacles.end());
+        path_obstacles.clear();
+        path_obstacles.add(
+            getObstaclesAroundStartOfOtherObjectives(objectives, current_objective));
+        path_obstacles.add(current_velocity_obstacles);
+        path_obstacles.add(current_objective.obstacles);
         path_planning_obstacles.insert(path_planning_obstacles.end(),
-                                       path_obstacles.begin(), path_obstacles.end());
+                                       path_obstacles.getObstacles().begin(),
+                                       path_obstacles.getObstacles().end());
         auto path = path_planner->findPath(current_objective.start, current_objective.end,
                                            navigable_area, path_obstacles);
 
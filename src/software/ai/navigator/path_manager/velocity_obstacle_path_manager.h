@@ -1,6 +1,7 @@
 #pragma once
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
 #include "software/ai/navigator/obstacle/robot_navigation_obstacle_factory.h"
 #include "software/ai/navigator/path_manager/path_manager.h"
 
@@ -42,4 +43,7 @@ class VelocityObstaclePathManager : public PathManager
     std::unique_ptr<PathPlanner> path_planner;
     RobotNavigationObstacleFactory robot_navigation_obstacle_factory;
     std::vector<ObstaclePtr> path_planning_obstacles;
+    // The obstacles of the path currently being planned. This is kept between paths so
+    // that its storage is reused.
+    ObstacleSet path_obstacles;
 };
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/obstacle_set.h"
 #include "software/geom/linear_spline2d.h"
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
@@ -36,5 +37,27 @@ class PathPlanner
                                          const Rectangle &navigable_area,
                                          const std::vector<ObstaclePtr> &obstacles) = 0;
 
+    /**
+     * Returns a path between start and destination that avoids the given set of
+     * obstacles. Path planners that test many points and segments against the obstacles
+     * should override this, since an ObstacleSet tests them much faster than the
+     * obstacles individually. By default, this plans a path around the obstacles in the
+     * set individually.
+     *
+     * @param start start point
+     * @param destination destination point
+     * @param navigable_area Rectangle representing the navigable area
+     * @param obstacles obstacles to avoid
+     *
+     * @return a path between start and destination
+     *     * no path is represented by std::nullopt
+     */
+    virtual std::optional<Path> findPath(const Point &start, const Point &destination,
+                                         const Rectangle &navigable_area,
+                                         const ObstacleSet &obstacles)
+    {
+        return findPath(start, destination, navigable_area, obstacles.getObstacles());
+    }
+
     virtual ~PathPlanner() = default;
 };
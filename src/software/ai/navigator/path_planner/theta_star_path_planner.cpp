@@ -7,7 +7,9 @@
 #include "software/logger/logger.h"
 
 ThetaStarPathPlanner::ThetaStarPathPlanner()
-    : num_grid_rows(0),
+    : obstacles(nullptr),
+      obstacle_set(),
+      num_grid_rows(0),
       num_grid_cols(0),
       max_navigable_x_coord(0),
       max_navigable_y_coord(0)
@@ -27,17 +29,7 @@ bool ThetaStarPathPlanner::isUnblocked(const Coordinate &coord)
     auto unblocked_grid_it = unblocked_grid.find(coord);
     if (unblocked_grid_it == unblocked_grid.end())
     {
-        bool blocked = false;
-
-        Point p = convertCoordToPoint(coord);
-        for (auto &obstacle : obstacles)
-        {
-            if (obstacle->contains(p))
-            {
-                blocked = true;
-                break;
-            }
-        }
+        bool blocked = obstacles->contains(convertCoordToPoint(coord));
 
         // We use the opposite convention to indicate blocked or not
         unblocked_grid[coord] = !blocked;
@@ -63,16 +55,7 @@ bool ThetaStarPathPlanner::lineOfSight(const Coordinate &coord1, const Coordinat
     if (line_of_sight_cache_it == line_of_sight_cache.end())
     {
         Segment seg(convertCoordToPoint(coord1), convertCoordToPoint(coord2));
-        bool has_line_of_sight = true;
-
-        for (const auto &obstacle : obstacles)
-        {
-            if (obstacle->intersects(seg))
-            {
-                has_line_of_sight = false;
-                break;
-            }
-        }
+        bool has_line_of_sight = !obstacles->intersects(seg);
 
         // We use the opposite convention to indicate blocked or not
         line_of_sight_cache[coord_pair] = has_line_of_sight;
@@ -167,6 +150,15 @@ bool ThetaStarPathPlanner::updateVertex(const Coordinate &current, const Coordin
 std::optional<Path> ThetaStarPathPlanner::findPath(
     const Point &start, const Point &end, const Rectangle &navigable_area,
     const std::vector<ObstaclePtr> &obstacles)
+{
+    obstacle_set.clear();
+    obstacle_set.add(obstacles);
+    return findPath(start, end, navigable_area, obstacle_set);
+}
+
+std::optional<Path> ThetaStarPathPlanner::findPath(const Point &start, const Point &end,
+                                                   const Rectangle &navigable_area,
+                                                   const ObstacleSet &obstacles)
 {
     bool navigable_area_contains_start =
         (start.x() >= navigable_area.xMin()) && (start.x() <= navigable_area.xMax()) &&
@@ -475,15 +467,7 @@ bool ThetaStarPathPlanner::isPointNavigableAndFreeOfObstacles(const Point &p)
         return false;
     }
 
-    for (auto &obstacle : obstacles)
-    {
-        if (obstacle->contains(p))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return !obstacles->contains(p);
 }
 
 bool ThetaStarPathPlanner::isPointNavigable(const Point &p) const
@@ -514,10 +498,10 @@ ThetaStarPathPlanner::Coordinate ThetaStarPathPlanner::convertPointToCoord(
 }
 
 void ThetaStarPathPlanner::resetAndInitializeMemberVariables(
-    const Rectangle &navigable_area, const std::vector<ObstaclePtr> &obstacles)
+    const Rectangle &navigable_area, const ObstacleSet &obstacles)
 {
     // Initialize member variables
-    this->obstacles = obstacles;
+    this->obstacles = &obstacles;
     centre          = navigable_area.centre();
     max_navigable_x_coord =
         std::max(navigable_area.xLength() / 2.0 - ROBOT_MAX_RADIUS_METERS, 0.0);
@@ -40,6 +40,21 @@ class ThetaStarPathPlanner : public PathPlanner
                                  const Rectangle &navigable_area,
                                  const std::vector<ObstaclePtr> &obstacles) override;
 
+    /**
+     * Returns a path that is an optimized path between start and end.
+     *
+     * @param start start point
+     * @param end end point
+     * @param navigable_area Rectangle representing the navigable area
+     * @param obstacles obstacles to avoid
+     *
+     * @return a vector of points that is the optimal path avoiding obstacles
+     *         if no valid path then return empty vector
+     */
+    std::optional<Path> findPath(const Point &start, const Point &end,
+                                 const Rectangle &navigable_area,
+                                 const ObstacleSet &obstacles) override;
+
    private:
     class Coordinate
     {
@@ -399,7 +414,7 @@ class ThetaStarPathPlanner : public PathPlanner
      * @param obstacles obstacles to avoid
      */
     void resetAndInitializeMemberVariables(const Rectangle &navigable_area,
-                                           const std::vector<ObstaclePtr> &obstacles);
+                                           const ObstacleSet &obstacles);
 
     // if close to end then return direct path to end point
     static constexpr double CLOSE_TO_END_THRESHOLD = 0.01;  // in metres
@@ -411,7 +426,11 @@ class ThetaStarPathPlanner : public PathPlanner
     const double SIZE_OF_GRID_CELL_IN_METERS =
         ROBOT_MAX_RADIUS_METERS;  // this is the n in the O(n^2) algorithm :p
 
-    std::vector<ObstaclePtr> obstacles;
+    // The obstacles of the path being planned, which are only valid while planning
+    const ObstacleSet *obstacles;
+    // The set of obstacles used when the obstacles are given as a vector. This is kept
+    // between paths so that its storage is reused.
+    ObstacleSet obstacle_set;
     Point centre;
     unsigned int num_grid_rows;
     unsigned int num_grid_cols;
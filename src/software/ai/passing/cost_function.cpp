@@ -1,11 +1,17 @@
 #include "software/ai/passing/cost_function.h"
 
+#include <array>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <numeric>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/../shared/constants.h"
 #include "software/ai/evaluation/calc_best_shot.h"
 #include "software/ai/evaluation/pass.h"
+#include "software/ai/passing/static_position_quality_map.h"
 #include "software/geom/algorithms/acute_angle.h"
 #include "software/geom/algorithms/closest_point.h"
 #include "software/geom/algorithms/contains.h"
@@ -14,22 +20,28 @@
 double ratePass(const World& world, const Pass& pass, const Rectangle& zone,
                 std::shared_ptr<const PassingConfig> passing_config)
 {
+    // The snapshot is read once and passed down, so all the ratings use the same
+    // parameters
+    std::shared_ptr<const PassingConfig::Snapshot> passing_params =
+        passing_config->getSnapshot();
+
     double static_pass_quality =
-        getStaticPositionQuality(world.field(), pass.receiverPoint(), passing_config);
+        lookupStaticPositionQuality(world.field(), pass.receiverPoint(), *passing_params);
 
     double friendly_pass_rating =
         ratePassFriendlyCapability(world.friendlyTeam(), pass, passing_config);
 
-    double enemy_pass_rating = ratePassEnemyRisk(world.enemyTeam(), pass, passing_config);
+    double enemy_pass_rating =
+        ratePassEnemyRisk(world.enemyTeam(), pass, *passing_params);
 
     double shoot_pass_rating =
-        ratePassShootScore(world.field(), world.enemyTeam(), pass, passing_config);
+        ratePassShootScore(world.field(), world.enemyTeam(), pass, *passing_params);
 
     double in_region_quality = rectangleSigmoid(zone, pass.receiverPoint(), 0.2);
 
     // Place strict limits on the ball speed
-    double min_pass_speed     = passing_config->getMinPassSpeedMPerS()->value();
-    double max_pass_speed     = passing_config->getMaxPassSpeedMPerS()->value();
+    double min_pass_speed     = passing_params->min_pass_speed_m_per_s;
+    double max_pass_speed     = passing_params->max_pass_speed_m_per_s;
     double pass_speed_quality = sigmoid(pass.speed(), min_pass_speed, 0.2) *
                                 (1 - sigmoid(pass.speed(), max_pass_speed, 0.2));
 
@@ -41,35 +53,34 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
                 const Point& ball_position,
                 std::shared_ptr<const PassingConfig> passing_config)
 {
+    std::shared_ptr<const PassingConfig::Snapshot> passing_params =
+        passing_config->getSnapshot();
+
     // TODO (#2021) improve and implement tests
     // Zones with their centers in bad positions are not good
     double static_pass_quality =
-        getStaticPositionQuality(field, zone.centre(), passing_config);
+        lookupStaticPositionQuality(field, zone.centre(), *passing_params);
 
     // Rate zones that are up the field higher to encourage progress up the field
     double pass_up_field_rating = zone.centre().x() / field.xLength();
 
+    double max_pass_speed = passing_params->max_pass_speed_m_per_s;
+
     double enemy_risk_rating =
         (ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.negXNegYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           passing_config) +
-         ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.negXPosYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           passing_config) +
+                           Pass(ball_position, zone.negXNegYCorner(), max_pass_speed),
+                           *passing_params) +
          ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.posXNegYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           passing_config) +
+                           Pass(ball_position, zone.negXPosYCorner(), max_pass_speed),
+                           *passing_params) +
          ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.posXPosYCorner(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           passing_config) +
+                           Pass(ball_position, zone.posXNegYCorner(), max_pass_speed),
+                           *passing_params) +
          ratePassEnemyRisk(enemy_team,
-                           Pass(ball_position, zone.centre(),
-                                passing_config->getMaxPassSpeedMPerS()->value()),
-                           passing_config)) /
+                           Pass(ball_position, zone.posXPosYCorner(), max_pass_speed),
+                           *passing_params) +
+         ratePassEnemyRisk(enemy_team, Pass(ball_position, zone.centre(), max_pass_speed),
+                           *passing_params)) /
         5.0;
 
     return pass_up_field_rating * static_pass_quality * enemy_risk_rating;
@@ -77,15 +88,22 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           std::shared_ptr<const PassingConfig> passing_config)
+{
+    return ratePassShootScore(field, enemy_team, pass, *passing_config->getSnapshot());
+}
+
+double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
+                          const PassingConfig::Snapshot& passing_params)
 {
     double ideal_max_rotation_to_shoot_degrees =
-        passing_config->getIdealMaxRotationToShootDegrees()->value();
+        passing_params.ideal_max_rotation_to_shoot_degrees;
 
     // Figure out the range of angles for which we have an open shot to the goal after
     // receiving the pass
-    auto shot_opt =
-        calcBestShotOnGoal(Segment(field.enemyGoalpostNeg(), field.enemyGoalpostPos()),
-                           pass.receiverPoint(), enemy_team.getAllRobots());
+    const TeamRobots& enemy_robots = enemy_team.getAllRobots();
+    auto shot_opt                  = calcBestShotOnGoal(
+        Segment(field.enemyGoalpostNeg(), field.enemyGoalpostPos()), pass.receiverPoint(),
+        std::vector<Robot>(enemy_robots.begin(), enemy_robots.end()));
 
     Angle open_angle_to_goal = Angle::zero();
     Point shot_target        = field.enemyGoalCenter();
@@ -132,8 +150,13 @@ double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          std::shared_ptr<const PassingConfig> passing_config)
 {
-    double enemy_proximity_importance =
-        passing_config->getEnemyProximityImportance()->value();
+    return ratePassEnemyRisk(enemy_team, pass, *passing_config->getSnapshot());
+}
+
+double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
+                         const PassingConfig::Snapshot& passing_params)
+{
+    double enemy_proximity_importance = passing_params.enemy_proximity_importance;
 
     // Calculate a risk score based on the distance of the enemy robots from the receive
     // point, based on an exponential function of the distance of each robot from the
@@ -151,7 +174,7 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
         enemy_receiver_proximity_risk = 0;
     }
 
-    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_config);
+    double intercept_risk = calculateInterceptRisk(enemy_team, pass, passing_params);
 
     // We want to rate a pass more highly if it is lower risk, so subtract from 1
     return 1 - std::max(intercept_risk, enemy_receiver_proximity_risk);
@@ -159,9 +182,15 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
 
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config)
+{
+    return calculateInterceptRisk(enemy_team, pass, *passing_config->getSnapshot());
+}
+
+double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
+                              const PassingConfig::Snapshot& passing_params)
 {
     // Return the highest risk for all the enemy robots, if there are any
-    const std::vector<Robot>& enemy_robots = enemy_team.getAllRobots();
+    const TeamRobots& enemy_robots = enemy_team.getAllRobots();
     if (enemy_robots.empty())
     {
         return 0;
@@ -169,12 +198,18 @@ double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
     std::vector<double> enemy_intercept_risks(enemy_robots.size());
     std::transform(
         enemy_robots.begin(), enemy_robots.end(), enemy_intercept_risks.begin(),
-        [&](Robot robot) { return calculateInterceptRisk(robot, pass, passing_config); });
+        [&](Robot robot) { return calculateInterceptRisk(robot, pass, passing_params); });
     return *std::max_element(enemy_intercept_risks.begin(), enemy_intercept_risks.end());
 }
 
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config)
+{
+    return calculateInterceptRisk(enemy_robot, pass, *passing_config->getSnapshot());
+}
+
+double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
+                              const PassingConfig::Snapshot& passing_params)
 {
     // We estimate the intercept by the risk that the robot will get to the closest
     // point on the pass before the ball, and by the risk that the robot will get to
@@ -211,7 +246,7 @@ double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
     Duration ball_time_to_pass_receive_position = pass.estimatePassDuration();
 
     Duration enemy_reaction_time =
-        Duration::fromSeconds(passing_config->getEnemyReactionTime()->value());
+        Duration::fromSeconds(passing_params.enemy_reaction_time);
 
     double robot_ball_time_diff_at_closest_pass_point =
         ((enemy_robot_time_to_closest_pass_point + enemy_reaction_time) -
@@ -298,16 +333,22 @@ double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
 
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config)
+{
+    // Read all the parameters from the same snapshot so they are consistent
+    return getStaticPositionQuality(field, position, *passing_config->getSnapshot());
+}
+
+double getStaticPositionQuality(const Field& field, const Point& position,
+                                const PassingConfig::Snapshot& passing_params)
 {
     // This constant is used to determine how steep the sigmoid slopes below are
     static const double sig_width = 0.1;
 
     // The offset from the sides of the field for the center of the sigmoid functions
-    double x_offset = passing_config->getStaticFieldPositionQualityXOffset()->value();
-    double y_offset = passing_config->getStaticFieldPositionQualityYOffset()->value();
+    double x_offset = passing_params.static_field_position_quality_x_offset;
+    double y_offset = passing_params.static_field_position_quality_y_offset;
     double friendly_goal_weight =
-        passing_config->getStaticFieldPositionQualityFriendlyGoalDistanceWeight()
-            ->value();
+        passing_params.static_field_position_quality_friendly_goal_distance_weight;
 
     // Make a slightly smaller field, and positive weight values in this reduced field
     double half_field_length = field.xLength() / 2;
@@ -332,3 +373,99 @@ double getStaticPositionQuality(const Field& field, const Point& position,
 
     return on_field_quality * near_friendly_goal_quality * in_enemy_defense_area_quality;
 }
+
+// The number of static position quality maps that are kept. Several AIs with different
+// fields or passing configs (ie. in a PlayEvaluator) can then run on the same thread
+// without precomputing their maps again every time they alternate.
+static constexpr std::size_t MAX_NUM_STATIC_POSITION_QUALITY_MAPS = 4;
+
+std::shared_ptr<const StaticPositionQualityMap> getStaticPositionQualityMap(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    return getStaticPositionQualityMap(field, *passing_config->getSnapshot());
+}
+
+std::shared_ptr<const StaticPositionQualityMap> getStaticPositionQualityMap(
+    const Field& field, const PassingConfig::Snapshot& passing_params)
+{
+    StaticPositionQualityMapKey key(field, passing_params);
+
+    // Each thread keeps the maps it has recently used, so that the shared maps only
+    // have to be locked when the thread needs a map it has not used recently. Maps are
+    // replaced in the order they were added, so looking one up never changes the cache.
+    thread_local std::array<std::shared_ptr<const StaticPositionQualityMap>,
+                            MAX_NUM_STATIC_POSITION_QUALITY_MAPS>
+        thread_maps;
+    thread_local std::size_t next_thread_map_index = 0;
+    for (const auto& thread_map : thread_maps)
+    {
+        if (thread_map && thread_map->getKey() == key)
+        {
+            return thread_map;
+        }
+    }
+
+    // The maps that are ready or still being precomputed, oldest first
+    static std::mutex shared_maps_mutex;
+    static std::deque<
+        std::pair<StaticPositionQualityMapKey,
+                  std::shared_future<std::shared_ptr<const StaticPositionQualityMap>>>>
+        shared_maps;
+    std::shared_future<std::shared_ptr<const StaticPositionQualityMap>> map_future;
+    {
+        std::scoped_lock lock(shared_maps_mutex);
+        auto shared_map_iter = std::find_if(
+            shared_maps.begin(), shared_maps.end(),
+            [&key](const auto& shared_map) { return shared_map.first == key; });
+        if (shared_map_iter != shared_maps.end())
+        {
+            map_future = shared_map_iter->second;
+        }
+        else
+        {
+            // Precomputing a map takes far longer than an AI tick, so it is done in the
+            // background while the static position quality is calculated directly
+            map_future = std::async(std::launch::async, [field, passing_params]() {
+                             return std::make_shared<const StaticPositionQualityMap>(
+                                 field, passing_params);
+                         }).share();
+            shared_maps.emplace_back(key, map_future);
+
+            // Only evict maps that are ready, since the last future of a map that is
+            // still being precomputed would block until it is done
+            auto ready_map_iter = std::find_if(
+                shared_maps.begin(), shared_maps.end(), [](const auto& shared_map) {
+                    return shared_map.second.wait_for(std::chrono::seconds(0)) ==
+                           std::future_status::ready;
+                });
+            if (shared_maps.size() > MAX_NUM_STATIC_POSITION_QUALITY_MAPS &&
+                ready_map_iter != shared_maps.end())
+            {
+                shared_maps.erase(ready_map_iter);
+            }
+        }
+    }
+
+    if (map_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<const StaticPositionQualityMap> map = map_future.get();
+    thread_maps[next_thread_map_index]                  = map;
+    next_thread_map_index =
+        (next_thread_map_index + 1) % MAX_NUM_STATIC_POSITION_QUALITY_MAPS;
+    return map;
+}
+
+double lookupStaticPositionQuality(const Field& field, const Point& position,
+                                   const PassingConfig::Snapshot& passing_params)
+{
+    std::shared_ptr<const StaticPositionQualityMap> map =
+        getStaticPositionQualityMap(field, passing_params);
+    if (map)
+    {
+        return map->getQuality(position);
+    }
+    return getStaticPositionQuality(field, position, passing_params);
+}
@@ -10,6 +10,8 @@
 #include "software/world/team.h"
 #include "software/world/world.h"
 
+class StaticPositionQualityMap;
+
 /**
  * Calculate the quality of a given pass
  *
@@ -55,6 +57,21 @@ double rateZone(const Field& field, const Team& enemy_team, const Rectangle& zon
 double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
                           std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Rate pass based on the probability of scoring once we receive the pass
+ *
+ * @param field The field we are playing on
+ * @param enemy_team The enemy team
+ * @param pass The pass to rate
+ * @param passing_params The snapshot of the passing config used for tuning
+ *
+ * @return A value in [0,1], with 0 indicating that it's impossible to score off of
+ *         the pass, and 1 indicating that it is guaranteed to be able to score off of
+ *         the pass
+ */
+double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass& pass,
+                          const PassingConfig::Snapshot& passing_params);
+
 /**
  * Calculates the risk of an enemy robot interfering with a given pass
  *
@@ -69,6 +86,20 @@ double ratePassShootScore(const Field& field, const Team& enemy_team, const Pass
 double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
                          std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculates the risk of an enemy robot interfering with a given pass
+ *
+ * @param enemy_team The team of enemy robots
+ * @param pass The pass to rate
+ * @param passing_params The snapshot of the passing config used for tuning
+ * @return A value in [0,1] indicating the quality of the pass based on the risk
+ *         that an enemy interfere with it, with 1 indicating the pass is guaranteed
+ *         to run without interference, and 0 indicating that the pass will certainly
+ *         be interfered with (and so is very poor)
+ */
+double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
+                         const PassingConfig::Snapshot& passing_params);
+
 /**
  * Calculates the likelihood that the given pass will be intercepted
  *
@@ -83,6 +114,20 @@ double ratePassEnemyRisk(const Team& enemy_team, const Pass& pass,
 double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculates the likelihood that the given pass will be intercepted
+ *
+ * @param enemy_team The team of robots that we're worried about intercepting our pass
+ * @param pass The pass we want to get the intercept probability for
+ * @param passing_params The snapshot of the passing config used for tuning
+ * @return A value in [0,1] indicating the probability that the given pass will be
+ *         intercepted by a robot on the given team, with 1 indicating the pass is
+ *         guaranteed to be intercepted, and 0 indicating it's impossible for the
+ *         pass to be intercepted
+ */
+double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
+                              const PassingConfig::Snapshot& passing_params);
+
 /**
  * Calculates the likelihood that the given pass will be intercepted by a given robot
  *
@@ -97,6 +142,20 @@ double calculateInterceptRisk(const Team& enemy_team, const Pass& pass,
 double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
                               std::shared_ptr<const PassingConfig> passing_config);
 
+/**
+ * Calculates the likelihood that the given pass will be intercepted by a given robot
+ *
+ * @param enemy_robot The robot that might intercept our pass
+ * @param pass The pass we want to get the intercept probability for
+ * @param passing_params The snapshot of the passing config used for tuning
+ * @return A value in [0,1] indicating the probability that the given pass will be
+ *         intercepted by the given robot, with 1 indicating the pass is guaranteed to
+ *         be intercepted, and 0 indicating it's impossible for the pass to be
+ *         intercepted
+ */
+double calculateInterceptRisk(const Robot& enemy_robot, const Pass& pass,
+                              const PassingConfig::Snapshot& passing_params);
+
 
 /**
  * Calculate the probability of a friendly robot receiving the given pass
@@ -131,3 +190,61 @@ double ratePassFriendlyCapability(Team friendly_team, const Pass& pass,
  */
 double getStaticPositionQuality(const Field& field, const Point& position,
                                 std::shared_ptr<const PassingConfig> passing_config);
+
+/**
+ * Calculates the static position quality for a given position on a given field
+ *
+ * @param field The field on which to calculate the static position quality
+ * @param position The position on the field at which to calculate the quality
+ * @param passing_params The snapshot of the passing config used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the given point on the given
+ *         field, with a higher value representing a more desirable position
+ */
+double getStaticPositionQuality(const Field& field, const Point& position,
+                                const PassingConfig::Snapshot& passing_params);
+
+/**
+ * Gets the precomputed static position quality for the given field and passing config.
+ *
+ * The map for a field and static position quality parameters is precomputed in the
+ * background the first time they are used, which takes much longer than an AI tick, so
+ * there is no map until it is done. The maps for the last few combinations are kept and
+ * shared between threads, so a map is only precomputed again when it is used after
+ * being evicted.
+ *
+ * @param field The field to get the static position quality on
+ * @param passing_config The passing config used for tuning
+ *
+ * @return the static position quality map for the given field and passing config, or
+ * nullptr if it is still being precomputed
+ */
+std::shared_ptr<const StaticPositionQualityMap> getStaticPositionQualityMap(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config);
+
+/**
+ * Gets the precomputed static position quality for the given field and passing config.
+ *
+ * @param field The field to get the static position quality on
+ * @param passing_params The snapshot of the passing config used for tuning
+ *
+ * @return the static position quality map for the given field and passing config, or
+ * nullptr if it is still being precomputed
+ */
+std::shared_ptr<const StaticPositionQualityMap> getStaticPositionQualityMap(
+    const Field& field, const PassingConfig::Snapshot& passing_params);
+
+/**
+ * Gets the static position quality for a given position on a given field from the
+ * precomputed map (see getStaticPositionQualityMap), or calculates it directly while
+ * the map is still being precomputed
+ *
+ * @param field The field on which to get the static position quality
+ * @param position The position on the field at which to get the quality
+ * @param passing_params The snapshot of the passing config used for tuning
+ *
+ * @return A value in [0,1] representing the quality of the given point on the given
+ *         field, with a higher value representing a more desirable position
+ */
+double lookupStaticPositionQuality(const Field& field, const Point& position,
+                                   const PassingConfig::Snapshot& passing_params);
@@ -62,6 +62,18 @@ class PassGenerator
      */
     PassEvaluation<ZoneEnum> generatePassEvaluation(const World& world);
 
+    /**
+     * Changes the pitch division passes are generated in, such as to a
+     * QuadTreePitchDivision refined for the current state of the game.
+     *
+     * The best passes found so far are kept in the zones of the new pitch division
+     * their receiver points are in, so that they keep being improved on.
+     *
+     * @param pitch_division The pitch division to use when looking for passes
+     */
+    void setPitchDivision(
+        std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division);
+
 
    private:
     // Weights used to normalize the parameters that we pass to GradientDescent
@@ -75,13 +87,36 @@ class PassGenerator
     std::array<double, NUM_PARAMS_TO_OPTIMIZE> optimizer_param_weights = {
         PASS_SPACE_WEIGHT, PASS_SPACE_WEIGHT, PASS_SPEED_WEIGHT};
 
+    // The average number of passes randomly sampled in each zone on each iteration.
+    // Every zone gets at least one sample, and the rest are split between the zones in
+    // proportion to their estimated values. Each sample costs one ratePass call, and
+    // each gradient descent step costs NUM_PARAMS_TO_OPTIMIZE + 1.
+    static constexpr unsigned int NUM_SAMPLES_PER_ZONE = 2;
+    // The estimated value of a zone is this plus the rating of its best pass, so that
+    // zones without any good passes are still explored
+    static constexpr double MIN_ZONE_VALUE = 0.05;
+
     /**
-     * Randomly samples a receive point across every zone and assigns a random
-     * speed to each pass.
+     * Estimates how valuable it is to look for passes in each zone, from the rating of
+     * the best pass found in the zone so far
+     *
+     * @returns the estimated value of each zone, in the order of
+     * pitch_division_->getAllZoneIds()
+     */
+    std::vector<double> estimateZoneValues() const;
+
+    /**
+     * Randomly samples receive points in every zone and assigns a random speed to
+     * each pass, keeping the best pass sampled in each zone.
+     *
+     * @param world The world
+     * @param num_samples The number of passes to sample in each zone, in the order of
+     * pitch_division_->getAllZoneIds()
      *
      * @returns a mapping of the Zone Id to the sampled pass
      */
-    ZonePassMap<ZoneEnum> samplePasses(const World& world);
+    ZonePassMap<ZoneEnum> samplePasses(const World& world,
+                                       const std::vector<unsigned int>& num_samples);
 
     /**
      * Given a map of passes, runs a gradient descent optimizer to find
@@ -89,10 +124,14 @@ class PassGenerator
      *
      * @param The world
      * @param The passes to be optimized mapped to the zone
+     * @param num_steps The number of gradient descent steps to run in each zone, in the
+     * order of pitch_division_->getAllZoneIds()
+     *
      * @returns a mapping of the Zone id to the optimized pass
      */
     ZonePassMap<ZoneEnum> optimizePasses(const World& world,
-                                         const ZonePassMap<ZoneEnum>& initial_passes);
+                                         const ZonePassMap<ZoneEnum>& initial_passes,
+                                         const std::vector<unsigned int>& num_steps);
 
     /**
      * Re-evaluates ratePass on the previous world's passes and keeps the better pass
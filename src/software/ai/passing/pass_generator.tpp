@@ -5,6 +5,9 @@
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/pass_evaluation.h"
 #include "software/ai/passing/pass_generator.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/math/math_functions.h"
+#include "software/util/profiler/profiler.h"
 
 template <class ZoneEnum>
 PassGenerator<ZoneEnum>::PassGenerator(
@@ -21,12 +24,27 @@ template <class ZoneEnum>
 PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
     const World& world)
 {
-    auto generated_passes = samplePasses(world);
-    if (current_best_passes_.empty())
-    {
-        current_best_passes_ = generated_passes;
-    }
-    auto optimized_passes = optimizePasses(world, generated_passes);
+    PROFILE_SCOPE("PassGenerator::generatePassEvaluation");
+
+    // Spend more of the time budget in the zones where the best passes have been found.
+    // The gradient descent steps are split between the zones with the same total as
+    // when every zone got the same number, but every zone still needs one sample to
+    // start from, so NUM_SAMPLES_PER_ZONE - 1 extra samples per zone are rated in total.
+    std::vector<double> zone_values = estimateZoneValues();
+    auto num_zones                  = static_cast<unsigned int>(zone_values.size());
+    auto num_gradient_descent_steps = static_cast<unsigned int>(
+        passing_config_->getNumberOfGradientDescentStepsPerIter()->value());
+    std::vector<unsigned int> num_samples =
+        allocateProportionally(zone_values, NUM_SAMPLES_PER_ZONE * num_zones, 1);
+    std::vector<unsigned int> num_steps =
+        allocateProportionally(zone_values, num_gradient_descent_steps * num_zones,
+                               std::min(num_gradient_descent_steps, 1u));
+
+    auto generated_passes = samplePasses(world, num_samples);
+    // Zones without a best pass yet, such as every zone on the first iteration, start
+    // with the generated pass
+    current_best_passes_.insert(generated_passes.begin(), generated_passes.end());
+    auto optimized_passes = optimizePasses(world, generated_passes, num_steps);
 
     updatePasses(world, optimized_passes);
 
@@ -35,31 +53,88 @@ PassEvaluation<ZoneEnum> PassGenerator<ZoneEnum>::generatePassEvaluation(
 }
 
 template <class ZoneEnum>
-ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
+void PassGenerator<ZoneEnum>::setPitchDivision(
+    std::shared_ptr<const FieldPitchDivision<ZoneEnum>> pitch_division)
+{
+    ZonePassMap<ZoneEnum> best_passes_in_new_zones;
+    for (const auto& [zone_id, pass_with_rating] : current_best_passes_)
+    {
+        const Point& receiver_point               = pass_with_rating.pass.receiverPoint();
+        const std::vector<ZoneEnum>& new_zone_ids = pitch_division->getAllZoneIds();
+        auto new_zone_id_iter                     = std::find_if(
+            new_zone_ids.begin(), new_zone_ids.end(), [&](ZoneEnum new_zone_id) {
+                return contains(pitch_division->getZone(new_zone_id), receiver_point);
+            });
+        if (new_zone_id_iter == new_zone_ids.end())
+        {
+            continue;
+        }
+
+        auto [best_pass_iter, inserted] =
+            best_passes_in_new_zones.emplace(*new_zone_id_iter, pass_with_rating);
+        if (!inserted && best_pass_iter->second.rating < pass_with_rating.rating)
+        {
+            best_pass_iter->second = pass_with_rating;
+        }
+    }
+
+    current_best_passes_ = best_passes_in_new_zones;
+    pitch_division_      = pitch_division;
+}
+
+template <class ZoneEnum>
+std::vector<double> PassGenerator<ZoneEnum>::estimateZoneValues() const
 {
+    std::vector<double> zone_values;
+    for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
+    {
+        auto best_pass_iter = current_best_passes_.find(zone_id);
+        // Zones that have not been searched yet are assumed to be as good as possible
+        double best_rating = best_pass_iter != current_best_passes_.end()
+                                 ? best_pass_iter->second.rating
+                                 : 1.0;
+        zone_values.push_back(MIN_ZONE_VALUE + best_rating);
+    }
+    return zone_values;
+}
+
+template <class ZoneEnum>
+ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(
+    const World& world, const std::vector<unsigned int>& num_samples)
+{
+    PROFILE_SCOPE("PassGenerator::samplePasses");
+
     std::uniform_real_distribution speed_distribution(
         passing_config_->getMinPassSpeedMPerS()->value(),
         passing_config_->getMaxPassSpeedMPerS()->value());
 
     ZonePassMap<ZoneEnum> passes;
 
-    // Randomly sample a pass in each zone
-    for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
+    // Randomly sample passes in each zone
+    const std::vector<ZoneEnum>& zone_ids = pitch_division_->getAllZoneIds();
+    for (std::size_t i = 0; i < zone_ids.size(); i++)
     {
-        auto zone = pitch_division_->getZone(zone_id);
+        ZoneEnum zone_id = zone_ids[i];
+        auto zone        = pitch_division_->getZone(zone_id);
 
         std::uniform_real_distribution x_distribution(zone.xMin(), zone.xMax());
         std::uniform_real_distribution y_distribution(zone.yMin(), zone.yMax());
 
-        auto pass =
-            Pass(world.ball().position(),
-                 Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
-                 speed_distribution(random_num_gen_));
-
-        passes.emplace(
-            zone_id,
-            PassWithRating{pass, ratePass(world, pass, pitch_division_->getZone(zone_id),
-                                          passing_config_)});
+        for (unsigned int sample = 0; sample < num_samples[i]; sample++)
+        {
+            auto pass = Pass(
+                world.ball().position(),
+                Point(x_distribution(random_num_gen_), y_distribution(random_num_gen_)),
+                speed_distribution(random_num_gen_));
+            PassWithRating pass_with_rating{pass,
+                                            ratePass(world, pass, zone, passing_config_)};
+
+            auto [best_pass_iter, inserted] = passes.emplace(zone_id, pass_with_rating);
+            if (!inserted && best_pass_iter->second.rating < pass_with_rating.rating)
+            {
+                best_pass_iter->second = pass_with_rating;
+            }
+        }
     }
 
     return passes;
@@ -67,14 +142,19 @@ ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::samplePasses(const World& world)
 
 template <class ZoneEnum>
 ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::optimizePasses(
-    const World& world, const ZonePassMap<ZoneEnum>& generated_passes)
+    const World& world, const ZonePassMap<ZoneEnum>& generated_passes,
+    const std::vector<unsigned int>& num_steps)
 {
+    PROFILE_SCOPE("PassGenerator::optimizePasses");
+
     // Run gradient descent to optimize the passes to for the requested number
     // of iterations
     ZonePassMap<ZoneEnum> optimized_passes;
 
-    for (ZoneEnum zone_id : pitch_division_->getAllZoneIds())
+    const std::vector<ZoneEnum>& zone_ids = pitch_division_->getAllZoneIds();
+    for (std::size_t i = 0; i < zone_ids.size(); i++)
     {
+        ZoneEnum zone_id = zone_ids[i];
         // The objective function we minimize in gradient descent to improve each pass
         // that we're optimizing
         const auto objective_function =
@@ -87,7 +167,7 @@ ZonePassMap<ZoneEnum> PassGenerator<ZoneEnum>::optimizePasses(
 
         auto pass_array = optimizer_.maximize(
             objective_function, generated_passes.at(zone_id).pass.toPassArray(),
-            passing_config_->getNumberOfGradientDescentStepsPerIter()->value());
+            num_steps[i]);
 
         auto new_pass = Pass::fromPassArray(world.ball().position(), pass_array);
         auto score =
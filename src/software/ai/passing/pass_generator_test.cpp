@@ -6,6 +6,7 @@
 #include "software//world/world.h"
 #include "software/ai/passing/cost_function.h"
 #include "software/ai/passing/eighteen_zone_pitch_division.h"
+#include "software/ai/passing/quad_tree_pitch_division.h"
 #include "software/geom/algorithms/contains.h"
 #include "software/test_util/test_util.h"
 
@@ -216,3 +217,84 @@ TEST_F(PassGeneratorTest, test_passer_point_changes_are_respected)
     EXPECT_GT((converged_pass.receiverPoint() - neg_y_friendly.position()).length(),
               (converged_pass.receiverPoint() - pos_y_friendly.position()).length());
 }
+
+TEST_F(PassGeneratorTest, check_pass_converges_with_quad_tree_pitch_division)
+{
+    // Test that we can converge to a stable pass when the pitch division is refined
+    // around the best zones on every iteration
+
+    world.updateBall(
+        Ball(BallState(Point(2, 2), Vector(0, 0)), Timestamp::fromSeconds(0)));
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots({
+        Robot(3, {1, 0}, {0.5, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto rate_zone = [&](const Rectangle& zone) {
+        return rateZone(world.field(), world.enemyTeam(), zone, world.ball().position(),
+                        passing_config);
+    };
+    PassGenerator<QuadTreeZoneId> quad_tree_pass_generator(
+        std::make_shared<const QuadTreePitchDivision>(world.field(), rate_zone),
+        passing_config);
+
+    for (int i = 0; i < 100; i++)
+    {
+        quad_tree_pass_generator.setPitchDivision(
+            std::make_shared<const QuadTreePitchDivision>(world.field(), rate_zone));
+        quad_tree_pass_generator.generatePassEvaluation(world);
+    }
+
+    auto [best_pass, score] =
+        quad_tree_pass_generator.generatePassEvaluation(world).getBestPassOnField();
+
+    for (int i = 0; i < 7; i++)
+    {
+        quad_tree_pass_generator.setPitchDivision(
+            std::make_shared<const QuadTreePitchDivision>(world.field(), rate_zone));
+        auto [pass, score] =
+            quad_tree_pass_generator.generatePassEvaluation(world).getBestPassOnField();
+
+        EXPECT_LE((best_pass.receiverPoint() - pass.receiverPoint()).length(), 0.7);
+        EXPECT_LE(abs(best_pass.speed() - pass.speed()), 0.7);
+        UNUSED(score);
+    }
+    UNUSED(score);
+}
+
+TEST_F(PassGeneratorTest, test_set_pitch_division_keeps_best_passes)
+{
+    world.updateBall(Ball(BallState({-2, 0}, {0, 0}), Timestamp::fromSeconds(0)));
+    Team friendly_team(Duration::fromSeconds(10));
+    friendly_team.updateRobots({
+        Robot(1, {1.5, 1.5}, {0, 0}, Angle::zero(), AngularVelocity::zero(),
+              Timestamp::fromSeconds(0)),
+    });
+    world.updateFriendlyTeamState(friendly_team);
+
+    auto uniform_pitch_division = std::make_shared<const QuadTreePitchDivision>(
+        world.field(), [](const Rectangle&) { return 1.0; });
+    PassGenerator<QuadTreeZoneId> quad_tree_pass_generator(uniform_pitch_division,
+                                                           passing_config);
+    for (int i = 0; i < 20; i++)
+    {
+        quad_tree_pass_generator.generatePassEvaluation(world);
+    }
+    double best_rating_before = quad_tree_pass_generator.generatePassEvaluation(world)
+                                    .getBestPassOnField()
+                                    .rating;
+
+    // Refine the pitch division in a different region, the best pass found so far
+    // should still be kept
+    quad_tree_pass_generator.setPitchDivision(
+        std::make_shared<const QuadTreePitchDivision>(
+            world.field(),
+            [](const Rectangle& zone) { return zone.centre().x() < 0 ? 1.0 : 0.0; }));
+    double best_rating_after = quad_tree_pass_generator.generatePassEvaluation(world)
+                                   .getBestPassOnField()
+                                   .rating;
+
+    EXPECT_GE(best_rating_after, best_rating_before - 0.05);
+}
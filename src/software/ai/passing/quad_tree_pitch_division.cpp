@@ -0,0 +1,146 @@
+#include "software/ai/passing/quad_tree_pitch_division.h"
+
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+
+#include "software/geom/algorithms/contains.h"
+
+QuadTreePitchDivision::QuadTreePitchDivision(
+    const Field& field, const std::function<double(const Rectangle&)>& rate_zone,
+    unsigned int num_zones)
+    : field_lines_(field.fieldLines()),
+      num_grid_columns_(static_cast<unsigned int>(
+          std::ceil(field_lines_.xLength() / MAX_INITIAL_ZONE_SIZE_M))),
+      num_grid_rows_(static_cast<unsigned int>(
+          std::ceil(field_lines_.yLength() / MAX_INITIAL_ZONE_SIZE_M)))
+{
+    if (num_zones > sizeQuadTreeZoneId())
+    {
+        throw std::invalid_argument("QuadTreePitchDivision: cannot create " +
+                                    std::to_string(num_zones) + " zones, the most is " +
+                                    std::to_string(sizeQuadTreeZoneId()));
+    }
+    if (num_zones < num_grid_columns_ * num_grid_rows_)
+    {
+        throw std::invalid_argument("QuadTreePitchDivision: cannot create " +
+                                    std::to_string(num_zones) +
+                                    " zones, the field needs at least " +
+                                    std::to_string(num_grid_columns_ * num_grid_rows_));
+    }
+
+    // Nodes that could be split, by priority
+    using NodePriority = std::pair<double, std::size_t>;
+    std::priority_queue<NodePriority> split_candidates;
+    auto add_node = [&](const Rectangle& region) {
+        nodes_.push_back(Node{region, std::nullopt, QuadTreeZoneId::ZONE_1});
+        if (region.xLength() >= 2 * MIN_ZONE_SIZE_M &&
+            region.yLength() >= 2 * MIN_ZONE_SIZE_M)
+        {
+            double priority = rate_zone(region) * region.xLength() * region.yLength();
+            split_candidates.emplace(priority, nodes_.size() - 1);
+        }
+    };
+
+    double cell_x_length = field_lines_.xLength() / num_grid_columns_;
+    double cell_y_length = field_lines_.yLength() / num_grid_rows_;
+    for (unsigned int row = 0; row < num_grid_rows_; row++)
+    {
+        for (unsigned int column = 0; column < num_grid_columns_; column++)
+        {
+            Point cell_min(field_lines_.xMin() + column * cell_x_length,
+                           field_lines_.yMin() + row * cell_y_length);
+            add_node(
+                Rectangle(cell_min, cell_min + Vector(cell_x_length, cell_y_length)));
+        }
+    }
+
+    // Each split replaces a zone with 4 zones
+    unsigned int current_num_zones = num_grid_columns_ * num_grid_rows_;
+    while (current_num_zones + 3 <= num_zones && !split_candidates.empty())
+    {
+        std::size_t node_index = split_candidates.top().second;
+        split_candidates.pop();
+
+        Rectangle region = nodes_[node_index].region;
+        Point centre     = region.centre();
+        std::array<std::size_t, 4> children;
+        // The children are ordered so that the index of the child containing a point is
+        // 1 if the point is in the positive x half, plus 2 if it is in the positive y
+        // half
+        children[0] = nodes_.size();
+        add_node(Rectangle(region.negXNegYCorner(), centre));
+        children[1] = nodes_.size();
+        add_node(Rectangle(Point(centre.x(), region.yMin()),
+                           Point(region.xMax(), centre.y())));
+        children[2] = nodes_.size();
+        add_node(Rectangle(Point(region.xMin(), centre.y()),
+                           Point(centre.x(), region.yMax())));
+        children[3] = nodes_.size();
+        add_node(Rectangle(centre, region.posXPosYCorner()));
+        nodes_[node_index].children = children;
+
+        current_num_zones += 3;
+    }
+
+    for (std::size_t i = 0; i < num_grid_columns_ * num_grid_rows_; i++)
+    {
+        assignZoneIds(i);
+    }
+}
+
+void QuadTreePitchDivision::assignZoneIds(std::size_t node_index)
+{
+    Node& node = nodes_[node_index];
+    if (node.children)
+    {
+        for (std::size_t child_index : *node.children)
+        {
+            assignZoneIds(child_index);
+        }
+    }
+    else
+    {
+        node.zone_id = static_cast<QuadTreeZoneId>(zones_.size());
+        zones_.push_back(node.region);
+        zone_ids_.push_back(node.zone_id);
+    }
+}
+
+const Rectangle& QuadTreePitchDivision::getZone(QuadTreeZoneId zone_id) const
+{
+    return zones_.at(static_cast<unsigned>(zone_id));
+}
+
+QuadTreeZoneId QuadTreePitchDivision::getZoneId(const Point& position) const
+{
+    if (!contains(field_lines_, position))
+    {
+        throw std::invalid_argument("requested position not on field!");
+    }
+
+    // Find the cell of the initial grid the position is in, then descend the quadtree
+    unsigned int column =
+        std::min(static_cast<unsigned int>((position.x() - field_lines_.xMin()) /
+                                           (field_lines_.xLength() / num_grid_columns_)),
+                 num_grid_columns_ - 1);
+    unsigned int row =
+        std::min(static_cast<unsigned int>((position.y() - field_lines_.yMin()) /
+                                           (field_lines_.yLength() / num_grid_rows_)),
+                 num_grid_rows_ - 1);
+
+    const Node* node = &nodes_[row * num_grid_columns_ + column];
+    while (node->children)
+    {
+        Point centre = node->region.centre();
+        std::size_t child =
+            (position.x() >= centre.x() ? 1 : 0) + (position.y() >= centre.y() ? 2 : 0);
+        node = &nodes_[(*node->children)[child]];
+    }
+    return node->zone_id;
+}
+
+const std::vector<QuadTreeZoneId>& QuadTreePitchDivision::getAllZoneIds() const
+{
+    return zone_ids_;
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <functional>
+#include <optional>
+
+#include "software/ai/passing/field_pitch_division.h"
+#include "software/geom/rectangle.h"
+#include "software/util/make_enum/make_enum.h"
+
+// clang-format off
+MAKE_ENUM(QuadTreeZoneId,
+            ZONE_1, ZONE_2, ZONE_3, ZONE_4, ZONE_5,
+            ZONE_6, ZONE_7, ZONE_8, ZONE_9, ZONE_10,
+            ZONE_11, ZONE_12, ZONE_13, ZONE_14, ZONE_15,
+            ZONE_16, ZONE_17, ZONE_18, ZONE_19, ZONE_20,
+            ZONE_21, ZONE_22, ZONE_23, ZONE_24, ZONE_25,
+            ZONE_26, ZONE_27, ZONE_28, ZONE_29, ZONE_30,
+            ZONE_31, ZONE_32);
+// clang-format on
+
+/**
+ * A pitch division that is refined around the most promising regions of the field.
+ *
+ * The field is first divided into a grid of zones no larger than
+ * MAX_INITIAL_ZONE_SIZE_M, so that larger fields start with more zones. Then, like a
+ * quadtree, the zone with the highest priority is repeatedly split into 4 equal zones
+ * until there are as many zones as requested. The priority of a zone is its rating
+ * multiplied by its area, so promising regions of the field end up divided into many
+ * small zones while unpromising regions are left as a few large zones.
+ *
+ * For example, a 9x6m field starts as a 3x2 grid, and if the zones nearest the enemy
+ * net are rated highest they are split first, then the best of their children:
+ *
+ *                FRIENDLY          ENEMY
+ *        ┌──────────┬──────────┬─────┬─────┐
+ *        │          │          │     │     │
+ *        │          │          ├──┬──┼─────┤
+ *        │          │          ├──┼──┤     │
+ *        ├──────────┼──────────┼──┴──┼─────┤
+ *        │          │          │     │     │
+ *        │          │          │     │     │
+ *        └──────────┴──────────┴─────┴─────┘
+ *
+ * Since the division depends on the state of the game, a new division should be created
+ * on each tick (see PassGenerator::setPitchDivision).
+ */
+class QuadTreePitchDivision : public FieldPitchDivision<QuadTreeZoneId>
+{
+   public:
+    /**
+     * Divides the field into zones, refined around the highest rated zones
+     *
+     * @param field The field to divide into zones
+     * @param rate_zone Rates a zone, with higher values for more promising zones. The
+     * ratings must not be negative.
+     * @param num_zones The number of zones to divide the field into. Fewer zones may be
+     * created if no more zones can be split, or so that each split creates exactly 3
+     * more zones.
+     *
+     * @throws std::invalid_argument if num_zones is more than the number of
+     * QuadTreeZoneIds, or less than the number of zones in the initial grid
+     */
+    explicit QuadTreePitchDivision(
+        const Field& field, const std::function<double(const Rectangle&)>& rate_zone,
+        unsigned int num_zones = DEFAULT_NUM_ZONES);
+
+    const Rectangle& getZone(QuadTreeZoneId zone_id) const override;
+    const std::vector<QuadTreeZoneId>& getAllZoneIds() const override;
+    QuadTreeZoneId getZoneId(const Point& position) const override;
+
+    // The same number of zones as the EighteenZonePitchDivision, so that passes are
+    // generated in about the same time
+    static constexpr unsigned int DEFAULT_NUM_ZONES = 18;
+    // The zones in the initial grid are no larger than this along either axis
+    static constexpr double MAX_INITIAL_ZONE_SIZE_M = 3.0;
+    // Zones are never split into zones smaller than this along either axis
+    static constexpr double MIN_ZONE_SIZE_M = 0.4;
+
+   private:
+    /**
+     * A zone in the quadtree, which has either been split into 4 children or is one of
+     * the zones of the pitch division
+     */
+    struct Node
+    {
+        Rectangle region;
+        // The indices of the children in nodes_ if this node has been split
+        std::optional<std::array<std::size_t, 4>> children;
+        // The zone id if this node has not been split
+        QuadTreeZoneId zone_id;
+    };
+
+    /**
+     * Assigns zone ids to the nodes that have not been split, depth first from the
+     * given node
+     *
+     * @param node_index The index in nodes_ of the node to start from
+     */
+    void assignZoneIds(std::size_t node_index);
+
+    Rectangle field_lines_;
+    unsigned int num_grid_columns_;
+    unsigned int num_grid_rows_;
+    // The initial grid cells are the first nodes, in row-major order
+    std::vector<Node> nodes_;
+    std::vector<Rectangle> zones_;
+    std::vector<QuadTreeZoneId> zone_ids_;
+};
@@ -0,0 +1,146 @@
+#include "software/ai/passing/quad_tree_pitch_division.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/world/field.h"
+
+class QuadTreePitchDivisionTest : public testing::TestWithParam<Field>
+{
+   protected:
+    static double rateUniformly(const Rectangle& zone)
+    {
+        return 1.0;
+    }
+
+    static double rateEnemyHalf(const Rectangle& zone)
+    {
+        return zone.centre().x() > 0 ? 1.0 : 0.01;
+    }
+};
+
+TEST_P(QuadTreePitchDivisionTest, test_zones_cover_field_without_overlapping)
+{
+    Field field = GetParam();
+    QuadTreePitchDivision pitch_division(field, rateEnemyHalf);
+
+    EXPECT_EQ(QuadTreePitchDivision::DEFAULT_NUM_ZONES,
+              pitch_division.getAllZoneIds().size());
+
+    double total_area = 0;
+    for (QuadTreeZoneId zone_id : pitch_division.getAllZoneIds())
+    {
+        const Rectangle& zone = pitch_division.getZone(zone_id);
+        total_area += zone.xLength() * zone.yLength();
+        EXPECT_TRUE(contains(field.fieldLines(), zone.centre()));
+        EXPECT_EQ(zone_id, pitch_division.getZoneId(zone.centre()));
+    }
+    EXPECT_NEAR(field.xLength() * field.yLength(), total_area, 1e-6);
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_get_zone_id_at_field_corners)
+{
+    Field field = GetParam();
+    QuadTreePitchDivision pitch_division(field, rateEnemyHalf);
+
+    Rectangle field_lines = field.fieldLines();
+    Point neg_x_neg_y     = field_lines.negXNegYCorner();
+    Point pos_x_pos_y     = neg_x_neg_y + field_lines.diagonal();
+    for (const Point& corner :
+         {neg_x_neg_y, pos_x_pos_y, Point(neg_x_neg_y.x(), pos_x_pos_y.y()),
+          Point(pos_x_pos_y.x(), neg_x_neg_y.y())})
+    {
+        QuadTreeZoneId zone_id = pitch_division.getZoneId(corner);
+        const Rectangle& zone  = pitch_division.getZone(zone_id);
+        EXPECT_LE(distance(zone.centre(), corner), zone.diagonal().length() / 2 + 1e-6);
+    }
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_higher_rated_zones_are_refined)
+{
+    Field field = GetParam();
+    QuadTreePitchDivision pitch_division(field, rateEnemyHalf);
+
+    // Only the zones in the enemy half are rated highly enough to be split
+    double min_friendly_half_zone_area = std::numeric_limits<double>::max();
+    double min_enemy_half_zone_area    = std::numeric_limits<double>::max();
+    for (QuadTreeZoneId zone_id : pitch_division.getAllZoneIds())
+    {
+        const Rectangle& zone = pitch_division.getZone(zone_id);
+        double area           = zone.xLength() * zone.yLength();
+        if (zone.centre().x() > 0)
+        {
+            min_enemy_half_zone_area = std::min(min_enemy_half_zone_area, area);
+        }
+        else
+        {
+            min_friendly_half_zone_area = std::min(min_friendly_half_zone_area, area);
+        }
+    }
+    EXPECT_LT(min_enemy_half_zone_area, min_friendly_half_zone_area);
+    EXPECT_GE(min_friendly_half_zone_area,
+              std::pow(QuadTreePitchDivision::MAX_INITIAL_ZONE_SIZE_M, 2) / 2);
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_uniformly_rated_zones_are_split_evenly)
+{
+    Field field = GetParam();
+    QuadTreePitchDivision pitch_division(field, rateUniformly);
+
+    // With uniform ratings every zone of the initial grid is split once before any
+    // zone is split twice, so the largest zone is no larger than a grid cell
+    for (QuadTreeZoneId zone_id : pitch_division.getAllZoneIds())
+    {
+        const Rectangle& zone = pitch_division.getZone(zone_id);
+        EXPECT_LE(zone.xLength(), QuadTreePitchDivision::MAX_INITIAL_ZONE_SIZE_M);
+        EXPECT_LE(zone.yLength(), QuadTreePitchDivision::MAX_INITIAL_ZONE_SIZE_M);
+    }
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_zones_are_not_split_below_min_size)
+{
+    Field field = GetParam();
+    // Only ever refine around one point, so the zones around it would keep being split
+    Point target(1.0, 1.0);
+    QuadTreePitchDivision pitch_division(
+        field,
+        [&target](const Rectangle& zone) { return contains(zone, target) ? 1.0 : 0.0; },
+        static_cast<unsigned int>(sizeQuadTreeZoneId()));
+
+    for (QuadTreeZoneId zone_id : pitch_division.getAllZoneIds())
+    {
+        const Rectangle& zone = pitch_division.getZone(zone_id);
+        EXPECT_GE(zone.xLength(), QuadTreePitchDivision::MIN_ZONE_SIZE_M);
+        EXPECT_GE(zone.yLength(), QuadTreePitchDivision::MIN_ZONE_SIZE_M);
+    }
+    const Rectangle& target_zone =
+        pitch_division.getZone(pitch_division.getZoneId(target));
+    EXPECT_LT(target_zone.xLength(), 2 * QuadTreePitchDivision::MIN_ZONE_SIZE_M);
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_invalid_number_of_zones_throws)
+{
+    Field field = GetParam();
+    EXPECT_THROW(
+        QuadTreePitchDivision(field, rateUniformly,
+                              static_cast<unsigned int>(sizeQuadTreeZoneId()) + 1),
+        std::invalid_argument);
+    EXPECT_THROW(QuadTreePitchDivision(field, rateUniformly, 1), std::invalid_argument);
+}
+
+TEST_P(QuadTreePitchDivisionTest, test_get_zone_id_off_field_throws)
+{
+    Field field = GetParam();
+    QuadTreePitchDivision pitch_division(field, rateUniformly);
+
+    EXPECT_THROW(pitch_division.getZoneId(Point(field.xLength(), 0)),
+                 std::invalid_argument);
+}
+
+INSTANTIATE_TEST_CASE_P(All, QuadTreePitchDivisionTest,
+                        ::testing::Values(Field::createSSLDivisionAField(),
+                                          Field::createSSLDivisionBField()));
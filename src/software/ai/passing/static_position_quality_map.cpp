@@ -0,0 +1,104 @@
+#include "software/ai/passing/static_position_quality_map.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "software/ai/passing/cost_function.h"
+
+StaticPositionQualityMapKey::StaticPositionQualityMapKey(
+    const Field& field, const PassingConfig::Snapshot& passing_params)
+    : field_x_length(field.xLength()),
+      field_y_length(field.yLength()),
+      defense_area_x_length(field.defenseAreaXLength()),
+      defense_area_y_length(field.defenseAreaYLength()),
+      boundary_margin(field.boundaryMargin()),
+      x_offset(passing_params.static_field_position_quality_x_offset),
+      y_offset(passing_params.static_field_position_quality_y_offset),
+      friendly_goal_distance_weight(
+          passing_params.static_field_position_quality_friendly_goal_distance_weight),
+      resolution_m(passing_params.static_field_position_quality_lookup_resolution_m)
+{
+}
+
+bool StaticPositionQualityMapKey::operator==(
+    const StaticPositionQualityMapKey& other) const
+{
+    return field_x_length == other.field_x_length &&
+           field_y_length == other.field_y_length &&
+           defense_area_x_length == other.defense_area_x_length &&
+           defense_area_y_length == other.defense_area_y_length &&
+           boundary_margin == other.boundary_margin && x_offset == other.x_offset &&
+           y_offset == other.y_offset &&
+           friendly_goal_distance_weight == other.friendly_goal_distance_weight &&
+           resolution_m == other.resolution_m;
+}
+
+bool StaticPositionQualityMapKey::operator!=(
+    const StaticPositionQualityMapKey& other) const
+{
+    return !(*this == other);
+}
+
+StaticPositionQualityMap::StaticPositionQualityMap(
+    const Field& field, const PassingConfig::Snapshot& passing_params)
+    : key_(field, passing_params), grid_origin_(field.fieldBoundary().negXNegYCorner())
+{
+    Rectangle field_boundary = field.fieldBoundary();
+
+    // Use at least the requested resolution, with grid points exactly on the edges of
+    // the field boundary
+    num_x_points_ = static_cast<unsigned int>(
+                        std::ceil(field_boundary.xLength() / key_.resolution_m)) +
+                    1;
+    num_y_points_ = static_cast<unsigned int>(
+                        std::ceil(field_boundary.yLength() / key_.resolution_m)) +
+                    1;
+    x_spacing_m_ = field_boundary.xLength() / (num_x_points_ - 1);
+    y_spacing_m_ = field_boundary.yLength() / (num_y_points_ - 1);
+
+    qualities_.reserve(static_cast<std::size_t>(num_x_points_) * num_y_points_);
+    for (unsigned int y_index = 0; y_index < num_y_points_; y_index++)
+    {
+        for (unsigned int x_index = 0; x_index < num_x_points_; x_index++)
+        {
+            Point position(grid_origin_.x() + x_index * x_spacing_m_,
+                           grid_origin_.y() + y_index * y_spacing_m_);
+            qualities_.push_back(static_cast<float>(
+                getStaticPositionQuality(field, position, passing_params)));
+        }
+    }
+}
+
+double StaticPositionQualityMap::getQuality(const Point& position) const
+{
+    // The position in units of grid spacings from the grid origin, clamped to the grid
+    double x = std::clamp((position.x() - grid_origin_.x()) / x_spacing_m_, 0.0,
+                          static_cast<double>(num_x_points_ - 1));
+    double y = std::clamp((position.y() - grid_origin_.y()) / y_spacing_m_, 0.0,
+                          static_cast<double>(num_y_points_ - 1));
+
+    // The grid cell containing the position, which is the last cell if the position is
+    // on the far edge of the grid
+    unsigned int x_index = std::min(static_cast<unsigned int>(x), num_x_points_ - 2);
+    unsigned int y_index = std::min(static_cast<unsigned int>(y), num_y_points_ - 2);
+    double x_fraction    = x - x_index;
+    double y_fraction    = y - y_index;
+
+    std::size_t index = static_cast<std::size_t>(y_index) * num_x_points_ + x_index;
+    double bottom =
+        qualities_[index] * (1 - x_fraction) + qualities_[index + 1] * x_fraction;
+    double top = qualities_[index + num_x_points_] * (1 - x_fraction) +
+                 qualities_[index + num_x_points_ + 1] * x_fraction;
+    return bottom * (1 - y_fraction) + top * y_fraction;
+}
+
+bool StaticPositionQualityMap::isValidFor(
+    const Field& field, const PassingConfig::Snapshot& passing_params) const
+{
+    return key_ == StaticPositionQualityMapKey(field, passing_params);
+}
+
+const StaticPositionQualityMapKey& StaticPositionQualityMap::getKey() const
+{
+    return key_;
+}
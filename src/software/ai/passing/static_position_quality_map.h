@@ -0,0 +1,123 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/geom/point.h"
+#include "software/world/field.h"
+
+/**
+ * Everything that the static position quality of a position depends on, other than the
+ * position itself: the dimensions of the field, the static position quality parameters
+ * and the lookup resolution. This is much cheaper to compare than a whole Field, so it
+ * is used to find the StaticPositionQualityMap for a field and passing parameters.
+ */
+struct StaticPositionQualityMapKey
+{
+    /**
+     * Creates the key for the given field and passing parameters
+     *
+     * @param field The field
+     * @param passing_params The passing parameters
+     */
+    explicit StaticPositionQualityMapKey(const Field& field,
+                                         const PassingConfig::Snapshot& passing_params);
+
+    bool operator==(const StaticPositionQualityMapKey& other) const;
+    bool operator!=(const StaticPositionQualityMapKey& other) const;
+
+    double field_x_length;
+    double field_y_length;
+    double defense_area_x_length;
+    double defense_area_y_length;
+    double boundary_margin;
+    double x_offset;
+    double y_offset;
+    double friendly_goal_distance_weight;
+    double resolution_m;
+};
+
+template <>
+struct std::hash<StaticPositionQualityMapKey>
+{
+    std::size_t operator()(const StaticPositionQualityMapKey& key) const
+    {
+        std::size_t seed = 0;
+        for (double value :
+             {key.field_x_length, key.field_y_length, key.defense_area_x_length,
+              key.defense_area_y_length, key.boundary_margin, key.x_offset, key.y_offset,
+              key.friendly_goal_distance_weight, key.resolution_m})
+        {
+            // This combines hashes the same way as boost::hash_combine
+            seed ^= std::hash<double>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
+/**
+ * The static position quality (see getStaticPositionQuality) of every position on a
+ * field, precomputed on a grid covering the field boundary and bilinearly interpolated
+ * between grid points.
+ *
+ * The static position quality only depends on the field and a few passing parameters,
+ * but is evaluated for every pass candidate and every gradient descent step, so looking
+ * it up is much cheaper than evaluating its sigmoids each time.
+ */
+class StaticPositionQualityMap
+{
+   public:
+    /**
+     * Precomputes the static position quality on the given field
+     *
+     * @param field The field to precompute the static position quality on
+     * @param passing_params The passing parameters used to calculate the static position
+     * quality. The grid spacing is static_field_position_quality_lookup_resolution_m.
+     */
+    explicit StaticPositionQualityMap(const Field& field,
+                                      const PassingConfig::Snapshot& passing_params);
+
+    /**
+     * Gets the static position quality at the given position. Positions outside the
+     * field boundary have the quality of the closest position on the field boundary.
+     *
+     * @param position The position to get the static position quality at
+     *
+     * @return the static position quality at the given position, in [0,1]
+     */
+    double getQuality(const Point& position) const;
+
+    /**
+     * Checks whether this map was precomputed on the given field with the given
+     * passing parameters, so it can be used instead of calculating the static position
+     * quality for them
+     *
+     * @param field The field
+     * @param passing_params The passing parameters
+     *
+     * @return whether this map matches the given field and passing parameters
+     */
+    bool isValidFor(const Field& field,
+                    const PassingConfig::Snapshot& passing_params) const;
+
+    /**
+     * Gets the key of the field and passing parameters this map was precomputed for
+     *
+     * @return the key of the field and passing parameters this map was precomputed for
+     */
+    const StaticPositionQualityMapKey& getKey() const;
+
+   private:
+    StaticPositionQualityMapKey key_;
+
+    // The grid of qualities covers the field boundary, with the given number of points
+    // along each axis and the given spacing between them. The qualities are stored in
+    // row-major order, with rows along the x axis.
+    Point grid_origin_;
+    unsigned int num_x_points_;
+    unsigned int num_y_points_;
+    double x_spacing_m_;
+    double y_spacing_m_;
+    std::vector<float> qualities_;
+};
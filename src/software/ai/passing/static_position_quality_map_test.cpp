@@ -0,0 +1,224 @@
+#include "software/ai/passing/static_position_quality_map.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+#include "software/ai/passing/cost_function.h"
+
+class StaticPositionQualityMapTest : public testing::TestWithParam<Field>
+{
+   protected:
+    /**
+     * Returns the largest difference between the precomputed and calculated static
+     * position quality at random positions in the field boundary
+     */
+    static double getMaxError(const StaticPositionQualityMap& map, const Field& field,
+                              const PassingConfig::Snapshot& passing_params)
+    {
+        std::mt19937 random_num_gen(1);
+        Rectangle field_boundary = field.fieldBoundary();
+        std::uniform_real_distribution x_distribution(field_boundary.xMin(),
+                                                      field_boundary.xMax());
+        std::uniform_real_distribution y_distribution(field_boundary.yMin(),
+                                                      field_boundary.yMax());
+
+        double max_error = 0;
+        for (int i = 0; i < 100000; i++)
+        {
+            Point position(x_distribution(random_num_gen),
+                           y_distribution(random_num_gen));
+            double error =
+                std::abs(map.getQuality(position) -
+                         getStaticPositionQuality(field, position, passing_params));
+            max_error = std::max(max_error, error);
+        }
+        return max_error;
+    }
+};
+
+TEST_P(StaticPositionQualityMapTest, test_error_at_default_resolution)
+{
+    Field field         = GetParam();
+    auto passing_config = std::make_shared<const PassingConfig>();
+    StaticPositionQualityMap map(field, *passing_config->getSnapshot());
+
+    EXPECT_LT(getMaxError(map, field, *passing_config->getSnapshot()), 0.04);
+}
+
+TEST_P(StaticPositionQualityMapTest, test_error_at_fine_resolution)
+{
+    Field field         = GetParam();
+    auto passing_config = std::make_shared<PassingConfig>();
+    passing_config->getMutableStaticFieldPositionQualityLookupResolutionM()->setValue(
+        0.01);
+    StaticPositionQualityMap map(field, *passing_config->getSnapshot());
+
+    EXPECT_LT(getMaxError(map, field, *passing_config->getSnapshot()), 0.01);
+}
+
+TEST_P(StaticPositionQualityMapTest, test_quality_at_grid_corners)
+{
+    Field field         = GetParam();
+    auto passing_config = std::make_shared<const PassingConfig>();
+    StaticPositionQualityMap map(field, *passing_config->getSnapshot());
+
+    Rectangle field_boundary = field.fieldBoundary();
+    for (const Point& corner : field_boundary.getPoints())
+    {
+        EXPECT_NEAR(
+            getStaticPositionQuality(field, corner, *passing_config->getSnapshot()),
+            map.getQuality(corner), 1e-6);
+    }
+}
+
+TEST_P(StaticPositionQualityMapTest, test_quality_outside_field_boundary_is_clamped)
+{
+    Field field         = GetParam();
+    auto passing_config = std::make_shared<const PassingConfig>();
+    StaticPositionQualityMap map(field, *passing_config->getSnapshot());
+
+    Rectangle field_boundary = field.fieldBoundary();
+    EXPECT_DOUBLE_EQ(map.getQuality(Point(field_boundary.xMax(), 0.5)),
+                     map.getQuality(Point(field_boundary.xMax() + 2, 0.5)));
+    EXPECT_DOUBLE_EQ(map.getQuality(Point(0.5, field_boundary.yMin())),
+                     map.getQuality(Point(0.5, field_boundary.yMin() - 2)));
+}
+
+INSTANTIATE_TEST_CASE_P(All, StaticPositionQualityMapTest,
+                        ::testing::Values(Field::createSSLDivisionAField(),
+                                          Field::createSSLDivisionBField()));
+
+TEST(StaticPositionQualityMapValidityTest, test_valid_for_same_field_and_parameters)
+{
+    auto passing_config = std::make_shared<const PassingConfig>();
+    StaticPositionQualityMap map(Field::createSSLDivisionBField(),
+                                 *passing_config->getSnapshot());
+
+    EXPECT_TRUE(
+        map.isValidFor(Field::createSSLDivisionBField(), *passing_config->getSnapshot()));
+    EXPECT_FALSE(
+        map.isValidFor(Field::createSSLDivisionAField(), *passing_config->getSnapshot()));
+}
+
+TEST(StaticPositionQualityMapValidityTest, test_invalid_when_parameters_change)
+{
+    auto passing_config = std::make_shared<PassingConfig>();
+    StaticPositionQualityMap map(Field::createSSLDivisionBField(),
+                                 *passing_config->getSnapshot());
+
+    // Parameters that do not affect the static position quality don't matter
+    passing_config->getMutableEnemyProximityImportance()->setValue(2.0);
+    EXPECT_TRUE(
+        map.isValidFor(Field::createSSLDivisionBField(), *passing_config->getSnapshot()));
+
+    passing_config->getMutableStaticFieldPositionQualityXOffset()->setValue(0.5);
+    EXPECT_FALSE(
+        map.isValidFor(Field::createSSLDivisionBField(), *passing_config->getSnapshot()));
+}
+
+/**
+ * Waits until the static position quality map for the given field and passing config
+ * has been precomputed
+ *
+ * @return the map, or nullptr if it took too long to precompute
+ */
+static std::shared_ptr<const StaticPositionQualityMap> waitForStaticPositionQualityMap(
+    const Field& field, std::shared_ptr<const PassingConfig> passing_config)
+{
+    for (int i = 0; i < 1000; i++)
+    {
+        std::shared_ptr<const StaticPositionQualityMap> map =
+            getStaticPositionQualityMap(field, passing_config);
+        if (map)
+        {
+            return map;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return nullptr;
+}
+
+TEST(StaticPositionQualityMapValidityTest,
+     test_static_position_quality_is_calculated_while_map_is_precomputed)
+{
+    Field field         = Field::createSSLDivisionBField();
+    auto passing_config = std::make_shared<PassingConfig>();
+    passing_config->getMutableStaticFieldPositionQualityXOffset()->setValue(0.35);
+
+    // The map is never ready right away, so looking up the quality doesn't block
+    EXPECT_EQ(nullptr, getStaticPositionQualityMap(field, passing_config));
+    EXPECT_DOUBLE_EQ(getStaticPositionQuality(field, Point(1, 2.5), passing_config),
+                     lookupStaticPositionQuality(field, Point(1, 2.5),
+                                                 *passing_config->getSnapshot()));
+
+    std::shared_ptr<const StaticPositionQualityMap> map =
+        waitForStaticPositionQualityMap(field, passing_config);
+    ASSERT_NE(nullptr, map);
+    EXPECT_DOUBLE_EQ(map->getQuality(Point(1, 2.5)),
+                     lookupStaticPositionQuality(field, Point(1, 2.5),
+                                                 *passing_config->getSnapshot()));
+}
+
+TEST(StaticPositionQualityMapValidityTest,
+     test_get_static_position_quality_map_is_recomputed_when_parameters_change)
+{
+    Field field         = Field::createSSLDivisionBField();
+    auto passing_config = std::make_shared<PassingConfig>();
+
+    std::shared_ptr<const StaticPositionQualityMap> map =
+        waitForStaticPositionQualityMap(field, passing_config);
+    ASSERT_NE(nullptr, map);
+    EXPECT_TRUE(map->isValidFor(field, *passing_config->getSnapshot()));
+    EXPECT_EQ(map, getStaticPositionQualityMap(field, passing_config));
+
+    passing_config->getMutableStaticFieldPositionQualityYOffset()->setValue(0.5);
+    std::shared_ptr<const StaticPositionQualityMap> new_map =
+        waitForStaticPositionQualityMap(field, passing_config);
+    ASSERT_NE(nullptr, new_map);
+    EXPECT_TRUE(new_map->isValidFor(field, *passing_config->getSnapshot()));
+    EXPECT_NEAR(getStaticPositionQuality(field, Point(1, 2.5), passing_config),
+                new_map->getQuality(Point(1, 2.5)), 0.04);
+}
+
+TEST(StaticPositionQualityMapValidityTest,
+     test_get_static_position_quality_map_keeps_maps_for_different_parameters)
+{
+    Field field         = Field::createSSLDivisionBField();
+    auto passing_config = std::make_shared<PassingConfig>();
+    auto other_config   = std::make_shared<PassingConfig>();
+    other_config->getMutableStaticFieldPositionQualityXOffset()->setValue(0.5);
+
+    // Two AIs with different passing configs alternating on the same thread must not
+    // evict each other's map
+    std::shared_ptr<const StaticPositionQualityMap> map =
+        waitForStaticPositionQualityMap(field, passing_config);
+    std::shared_ptr<const StaticPositionQualityMap> other_map =
+        waitForStaticPositionQualityMap(field, other_config);
+    ASSERT_NE(nullptr, map);
+    ASSERT_NE(nullptr, other_map);
+    EXPECT_NE(map, other_map);
+    EXPECT_TRUE(other_map->isValidFor(field, *other_config->getSnapshot()));
+    EXPECT_EQ(map, getStaticPositionQualityMap(field, passing_config));
+    EXPECT_EQ(other_map, getStaticPositionQualityMap(field, other_config));
+}
+
+TEST(StaticPositionQualityMapValidityTest,
+     test_get_static_position_quality_map_on_other_thread)
+{
+    Field field         = Field::createSSLDivisionAField();
+    auto passing_config = std::make_shared<const PassingConfig>();
+
+    std::shared_ptr<const StaticPositionQualityMap> map =
+        waitForStaticPositionQualityMap(field, passing_config);
+    ASSERT_NE(nullptr, map);
+
+    // Maps are shared between threads, so another thread doesn't precompute it again
+    std::shared_ptr<const StaticPositionQualityMap> other_thread_map;
+    std::thread([&]() {
+        other_thread_map = getStaticPositionQualityMap(field, passing_config);
+    }).join();
+    EXPECT_EQ(map, other_thread_map);
+}
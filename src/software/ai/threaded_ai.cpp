@@ -1,9 +1,12 @@
 #include "software/ai/threaded_ai.h"
 
+#include <atomic>
 #include <boost/bind.hpp>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
-#include "software/gui/drawing/navigator.h"
+#include "software/gui/drawing/navigator_draw_commands.h"
+#include "software/proto/message_translation/draw_commands.h"
+#include "software/util/profiler/profiler.h"
 
 ThreadedAI::ThreadedAI(std::shared_ptr<const AiConfig> ai_config,
                        std::shared_ptr<const AiControlConfig> control_config,
@@ -20,6 +23,8 @@ void ThreadedAI::onValueReceived(World world)
 
 void ThreadedAI::runAIAndSendPrimitives(const World &world)
 {
+    PROFILE_SCOPE("ThreadedAI::runAIAndSendPrimitives");
+
     if (control_config->getRunAi()->value())
     {
         auto new_primitives = ai.getPrimitives(world);
@@ -35,7 +40,17 @@ void ThreadedAI::drawAI()
 {
     if (ai.getNavigator())
     {
-        auto draw_function = drawNavigator(ai.getNavigator());
-        Subject<AIDrawFunction>::sendValueToObservers(draw_function);
+        draw_command_buffer.clear();
+        writeNavigatorDrawCommands(*ai.getNavigator(), draw_command_buffer);
+        if (!draw_commands_proto || draw_commands_proto.use_count() > 1)
+        {
+            draw_commands_proto = std::make_shared<DrawCommandsProto>();
+        }
+        // use_count() is a relaxed load, so synchronize with the observers that
+        // released the proto before it is overwritten
+        std::atomic_thread_fence(std::memory_order_acquire);
+        updateDrawCommands(draw_command_buffer, *draw_commands_proto);
+        Subject<std::shared_ptr<const DrawCommandsProto>>::sendValueToObservers(
+            draw_commands_proto);
     }
 }
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
+
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/ai/ai.h"
 #include "software/ai/hl/stp/play_info.h"
-#include "software/gui/drawing/draw_functions.h"
+#include "software/gui/drawing/draw_command_buffer.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.h"
+#include "software/proto/draw_commands_msg.pb.h"
 #include "software/world/world.h"
 
 /**
@@ -15,7 +18,7 @@
  */
 class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
                    public Subject<TbotsProto::PrimitiveSet>,
-                   public Subject<AIDrawFunction>,
+                   public Subject<std::shared_ptr<const DrawCommandsProto>>,
                    public Subject<PlayInfo>
 {
    public:
@@ -43,10 +46,16 @@ class ThreadedAI : public FirstInFirstOutThreadedObserver<World>,
     void runAIAndSendPrimitives(const World &world);
 
     /**
-     * Publishes draw functions
+     * Publishes the commands to draw the AI. Every observer is sent the same proto
      */
     void drawAI();
 
     AI ai;
     std::shared_ptr<const AiControlConfig> control_config;
+
+    // These are refilled every tick rather than recreated, so they stop allocating once
+    // they are large enough to hold what the AI draws. The proto is only refilled once
+    // no observer holds it anymore, otherwise a new one is published
+    DrawCommandBuffer draw_command_buffer;
+    std::shared_ptr<DrawCommandsProto> draw_commands_proto;
 };
@@ -15,6 +15,13 @@ void Backend::receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg)
     SensorProto sensor_msg;
     *(sensor_msg.mutable_ssl_vision_msg())        = msg;
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
+    if (msg.has_detection())
+    {
+        TbotsProto::LatencyTrace& latency_trace = *sensor_msg.mutable_latency_trace();
+        latency_trace.set_camera_capture_time_seconds(msg.detection().t_capture());
+        latency_trace.set_backend_received_time_seconds(
+            sensor_msg.backend_received_time().epoch_timestamp_seconds());
+    }
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
 }
 
@@ -25,3 +32,14 @@ void Backend::receiveSSLReferee(SSLProto::Referee msg)
     *(sensor_msg.mutable_backend_received_time()) = *createCurrentTimestamp();
     Subject<SensorProto>::sendValueToObservers(sensor_msg);
 }
+
+void Backend::sendLatencyTrace(const TbotsProto::PrimitiveSet& primitives)
+{
+    if (primitives.has_latency_trace())
+    {
+        TbotsProto::LatencyTrace latency_trace = primitives.latency_trace();
+        latency_trace.set_backend_sent_time_seconds(
+            createCurrentTimestamp()->epoch_timestamp_seconds());
+        Subject<TbotsProto::LatencyTrace>::sendValueToObservers(latency_trace);
+    }
+}
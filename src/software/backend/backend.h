@@ -1,5 +1,6 @@
 #pragma once
 
+#include "shared/proto/latency_trace_msg.pb.h"
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/subject.h"
@@ -13,8 +14,13 @@
  *
  * This produce/consume pattern is performed by extending both "Observer" and
  * "Subject". Please see the implementation of those classes for details.
+ *
+ * Once primitives have been sent, the backend also produces the LatencyTrace of the
+ * vision data they were created from, completing the trace it started when it received
+ * the vision data.
  */
 class Backend : public Subject<SensorProto>,
+                public Subject<TbotsProto::LatencyTrace>,
                 public FirstInFirstOutThreadedObserver<World>,
                 public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
 {
@@ -32,4 +38,13 @@ class Backend : public Subject<SensorProto>,
     void receiveRobotStatus(TbotsProto::RobotStatus msg);
     void receiveSSLWrapperPacket(SSLProto::SSL_WrapperPacket msg);
     void receiveSSLReferee(SSLProto::Referee msg);
+
+   protected:
+    /**
+     * Marks the given primitives as sent and sends their LatencyTrace to observers,
+     * if they have one
+     *
+     * @param primitives The primitives that were sent
+     */
+    void sendLatencyTrace(const TbotsProto::PrimitiveSet& primitives);
 };
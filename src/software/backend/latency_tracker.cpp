@@ -0,0 +1,123 @@
+#include "software/backend/latency_tracker.h"
+
+#include <iomanip>
+#include <sstream>
+
+LatencyTracker::LatencyTracker()
+    : stage_histograms(sizeLatencyStage(),
+                       LatencyHistogram(Duration::fromMilliseconds(
+                                            HISTOGRAM_BUCKET_WIDTH_MILLISECONDS),
+                                        HISTOGRAM_NUM_BUCKETS))
+{
+}
+
+void LatencyTracker::addLatencyTrace(const TbotsProto::LatencyTrace& latency_trace)
+{
+    for (LatencyStage stage : allValuesLatencyStage())
+    {
+        if (std::optional<Duration> latency = getStageLatency(latency_trace, stage))
+        {
+            stage_histograms[static_cast<std::size_t>(stage)].addLatency(*latency);
+        }
+    }
+}
+
+std::vector<LatencyStatistics> LatencyTracker::getLatencyStatistics() const
+{
+    std::vector<LatencyStatistics> statistics;
+    for (LatencyStage stage : allValuesLatencyStage())
+    {
+        const LatencyHistogram& histogram =
+            stage_histograms[static_cast<std::size_t>(stage)];
+        statistics.push_back(LatencyStatistics{
+            .stage                 = stage,
+            .num_latencies         = histogram.getNumLatencies(),
+            .mean_latency          = histogram.getMeanLatency(),
+            .median_latency        = histogram.getPercentileLatency(0.5),
+            .percentile_99_latency = histogram.getPercentileLatency(0.99),
+            .max_latency           = histogram.getMaxLatency()});
+    }
+    return statistics;
+}
+
+void LatencyTracker::clear()
+{
+    for (LatencyHistogram& histogram : stage_histograms)
+    {
+        histogram.clear();
+    }
+}
+
+std::optional<Duration> LatencyTracker::getStageLatency(
+    const TbotsProto::LatencyTrace& latency_trace, LatencyStage stage)
+{
+    double start_time_seconds = 0;
+    double end_time_seconds   = 0;
+    switch (stage)
+    {
+        case LatencyStage::RECEIVE:
+            start_time_seconds = latency_trace.camera_capture_time_seconds();
+            end_time_seconds   = latency_trace.backend_received_time_seconds();
+            break;
+        case LatencyStage::SENSOR_FUSION:
+            start_time_seconds = latency_trace.backend_received_time_seconds();
+            end_time_seconds   = latency_trace.sensor_fusion_time_seconds();
+            break;
+        case LatencyStage::AI_QUEUE:
+            start_time_seconds = latency_trace.sensor_fusion_time_seconds();
+            end_time_seconds   = latency_trace.ai_start_time_seconds();
+            break;
+        case LatencyStage::STP:
+            start_time_seconds = latency_trace.ai_start_time_seconds();
+            end_time_seconds   = latency_trace.stp_time_seconds();
+            break;
+        case LatencyStage::NAVIGATOR:
+            start_time_seconds = latency_trace.stp_time_seconds();
+            end_time_seconds   = latency_trace.navigator_time_seconds();
+            break;
+        case LatencyStage::SEND:
+            start_time_seconds = latency_trace.navigator_time_seconds();
+            end_time_seconds   = latency_trace.backend_sent_time_seconds();
+            break;
+        case LatencyStage::TOTAL:
+            start_time_seconds = latency_trace.backend_received_time_seconds();
+            end_time_seconds   = latency_trace.backend_sent_time_seconds();
+            break;
+    }
+
+    // Times the trace has not reached are 0
+    if (start_time_seconds == 0 || end_time_seconds == 0)
+    {
+        return std::nullopt;
+    }
+    return Duration::fromSeconds(end_time_seconds - start_time_seconds);
+}
+
+std::string LatencyTracker::createCsvHeader()
+{
+    std::ostringstream header;
+    header << "backend_received_time_seconds";
+    for (LatencyStage stage : allValuesLatencyStage())
+    {
+        header << "," << stage << "_ms";
+    }
+    header << "\n";
+    return header.str();
+}
+
+std::string LatencyTracker::createCsvRow(const TbotsProto::LatencyTrace& latency_trace)
+{
+    std::ostringstream row;
+    row << std::fixed << std::setprecision(6)
+        << latency_trace.backend_received_time_seconds() << std::setprecision(3);
+    for (LatencyStage stage : allValuesLatencyStage())
+    {
+        row << ",";
+        if (std::optional<Duration> latency = getStageLatency(latency_trace, stage))
+        {
+            row << latency->toMilliseconds();
+        }
+    }
+    row << "\n";
+    return row.str();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "shared/proto/latency_trace_msg.pb.h"
+#include "software/time/duration.h"
+#include "software/time/latency_histogram.h"
+#include "software/util/make_enum/make_enum.h"
+
+/**
+ * The stages of the full system that the latency between a camera capturing a frame and
+ * the primitives created from it being sent is broken down into
+ *
+ * RECEIVE: From the camera capturing the frame to the backend receiving it. This
+ * includes the clock offset between the vision computer and us.
+ * SENSOR_FUSION: From the backend receiving the frame to SensorFusion creating a World
+ * AI_QUEUE: From SensorFusion creating the World to the AI starting to run on it
+ * STP: From the AI starting to STP assigning intents
+ * NAVIGATOR: From STP assigning intents to the Navigator creating primitives
+ * SEND: From the Navigator creating primitives to the backend sending them
+ * TOTAL: From the backend receiving the frame to sending the primitives, which does
+ * not depend on the vision computer's clock
+ */
+MAKE_ENUM(LatencyStage, RECEIVE, SENSOR_FUSION, AI_QUEUE, STP, NAVIGATOR, SEND, TOTAL);
+
+/**
+ * Statistics about the latency of a single stage
+ */
+struct LatencyStatistics
+{
+    LatencyStage stage;
+    unsigned int num_latencies;
+    Duration mean_latency;
+    Duration median_latency;
+    Duration percentile_99_latency;
+    Duration max_latency;
+};
+
+/**
+ * The LatencyTracker keeps histograms of the latency of each stage of complete
+ * LatencyTraces
+ */
+class LatencyTracker
+{
+   public:
+    /**
+     * Creates a new LatencyTracker that has not tracked any LatencyTraces
+     */
+    explicit LatencyTracker();
+
+    /**
+     * Adds the latency of each stage the given trace went through to the histograms
+     *
+     * @param latency_trace The trace to add
+     */
+    void addLatencyTrace(const TbotsProto::LatencyTrace& latency_trace);
+
+    /**
+     * Returns the statistics of each stage, in the order of the stages
+     *
+     * @return the statistics of each stage
+     */
+    std::vector<LatencyStatistics> getLatencyStatistics() const;
+
+    /**
+     * Removes all the traces that have been added
+     */
+    void clear();
+
+    /**
+     * Returns the latency of the given stage of the given trace
+     *
+     * @param latency_trace The trace to get the latency from
+     * @param stage The stage to get the latency of
+     *
+     * @return the latency of the stage, or std::nullopt if the trace does not have the
+     * times at the start or end of the stage
+     */
+    static std::optional<Duration> getStageLatency(
+        const TbotsProto::LatencyTrace& latency_trace, LatencyStage stage);
+
+    /**
+     * Creates the header and rows of a CSV file with the latency of each stage of
+     * traces in milliseconds. Stages the trace did not go through are left empty.
+     *
+     * @param latency_trace The trace to create a row for
+     *
+     * @return the line of the CSV file, including the trailing newline
+     */
+    static std::string createCsvHeader();
+    static std::string createCsvRow(const TbotsProto::LatencyTrace& latency_trace);
+
+   private:
+    // Indexed by LatencyStage
+    std::vector<LatencyHistogram> stage_histograms;
+
+    // The histograms cover latencies up to 200ms with a resolution of 0.25ms
+    static constexpr double HISTOGRAM_BUCKET_WIDTH_MILLISECONDS = 0.25;
+    static constexpr unsigned int HISTOGRAM_NUM_BUCKETS         = 800;
+};
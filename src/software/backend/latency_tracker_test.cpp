@@ -0,0 +1,84 @@
+#include "software/backend/latency_tracker.h"
+
+#include <gtest/gtest.h>
+
+class LatencyTrackerTest : public ::testing::Test
+{
+   protected:
+    static TbotsProto::LatencyTrace createLatencyTrace(double start_time_seconds)
+    {
+        TbotsProto::LatencyTrace latency_trace;
+        latency_trace.set_camera_capture_time_seconds(start_time_seconds);
+        latency_trace.set_backend_received_time_seconds(start_time_seconds + 0.004);
+        latency_trace.set_sensor_fusion_time_seconds(start_time_seconds + 0.005);
+        latency_trace.set_ai_start_time_seconds(start_time_seconds + 0.007);
+        latency_trace.set_stp_time_seconds(start_time_seconds + 0.010);
+        latency_trace.set_navigator_time_seconds(start_time_seconds + 0.018);
+        latency_trace.set_backend_sent_time_seconds(start_time_seconds + 0.019);
+        return latency_trace;
+    }
+};
+
+TEST_F(LatencyTrackerTest, stage_latencies_of_complete_trace)
+{
+    TbotsProto::LatencyTrace latency_trace = createLatencyTrace(1000);
+
+    std::vector<std::pair<LatencyStage, double>> expected_latencies_ms = {
+        {LatencyStage::RECEIVE, 4},   {LatencyStage::SENSOR_FUSION, 1},
+        {LatencyStage::AI_QUEUE, 2},  {LatencyStage::STP, 3},
+        {LatencyStage::NAVIGATOR, 8}, {LatencyStage::SEND, 1},
+        {LatencyStage::TOTAL, 15}};
+    for (const auto& [stage, expected_latency_ms] : expected_latencies_ms)
+    {
+        std::optional<Duration> latency =
+            LatencyTracker::getStageLatency(latency_trace, stage);
+        ASSERT_TRUE(latency) << stage;
+        EXPECT_NEAR(latency->toMilliseconds(), expected_latency_ms, 1e-3) << stage;
+    }
+}
+
+TEST_F(LatencyTrackerTest, stages_of_incomplete_trace_have_no_latency)
+{
+    TbotsProto::LatencyTrace latency_trace = createLatencyTrace(1000);
+    latency_trace.clear_camera_capture_time_seconds();
+    latency_trace.clear_backend_sent_time_seconds();
+
+    EXPECT_FALSE(LatencyTracker::getStageLatency(latency_trace, LatencyStage::RECEIVE));
+    EXPECT_FALSE(LatencyTracker::getStageLatency(latency_trace, LatencyStage::SEND));
+    EXPECT_FALSE(LatencyTracker::getStageLatency(latency_trace, LatencyStage::TOTAL));
+    EXPECT_TRUE(LatencyTracker::getStageLatency(latency_trace, LatencyStage::STP));
+}
+
+TEST_F(LatencyTrackerTest, statistics_of_traces)
+{
+    LatencyTracker latency_tracker;
+    for (int i = 0; i < 10; i++)
+    {
+        latency_tracker.addLatencyTrace(createLatencyTrace(1000 + i));
+    }
+
+    std::vector<LatencyStatistics> statistics = latency_tracker.getLatencyStatistics();
+    ASSERT_EQ(statistics.size(), sizeLatencyStage());
+    const LatencyStatistics& navigator_statistics =
+        statistics[static_cast<std::size_t>(LatencyStage::NAVIGATOR)];
+    EXPECT_EQ(navigator_statistics.stage, LatencyStage::NAVIGATOR);
+    EXPECT_EQ(navigator_statistics.num_latencies, 10);
+    EXPECT_NEAR(navigator_statistics.mean_latency.toMilliseconds(), 8, 1e-3);
+    EXPECT_NEAR(navigator_statistics.median_latency.toMilliseconds(), 8, 0.25);
+    EXPECT_NEAR(navigator_statistics.max_latency.toMilliseconds(), 8, 1e-3);
+
+    latency_tracker.clear();
+    EXPECT_EQ(latency_tracker.getLatencyStatistics()[0].num_latencies, 0);
+}
+
+TEST_F(LatencyTrackerTest, csv_rows_match_header)
+{
+    TbotsProto::LatencyTrace latency_trace = createLatencyTrace(1000);
+    latency_trace.clear_camera_capture_time_seconds();
+
+    EXPECT_EQ(LatencyTracker::createCsvHeader(),
+              "backend_received_time_seconds,RECEIVE_ms,SENSOR_FUSION_ms,AI_QUEUE_ms,"
+              "STP_ms,NAVIGATOR_ms,SEND_ms,TOTAL_ms\n");
+    EXPECT_EQ(LatencyTracker::createCsvRow(latency_trace),
+              "1000.004000,,1.000,2.000,3.000,8.000,1.000,15.000\n");
+}
@@ -19,6 +19,7 @@ RadioBackend::RadioBackend(std::shared_ptr<const BackendConfig> config)
 void RadioBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
 {
     radio_output.sendPrimitives(primitives);
+    sendLatencyTrace(primitives);
 }
 
 void RadioBackend::onValueReceived(World world)
@@ -45,7 +45,7 @@ void ReplayBackend::continuouslyPullFromReplayFiles()
                     (this_msg_received_time - *last_msg_received_time));
             }
         }
-        this->sendValueToObservers(*sensor_msg_or_null);
+        Subject<SensorProto>::sendValueToObservers(*sensor_msg_or_null);
         last_msg_replayed_time = std::chrono::steady_clock::now();
         last_msg_received_time = this_msg_received_time;
     }
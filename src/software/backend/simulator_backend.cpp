@@ -44,6 +44,8 @@ void SimulatorBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
     {
         defending_side_output->sendProto(*createDefendingSide(FieldSide::NEG_X));
     }
+
+    sendLatencyTrace(primitives);
 }
 
 void SimulatorBackend::onValueReceived(World world)
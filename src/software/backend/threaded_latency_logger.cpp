@@ -0,0 +1,16 @@
+#include "software/backend/threaded_latency_logger.h"
+
+#include "software/backend/latency_tracker.h"
+#include "software/logger/logger.h"
+
+ThreadedLatencyLogger::ThreadedLatencyLogger(const std::string& csv_file_name)
+    : FirstInFirstOutThreadedObserver<TbotsProto::LatencyTrace>(),
+      csv_file_name(csv_file_name)
+{
+    LOG(CSV, csv_file_name) << LatencyTracker::createCsvHeader();
+}
+
+void ThreadedLatencyLogger::onValueReceived(TbotsProto::LatencyTrace latency_trace)
+{
+    LOG(CSV, csv_file_name) << LatencyTracker::createCsvRow(latency_trace);
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "shared/proto/latency_trace_msg.pb.h"
+#include "software/multithreading/first_in_first_out_threaded_observer.h"
+
+/**
+ * The ThreadedLatencyLogger logs the latency of each stage of the LatencyTraces it
+ * receives to a CSV file in the logging directory, with a row per trace
+ */
+class ThreadedLatencyLogger
+    : public FirstInFirstOutThreadedObserver<TbotsProto::LatencyTrace>
+{
+   public:
+    /**
+     * Creates a new ThreadedLatencyLogger and logs the header of the CSV file
+     *
+     * @param csv_file_name The name of the CSV file to log to, which must end in .csv
+     */
+    explicit ThreadedLatencyLogger(const std::string& csv_file_name);
+
+   private:
+    void onValueReceived(TbotsProto::LatencyTrace latency_trace) override;
+
+    const std::string csv_file_name;
+};
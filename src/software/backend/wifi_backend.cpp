@@ -44,6 +44,8 @@ void WifiBackend::onValueReceived(TbotsProto::PrimitiveSet primitives)
     {
         defending_side_output->sendProto(*createDefendingSide(FieldSide::NEG_X));
     }
+
+    sendLatencyTrace(primitives);
 }
 
 void WifiBackend::onValueReceived(World world)
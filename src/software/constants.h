@@ -6,6 +6,14 @@
 // considered as "gone" and no longer reported.
 static constexpr unsigned int ROBOT_DEBOUNCE_DURATION_MILLISECONDS = 200;
 
+// The CSV file in the logging directory that the latency of each stage of the full
+// system is logged to
+static const std::string LATENCY_TRACE_CSV_FILE_NAME = "latency_trace.csv";
+
+
+// The port the AI streams its draw commands on, so that they can be rendered by a GUI
+// running in another process
+static constexpr unsigned short DRAW_COMMANDS_PORT = 42075;
 
 static constexpr unsigned int MAX_SIMULATOR_MULTICAST_CHANNELS = 16;
 
@@ -1,20 +1,27 @@
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <csignal>
 #include <experimental/filesystem>
 #include <iostream>
 #include <numeric>
+#include <thread>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/play_info.h"
 #include "software/ai/threaded_ai.h"
 #include "software/backend/backend.h"
+#include "software/backend/threaded_latency_logger.h"
 #include "software/constants.h"
 #include "software/gui/full_system/threaded_full_system_gui.h"
 #include "software/logger/logger.h"
 #include "software/multithreading/observer_subject_adapter.h"
+#include "software/networking/threaded_draw_commands_sender.h"
 #include "software/proto/logging/proto_logger.h"
 #include "software/proto/message_translation/ssl_wrapper.h"
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
+#include "software/util/coroutine_stack_pool/coroutine_stack_pool.h"
 #include "software/util/design_patterns/generic_factory.h"
+#include "software/util/profiler/profiler.h"
 
 // clang-format off
 std::string BANNER =
@@ -29,6 +36,14 @@ std::string BANNER =
 "  /'                                                                                                                     /'          \n";
 // clang-format on
 
+// Set when SIGINT is received while running headless, so that the full system can
+// shut down cleanly
+static volatile std::sig_atomic_t interrupt_received = 0;
+
+static void handleInterrupt(int)
+{
+    interrupt_received = 1;
+}
 
 int main(int argc, char** argv)
 {
@@ -68,6 +83,9 @@ int main(int argc, char** argv)
         auto ai = std::make_shared<ThreadedAI>(thunderbots_config->getAiConfig(),
                                                thunderbots_config->getAiControlConfig(),
                                                thunderbots_config->getPlayConfig());
+        // Log the latency of each stage of the full system
+        auto latency_logger =
+            std::make_shared<ThreadedLatencyLogger>(LATENCY_TRACE_CSV_FILE_NAME);
         std::shared_ptr<ThreadedFullSystemGUI> visualizer;
 
         // Connect observers
@@ -75,6 +93,7 @@ int main(int argc, char** argv)
         sensor_fusion->Subject<World>::registerObserver(ai);
         backend->Subject<SensorProto>::registerObserver(sensor_fusion);
         sensor_fusion->Subject<World>::registerObserver(backend);
+        backend->Subject<TbotsProto::LatencyTrace>::registerObserver(latency_logger);
         if (!args->getHeadless()->value())
         {
             visualizer =
@@ -82,9 +101,20 @@ int main(int argc, char** argv)
 
             sensor_fusion->Subject<World>::registerObserver(visualizer);
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(visualizer);
-            ai->Subject<AIDrawFunction>::registerObserver(visualizer);
+            ai->Subject<std::shared_ptr<const DrawCommandsProto>>::registerObserver(
+                visualizer);
             ai->Subject<PlayInfo>::registerObserver(visualizer);
             backend->Subject<SensorProto>::registerObserver(visualizer);
+            backend->Subject<TbotsProto::LatencyTrace>::registerObserver(visualizer);
+        }
+
+        std::shared_ptr<ThreadedDrawCommandsSender> draw_commands_sender;
+        if (!args->getDrawCommandsAddress()->value().empty())
+        {
+            draw_commands_sender = std::make_shared<ThreadedDrawCommandsSender>(
+                args->getDrawCommandsAddress()->value(), DRAW_COMMANDS_PORT);
+            ai->Subject<std::shared_ptr<const DrawCommandsProto>>::registerObserver(
+                draw_commands_sender);
         }
 
         if (!args->getProtoLogOutputDir()->value().empty())
@@ -110,6 +140,13 @@ int main(int argc, char** argv)
             backend->Subject<SensorProto>::registerObserver(sensor_msg_logger);
             ai->Subject<TbotsProto::PrimitiveSet>::registerObserver(primitive_set_logger);
 
+            // log the latency traces of the primitives that were sent
+            auto latency_trace_logger =
+                std::make_shared<ProtoLogger<TbotsProto::LatencyTrace>>(
+                    proto_log_output_dir / "Backend_LatencyTrace");
+            backend->Subject<TbotsProto::LatencyTrace>::registerObserver(
+                latency_trace_logger);
+
             // log filtered world state
             bool friendly_colour_yellow = thunderbots_config->getSensorFusionConfig()
                                               ->getFriendlyColorYellow()
@@ -142,8 +179,31 @@ int main(int argc, char** argv)
         }
         else
         {
-            // This blocks forever without using the CPU
-            std::promise<void>().get_future().wait();
+            // Wait for SIGINT so that the stats and profile below are written before
+            // exiting
+            std::signal(SIGINT, handleInterrupt);
+            while (!interrupt_received)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+
+        // Report how much of the coroutine stacks the AI actually used, so that
+        // CoroutineStackPool::DEFAULT_STACK_SIZE can be tuned
+        auto ai_stack_pool = CoroutineStackPool::getAIStackPool();
+        LOG(INFO) << "AI coroutine stacks: " << ai_stack_pool->getNumStacks()
+                  << " stacks of " << ai_stack_pool->getStackSize()
+                  << " bytes, deepest use " << ai_stack_pool->getHighWaterMark()
+                  << " bytes";
+
+        if (!args->getProfileOutputFile()->value().empty())
+        {
+#ifndef TBOTS_ENABLE_PROFILING
+            LOG(WARNING) << "Profiling is compiled out, so the profile will be empty. "
+                         << "Build with --config=profile to record it.";
+#endif
+            Profiler::writeChromeTrace(args->getProfileOutputFile()->value());
+            LOG(INFO) << "Wrote profile to " << args->getProfileOutputFile()->value();
         }
     }
 
@@ -0,0 +1,699 @@
+#include "software/geom/algorithms/batched_geometry.h"
+
+#include <stdexcept>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+// The SIMD implementations below use the same operations in the same order as the
+// scalar functions they are based on, so that they give exactly the same results. The
+// AVX2 functions are compiled for AVX2 without enabling FMA, since the compiler could
+// otherwise fuse a multiply and add and round the result differently.
+
+bool isSimdInstructionSetSupported(SimdInstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case SimdInstructionSet::SCALAR:
+            return true;
+#if defined(__x86_64__)
+        case SimdInstructionSet::SSE2:
+            // SSE2 is part of the x86-64 instruction set, so is always supported
+            return true;
+        case SimdInstructionSet::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+SimdInstructionSet bestSimdInstructionSet()
+{
+    static const SimdInstructionSet best_instruction_set = []() {
+        for (SimdInstructionSet instruction_set :
+             {SimdInstructionSet::AVX2, SimdInstructionSet::SSE2})
+        {
+            if (isSimdInstructionSetSupported(instruction_set))
+            {
+                return instruction_set;
+            }
+        }
+        return SimdInstructionSet::SCALAR;
+    }();
+    return best_instruction_set;
+}
+
+/**
+ * Throws an exception if the given instruction set is not supported
+ *
+ * @param instruction_set The instruction set to check
+ *
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+static void checkSimdInstructionSetSupported(SimdInstructionSet instruction_set)
+{
+    if (!isSimdInstructionSetSupported(instruction_set))
+    {
+        throw std::invalid_argument("The " + toString(instruction_set) +
+                                    " instruction set is not supported");
+    }
+}
+
+PointBatch::PointBatch(const std::vector<Point> &points)
+{
+    x_.reserve(points.size());
+    y_.reserve(points.size());
+    for (const Point &point : points)
+    {
+        add(point);
+    }
+}
+
+void PointBatch::add(const Point &point)
+{
+    x_.push_back(point.x());
+    y_.push_back(point.y());
+}
+
+void PointBatch::clear()
+{
+    x_.clear();
+    y_.clear();
+}
+
+std::size_t PointBatch::size() const
+{
+    return x_.size();
+}
+
+Point PointBatch::get(std::size_t index) const
+{
+    return Point(x_[index], y_[index]);
+}
+
+const std::vector<double> &PointBatch::x() const
+{
+    return x_;
+}
+
+const std::vector<double> &PointBatch::y() const
+{
+    return y_;
+}
+
+CircleBatch::CircleBatch(const std::vector<Circle> &circles)
+{
+    origin_x_.reserve(circles.size());
+    origin_y_.reserve(circles.size());
+    radius_.reserve(circles.size());
+    for (const Circle &circle : circles)
+    {
+        add(circle);
+    }
+}
+
+void CircleBatch::add(const Circle &circle)
+{
+    origin_x_.push_back(circle.origin().x());
+    origin_y_.push_back(circle.origin().y());
+    radius_.push_back(circle.radius());
+}
+
+void CircleBatch::clear()
+{
+    origin_x_.clear();
+    origin_y_.clear();
+    radius_.clear();
+}
+
+std::size_t CircleBatch::size() const
+{
+    return radius_.size();
+}
+
+Circle CircleBatch::get(std::size_t index) const
+{
+    return Circle(Point(origin_x_[index], origin_y_[index]), radius_[index]);
+}
+
+const std::vector<double> &CircleBatch::originX() const
+{
+    return origin_x_;
+}
+
+const std::vector<double> &CircleBatch::originY() const
+{
+    return origin_y_;
+}
+
+const std::vector<double> &CircleBatch::radius() const
+{
+    return radius_;
+}
+
+SegmentBatch::SegmentBatch(const std::vector<Segment> &segments)
+{
+    start_x_.reserve(segments.size());
+    start_y_.reserve(segments.size());
+    end_x_.reserve(segments.size());
+    end_y_.reserve(segments.size());
+    for (const Segment &segment : segments)
+    {
+        add(segment);
+    }
+}
+
+void SegmentBatch::add(const Segment &segment)
+{
+    start_x_.push_back(segment.getStart().x());
+    start_y_.push_back(segment.getStart().y());
+    end_x_.push_back(segment.getEnd().x());
+    end_y_.push_back(segment.getEnd().y());
+}
+
+void SegmentBatch::clear()
+{
+    start_x_.clear();
+    start_y_.clear();
+    end_x_.clear();
+    end_y_.clear();
+}
+
+std::size_t SegmentBatch::size() const
+{
+    return start_x_.size();
+}
+
+Segment SegmentBatch::get(std::size_t index) const
+{
+    return Segment(Point(start_x_[index], start_y_[index]),
+                   Point(end_x_[index], end_y_[index]));
+}
+
+const std::vector<double> &SegmentBatch::startX() const
+{
+    return start_x_;
+}
+
+const std::vector<double> &SegmentBatch::startY() const
+{
+    return start_y_;
+}
+
+const std::vector<double> &SegmentBatch::endX() const
+{
+    return end_x_;
+}
+
+const std::vector<double> &SegmentBatch::endY() const
+{
+    return end_y_;
+}
+
+#if defined(__x86_64__)
+
+/**
+ * Finds the squared distance between 2 points and 2 segments with SSE2, the same as
+ * distanceSquared(const Point &, const Segment &)
+ *
+ * @param px, py The coordinates of the points
+ * @param sx, sy, ex, ey The coordinates of the start and end points of the segments
+ *
+ * @return the squared distance between each point and segment
+ */
+static inline __m128d distanceSquaredSse2(__m128d px, __m128d py, __m128d sx, __m128d sy,
+                                          __m128d ex, __m128d ey)
+{
+    const __m128d zero = _mm_setzero_pd();
+    __m128d seg_x      = _mm_sub_pd(ex, sx);
+    __m128d seg_y      = _mm_sub_pd(ey, sy);
+    __m128d start_x    = _mm_sub_pd(px, sx);
+    __m128d start_y    = _mm_sub_pd(py, sy);
+    __m128d end_x      = _mm_sub_pd(px, ex);
+    __m128d end_y      = _mm_sub_pd(py, ey);
+
+    __m128d start_dot =
+        _mm_add_pd(_mm_mul_pd(seg_x, start_x), _mm_mul_pd(seg_y, start_y));
+    __m128d end_dot = _mm_add_pd(_mm_mul_pd(seg_x, end_x), _mm_mul_pd(seg_y, end_y));
+    __m128d start_length_squared =
+        _mm_add_pd(_mm_mul_pd(start_x, start_x), _mm_mul_pd(start_y, start_y));
+    __m128d end_length_squared =
+        _mm_add_pd(_mm_mul_pd(end_x, end_x), _mm_mul_pd(end_y, end_y));
+    __m128d seg_length_squared =
+        _mm_add_pd(_mm_mul_pd(seg_x, seg_x), _mm_mul_pd(seg_y, seg_y));
+    __m128d cross = _mm_sub_pd(_mm_mul_pd(start_x, seg_y), _mm_mul_pd(start_y, seg_x));
+    // Clearing the sign bit takes the absolute value
+    __m128d perpendicular_distance_squared = _mm_andnot_pd(
+        _mm_set1_pd(-0.0), _mm_div_pd(_mm_mul_pd(cross, cross), seg_length_squared));
+
+    // SSE2 has no blend instruction, so select the result for each lane with masks
+    __m128d before_start = _mm_cmple_pd(start_dot, zero);
+    __m128d after_end    = _mm_cmpge_pd(end_dot, zero);
+    __m128d result       = _mm_or_pd(_mm_and_pd(after_end, end_length_squared),
+                               _mm_andnot_pd(after_end, perpendicular_distance_squared));
+    return _mm_or_pd(_mm_and_pd(before_start, start_length_squared),
+                     _mm_andnot_pd(before_start, result));
+}
+
+/**
+ * Finds the squared distance between 4 points and 4 segments with AVX2, the same as
+ * distanceSquared(const Point &, const Segment &)
+ *
+ * @param px, py The coordinates of the points
+ * @param sx, sy, ex, ey The coordinates of the start and end points of the segments
+ *
+ * @return the squared distance between each point and segment
+ */
+__attribute__((target("avx2"))) static inline __m256d distanceSquaredAvx2(
+    __m256d px, __m256d py, __m256d sx, __m256d sy, __m256d ex, __m256d ey)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    __m256d seg_x      = _mm256_sub_pd(ex, sx);
+    __m256d seg_y      = _mm256_sub_pd(ey, sy);
+    __m256d start_x    = _mm256_sub_pd(px, sx);
+    __m256d start_y    = _mm256_sub_pd(py, sy);
+    __m256d end_x      = _mm256_sub_pd(px, ex);
+    __m256d end_y      = _mm256_sub_pd(py, ey);
+
+    __m256d start_dot =
+        _mm256_add_pd(_mm256_mul_pd(seg_x, start_x), _mm256_mul_pd(seg_y, start_y));
+    __m256d end_dot =
+        _mm256_add_pd(_mm256_mul_pd(seg_x, end_x), _mm256_mul_pd(seg_y, end_y));
+    __m256d start_length_squared =
+        _mm256_add_pd(_mm256_mul_pd(start_x, start_x), _mm256_mul_pd(start_y, start_y));
+    __m256d end_length_squared =
+        _mm256_add_pd(_mm256_mul_pd(end_x, end_x), _mm256_mul_pd(end_y, end_y));
+    __m256d seg_length_squared =
+        _mm256_add_pd(_mm256_mul_pd(seg_x, seg_x), _mm256_mul_pd(seg_y, seg_y));
+    __m256d cross =
+        _mm256_sub_pd(_mm256_mul_pd(start_x, seg_y), _mm256_mul_pd(start_y, seg_x));
+    // Clearing the sign bit takes the absolute value
+    __m256d perpendicular_distance_squared =
+        _mm256_andnot_pd(_mm256_set1_pd(-0.0),
+                         _mm256_div_pd(_mm256_mul_pd(cross, cross), seg_length_squared));
+
+    __m256d before_start = _mm256_cmp_pd(start_dot, zero, _CMP_LE_OQ);
+    __m256d after_end    = _mm256_cmp_pd(end_dot, zero, _CMP_GE_OQ);
+    __m256d result =
+        _mm256_blendv_pd(perpendicular_distance_squared, end_length_squared, after_end);
+    return _mm256_blendv_pd(result, start_length_squared, before_start);
+}
+
+/**
+ * Finds the distance between a point and as many segments in a batch as can be
+ * processed 2 at a time with SSE2
+ *
+ * @param point The point
+ * @param segments The segments
+ * @param distances The array to store the distance to each segment in
+ *
+ * @return the number of segments processed
+ */
+static std::size_t distanceSse2(const Point &point, const SegmentBatch &segments,
+                                double *distances)
+{
+    const __m128d px = _mm_set1_pd(point.x());
+    const __m128d py = _mm_set1_pd(point.y());
+    std::size_t i    = 0;
+    for (; i + 2 <= segments.size(); i += 2)
+    {
+        __m128d distance_squared = distanceSquaredSse2(
+            px, py, _mm_loadu_pd(&segments.startX()[i]),
+            _mm_loadu_pd(&segments.startY()[i]), _mm_loadu_pd(&segments.endX()[i]),
+            _mm_loadu_pd(&segments.endY()[i]));
+        _mm_storeu_pd(&distances[i], _mm_sqrt_pd(distance_squared));
+    }
+    return i;
+}
+
+/**
+ * Finds the distance between a point and as many segments in a batch as can be
+ * processed 4 at a time with AVX2
+ *
+ * @param point The point
+ * @param segments The segments
+ * @param distances The array to store the distance to each segment in
+ *
+ * @return the number of segments processed
+ */
+__attribute__((target("avx2"))) static std::size_t distanceAvx2(
+    const Point &point, const SegmentBatch &segments, double *distances)
+{
+    const __m256d px = _mm256_set1_pd(point.x());
+    const __m256d py = _mm256_set1_pd(point.y());
+    std::size_t i    = 0;
+    for (; i + 4 <= segments.size(); i += 4)
+    {
+        __m256d distance_squared = distanceSquaredAvx2(
+            px, py, _mm256_loadu_pd(&segments.startX()[i]),
+            _mm256_loadu_pd(&segments.startY()[i]), _mm256_loadu_pd(&segments.endX()[i]),
+            _mm256_loadu_pd(&segments.endY()[i]));
+        _mm256_storeu_pd(&distances[i], _mm256_sqrt_pd(distance_squared));
+    }
+    return i;
+}
+
+/**
+ * Checks whether a segment intersects 2 circles in a batch with SSE2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param index The index of the first of the 2 circles
+ *
+ * @return a mask with bit i set if the segment intersects circle index + i
+ */
+static inline int intersectsMaskSse2(const Segment &segment, const CircleBatch &circles,
+                                     std::size_t index)
+{
+    __m128d distance_squared = distanceSquaredSse2(
+        _mm_loadu_pd(&circles.originX()[index]), _mm_loadu_pd(&circles.originY()[index]),
+        _mm_set1_pd(segment.getStart().x()), _mm_set1_pd(segment.getStart().y()),
+        _mm_set1_pd(segment.getEnd().x()), _mm_set1_pd(segment.getEnd().y()));
+    return _mm_movemask_pd(_mm_cmple_pd(_mm_sqrt_pd(distance_squared),
+                                        _mm_loadu_pd(&circles.radius()[index])));
+}
+
+/**
+ * Checks whether a segment intersects 4 circles in a batch with AVX2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param index The index of the first of the 4 circles
+ *
+ * @return a mask with bit i set if the segment intersects circle index + i
+ */
+__attribute__((target("avx2"))) static inline int intersectsMaskAvx2(
+    const Segment &segment, const CircleBatch &circles, std::size_t index)
+{
+    __m256d distance_squared = distanceSquaredAvx2(
+        _mm256_loadu_pd(&circles.originX()[index]),
+        _mm256_loadu_pd(&circles.originY()[index]),
+        _mm256_set1_pd(segment.getStart().x()), _mm256_set1_pd(segment.getStart().y()),
+        _mm256_set1_pd(segment.getEnd().x()), _mm256_set1_pd(segment.getEnd().y()));
+    return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_sqrt_pd(distance_squared),
+                                            _mm256_loadu_pd(&circles.radius()[index]),
+                                            _CMP_LE_OQ));
+}
+
+/**
+ * Checks whether a segment intersects as many circles in a batch as can be processed 2
+ * at a time with SSE2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param intersections Set to whether the segment intersects each circle processed
+ *
+ * @return the number of circles processed
+ */
+static std::size_t intersectsSse2(const Segment &segment, const CircleBatch &circles,
+                                  std::vector<bool> &intersections)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= circles.size(); i += 2)
+    {
+        int mask             = intersectsMaskSse2(segment, circles, i);
+        intersections[i]     = mask & 1;
+        intersections[i + 1] = mask & 2;
+    }
+    return i;
+}
+
+/**
+ * Checks whether a segment intersects as many circles in a batch as can be processed 4
+ * at a time with AVX2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param intersections Set to whether the segment intersects each circle processed
+ *
+ * @return the number of circles processed
+ */
+__attribute__((target("avx2"))) static std::size_t intersectsAvx2(
+    const Segment &segment, const CircleBatch &circles, std::vector<bool> &intersections)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= circles.size(); i += 4)
+    {
+        int mask             = intersectsMaskAvx2(segment, circles, i);
+        intersections[i]     = mask & 1;
+        intersections[i + 1] = mask & 2;
+        intersections[i + 2] = mask & 4;
+        intersections[i + 3] = mask & 8;
+    }
+    return i;
+}
+
+/**
+ * Checks whether a segment intersects any of as many circles in a batch as can be
+ * processed 2 at a time with SSE2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param num_processed Set to the number of circles processed, if none of them
+ * intersect the segment
+ *
+ * @return whether the segment intersects any of the circles processed
+ */
+static bool intersectsAnySse2(const Segment &segment, const CircleBatch &circles,
+                              std::size_t &num_processed)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= circles.size(); i += 2)
+    {
+        if (intersectsMaskSse2(segment, circles, i))
+        {
+            return true;
+        }
+    }
+    num_processed = i;
+    return false;
+}
+
+/**
+ * Checks whether a segment intersects any of as many circles in a batch as can be
+ * processed 4 at a time with AVX2
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param num_processed Set to the number of circles processed, if none of them
+ * intersect the segment
+ *
+ * @return whether the segment intersects any of the circles processed
+ */
+__attribute__((target("avx2"))) static bool intersectsAnyAvx2(const Segment &segment,
+                                                              const CircleBatch &circles,
+                                                              std::size_t &num_processed)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= circles.size(); i += 4)
+    {
+        if (intersectsMaskAvx2(segment, circles, i))
+        {
+            return true;
+        }
+    }
+    num_processed = i;
+    return false;
+}
+
+/**
+ * Checks whether a polygon contains as many points in a batch as can be processed 2 at
+ * a time with SSE2, using the same algorithm as contains(const Polygon &, const Point &)
+ *
+ * @param polygon The polygon
+ * @param points The points
+ * @param containments Set to whether the polygon contains each point processed
+ *
+ * @return the number of points processed
+ */
+static std::size_t containsSse2(const Polygon &polygon, const PointBatch &points,
+                                std::vector<bool> &containments)
+{
+    const std::vector<Point> &vertices = polygon.getPoints();
+    std::size_t i                      = 0;
+    for (; i + 2 <= points.size(); i += 2)
+    {
+        __m128d px                 = _mm_loadu_pd(&points.x()[i]);
+        __m128d py                 = _mm_loadu_pd(&points.y()[i]);
+        __m128d point_is_contained = _mm_setzero_pd();
+        for (std::size_t k = 0, j = vertices.size() - 1; k < vertices.size(); j = k++)
+        {
+            __m128d pix = _mm_set1_pd(vertices[k].x());
+            __m128d piy = _mm_set1_pd(vertices[k].y());
+            __m128d pjx = _mm_set1_pd(vertices[j].x());
+            __m128d pjy = _mm_set1_pd(vertices[j].y());
+            __m128d p_within_edge_y_range =
+                _mm_xor_pd(_mm_cmpgt_pd(piy, py), _mm_cmpgt_pd(pjy, py));
+            __m128d crossings = p_within_edge_y_range;
+            if (vertices[j].y() != vertices[k].y())
+            {
+                __m128d edge_x = _mm_add_pd(
+                    _mm_div_pd(_mm_mul_pd(_mm_sub_pd(pjx, pix), _mm_sub_pd(py, piy)),
+                               _mm_sub_pd(pjy, piy)),
+                    pix);
+                crossings = _mm_and_pd(crossings, _mm_cmplt_pd(px, edge_x));
+            }
+            point_is_contained = _mm_xor_pd(point_is_contained, crossings);
+        }
+        int mask            = _mm_movemask_pd(point_is_contained);
+        containments[i]     = mask & 1;
+        containments[i + 1] = mask & 2;
+    }
+    return i;
+}
+
+/**
+ * Checks whether a polygon contains as many points in a batch as can be processed 4 at
+ * a time with AVX2, using the same algorithm as contains(const Polygon &, const Point &)
+ *
+ * @param polygon The polygon
+ * @param points The points
+ * @param containments Set to whether the polygon contains each point processed
+ *
+ * @return the number of points processed
+ */
+__attribute__((target("avx2"))) static std::size_t containsAvx2(
+    const Polygon &polygon, const PointBatch &points, std::vector<bool> &containments)
+{
+    const std::vector<Point> &vertices = polygon.getPoints();
+    std::size_t i                      = 0;
+    for (; i + 4 <= points.size(); i += 4)
+    {
+        __m256d px                 = _mm256_loadu_pd(&points.x()[i]);
+        __m256d py                 = _mm256_loadu_pd(&points.y()[i]);
+        __m256d point_is_contained = _mm256_setzero_pd();
+        for (std::size_t k = 0, j = vertices.size() - 1; k < vertices.size(); j = k++)
+        {
+            __m256d pix                   = _mm256_set1_pd(vertices[k].x());
+            __m256d piy                   = _mm256_set1_pd(vertices[k].y());
+            __m256d pjx                   = _mm256_set1_pd(vertices[j].x());
+            __m256d pjy                   = _mm256_set1_pd(vertices[j].y());
+            __m256d p_within_edge_y_range = _mm256_xor_pd(
+                _mm256_cmp_pd(piy, py, _CMP_GT_OQ), _mm256_cmp_pd(pjy, py, _CMP_GT_OQ));
+            __m256d crossings = p_within_edge_y_range;
+            if (vertices[j].y() != vertices[k].y())
+            {
+                __m256d edge_x = _mm256_add_pd(
+                    _mm256_div_pd(
+                        _mm256_mul_pd(_mm256_sub_pd(pjx, pix), _mm256_sub_pd(py, piy)),
+                        _mm256_sub_pd(pjy, piy)),
+                    pix);
+                crossings =
+                    _mm256_and_pd(crossings, _mm256_cmp_pd(px, edge_x, _CMP_LT_OQ));
+            }
+            point_is_contained = _mm256_xor_pd(point_is_contained, crossings);
+        }
+        int mask            = _mm256_movemask_pd(point_is_contained);
+        containments[i]     = mask & 1;
+        containments[i + 1] = mask & 2;
+        containments[i + 2] = mask & 4;
+        containments[i + 3] = mask & 8;
+    }
+    return i;
+}
+
+#endif
+
+void distance(const Point &point, const SegmentBatch &segments,
+              std::vector<double> &distances, SimdInstructionSet instruction_set)
+{
+    checkSimdInstructionSetSupported(instruction_set);
+    distances.resize(segments.size());
+
+    std::size_t i = 0;
+#if defined(__x86_64__)
+    if (instruction_set == SimdInstructionSet::AVX2)
+    {
+        i = distanceAvx2(point, segments, distances.data());
+    }
+    else if (instruction_set == SimdInstructionSet::SSE2)
+    {
+        i = distanceSse2(point, segments, distances.data());
+    }
+#endif
+    // The segments left over after the SIMD implementations are processed one at a time
+    for (; i < segments.size(); i++)
+    {
+        distances[i] = distance(point, segments.get(i));
+    }
+}
+
+void intersects(const Segment &segment, const CircleBatch &circles,
+                std::vector<bool> &intersections, SimdInstructionSet instruction_set)
+{
+    checkSimdInstructionSetSupported(instruction_set);
+    intersections.resize(circles.size());
+
+    std::size_t i = 0;
+#if defined(__x86_64__)
+    if (instruction_set == SimdInstructionSet::AVX2)
+    {
+        i = intersectsAvx2(segment, circles, intersections);
+    }
+    else if (instruction_set == SimdInstructionSet::SSE2)
+    {
+        i = intersectsSse2(segment, circles, intersections);
+    }
+#endif
+    for (; i < circles.size(); i++)
+    {
+        intersections[i] = intersects(segment, circles.get(i));
+    }
+}
+
+bool intersectsAny(const Segment &segment, const CircleBatch &circles,
+                   SimdInstructionSet instruction_set)
+{
+    checkSimdInstructionSetSupported(instruction_set);
+
+    std::size_t i = 0;
+#if defined(__x86_64__)
+    if (instruction_set == SimdInstructionSet::AVX2 &&
+        intersectsAnyAvx2(segment, circles, i))
+    {
+        return true;
+    }
+    else if (instruction_set == SimdInstructionSet::SSE2 &&
+             intersectsAnySse2(segment, circles, i))
+    {
+        return true;
+    }
+#endif
+    for (; i < circles.size(); i++)
+    {
+        if (intersects(segment, circles.get(i)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void contains(const Polygon &polygon, const PointBatch &points,
+              std::vector<bool> &containments, SimdInstructionSet instruction_set)
+{
+    checkSimdInstructionSetSupported(instruction_set);
+    containments.resize(points.size());
+
+    std::size_t i = 0;
+#if defined(__x86_64__)
+    if (instruction_set == SimdInstructionSet::AVX2)
+    {
+        i = containsAvx2(polygon, points, containments);
+    }
+    else if (instruction_set == SimdInstructionSet::SSE2)
+    {
+        i = containsSse2(polygon, points, containments);
+    }
+#endif
+    for (; i < points.size(); i++)
+    {
+        containments[i] = contains(polygon, points.get(i));
+    }
+}
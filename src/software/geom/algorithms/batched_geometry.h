@@ -0,0 +1,282 @@
+#pragma once
+
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/polygon.h"
+#include "software/geom/segment.h"
+#include "software/util/make_enum/make_enum.h"
+
+/**
+ * Batched versions of some of the geometry queries in distance.h, intersects.h and
+ * contains.h, which evaluate one shape against many others at once.
+ *
+ * The shapes in a batch are stored as a structure of arrays (one array per coordinate)
+ * so that the queries can be evaluated for several shapes at a time with SIMD
+ * instructions. Every batched query gives exactly the same result for each shape as the
+ * scalar function it is based on, so it can be used as a drop-in replacement where the
+ * same query is made against many shapes, such as checking a pass against every enemy
+ * robot or rating every point of a grid.
+ */
+
+// The SIMD instruction sets the batched queries can use, from slowest to fastest.
+// SSE2 and AVX2 are only supported on x86-64 processors.
+MAKE_ENUM(SimdInstructionSet, SCALAR, SSE2, AVX2);
+
+/**
+ * Checks whether the batched queries can use the given instruction set on this processor
+ *
+ * @param instruction_set The instruction set to check
+ *
+ * @return whether the instruction set is supported
+ */
+bool isSimdInstructionSetSupported(SimdInstructionSet instruction_set);
+
+/**
+ * Gets the fastest instruction set supported by this processor
+ *
+ * @return the fastest supported instruction set
+ */
+SimdInstructionSet bestSimdInstructionSet();
+
+/**
+ * A batch of points, stored as a structure of arrays
+ */
+class PointBatch
+{
+   public:
+    PointBatch() = default;
+
+    /**
+     * Creates a batch of the given points
+     *
+     * @param points The points in the batch
+     */
+    explicit PointBatch(const std::vector<Point> &points);
+
+    /**
+     * Adds a point to the end of the batch
+     *
+     * @param point The point to add
+     */
+    void add(const Point &point);
+
+    /**
+     * Removes all the points from the batch, keeping the memory allocated for them
+     */
+    void clear();
+
+    /**
+     * Gets the number of points in the batch
+     *
+     * @return the number of points in the batch
+     */
+    std::size_t size() const;
+
+    /**
+     * Gets a point in the batch
+     *
+     * @param index The index of the point
+     *
+     * @return the point at the given index
+     */
+    Point get(std::size_t index) const;
+
+    /**
+     * Gets the coordinates of the points in the batch
+     *
+     * @return the coordinates of the points, in the same order as the points
+     */
+    const std::vector<double> &x() const;
+    const std::vector<double> &y() const;
+
+   private:
+    std::vector<double> x_;
+    std::vector<double> y_;
+};
+
+/**
+ * A batch of circles, stored as a structure of arrays
+ */
+class CircleBatch
+{
+   public:
+    CircleBatch() = default;
+
+    /**
+     * Creates a batch of the given circles
+     *
+     * @param circles The circles in the batch
+     */
+    explicit CircleBatch(const std::vector<Circle> &circles);
+
+    /**
+     * Adds a circle to the end of the batch
+     *
+     * @param circle The circle to add
+     */
+    void add(const Circle &circle);
+
+    /**
+     * Removes all the circles from the batch, keeping the memory allocated for them
+     */
+    void clear();
+
+    /**
+     * Gets the number of circles in the batch
+     *
+     * @return the number of circles in the batch
+     */
+    std::size_t size() const;
+
+    /**
+     * Gets a circle in the batch
+     *
+     * @param index The index of the circle
+     *
+     * @return the circle at the given index
+     */
+    Circle get(std::size_t index) const;
+
+    /**
+     * Gets the origins and radii of the circles in the batch
+     *
+     * @return the coordinates of the origins or the radii of the circles, in the same
+     * order as the circles
+     */
+    const std::vector<double> &originX() const;
+    const std::vector<double> &originY() const;
+    const std::vector<double> &radius() const;
+
+   private:
+    std::vector<double> origin_x_;
+    std::vector<double> origin_y_;
+    std::vector<double> radius_;
+};
+
+/**
+ * A batch of segments, stored as a structure of arrays
+ */
+class SegmentBatch
+{
+   public:
+    SegmentBatch() = default;
+
+    /**
+     * Creates a batch of the given segments
+     *
+     * @param segments The segments in the batch
+     */
+    explicit SegmentBatch(const std::vector<Segment> &segments);
+
+    /**
+     * Adds a segment to the end of the batch
+     *
+     * @param segment The segment to add
+     */
+    void add(const Segment &segment);
+
+    /**
+     * Removes all the segments from the batch, keeping the memory allocated for them
+     */
+    void clear();
+
+    /**
+     * Gets the number of segments in the batch
+     *
+     * @return the number of segments in the batch
+     */
+    std::size_t size() const;
+
+    /**
+     * Gets a segment in the batch
+     *
+     * @param index The index of the segment
+     *
+     * @return the segment at the given index
+     */
+    Segment get(std::size_t index) const;
+
+    /**
+     * Gets the coordinates of the start and end points of the segments in the batch
+     *
+     * @return the coordinates of the start or end points of the segments, in the same
+     * order as the segments
+     */
+    const std::vector<double> &startX() const;
+    const std::vector<double> &startY() const;
+    const std::vector<double> &endX() const;
+    const std::vector<double> &endY() const;
+
+   private:
+    std::vector<double> start_x_;
+    std::vector<double> start_y_;
+    std::vector<double> end_x_;
+    std::vector<double> end_y_;
+};
+
+/**
+ * Finds the shortest distance between a Point and each Segment in a batch, the same as
+ * distance(const Point &, const Segment &)
+ *
+ * @param point The point
+ * @param segments The segments
+ * @param distances Set to the distance to each segment, in the same order as the
+ * segments. This is an output parameter so that its memory can be reused between calls.
+ * @param instruction_set The instruction set to use
+ *
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+void distance(const Point &point, const SegmentBatch &segments,
+              std::vector<double> &distances,
+              SimdInstructionSet instruction_set = bestSimdInstructionSet());
+
+/**
+ * Checks whether a Segment intersects each Circle in a batch, the same as
+ * intersects(const Segment &, const Circle &)
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param intersections Set to whether the segment intersects each circle, in the same
+ * order as the circles. This is an output parameter so that its memory can be reused
+ * between calls.
+ * @param instruction_set The instruction set to use
+ *
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+void intersects(const Segment &segment, const CircleBatch &circles,
+                std::vector<bool> &intersections,
+                SimdInstructionSet instruction_set = bestSimdInstructionSet());
+
+/**
+ * Checks whether a Segment intersects any Circle in a batch. This stops as soon as an
+ * intersecting circle is found, so is faster than checking every circle.
+ *
+ * @param segment The segment
+ * @param circles The circles
+ * @param instruction_set The instruction set to use
+ *
+ * @return whether the segment intersects any of the circles
+ *
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+bool intersectsAny(const Segment &segment, const CircleBatch &circles,
+                   SimdInstructionSet instruction_set = bestSimdInstructionSet());
+
+/**
+ * Checks whether a Polygon contains each Point in a batch, the same as
+ * contains(const Polygon &, const Point &)
+ *
+ * @param polygon The polygon
+ * @param points The points
+ * @param containments Set to whether the polygon contains each point, in the same order
+ * as the points. This is an output parameter so that its memory can be reused between
+ * calls.
+ * @param instruction_set The instruction set to use
+ *
+ * @throws std::invalid_argument if the instruction set is not supported
+ */
+void contains(const Polygon &polygon, const PointBatch &points,
+              std::vector<bool> &containments,
+              SimdInstructionSet instruction_set = bestSimdInstructionSet());
@@ -0,0 +1,190 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "software/geom/algorithms/batched_geometry.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+// Each batched query is compared against calling the scalar function it is based on in
+// a loop. The first argument of each benchmark is the number of shapes in the batch,
+// and the second is the SimdInstructionSet to use.
+
+/**
+ * Creates random points on a 9x6m field
+ *
+ * @param num_points The number of points to create
+ *
+ * @return the random points
+ */
+static std::vector<Point> createRandomPoints(std::size_t num_points)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> x_distribution(-4.5, 4.5);
+    std::uniform_real_distribution<double> y_distribution(-3, 3);
+    std::vector<Point> points;
+    for (std::size_t i = 0; i < num_points; i++)
+    {
+        points.emplace_back(x_distribution(random_engine), y_distribution(random_engine));
+    }
+    return points;
+}
+
+/**
+ * Gets the instruction set to use from the arguments of a benchmark, and skips the
+ * benchmark if it is not supported
+ *
+ * @param state The state of the benchmark
+ *
+ * @return the instruction set to use
+ */
+static SimdInstructionSet getInstructionSet(benchmark::State &state)
+{
+    auto instruction_set = static_cast<SimdInstructionSet>(state.range(1));
+    state.SetLabel(toString(instruction_set));
+    if (!isSimdInstructionSetSupported(instruction_set))
+    {
+        state.SkipWithError("Instruction set not supported");
+    }
+    return instruction_set;
+}
+
+static void benchmarkDistanceScalar(benchmark::State &state)
+{
+    std::vector<Point> points = createRandomPoints(2 * state.range(0));
+    std::vector<Segment> segments;
+    for (std::size_t i = 0; i < points.size(); i += 2)
+    {
+        segments.emplace_back(points[i], points[i + 1]);
+    }
+    std::vector<double> distances(segments.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < segments.size(); i++)
+        {
+            distances[i] = distance(Point(0.5, 0.25), segments[i]);
+        }
+        benchmark::DoNotOptimize(distances.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmarkDistanceBatched(benchmark::State &state)
+{
+    SimdInstructionSet instruction_set = getInstructionSet(state);
+    std::vector<Point> points          = createRandomPoints(2 * state.range(0));
+    SegmentBatch segments;
+    for (std::size_t i = 0; i < points.size(); i += 2)
+    {
+        segments.add(Segment(points[i], points[i + 1]));
+    }
+    std::vector<double> distances;
+
+    for (auto _ : state)
+    {
+        distance(Point(0.5, 0.25), segments, distances, instruction_set);
+        benchmark::DoNotOptimize(distances.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmarkIntersectsScalar(benchmark::State &state)
+{
+    std::vector<Circle> circles;
+    for (const Point &point : createRandomPoints(state.range(0)))
+    {
+        circles.emplace_back(point, 0.09);
+    }
+    Segment segment(Point(-4, -2), Point(4, 2.5));
+    std::vector<bool> intersections(circles.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < circles.size(); i++)
+        {
+            intersections[i] = intersects(segment, circles[i]);
+        }
+        benchmark::DoNotOptimize(intersections);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmarkIntersectsBatched(benchmark::State &state)
+{
+    SimdInstructionSet instruction_set = getInstructionSet(state);
+    CircleBatch circles;
+    for (const Point &point : createRandomPoints(state.range(0)))
+    {
+        circles.add(Circle(point, 0.09));
+    }
+    Segment segment(Point(-4, -2), Point(4, 2.5));
+    std::vector<bool> intersections;
+
+    for (auto _ : state)
+    {
+        intersects(segment, circles, intersections, instruction_set);
+        benchmark::DoNotOptimize(intersections);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmarkContainsScalar(benchmark::State &state)
+{
+    Polygon polygon({Point(-3, -2), Point(0, -2.5), Point(3, -1), Point(2, 2),
+                     Point(0, 1), Point(-2.5, 2.5)});
+    std::vector<Point> points = createRandomPoints(state.range(0));
+    std::vector<bool> containments(points.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            containments[i] = contains(polygon, points[i]);
+        }
+        benchmark::DoNotOptimize(containments);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void benchmarkContainsBatched(benchmark::State &state)
+{
+    SimdInstructionSet instruction_set = getInstructionSet(state);
+    Polygon polygon({Point(-3, -2), Point(0, -2.5), Point(3, -1), Point(2, 2),
+                     Point(0, 1), Point(-2.5, 2.5)});
+    PointBatch points(createRandomPoints(state.range(0)));
+    std::vector<bool> containments;
+
+    for (auto _ : state)
+    {
+        contains(polygon, points, containments, instruction_set);
+        benchmark::DoNotOptimize(containments);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Runs a batched benchmark with 16 shapes, about the number of robots on the field, and
+ * 1024 shapes, about the number of points on a grid over the field, with every
+ * instruction set
+ *
+ * @param benchmark The benchmark to set the arguments of
+ */
+static void batchedArguments(benchmark::internal::Benchmark *benchmark)
+{
+    for (int num_shapes : {16, 1024})
+    {
+        for (SimdInstructionSet instruction_set : allValuesSimdInstructionSet())
+        {
+            benchmark->Args({num_shapes, static_cast<int>(instruction_set)});
+        }
+    }
+}
+
+BENCHMARK(benchmarkDistanceScalar)->Arg(16)->Arg(1024);
+BENCHMARK(benchmarkDistanceBatched)->Apply(batchedArguments);
+BENCHMARK(benchmarkIntersectsScalar)->Arg(16)->Arg(1024);
+BENCHMARK(benchmarkIntersectsBatched)->Apply(batchedArguments);
+BENCHMARK(benchmarkContainsScalar)->Arg(16)->Arg(1024);
+BENCHMARK(benchmarkContainsBatched)->Apply(batchedArguments);
@@ -0,0 +1,240 @@
+#include "software/geom/algorithms/batched_geometry.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/algorithms/intersects.h"
+
+// Each batched query is compared against the scalar function it is based on for many
+// random shapes, with every instruction set this processor supports. The results must
+// be exactly the same, not just close.
+class BatchedGeometryTest : public testing::TestWithParam<SimdInstructionSet>
+{
+   protected:
+    void SetUp() override
+    {
+        if (!isSimdInstructionSetSupported(GetParam()))
+        {
+            GTEST_SKIP() << GetParam() << " is not supported on this processor";
+        }
+    }
+
+    /**
+     * Creates a random point. Points are often created on a coarse grid, so that there
+     * are many shapes with points that are on top of each other, on the same line, or
+     * on the same horizontal or vertical line, which are the edge cases of the queries.
+     *
+     * @return a random point
+     */
+    Point randomPoint()
+    {
+        if (grid_distribution(random_engine) % 2 == 0)
+        {
+            return Point(grid_distribution(random_engine) * 0.5,
+                         grid_distribution(random_engine) * 0.5);
+        }
+        return Point(coordinate_distribution(random_engine),
+                     coordinate_distribution(random_engine));
+    }
+
+    std::mt19937 random_engine{7};
+    std::uniform_real_distribution<double> coordinate_distribution{-3, 3};
+    std::uniform_int_distribution<int> grid_distribution{-6, 6};
+    std::uniform_real_distribution<double> radius_distribution{0, 1.5};
+};
+
+TEST_P(BatchedGeometryTest, test_distance_from_point_to_segments)
+{
+    std::vector<double> distances;
+    // Batches of every size up to a few times the SIMD width, to check the segments left
+    // over after the SIMD implementations
+    for (std::size_t num_segments = 0; num_segments <= 11; num_segments++)
+    {
+        for (unsigned int i = 0; i < 200; i++)
+        {
+            SegmentBatch segments;
+            for (std::size_t j = 0; j < num_segments; j++)
+            {
+                Point start = randomPoint();
+                // Some segments have the same start and end point
+                Point end = j % 5 == 0 ? start : randomPoint();
+                segments.add(Segment(start, end));
+            }
+            Point point = randomPoint();
+
+            distance(point, segments, distances, GetParam());
+
+            ASSERT_EQ(num_segments, distances.size());
+            for (std::size_t j = 0; j < num_segments; j++)
+            {
+                EXPECT_EQ(distance(point, segments.get(j)), distances[j]);
+            }
+        }
+    }
+}
+
+TEST_P(BatchedGeometryTest, test_segment_intersects_circles)
+{
+    std::vector<bool> intersections;
+    for (std::size_t num_circles = 0; num_circles <= 11; num_circles++)
+    {
+        for (unsigned int i = 0; i < 200; i++)
+        {
+            CircleBatch circles;
+            for (std::size_t j = 0; j < num_circles; j++)
+            {
+                // Some circles just touch the segments on the grid
+                double radius = j % 3 == 0 ? 0.5 : radius_distribution(random_engine);
+                circles.add(Circle(randomPoint(), radius));
+            }
+            Segment segment(randomPoint(), randomPoint());
+
+            intersects(segment, circles, intersections, GetParam());
+
+            ASSERT_EQ(num_circles, intersections.size());
+            bool intersects_any = false;
+            for (std::size_t j = 0; j < num_circles; j++)
+            {
+                EXPECT_EQ(intersects(segment, circles.get(j)), intersections[j]);
+                intersects_any = intersects_any || intersections[j];
+            }
+            EXPECT_EQ(intersects_any, intersectsAny(segment, circles, GetParam()));
+        }
+    }
+}
+
+TEST_P(BatchedGeometryTest, test_polygon_contains_points)
+{
+    std::vector<bool> containments;
+    for (std::size_t num_vertices = 3; num_vertices <= 8; num_vertices++)
+    {
+        for (unsigned int i = 0; i < 100; i++)
+        {
+            std::vector<Point> vertices;
+            for (std::size_t j = 0; j < num_vertices; j++)
+            {
+                vertices.push_back(randomPoint());
+            }
+            Polygon polygon(vertices);
+
+            PointBatch points;
+            for (std::size_t j = 0; j < 2 * i % 23; j++)
+            {
+                // Some points are vertices of the polygon
+                points.add(j % 7 == 0 ? vertices[j % num_vertices] : randomPoint());
+            }
+
+            contains(polygon, points, containments, GetParam());
+
+            ASSERT_EQ(points.size(), containments.size());
+            for (std::size_t j = 0; j < points.size(); j++)
+            {
+                EXPECT_EQ(contains(polygon, points.get(j)), containments[j]);
+            }
+        }
+    }
+}
+
+TEST_P(BatchedGeometryTest, test_convex_polygon_contains_points)
+{
+    // The scalar function has fast paths for convex polygons that the batched query does
+    // not, which must give the same results, especially for points near the edges
+    std::vector<bool> containments;
+    std::uniform_real_distribution<double> angle_distribution(0, 2 * M_PI);
+    for (std::size_t num_vertices = 3; num_vertices <= 8; num_vertices++)
+    {
+        for (unsigned int i = 0; i < 100; i++)
+        {
+            std::vector<double> angles;
+            for (std::size_t j = 0; j < num_vertices; j++)
+            {
+                angles.push_back(angle_distribution(random_engine));
+            }
+            std::sort(angles.begin(), angles.end());
+            if (i % 2 == 0)
+            {
+                // Clockwise polygons
+                std::reverse(angles.begin(), angles.end());
+            }
+            std::vector<Point> vertices;
+            for (double angle : angles)
+            {
+                vertices.emplace_back(2 * std::cos(angle), std::sin(angle));
+            }
+            Polygon polygon(vertices);
+
+            PointBatch points;
+            for (std::size_t j = 0; j < num_vertices; j++)
+            {
+                Point midpoint =
+                    vertices[j] + (vertices[(j + 1) % num_vertices] - vertices[j]) / 2;
+                points.add(vertices[j]);
+                points.add(midpoint);
+                points.add(midpoint + polygon.getEdgeNormals()[j] * 1e-12);
+                points.add(midpoint - polygon.getEdgeNormals()[j] * 1e-12);
+                points.add(randomPoint());
+            }
+
+            contains(polygon, points, containments, GetParam());
+
+            ASSERT_EQ(points.size(), containments.size());
+            for (std::size_t j = 0; j < points.size(); j++)
+            {
+                EXPECT_EQ(contains(polygon, points.get(j)), containments[j]);
+            }
+        }
+    }
+}
+
+TEST_P(BatchedGeometryTest, test_output_is_resized_when_reused)
+{
+    std::vector<double> distances(20, -1);
+    SegmentBatch segments({Segment(Point(0, 0), Point(1, 0)),
+                           Segment(Point(0, 1), Point(1, 1)),
+                           Segment(Point(0, 2), Point(1, 2))});
+
+    distance(Point(0.5, -1), segments, distances, GetParam());
+
+    EXPECT_EQ(std::vector<double>({1, 2, 3}), distances);
+}
+
+INSTANTIATE_TEST_CASE_P(All, BatchedGeometryTest,
+                        testing::ValuesIn(allValuesSimdInstructionSet()));
+
+TEST(BatchedGeometryInstructionSetTest, test_best_instruction_set_is_supported)
+{
+    EXPECT_TRUE(isSimdInstructionSetSupported(SimdInstructionSet::SCALAR));
+    EXPECT_TRUE(isSimdInstructionSetSupported(bestSimdInstructionSet()));
+}
+
+TEST(BatchedGeometryBatchTest, test_batches_store_shapes_in_order)
+{
+    SegmentBatch segments({Segment(Point(1, 2), Point(3, 4))});
+    segments.add(Segment(Point(5, 6), Point(7, 8)));
+    CircleBatch circles({Circle(Point(1, 2), 3)});
+    circles.add(Circle(Point(4, 5), 6));
+    PointBatch points({Point(1, 2)});
+    points.add(Point(3, 4));
+
+    ASSERT_EQ(2, segments.size());
+    EXPECT_EQ(Segment(Point(5, 6), Point(7, 8)), segments.get(1));
+    EXPECT_EQ(std::vector<double>({1, 5}), segments.startX());
+    ASSERT_EQ(2, circles.size());
+    EXPECT_EQ(Circle(Point(4, 5), 6), circles.get(1));
+    EXPECT_EQ(std::vector<double>({3, 6}), circles.radius());
+    ASSERT_EQ(2, points.size());
+    EXPECT_EQ(Point(3, 4), points.get(1));
+    EXPECT_EQ(std::vector<double>({2, 4}), points.y());
+
+    segments.clear();
+    circles.clear();
+    points.clear();
+    EXPECT_EQ(0, segments.size());
+    EXPECT_EQ(0, circles.size());
+    EXPECT_EQ(0, points.size());
+}
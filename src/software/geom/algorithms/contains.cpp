@@ -20,7 +20,6 @@ bool contains(const Circle& container, const Point& contained)
 bool contains(const Polygon& container, const Point& contained)
 {
     // This algorithm is from https://stackoverflow.com/a/16391873
-    // but does not include the bounding boxes.
     //
     // A quick description of the algorithm (also from the same post) is as follows:
     // "I run a semi-infinite ray horizontally (increasing x, fixed y) out from the test
@@ -32,7 +31,39 @@ bool contains(const Polygon& container, const Point& contained)
     // inconsistency does not matter for our use cases, and actually has the benefit that
     // should two distinct polygons share an edge, any point along this edge will be
     // located in one and only one polygon.
-    auto& points            = container.getPoints();
+    //
+    // Before counting crossings, points are ruled out with the bounding box of the
+    // polygon, and ruled in or out with the edge normals of convex polygons. Points that
+    // are close to the boundary always have their crossings counted, so the boundaries
+    // are treated the same either way.
+    if (!container.boundingBoxOverlaps(contained, contained))
+    {
+        return false;
+    }
+
+    auto& points = container.getPoints();
+    if (container.isConvex())
+    {
+        // A point is in a convex polygon if it is on the inner side of every edge
+        auto& edge_normals             = container.getEdgeNormals();
+        bool point_is_inside_all_edges = true;
+        for (size_t k = 0; k < points.size(); k++)
+        {
+            double distance_outside_edge = edge_normals[k].dot(contained - points[k]);
+            if (distance_outside_edge > Polygon::BOUNDARY_TOLERANCE)
+            {
+                return false;
+            }
+            point_is_inside_all_edges =
+                point_is_inside_all_edges &&
+                distance_outside_edge < -Polygon::BOUNDARY_TOLERANCE;
+        }
+        if (point_is_inside_all_edges)
+        {
+            return true;
+        }
+    }
+
     bool point_is_contained = false;
     size_t i                = 0;
     size_t j                = points.size() - 1;
@@ -115,6 +115,23 @@ TEST(ContainsTest, test_polygon_hexagon_contains_point)
     EXPECT_TRUE(contains(hexagon, Point(-1.5, 0.75)));
 }
 
+TEST(ContainsTest, test_convex_polygon_contains_points_close_to_edges)
+{
+    Polygon triangle{{0, 0}, {4, 0}, {0, 3}};
+    ASSERT_TRUE(triangle.isConvex());
+
+    // Points just inside and just outside the diagonal edge, which has a normal of
+    // (0.6, 0.8)
+    EXPECT_TRUE(contains(triangle, Point(2, 1.5) - Vector(0.6, 0.8) * 1e-6));
+    EXPECT_FALSE(contains(triangle, Point(2, 1.5) + Vector(0.6, 0.8) * 1e-6));
+    // Points on the bottom and left edges are contained, and points on the diagonal
+    // edge are not, the same as for non-convex polygons
+    EXPECT_TRUE(contains(triangle, Point(2, 0)));
+    EXPECT_TRUE(contains(triangle, Point(0, 1.5)));
+    EXPECT_FALSE(contains(triangle, Point(2, 1.5)));
+    EXPECT_FALSE(contains(triangle, Point(4, 0)));
+}
+
 TEST(ContainsTest, test_self_intersecting_polygon_contains)
 {
     /*
@@ -0,0 +1,733 @@
+#include "software/geom/algorithms/delaunay_triangulation.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+
+/**
+ * Calculates twice the signed area of the triangle abc
+ *
+ * @param a, b, c The vertices of the triangle
+ *
+ * @return a positive value if abc are in counter-clockwise order, a negative value if
+ * they are in clockwise order, and 0 if they are collinear
+ */
+static double orientation(const Point &a, const Point &b, const Point &c)
+{
+    return (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+}
+
+/**
+ * Checks whether a point is inside the circumcircle of a triangle
+ *
+ * @param a, b, c The vertices of the triangle, in counter-clockwise order
+ * @param d The point to check
+ *
+ * @return a positive value if d is inside the circumcircle of abc, a negative value if
+ * it is outside, and 0 if it is on the circumcircle
+ */
+static double inCircumcircle(const Point &a, const Point &b, const Point &c,
+                             const Point &d)
+{
+    // This is evaluated for every edge near every moved point, so it is written in
+    // terms of coordinates rather than Vectors
+    double adx = a.x() - d.x();
+    double ady = a.y() - d.y();
+    double bdx = b.x() - d.x();
+    double bdy = b.y() - d.y();
+    double cdx = c.x() - d.x();
+    double cdy = c.y() - d.y();
+    return (adx * adx + ady * ady) * (bdx * cdy - bdy * cdx) -
+           (bdx * bdx + bdy * bdy) * (adx * cdy - ady * cdx) +
+           (cdx * cdx + cdy * cdy) * (adx * bdy - ady * bdx);
+}
+
+/**
+ * Calculates the circumcircle of a triangle
+ *
+ * @param a, b, c The vertices of the triangle
+ *
+ * @return the circumcircle of the triangle
+ */
+static Circle circumcircle(const Point &a, const Point &b, const Point &c)
+{
+    Vector ab         = b - a;
+    Vector ac         = c - a;
+    double twice_area = ab.cross(ac);
+    Vector to_centre  = (ab.perpendicular() * ac.lengthSquared() -
+                        ac.perpendicular() * ab.lengthSquared()) /
+                       (2 * twice_area);
+    return Circle(a + to_centre, to_centre.length());
+}
+
+DelaunayTriangulation::DelaunayTriangulation(const Rectangle &bounds) : last_triangle(0)
+{
+    double size  = std::max(bounds.xLength(), bounds.yLength()) * SUPER_TRIANGLE_SCALE;
+    Point centre = bounds.centre();
+    vertices     = {centre + Vector(-2 * size, -size), centre + Vector(2 * size, -size),
+                centre + Vector(0, 2 * size)};
+    vertex_to_triangle = {0, 0, 0};
+    addTriangle(0, 1, 2);
+}
+
+void DelaunayTriangulation::updatePoint(unsigned int point_id, const Point &point)
+{
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        if (orientation(vertices[i], vertices[(i + 1) % 3], point) <= 0)
+        {
+            throw std::invalid_argument(
+                "DelaunayTriangulation: point is too far outside the bounds to be added");
+        }
+    }
+
+    std::size_t vertex_index;
+    auto point_iter = point_id_to_vertex.find(point_id);
+    if (point_iter != point_id_to_vertex.end())
+    {
+        vertex_index = point_iter->second;
+        if (vertices[vertex_index] == point || moveVertex(vertex_index, point))
+        {
+            return;
+        }
+        removeVertex(vertex_index);
+        vertices[vertex_index] = point;
+    }
+    else if (!free_vertices.empty())
+    {
+        vertex_index = free_vertices.back();
+        free_vertices.pop_back();
+        vertices[vertex_index] = point;
+    }
+    else
+    {
+        vertex_index = vertices.size();
+        vertices.push_back(point);
+        vertex_to_triangle.push_back(0);
+    }
+    point_id_to_vertex[point_id] = vertex_index;
+    insertVertex(vertex_index);
+}
+
+void DelaunayTriangulation::removePoint(unsigned int point_id)
+{
+    auto point_iter = point_id_to_vertex.find(point_id);
+    if (point_iter != point_id_to_vertex.end())
+    {
+        removeVertex(point_iter->second);
+        free_vertices.push_back(point_iter->second);
+        point_id_to_vertex.erase(point_iter);
+    }
+}
+
+std::vector<unsigned int> DelaunayTriangulation::getPointIds() const
+{
+    std::vector<unsigned int> point_ids;
+    for (const auto &[point_id, vertex_index] : point_id_to_vertex)
+    {
+        point_ids.push_back(point_id);
+    }
+    return point_ids;
+}
+
+std::vector<std::array<Point, 3>> DelaunayTriangulation::getTriangles() const
+{
+    std::vector<std::array<Point, 3>> result;
+    for (const Triangle &triangle : triangles)
+    {
+        if (triangle.valid && triangle.is_open_circle)
+        {
+            result.push_back({vertices[triangle.vertices[0]],
+                              vertices[triangle.vertices[1]],
+                              vertices[triangle.vertices[2]]});
+        }
+    }
+    return result;
+}
+
+std::vector<Circle> DelaunayTriangulation::findLargestOpenCircles(
+    const Rectangle &region, unsigned int max_num_circles) const
+{
+    std::vector<Circle> open_circles;
+    if (point_id_to_vertex.empty() || max_num_circles == 0)
+    {
+        return open_circles;
+    }
+
+    // Open circles can be centred on the corners of the region, or where the Voronoi
+    // edges cross the edges of the region. Walking around the boundary of the region
+    // through the Voronoi cells finds these without looking at the cells that the
+    // boundary does not pass through.
+    std::vector<Point> corners = region.getPoints();
+    std::size_t vertex_index   = findClosestVertex(corners[0]);
+    for (std::size_t i = 0; i < corners.size(); i++)
+    {
+        const Point &corner = corners[i];
+        open_circles.emplace_back(corner, distance(corner, vertices[vertex_index]));
+        vertex_index = findOpenCirclesAlongSegment(
+            corner, corners[(i + 1) % corners.size()], vertex_index, open_circles);
+    }
+    auto larger_radius = [](const Circle &c1, const Circle &c2) {
+        return c1.radius() > c2.radius();
+    };
+    std::sort(open_circles.begin(), open_circles.end(), larger_radius);
+    if (open_circles.size() > max_num_circles)
+    {
+        open_circles.resize(max_num_circles);
+    }
+
+    // The circumcircles of the triangles are the Voronoi vertices, which are the centres
+    // of the largest open circles inside the region. They are sorted by radius, so we can
+    // stop once we have found enough of them in the region, or they are smaller than
+    // the circles on the boundary of the region.
+    double min_radius =
+        open_circles.size() < max_num_circles ? 0.0 : open_circles.back().radius();
+    std::size_t num_boundary_circles = open_circles.size();
+    for (const auto &[radius, triangle_index] : open_circles_by_radius)
+    {
+        if (open_circles.size() - num_boundary_circles >= max_num_circles ||
+            radius <= min_radius)
+        {
+            break;
+        }
+        const Circle &circle = triangles[triangle_index].circumcircle;
+        if (contains(region, circle.origin()))
+        {
+            open_circles.push_back(circle);
+        }
+    }
+
+    std::sort(open_circles.begin(), open_circles.end(), larger_radius);
+    if (open_circles.size() > max_num_circles)
+    {
+        open_circles.resize(max_num_circles);
+    }
+    return open_circles;
+}
+
+std::size_t DelaunayTriangulation::findClosestVertex(const Point &point) const
+{
+    // Start from a vertex of the triangle containing the point, and move to any
+    // neighbour that is closer to the point. In a Delaunay triangulation this always
+    // reaches the closest vertex.
+    std::optional<std::size_t> closest_vertex;
+    for (std::size_t vertex_index : triangles[locate(point)].vertices)
+    {
+        if (!isSuperTriangleVertex(vertex_index) &&
+            (!closest_vertex || distance(point, vertices[vertex_index]) <
+                                    distance(point, vertices[*closest_vertex])))
+        {
+            closest_vertex = vertex_index;
+        }
+    }
+    std::size_t vertex_index =
+        closest_vertex.value_or(point_id_to_vertex.begin()->second);
+
+    bool moved_closer = true;
+    while (moved_closer)
+    {
+        moved_closer = false;
+        for (std::size_t triangle_index : findTrianglesAroundVertex(vertex_index))
+        {
+            const Triangle &triangle = triangles[triangle_index];
+            std::size_t neighbour =
+                triangle.vertices[(indexOf(triangle, vertex_index) + 1) % 3];
+            if (!isSuperTriangleVertex(neighbour) &&
+                distance(point, vertices[neighbour]) <
+                    distance(point, vertices[vertex_index]))
+            {
+                vertex_index = neighbour;
+                moved_closer = true;
+                break;
+            }
+        }
+    }
+    return vertex_index;
+}
+
+std::size_t DelaunayTriangulation::findOpenCirclesAlongSegment(
+    const Point &start, const Point &end, std::size_t start_vertex,
+    std::vector<Circle> &open_circles) const
+{
+    // The segment start + t * (end - start) crosses from the Voronoi cell of vertex v
+    // into the cell of its neighbour u where it crosses their perpendicular bisector,
+    // which is where 2 * (start + t * (end - start)) . (u - v) = |u|^2 - |v|^2. The
+    // segment leaves the cell of v at the first of these crossings, where it enters the
+    // cell of a neighbour that is further along the segment than v, so the walk never
+    // visits a vertex twice.
+    Vector direction         = end - start;
+    std::size_t vertex_index = start_vertex;
+    double t                 = 0;
+    for (std::size_t step = 0; step < vertices.size(); step++)
+    {
+        const Vector v = vertices[vertex_index].toVector();
+        std::optional<std::size_t> next_vertex;
+        double next_t = 1;
+        for (std::size_t triangle_index : findTrianglesAroundVertex(vertex_index))
+        {
+            const Triangle &triangle = triangles[triangle_index];
+            std::size_t neighbour =
+                triangle.vertices[(indexOf(triangle, vertex_index) + 1) % 3];
+            if (isSuperTriangleVertex(neighbour))
+            {
+                continue;
+            }
+            const Vector u           = vertices[neighbour].toVector();
+            double towards_neighbour = 2 * direction.dot(u - v);
+            if (towards_neighbour <= 0)
+            {
+                continue;
+            }
+            double crossing_t = (u.lengthSquared() - v.lengthSquared() -
+                                 2 * start.toVector().dot(u - v)) /
+                                towards_neighbour;
+            if (crossing_t <= next_t)
+            {
+                next_t      = crossing_t;
+                next_vertex = neighbour;
+            }
+        }
+
+        if (!next_vertex)
+        {
+            break;
+        }
+        // A crossing before the current position means the segment was already in the
+        // cell of the neighbour, where the previous crossing is
+        if (next_t > t && next_t < 1)
+        {
+            Point crossing = start + direction * next_t;
+            open_circles.emplace_back(crossing,
+                                      distance(crossing, vertices[vertex_index]));
+            t = next_t;
+        }
+        vertex_index = *next_vertex;
+    }
+    return vertex_index;
+}
+
+void DelaunayTriangulation::addTriangle(std::size_t a, std::size_t b, std::size_t c)
+{
+    std::size_t triangle_index;
+    if (!free_triangles.empty())
+    {
+        triangle_index = free_triangles.back();
+        free_triangles.pop_back();
+    }
+    else
+    {
+        triangle_index = triangles.size();
+        triangles.emplace_back();
+    }
+
+    Triangle &triangle      = triangles[triangle_index];
+    triangle.vertices       = {a, b, c};
+    triangle.valid          = true;
+    triangle.is_open_circle = !isSuperTriangleVertex(a) && !isSuperTriangleVertex(b) &&
+                              !isSuperTriangleVertex(c);
+    triangle.circumcircle = circumcircle(vertices[a], vertices[b], vertices[c]);
+    if (triangle.is_open_circle)
+    {
+        triangle.open_circle = open_circles_by_radius.emplace(
+            triangle.circumcircle.radius(), triangle_index);
+    }
+
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        edge_to_triangle[edgeKey(triangle.vertices[i], triangle.vertices[(i + 1) % 3])] =
+            triangle_index;
+        vertex_to_triangle[triangle.vertices[i]] = triangle_index;
+    }
+    last_triangle = triangle_index;
+}
+
+void DelaunayTriangulation::updateCircumcircle(std::size_t triangle_index)
+{
+    Triangle &triangle = triangles[triangle_index];
+    triangle.circumcircle =
+        circumcircle(vertices[triangle.vertices[0]], vertices[triangle.vertices[1]],
+                     vertices[triangle.vertices[2]]);
+    if (triangle.is_open_circle)
+    {
+        // Reuse the node rather than erasing and inserting, to avoid an allocation
+        auto node            = open_circles_by_radius.extract(triangle.open_circle);
+        node.key()           = triangle.circumcircle.radius();
+        triangle.open_circle = open_circles_by_radius.insert(std::move(node));
+    }
+}
+
+void DelaunayTriangulation::removeTriangle(std::size_t triangle_index)
+{
+    Triangle &triangle = triangles[triangle_index];
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        edge_to_triangle.erase(
+            edgeKey(triangle.vertices[i], triangle.vertices[(i + 1) % 3]));
+    }
+    if (triangle.is_open_circle)
+    {
+        open_circles_by_radius.erase(triangle.open_circle);
+    }
+    triangle.valid = false;
+    free_triangles.push_back(triangle_index);
+}
+
+void DelaunayTriangulation::insertVertex(std::size_t vertex_index)
+{
+    // The triangulation can not contain duplicate points, so move the point slightly if
+    // it is on top of another point, until it is not on top of any point
+    std::size_t containing_triangle = locate(vertices[vertex_index]);
+    std::optional<std::size_t> duplicate_vertex;
+    do
+    {
+        duplicate_vertex = std::nullopt;
+        for (std::size_t other_vertex : triangles[containing_triangle].vertices)
+        {
+            if (distance(vertices[other_vertex], vertices[vertex_index]) <
+                DUPLICATE_POINT_OFFSET_M)
+            {
+                duplicate_vertex = other_vertex;
+            }
+        }
+        if (duplicate_vertex)
+        {
+            vertices[vertex_index] =
+                vertices[*duplicate_vertex] +
+                Vector(DUPLICATE_POINT_OFFSET_M, DUPLICATE_POINT_OFFSET_M);
+            containing_triangle = locate(vertices[vertex_index]);
+        }
+    } while (duplicate_vertex);
+    const Point &point = vertices[vertex_index];
+
+    // Find the "cavity" of triangles whose circumcircles contain the point, which are no
+    // longer Delaunay triangles once the point is added
+    std::vector<std::size_t> cavity = {containing_triangle};
+    for (std::size_t i = 0; i < cavity.size(); i++)
+    {
+        const Triangle &triangle = triangles[cavity[i]];
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            std::optional<std::size_t> neighbour = findTriangleWithEdge(
+                triangle.vertices[(j + 1) % 3], triangle.vertices[j]);
+            if (neighbour &&
+                std::find(cavity.begin(), cavity.end(), *neighbour) == cavity.end())
+            {
+                const Triangle &neighbour_triangle = triangles[*neighbour];
+                if (inCircumcircle(vertices[neighbour_triangle.vertices[0]],
+                                   vertices[neighbour_triangle.vertices[1]],
+                                   vertices[neighbour_triangle.vertices[2]], point) > 0)
+                {
+                    cavity.push_back(*neighbour);
+                }
+            }
+        }
+    }
+
+    // Connect the point to every edge on the boundary of the cavity
+    std::vector<std::pair<std::size_t, std::size_t>> boundary_edges;
+    for (std::size_t triangle_index : cavity)
+    {
+        const Triangle &triangle = triangles[triangle_index];
+        for (std::size_t j = 0; j < 3; j++)
+        {
+            std::size_t from                     = triangle.vertices[j];
+            std::size_t to                       = triangle.vertices[(j + 1) % 3];
+            std::optional<std::size_t> neighbour = findTriangleWithEdge(to, from);
+            if (!neighbour ||
+                std::find(cavity.begin(), cavity.end(), *neighbour) == cavity.end())
+            {
+                boundary_edges.emplace_back(from, to);
+            }
+        }
+    }
+    for (std::size_t triangle_index : cavity)
+    {
+        removeTriangle(triangle_index);
+    }
+    for (const auto &[from, to] : boundary_edges)
+    {
+        addTriangle(from, to, vertex_index);
+    }
+}
+
+std::vector<std::size_t> DelaunayTriangulation::findTrianglesAroundVertex(
+    std::size_t vertex_index) const
+{
+    // Find a triangle around the vertex, falling back to searching every triangle if the
+    // triangle we last saw the vertex in has been removed
+    std::size_t start_triangle = vertex_to_triangle[vertex_index];
+    auto has_vertex            = [&](std::size_t triangle_index) {
+        const Triangle &triangle = triangles[triangle_index];
+        return triangle.valid &&
+               std::find(triangle.vertices.begin(), triangle.vertices.end(),
+                         vertex_index) != triangle.vertices.end();
+    };
+    if (!has_vertex(start_triangle))
+    {
+        for (start_triangle = 0; !has_vertex(start_triangle); start_triangle++)
+        {
+        }
+    }
+
+    // Walk counter-clockwise around the vertex, crossing the edge from the vertex to the
+    // last vertex of each triangle
+    std::vector<std::size_t> triangles_around_vertex;
+    triangles_around_vertex.reserve(TYPICAL_NUM_TRIANGLES_AROUND_VERTEX);
+    std::size_t triangle_index = start_triangle;
+    do
+    {
+        const Triangle &triangle = triangles[triangle_index];
+        triangles_around_vertex.push_back(triangle_index);
+        triangle_index = *findTriangleWithEdge(
+            vertex_index, triangle.vertices[(indexOf(triangle, vertex_index) + 2) % 3]);
+    } while (triangle_index != start_triangle);
+    return triangles_around_vertex;
+}
+
+bool DelaunayTriangulation::moveVertex(std::size_t vertex_index, const Point &point)
+{
+    std::vector<std::size_t> triangles_around_vertex =
+        findTrianglesAroundVertex(vertex_index);
+    Point old_point        = vertices[vertex_index];
+    vertices[vertex_index] = point;
+
+    // The triangles around the vertex are still a valid triangulation if none of them
+    // are flipped over by the move
+    for (std::size_t triangle_index : triangles_around_vertex)
+    {
+        const Triangle &triangle = triangles[triangle_index];
+        if (orientation(vertices[triangle.vertices[0]], vertices[triangle.vertices[1]],
+                        vertices[triangle.vertices[2]]) <= 0)
+        {
+            vertices[vertex_index] = old_point;
+            return false;
+        }
+    }
+
+    // Find the edges around the vertex that are no longer Delaunay. The edges from the
+    // vertex are between two of the triangles around it, and the edges opposite it are
+    // between one of the triangles around it and a triangle further away.
+    std::vector<std::pair<std::size_t, std::size_t>> edges_to_check;
+    for (std::size_t i = 0; i < triangles_around_vertex.size(); i++)
+    {
+        updateCircumcircle(triangles_around_vertex[i]);
+        const Triangle &triangle = triangles[triangles_around_vertex[i]];
+        const Triangle &next_triangle =
+            triangles[triangles_around_vertex[(i + 1) % triangles_around_vertex.size()]];
+        std::size_t vertex_position = indexOf(triangle, vertex_index);
+        std::size_t a               = triangle.vertices[(vertex_position + 1) % 3];
+        std::size_t b               = triangle.vertices[(vertex_position + 2) % 3];
+        std::size_t c =
+            next_triangle.vertices[(indexOf(next_triangle, vertex_index) + 2) % 3];
+        if (inCircumcircle(point, vertices[a], vertices[b], vertices[c]) > 0)
+        {
+            edges_to_check.emplace_back(vertex_index, b);
+        }
+
+        std::optional<std::size_t> neighbour_index = findTriangleWithEdge(b, a);
+        if (neighbour_index)
+        {
+            const Triangle &neighbour = triangles[*neighbour_index];
+            std::size_t d = neighbour.vertices[(indexOf(neighbour, a) + 1) % 3];
+            if (inCircumcircle(point, vertices[a], vertices[b], vertices[d]) > 0)
+            {
+                edges_to_check.emplace_back(a, b);
+            }
+        }
+    }
+
+    // Restore the Delaunay property by flipping edges whose opposite vertices are inside
+    // the circumcircles of their triangles. Floating point error could make the flips
+    // cycle when points are almost on the same circle, so the number of flips is
+    // limited, in which case the triangulation is still valid but may not be quite
+    // Delaunay.
+    std::size_t max_num_flips = MAX_FLIPS_PER_TRIANGLE * triangles.size();
+    for (std::size_t num_flips = 0; !edges_to_check.empty() && num_flips < max_num_flips;)
+    {
+        auto [a, b] = edges_to_check.back();
+        edges_to_check.pop_back();
+        std::optional<std::size_t> triangle_index  = findTriangleWithEdge(a, b);
+        std::optional<std::size_t> neighbour_index = findTriangleWithEdge(b, a);
+        if (!triangle_index || !neighbour_index)
+        {
+            continue;
+        }
+        const Triangle &triangle  = triangles[*triangle_index];
+        const Triangle &neighbour = triangles[*neighbour_index];
+        std::size_t c             = triangle.vertices[(indexOf(triangle, b) + 1) % 3];
+        std::size_t d             = neighbour.vertices[(indexOf(neighbour, a) + 1) % 3];
+        if (inCircumcircle(vertices[a], vertices[b], vertices[c], vertices[d]) <= 0)
+        {
+            continue;
+        }
+
+        // abc and bad form the quadrilateral adcb, so replace the diagonal ab with cd
+        removeTriangle(*triangle_index);
+        removeTriangle(*neighbour_index);
+        addTriangle(a, d, c);
+        addTriangle(d, b, c);
+        edges_to_check.insert(edges_to_check.end(), {{a, d}, {d, b}, {b, c}, {c, a}});
+        num_flips++;
+    }
+    return true;
+}
+
+void DelaunayTriangulation::removeVertex(std::size_t vertex_index)
+{
+    // The neighbours of the vertex form the polygon of the hole left when the triangles
+    // around the vertex are removed
+    std::vector<std::size_t> triangles_around_vertex =
+        findTrianglesAroundVertex(vertex_index);
+    std::vector<std::size_t> hole;
+    for (std::size_t triangle_index : triangles_around_vertex)
+    {
+        const Triangle &triangle = triangles[triangle_index];
+        hole.push_back(triangle.vertices[(indexOf(triangle, vertex_index) + 1) % 3]);
+    }
+
+    for (std::size_t index : triangles_around_vertex)
+    {
+        removeTriangle(index);
+    }
+
+    // Fill the hole by repeatedly cutting off "ears" whose circumcircles do not contain
+    // any other vertex of the hole, which are triangles of the Delaunay triangulation
+    // without the removed vertex
+    while (hole.size() > 3)
+    {
+        std::optional<std::size_t> ear;
+        std::optional<std::size_t> fallback_ear;
+        for (std::size_t i = 0; i < hole.size() && !ear; i++)
+        {
+            const Point &a = vertices[hole[(i + hole.size() - 1) % hole.size()]];
+            const Point &b = vertices[hole[i]];
+            const Point &c = vertices[hole[(i + 1) % hole.size()]];
+            if (orientation(a, b, c) <= 0)
+            {
+                continue;
+            }
+
+            bool circumcircle_empty = true;
+            bool triangle_empty     = true;
+            for (std::size_t j = 0; j < hole.size(); j++)
+            {
+                if (j == i || j == (i + 1) % hole.size() ||
+                    j == (i + hole.size() - 1) % hole.size())
+                {
+                    continue;
+                }
+                const Point &d = vertices[hole[j]];
+                circumcircle_empty &= inCircumcircle(a, b, c, d) <= 0;
+                triangle_empty &=
+                    !(orientation(a, b, d) >= 0 && orientation(b, c, d) >= 0 &&
+                      orientation(c, a, d) >= 0);
+            }
+            if (circumcircle_empty)
+            {
+                ear = i;
+            }
+            else if (triangle_empty && !fallback_ear)
+            {
+                // Floating point error can make every ear look like it is not Delaunay,
+                // in which case we still need a valid triangle
+                fallback_ear = i;
+            }
+        }
+
+        std::size_t i = ear ? *ear : fallback_ear.value_or(0);
+        addTriangle(hole[(i + hole.size() - 1) % hole.size()], hole[i],
+                    hole[(i + 1) % hole.size()]);
+        hole.erase(hole.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+    addTriangle(hole[0], hole[1], hole[2]);
+}
+
+std::size_t DelaunayTriangulation::locate(const Point &point) const
+{
+    // Walk from the last triangle towards the point by crossing any edge that the point
+    // is on the other side of. In a Delaunay triangulation this always reaches the
+    // triangle containing the point.
+    std::size_t triangle_index = last_triangle;
+    if (!triangles[triangle_index].valid)
+    {
+        triangle_index = 0;
+        while (!triangles[triangle_index].valid)
+        {
+            triangle_index++;
+        }
+    }
+
+    for (std::size_t step = 0; step < triangles.size(); step++)
+    {
+        const Triangle &triangle = triangles[triangle_index];
+        bool crossed_edge        = false;
+        for (std::size_t i = 0; i < 3 && !crossed_edge; i++)
+        {
+            std::size_t from = triangle.vertices[i];
+            std::size_t to   = triangle.vertices[(i + 1) % 3];
+            if (orientation(vertices[from], vertices[to], point) < 0)
+            {
+                std::optional<std::size_t> neighbour = findTriangleWithEdge(to, from);
+                if (neighbour)
+                {
+                    triangle_index = *neighbour;
+                    crossed_edge   = true;
+                }
+            }
+        }
+        if (!crossed_edge)
+        {
+            return triangle_index;
+        }
+    }
+
+    // The walk should not take more steps than there are triangles, but floating point
+    // error could make it loop, so fall back to checking every triangle
+    for (std::size_t i = 0; i < triangles.size(); i++)
+    {
+        const Triangle &triangle = triangles[i];
+        if (triangle.valid &&
+            orientation(vertices[triangle.vertices[0]], vertices[triangle.vertices[1]],
+                        point) >= 0 &&
+            orientation(vertices[triangle.vertices[1]], vertices[triangle.vertices[2]],
+                        point) >= 0 &&
+            orientation(vertices[triangle.vertices[2]], vertices[triangle.vertices[0]],
+                        point) >= 0)
+        {
+            return i;
+        }
+    }
+    return triangle_index;
+}
+
+std::optional<std::size_t> DelaunayTriangulation::findTriangleWithEdge(
+    std::size_t from, std::size_t to) const
+{
+    auto edge_iter = edge_to_triangle.find(edgeKey(from, to));
+    if (edge_iter == edge_to_triangle.end())
+    {
+        return std::nullopt;
+    }
+    return edge_iter->second;
+}
+
+bool DelaunayTriangulation::isSuperTriangleVertex(std::size_t vertex_index)
+{
+    return vertex_index < 3;
+}
+
+std::uint64_t DelaunayTriangulation::edgeKey(std::size_t from, std::size_t to)
+{
+    return (static_cast<std::uint64_t>(from) << 32) | static_cast<std::uint64_t>(to);
+}
+
+std::size_t DelaunayTriangulation::indexOf(const Triangle &triangle,
+                                           std::size_t vertex_index)
+{
+    return static_cast<std::size_t>(
+        std::find(triangle.vertices.begin(), triangle.vertices.end(), vertex_index) -
+        triangle.vertices.begin());
+}
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+
+/**
+ * A Delaunay triangulation of a set of points that is updated incrementally as points
+ * are added, moved and removed, so that it can be kept up to date with moving robots
+ * without being rebuilt from scratch every tick.
+ *
+ * The circumcircles of the Delaunay triangles are exactly the vertices of the Voronoi
+ * diagram of the points, so the triangulation can be used to find the largest circles
+ * that do not contain any of the points (see findLargestOpenCircles). These are kept
+ * sorted by radius as the triangulation changes, and open circles on the boundary of a
+ * region are found by walking along the boundary through the triangulation, so finding
+ * the largest open circles does not require looking at every triangle.
+ *
+ * Points are added with Bowyer-Watson insertion and removed by re-triangulating the
+ * hole left by the point, which only changes the triangles around the point. The
+ * triangulation is contained in a large "super triangle" around the given bounds, whose
+ * vertices are not part of the triangulation that is returned.
+ */
+class DelaunayTriangulation
+{
+   public:
+    /**
+     * Creates an empty triangulation
+     *
+     * @param bounds The region the points are expected to be in. Points somewhat outside
+     * the bounds may be added, but they are triangulated less accurately the further
+     * they are from the bounds.
+     */
+    explicit DelaunayTriangulation(const Rectangle &bounds);
+
+    DelaunayTriangulation() = delete;
+
+    /**
+     * Adds a point to the triangulation, or moves it to the given position if a point
+     * with the given id has already been added
+     *
+     * @param point_id The id of the point
+     * @param point The position of the point
+     *
+     * @throws std::invalid_argument if the point is too far outside the bounds of the
+     * triangulation to be added
+     */
+    void updatePoint(unsigned int point_id, const Point &point);
+
+    /**
+     * Removes a point from the triangulation. Does nothing if no point with the given id
+     * has been added.
+     *
+     * @param point_id The id of the point to remove
+     */
+    void removePoint(unsigned int point_id);
+
+    /**
+     * Gets the ids of all the points in the triangulation
+     *
+     * @return the ids of all the points in the triangulation, in no particular order
+     */
+    std::vector<unsigned int> getPointIds() const;
+
+    /**
+     * Gets the triangles of the Delaunay triangulation of the points
+     *
+     * @return the vertices of each triangle, in counter-clockwise order
+     */
+    std::vector<std::array<Point, 3>> getTriangles() const;
+
+    /**
+     * Finds the largest circles whose centres are within the given region, and that do
+     * not contain any of the points in the triangulation. These are the same circles
+     * found by findOpenCircles, except that points outside the region still limit the
+     * size of the circles.
+     *
+     * NOTE: this only guarantees that the center of each circle is within the
+     *       region, some portion of the circle may extend outside the region
+     *
+     * @param region The region in which to look for open circles
+     * @param max_num_circles The maximum number of circles to find
+     *
+     * This only looks at the triangles along the boundary of the region and at the
+     * circumcircles that are larger than the largest open circles found, rather than
+     * at every triangle.
+     *
+     * @return The largest open circles, sorted in descending order of radius. If there
+     * are no points in the triangulation, returns an empty list.
+     */
+    std::vector<Circle> findLargestOpenCircles(const Rectangle &region,
+                                               unsigned int max_num_circles) const;
+
+   private:
+    /**
+     * A triangle in the triangulation, with vertices in counter-clockwise order
+     */
+    struct Triangle
+    {
+        std::array<std::size_t, 3> vertices;
+        Circle circumcircle;
+        bool valid;
+        // Whether this triangle has no super triangle vertices, and so its circumcircle
+        // is an open circle in open_circles_by_radius
+        bool is_open_circle;
+        std::multimap<double, std::size_t, std::greater<>>::iterator open_circle;
+    };
+
+    /**
+     * Adds a triangle to the triangulation
+     *
+     * @param a, b, c The indices of the vertices of the triangle, in counter-clockwise
+     * order
+     */
+    void addTriangle(std::size_t a, std::size_t b, std::size_t c);
+
+    /**
+     * Recalculates the circumcircle of a triangle after one of its vertices has moved
+     *
+     * @param triangle_index The index of the triangle
+     */
+    void updateCircumcircle(std::size_t triangle_index);
+
+    /**
+     * Removes a triangle from the triangulation
+     *
+     * @param triangle_index The index of the triangle to remove
+     */
+    void removeTriangle(std::size_t triangle_index);
+
+    /**
+     * Inserts the vertex with the given index into the triangulation
+     *
+     * @param vertex_index The index of the vertex to insert
+     */
+    void insertVertex(std::size_t vertex_index);
+
+    /**
+     * Moves the vertex with the given index and then flips edges to restore the
+     * Delaunay property, if none of the triangles around it would be flipped over by the
+     * move. This is the case for most small movements, such as a robot moving during a
+     * tick, and only changes a few triangles around the vertex.
+     *
+     * @param vertex_index The index of the vertex to move
+     * @param point The position to move the vertex to
+     *
+     * @return whether the vertex was moved
+     */
+    bool moveVertex(std::size_t vertex_index, const Point &point);
+
+    /**
+     * Removes the vertex with the given index from the triangulation, and
+     * re-triangulates the hole it leaves
+     *
+     * @param vertex_index The index of the vertex to remove
+     */
+    void removeVertex(std::size_t vertex_index);
+
+    /**
+     * Finds the vertex closest to a point, ignoring the vertices of the super triangle
+     *
+     * @pre There is at least one point in the triangulation
+     *
+     * @param point The point to find the closest vertex to
+     *
+     * @return the index of the vertex closest to the point
+     */
+    std::size_t findClosestVertex(const Point &point) const;
+
+    /**
+     * Walks along a segment through the Voronoi cells of the vertices, and adds the
+     * open circles centred where the segment crosses from one cell into the next
+     *
+     * @param start, end The ends of the segment
+     * @param start_vertex The index of the vertex closest to the start of the segment
+     * @param open_circles The list to add the open circles to
+     *
+     * @return the index of the vertex closest to the end of the segment
+     */
+    std::size_t findOpenCirclesAlongSegment(const Point &start, const Point &end,
+                                            std::size_t start_vertex,
+                                            std::vector<Circle> &open_circles) const;
+
+    /**
+     * Finds the triangles that have the vertex with the given index as a vertex
+     *
+     * @param vertex_index The index of the vertex
+     *
+     * @return the indices of the triangles around the vertex, in counter-clockwise order
+     */
+    std::vector<std::size_t> findTrianglesAroundVertex(std::size_t vertex_index) const;
+
+    /**
+     * Finds a triangle containing the given point, by walking through the triangulation
+     * towards it
+     *
+     * @param point The point to find
+     *
+     * @return the index of a triangle containing the given point
+     */
+    std::size_t locate(const Point &point) const;
+
+    /**
+     * Finds the triangle containing the given directed edge
+     *
+     * @param from, to The indices of the vertices at the start and end of the edge
+     *
+     * @return the index of the triangle with the given edge in counter-clockwise order,
+     * or std::nullopt if there is no such triangle
+     */
+    std::optional<std::size_t> findTriangleWithEdge(std::size_t from,
+                                                    std::size_t to) const;
+
+    /**
+     * Checks whether a vertex is one of the vertices of the super triangle
+     *
+     * @param vertex_index The index of the vertex
+     *
+     * @return whether the vertex is one of the vertices of the super triangle
+     */
+    static bool isSuperTriangleVertex(std::size_t vertex_index);
+
+    /**
+     * Finds where a vertex is in a triangle
+     *
+     * @param triangle The triangle
+     * @param vertex_index The index of a vertex of the triangle
+     *
+     * @return the index of the vertex in the vertices of the triangle
+     */
+    static std::size_t indexOf(const Triangle &triangle, std::size_t vertex_index);
+
+    /**
+     * Gets the key of a directed edge in edge_to_triangle
+     *
+     * @param from, to The indices of the vertices at the start and end of the edge
+     *
+     * @return the key of the edge
+     */
+    static std::uint64_t edgeKey(std::size_t from, std::size_t to);
+
+    // The super triangle is made this many times larger than the bounds along each axis
+    static constexpr double SUPER_TRIANGLE_SCALE = 100.0;
+    // Vertices in a Delaunay triangulation have 6 neighbours on average, so this avoids
+    // reallocating when finding the triangles around most vertices
+    static constexpr std::size_t TYPICAL_NUM_TRIANGLES_AROUND_VERTEX = 8;
+    // The maximum number of edge flips when moving a vertex, per triangle
+    static constexpr std::size_t MAX_FLIPS_PER_TRIANGLE = 4;
+    // Points that are this close to another point are moved apart by this distance,
+    // since the triangulation can not contain duplicate points
+    static constexpr double DUPLICATE_POINT_OFFSET_M = 1e-6;
+
+    // The first 3 vertices are the vertices of the super triangle
+    std::vector<Point> vertices;
+    std::vector<std::size_t> free_vertices;
+    std::unordered_map<unsigned int, std::size_t> point_id_to_vertex;
+    // A triangle containing each vertex, used as a starting point to find the others.
+    // This may refer to a triangle that has since been removed.
+    std::vector<std::size_t> vertex_to_triangle;
+
+    std::vector<Triangle> triangles;
+    std::vector<std::size_t> free_triangles;
+    std::unordered_map<std::uint64_t, std::size_t> edge_to_triangle;
+    std::multimap<double, std::size_t, std::greater<>> open_circles_by_radius;
+    // The most recently added triangle, where searches through the triangulation start
+    std::size_t last_triangle;
+};
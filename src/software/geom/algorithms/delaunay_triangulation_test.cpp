@@ -0,0 +1,416 @@
+#include "software/geom/algorithms/delaunay_triangulation.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+
+class DelaunayTriangulationTest : public testing::Test
+{
+   protected:
+    /**
+     * Checks that no point in the triangulation is inside the circumcircle of any of its
+     * triangles, which is what makes it a Delaunay triangulation
+     *
+     * @param triangulation The triangulation to check
+     * @param points The points in the triangulation
+     */
+    static void expectDelaunay(const DelaunayTriangulation& triangulation,
+                               const std::vector<Point>& points)
+    {
+        for (const auto& [a, b, c] : triangulation.getTriangles())
+        {
+            EXPECT_GT((b - a).cross(c - a), 0);
+            Vector ab    = b - a;
+            Vector ac    = c - a;
+            Point centre = a + (ab.perpendicular() * ac.lengthSquared() -
+                                ac.perpendicular() * ab.lengthSquared()) /
+                                   (2 * ab.cross(ac));
+            double radius = distance(centre, a);
+            for (const Point& point : points)
+            {
+                EXPECT_GE(distance(centre, point), radius - 1e-9);
+            }
+        }
+    }
+
+    /**
+     * Checks that the open circles found by the triangulation do not contain any of the
+     * points, and that the largest one is as large as the largest open circle found by
+     * searching a fine grid over the region
+     *
+     * @param triangulation The triangulation to check
+     * @param region The region to find open circles in
+     * @param points The points in the triangulation
+     */
+    static void expectLargestOpenCircles(const DelaunayTriangulation& triangulation,
+                                         const Rectangle& region,
+                                         const std::vector<Point>& points)
+    {
+        auto distance_to_closest_point = [&points](const Point& position) {
+            double closest_distance = std::numeric_limits<double>::max();
+            for (const Point& point : points)
+            {
+                closest_distance = std::min(closest_distance, distance(position, point));
+            }
+            return closest_distance;
+        };
+
+        std::vector<Circle> open_circles =
+            triangulation.findLargestOpenCircles(region, 5);
+        ASSERT_EQ(5, open_circles.size());
+        for (std::size_t i = 0; i < open_circles.size(); i++)
+        {
+            EXPECT_TRUE(contains(region, open_circles[i].origin()));
+            EXPECT_NEAR(distance_to_closest_point(open_circles[i].origin()),
+                        open_circles[i].radius(), 1e-6);
+            if (i > 0)
+            {
+                EXPECT_LE(open_circles[i].radius(), open_circles[i - 1].radius());
+            }
+        }
+
+        const double grid_spacing = 0.02;
+        double largest_radius     = 0;
+        for (double x = region.xMin(); x <= region.xMax(); x += grid_spacing)
+        {
+            for (double y = region.yMin(); y <= region.yMax(); y += grid_spacing)
+            {
+                largest_radius =
+                    std::max(largest_radius, distance_to_closest_point(Point(x, y)));
+            }
+        }
+        EXPECT_GE(open_circles[0].radius(), largest_radius - 1e-9);
+        EXPECT_LE(open_circles[0].radius(), largest_radius + grid_spacing);
+    }
+
+    /**
+     * Finds the largest open circles in a region by checking every circle through
+     * three of the points, every point on the boundary of the region that is the same
+     * distance from two of the points, and every corner of the region
+     *
+     * @param region The region to find open circles in
+     * @param points The points that must not lie within the circles
+     * @param max_num_circles The maximum number of circles to find
+     *
+     * @return the largest open circles, sorted in descending order of radius
+     */
+    static std::vector<Circle> findLargestOpenCirclesByBruteForce(
+        const Rectangle& region, const std::vector<Point>& points,
+        std::size_t max_num_circles)
+    {
+        std::vector<Circle> open_circles;
+        auto add_corner = [&](const Point& centre) {
+            double radius = std::numeric_limits<double>::max();
+            for (const Point& point : points)
+            {
+                radius = std::min(radius, distance(centre, point));
+            }
+            open_circles.emplace_back(centre, radius);
+        };
+        auto is_open = [&](const Point& centre, double radius) {
+            for (const Point& point : points)
+            {
+                if (distance(centre, point) < radius - 1e-9)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<Point> corners = region.getPoints();
+        for (const Point& corner : corners)
+        {
+            add_corner(corner);
+        }
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            for (std::size_t j = i + 1; j < points.size(); j++)
+            {
+                const Vector pi = points[i].toVector();
+                const Vector pj = points[j].toVector();
+                for (std::size_t c = 0; c < corners.size(); c++)
+                {
+                    const Point& start = corners[c];
+                    Vector direction   = corners[(c + 1) % corners.size()] - start;
+                    double denominator = 2 * direction.dot(pj - pi);
+                    if (denominator == 0)
+                    {
+                        continue;
+                    }
+                    double t = (pj.lengthSquared() - pi.lengthSquared() -
+                                2 * start.toVector().dot(pj - pi)) /
+                               denominator;
+                    Point crossing = start + direction * t;
+                    if (t >= 0 && t <= 1 &&
+                        is_open(crossing, distance(crossing, points[i])))
+                    {
+                        open_circles.emplace_back(crossing,
+                                                  distance(crossing, points[i]));
+                    }
+                }
+                for (std::size_t k = j + 1; k < points.size(); k++)
+                {
+                    Vector ab = points[j] - points[i];
+                    Vector ac = points[k] - points[i];
+                    if (ab.cross(ac) == 0)
+                    {
+                        continue;
+                    }
+                    Point centre = points[i] + (ab.perpendicular() * ac.lengthSquared() -
+                                                ac.perpendicular() * ab.lengthSquared()) /
+                                                   (2 * ab.cross(ac));
+                    if (contains(region, centre) &&
+                        is_open(centre, distance(centre, points[i])))
+                    {
+                        open_circles.emplace_back(centre, distance(centre, points[i]));
+                    }
+                }
+            }
+        }
+
+        std::sort(
+            open_circles.begin(), open_circles.end(),
+            [](const Circle& c1, const Circle& c2) { return c1.radius() > c2.radius(); });
+        if (open_circles.size() > max_num_circles)
+        {
+            open_circles.resize(max_num_circles);
+        }
+        return open_circles;
+    }
+
+    Rectangle field = Rectangle(Point(-4.5, -3), Point(4.5, 3));
+    std::mt19937 random_engine{42};
+    std::uniform_real_distribution<double> x_distribution{-4.5, 4.5};
+    std::uniform_real_distribution<double> y_distribution{-3, 3};
+};
+
+TEST_F(DelaunayTriangulationTest, test_no_points)
+{
+    DelaunayTriangulation triangulation(field);
+
+    EXPECT_TRUE(triangulation.getTriangles().empty());
+    EXPECT_TRUE(triangulation.findLargestOpenCircles(field, 5).empty());
+}
+
+TEST_F(DelaunayTriangulationTest, test_one_point)
+{
+    DelaunayTriangulation triangulation(field);
+    triangulation.updatePoint(0, Point(4, 2.5));
+
+    std::vector<Circle> open_circles = triangulation.findLargestOpenCircles(field, 5);
+
+    ASSERT_EQ(4, open_circles.size());
+    EXPECT_EQ(Point(-4.5, -3), open_circles[0].origin());
+    EXPECT_DOUBLE_EQ(std::hypot(8.5, 5.5), open_circles[0].radius());
+    EXPECT_TRUE(triangulation.getTriangles().empty());
+}
+
+TEST_F(DelaunayTriangulationTest, test_two_points)
+{
+    DelaunayTriangulation triangulation(field);
+    std::vector<Point> points = {Point(-1, 0), Point(1, 0)};
+    triangulation.updatePoint(0, points[0]);
+    triangulation.updatePoint(1, points[1]);
+
+    expectLargestOpenCircles(triangulation, field, points);
+}
+
+TEST_F(DelaunayTriangulationTest, test_square_of_points)
+{
+    // The 4 points are on the same circle, so either diagonal is a valid triangulation
+    DelaunayTriangulation triangulation(field);
+    std::vector<Point> points = {Point(-1, -1), Point(1, -1), Point(1, 1), Point(-1, 1)};
+    for (unsigned int i = 0; i < points.size(); i++)
+    {
+        triangulation.updatePoint(i, points[i]);
+    }
+
+    EXPECT_EQ(2, triangulation.getTriangles().size());
+    expectDelaunay(triangulation, points);
+    expectLargestOpenCircles(triangulation, field, points);
+}
+
+TEST_F(DelaunayTriangulationTest, test_random_points)
+{
+    DelaunayTriangulation triangulation(field);
+    std::vector<Point> points;
+    for (unsigned int i = 0; i < 11; i++)
+    {
+        points.emplace_back(x_distribution(random_engine), y_distribution(random_engine));
+        triangulation.updatePoint(i, points[i]);
+    }
+
+    expectDelaunay(triangulation, points);
+    expectLargestOpenCircles(triangulation, field, points);
+}
+
+TEST_F(DelaunayTriangulationTest, test_largest_open_circles_match_brute_force)
+{
+    // Open circles on the boundary of the region are found by walking through the
+    // triangulation, so check them against every possible open circle for many regions
+    // and numbers of points
+    std::uniform_real_distribution<double> size_distribution(0.5, 4);
+    for (unsigned int num_points = 1; num_points <= 40; num_points++)
+    {
+        DelaunayTriangulation triangulation(field);
+        std::vector<Point> points;
+        for (unsigned int i = 0; i < num_points; i++)
+        {
+            points.emplace_back(x_distribution(random_engine),
+                                y_distribution(random_engine));
+            triangulation.updatePoint(i, points[i]);
+        }
+        Point corner(x_distribution(random_engine), y_distribution(random_engine));
+        Rectangle region(corner, corner + Vector(size_distribution(random_engine),
+                                                 size_distribution(random_engine)));
+
+        std::vector<Circle> open_circles =
+            triangulation.findLargestOpenCircles(region, 5);
+        std::vector<Circle> expected_open_circles =
+            findLargestOpenCirclesByBruteForce(region, points, 5);
+        ASSERT_EQ(expected_open_circles.size(), open_circles.size());
+        for (std::size_t i = 0; i < open_circles.size(); i++)
+        {
+            EXPECT_NEAR(expected_open_circles[i].radius(), open_circles[i].radius(),
+                        1e-6);
+        }
+    }
+}
+
+TEST_F(DelaunayTriangulationTest, test_moving_points)
+{
+    // Move the points around like robots over many ticks, checking that the
+    // triangulation stays the same as one built from scratch
+    DelaunayTriangulation triangulation(field);
+    std::vector<Point> points;
+    for (unsigned int i = 0; i < 11; i++)
+    {
+        points.emplace_back(x_distribution(random_engine), y_distribution(random_engine));
+        triangulation.updatePoint(i, points[i]);
+    }
+
+    std::normal_distribution<double> step_distribution(0, 0.05);
+    for (unsigned int tick = 0; tick < 200; tick++)
+    {
+        for (unsigned int i = 0; i < points.size(); i++)
+        {
+            points[i] = Point(
+                std::clamp(points[i].x() + step_distribution(random_engine), -4.5, 4.5),
+                std::clamp(points[i].y() + step_distribution(random_engine), -3.0, 3.0));
+            triangulation.updatePoint(i, points[i]);
+        }
+        expectDelaunay(triangulation, points);
+    }
+    expectLargestOpenCircles(triangulation, field, points);
+}
+
+TEST_F(DelaunayTriangulationTest, test_many_updates_on_grid)
+{
+    // Points on a grid are often on the same line or circle as each other, or on top of
+    // each other, which are the hardest cases for the triangulation
+    DelaunayTriangulation triangulation(field);
+    std::uniform_int_distribution<unsigned int> id_distribution(0, 15);
+    std::uniform_int_distribution<int> x_grid_distribution(-9, 9);
+    std::uniform_int_distribution<int> y_grid_distribution(-6, 6);
+    for (unsigned int i = 0; i < 5000; i++)
+    {
+        unsigned int point_id = id_distribution(random_engine);
+        if (i % 10 == 0)
+        {
+            triangulation.removePoint(point_id);
+        }
+        else
+        {
+            triangulation.updatePoint(point_id,
+                                      Point(x_grid_distribution(random_engine) * 0.5,
+                                            y_grid_distribution(random_engine) * 0.5));
+        }
+    }
+
+    // Move every point to a point on a different grid, so none are on top of each other
+    std::vector<Point> points;
+    for (unsigned int i = 0; i < 16; i++)
+    {
+        points.emplace_back(static_cast<int>(i % 4) - 1.25,
+                            static_cast<int>(i / 4) - 1.25);
+        triangulation.updatePoint(i, points[i]);
+    }
+
+    EXPECT_EQ(18, triangulation.getTriangles().size());
+    expectDelaunay(triangulation, points);
+    expectLargestOpenCircles(triangulation, field, points);
+}
+
+TEST_F(DelaunayTriangulationTest, test_removing_points)
+{
+    DelaunayTriangulation triangulation(field);
+    std::vector<Point> points;
+    for (unsigned int i = 0; i < 11; i++)
+    {
+        points.emplace_back(x_distribution(random_engine), y_distribution(random_engine));
+        triangulation.updatePoint(i, points[i]);
+    }
+
+    for (unsigned int i = 0; i < 8; i++)
+    {
+        triangulation.removePoint(i);
+    }
+    points.erase(points.begin(), points.begin() + 8);
+
+    std::vector<unsigned int> point_ids = triangulation.getPointIds();
+    std::sort(point_ids.begin(), point_ids.end());
+    EXPECT_EQ(std::vector<unsigned int>({8, 9, 10}), point_ids);
+    EXPECT_EQ(1, triangulation.getTriangles().size());
+    expectLargestOpenCircles(triangulation, field, points);
+
+    // Removing a point that is not in the triangulation does nothing
+    triangulation.removePoint(0);
+    EXPECT_EQ(3, triangulation.getPointIds().size());
+}
+
+TEST_F(DelaunayTriangulationTest, test_points_outside_region_limit_open_circles)
+{
+    DelaunayTriangulation triangulation(field);
+    triangulation.updatePoint(0, Point(-2, 0));
+    triangulation.updatePoint(1, Point(2, 0));
+    triangulation.updatePoint(2, Point(0, 2));
+
+    // Only consider the half of the field without the point at (-2, 0)
+    Rectangle region(Point(0, -3), Point(4.5, 3));
+    std::vector<Circle> open_circles = triangulation.findLargestOpenCircles(region, 10);
+
+    ASSERT_FALSE(open_circles.empty());
+    for (const Circle& circle : open_circles)
+    {
+        EXPECT_TRUE(contains(region, circle.origin()));
+        EXPECT_LE(circle.radius(), distance(circle.origin(), Point(-2, 0)) + 1e-9);
+        EXPECT_LE(circle.radius(), distance(circle.origin(), Point(2, 0)) + 1e-9);
+        EXPECT_LE(circle.radius(), distance(circle.origin(), Point(0, 2)) + 1e-9);
+    }
+}
+
+TEST_F(DelaunayTriangulationTest, test_duplicate_points)
+{
+    DelaunayTriangulation triangulation(field);
+    triangulation.updatePoint(0, Point(1, 1));
+    triangulation.updatePoint(1, Point(1, 1));
+    triangulation.updatePoint(2, Point(-1, 1));
+    triangulation.updatePoint(3, Point(1, 1));
+
+    EXPECT_EQ(4, triangulation.getPointIds().size());
+    EXPECT_FALSE(triangulation.findLargestOpenCircles(field, 5).empty());
+}
+
+TEST_F(DelaunayTriangulationTest, test_point_far_outside_bounds_throws)
+{
+    DelaunayTriangulation triangulation(field);
+
+    EXPECT_THROW(triangulation.updatePoint(0, Point(1e6, 0)), std::invalid_argument);
+    EXPECT_TRUE(triangulation.getPointIds().empty());
+}
@@ -36,18 +36,19 @@ double distance(const Point &first, const Polygon &second)
         return 0;
     }
 
-    double min_dist = std::numeric_limits<double>::max();
+    double min_dist_squared = std::numeric_limits<double>::max();
 
-    // Calculate the distance from the point to each edge
+    // Calculate the squared distance from the point to each edge, so that only the
+    // closest edge needs a square root
     for (auto &segment : second.getSegments())
     {
-        double current_dist = distance(first, segment);
-        if (current_dist < min_dist)
+        double current_dist_squared = distanceSquared(first, segment);
+        if (current_dist_squared < min_dist_squared)
         {
-            min_dist = current_dist;
+            min_dist_squared = current_dist_squared;
         }
     }
-    return min_dist;
+    return std::sqrt(min_dist_squared);
 }
 
 double distance(const Polygon &first, const Point &second)
@@ -6,6 +6,15 @@
 
 bool intersects(const Polygon &first, const Segment &second)
 {
+    const Point &start = second.getStart();
+    const Point &end   = second.getEnd();
+    if (!first.boundingBoxOverlaps(
+            Point(std::min(start.x(), end.x()), std::min(start.y(), end.y())),
+            Point(std::max(start.x(), end.x()), std::max(start.y(), end.y()))))
+    {
+        return false;
+    }
+
     for (const auto &seg : first.getSegments())
     {
         if (intersects(seg, second))
@@ -44,6 +53,13 @@ bool intersects(const Ray &first, const Polygon &second)
 
 bool intersects(const Polygon &first, const Circle &second)
 {
+    Vector radius_vector(second.radius(), second.radius());
+    if (!first.boundingBoxOverlaps(second.origin() - radius_vector,
+                                   second.origin() + radius_vector))
+    {
+        return false;
+    }
+
     if (contains(first, second.origin()))
     {
         return true;
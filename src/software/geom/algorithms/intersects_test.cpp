@@ -45,6 +45,15 @@ TEST(IntersectsTest, polygon_near_segment_not_intersecting)
     EXPECT_FALSE(intersects(s, p));
 }
 
+TEST(IntersectsTest, polygon_segment_touching_bounding_box_corner)
+{
+    Polygon p({{0, 0}, {2, 0}, {2, 2}});
+    EXPECT_TRUE(intersects(p, Segment({2, 2}, {3, 3})));
+    EXPECT_FALSE(intersects(p, Segment({2.1, 2.1}, {3, 3})));
+    // The segment overlaps the bounding box, but not the polygon
+    EXPECT_FALSE(intersects(p, Segment({0, 1}, {0, 2})));
+}
+
 TEST(IntersectsTest, segment_overlapping_polygon_edge)
 {
     Polygon p({{-6, 2}, {-1, 1}, {10, 7}, {5, -6}, {-5, -3}});
@@ -173,6 +182,14 @@ TEST(IntersectsTest, circle_outside_rectangle_intersecting)
     EXPECT_TRUE(intersects(c, r));
 }
 
+TEST(IntersectsTest, circle_overlapping_bounding_box_corner_not_intersecting)
+{
+    Polygon p({{-5, -2}, {3, -2}, {3, 4}, {-5, 4}});
+    Circle c({4.5, -3.5}, 1.6);
+    EXPECT_FALSE(intersects(p, c));
+    EXPECT_FALSE(intersects(c, p));
+}
+
 TEST(IntersectsTest, circle_outside_rectangle_not_intersecting)
 {
     Rectangle r({-5, -2}, {3, 4});
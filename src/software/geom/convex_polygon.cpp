@@ -4,7 +4,7 @@
 
 ConvexPolygon::ConvexPolygon(const std::vector<Point>& points) : Polygon(points)
 {
-    if (!isConvex())
+    if (!isApproximatelyConvex())
     {
         throw std::invalid_argument("Points do not make a convex polygon");
     }
@@ -12,7 +12,7 @@ ConvexPolygon::ConvexPolygon(const std::vector<Point>& points) : Polygon(points)
 
 ConvexPolygon::ConvexPolygon(const std::initializer_list<Point>& points) : Polygon(points)
 {
-    if (!isConvex())
+    if (!isApproximatelyConvex())
     {
         throw std::invalid_argument("Points do not make a convex polygon");
     }
@@ -20,7 +20,7 @@ ConvexPolygon::ConvexPolygon(const std::initializer_list<Point>& points) : Polyg
 
 // From:
 // https://math.stackexchange.com/questions/1743995/determine-whether-a-polygon-is-convex-based-on-its-vertices
-bool ConvexPolygon::isConvex()
+bool ConvexPolygon::isApproximatelyConvex()
 {
     if (points_.size() < 3)
     {
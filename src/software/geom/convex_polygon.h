@@ -45,10 +45,11 @@ class ConvexPolygon : public Polygon, public ConvexShape
      * Check that the points of this polygon make up a Convex polygon.
      *
      * Every vertex angle must be 180 degrees or less, and for each vertex angle a,
-     * the running total of all a must equal 360.
+     * the running total of all a must equal 360. Unlike Polygon::isConvex, this allows
+     * for a small floating point error.
      *
      * @return true if the points of this polygon make up a Convex polygon, false
      * otherwise
      */
-    bool isConvex();
+    bool isApproximatelyConvex();
 };
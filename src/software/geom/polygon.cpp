@@ -1,11 +1,27 @@
 #include "software/geom/polygon.h"
 
+#include <cmath>
+#include <limits>
 #include <unordered_set>
 
 Polygon::Polygon(const std::vector<Point>& points)
-    : points_(points), segments_(initSegments(points_))
+    : points_(points),
+      segments_(initSegments(points_)),
+      edge_normals_(initEdgeNormals(points_)),
+      is_convex_(initIsConvex(points_)),
+      bounding_box_min_(std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::max()),
+      bounding_box_max_(std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::lowest())
 {
     // we pre-compute the segments_ in the constructor to improve performance
+    for (const Point& point : points_)
+    {
+        bounding_box_min_ = Point(std::min(bounding_box_min_.x(), point.x()),
+                                  std::min(bounding_box_min_.y(), point.y()));
+        bounding_box_max_ = Point(std::max(bounding_box_max_.x(), point.x()),
+                                  std::max(bounding_box_max_.y(), point.y()));
+    }
 }
 
 Polygon::Polygon(const std::initializer_list<Point>& points)
@@ -13,9 +29,10 @@ Polygon::Polygon(const std::initializer_list<Point>& points)
 {
 }
 
-std::vector<Segment> Polygon::initSegments(std::vector<Point> points)
+std::vector<Segment> Polygon::initSegments(const std::vector<Point>& points)
 {
     std::vector<Segment> segments;
+    segments.reserve(points.size());
     for (unsigned i = 0; i < points.size(); i++)
     {
         // add a segment between consecutive points, but wrap index
@@ -25,6 +42,133 @@ std::vector<Segment> Polygon::initSegments(std::vector<Point> points)
     return segments;
 }
 
+std::vector<Vector> Polygon::initEdgeNormals(const std::vector<Point>& points)
+{
+    // This is called every time a polygon is constructed, so it works with the
+    // coordinates directly and reads each point once
+    std::vector<Vector> edge_normals;
+    if (points.empty())
+    {
+        return edge_normals;
+    }
+    edge_normals.reserve(points.size());
+
+    // The sign of the area of the polygon from the shoelace formula is positive if the
+    // points go counter-clockwise around the polygon, and negative if they go clockwise
+    double signed_area = 0;
+    double first_x     = points.front().x();
+    double first_y     = points.front().y();
+    double start_x     = first_x;
+    double start_y     = first_y;
+    for (std::size_t i = 1; i <= points.size(); i++)
+    {
+        double end_x  = i < points.size() ? points[i].x() : first_x;
+        double end_y  = i < points.size() ? points[i].y() : first_y;
+        double edge_x = end_x - start_x;
+        double edge_y = end_y - start_y;
+        signed_area += start_x * end_y - end_x * start_y;
+
+        // The normal to the left of the segment
+        double length = std::sqrt(edge_x * edge_x + edge_y * edge_y);
+        edge_normals.push_back(length > 0 ? Vector(-edge_y / length, edge_x / length)
+                                          : Vector());
+
+        start_x = end_x;
+        start_y = end_y;
+    }
+
+    // The outside of the polygon is to the right of each segment if the points go
+    // counter-clockwise, and to the left if they go clockwise
+    if (signed_area >= 0)
+    {
+        for (Vector& normal : edge_normals)
+        {
+            normal = -normal;
+        }
+    }
+    return edge_normals;
+}
+
+bool Polygon::initIsConvex(const std::vector<Point>& points)
+{
+    // A polygon is convex if it turns the same way at every point, and it only goes
+    // around once. The second condition is needed to rule out self-intersecting
+    // polygons like a star, and is true if the x and y coordinates of the edges each
+    // change sign at most twice going around the polygon.
+    // From:
+    // https://math.stackexchange.com/questions/1743995/determine-whether-a-polygon-is-convex-based-on-its-vertices
+    if (points.size() < 3)
+    {
+        return false;
+    }
+
+    int turn_sign = 0;
+    int x_sign = 0, x_first_sign = 0, x_flips = 0;
+    int y_sign = 0, y_first_sign = 0, y_flips = 0;
+    auto count_sign_flips = [](double value, int& sign, int& first_sign, int& flips) {
+        int value_sign = (value > 0) - (value < 0);
+        if (value_sign == 0)
+        {
+            return;
+        }
+        if (first_sign == 0)
+        {
+            first_sign = value_sign;
+        }
+        else if (value_sign != sign)
+        {
+            flips++;
+        }
+        sign = value_sign;
+    };
+
+    // Like initEdgeNormals, this reads each point once
+    double first_x     = points.front().x();
+    double first_y     = points.front().y();
+    double start_x     = first_x;
+    double start_y     = first_y;
+    double prev_edge_x = first_x - points.back().x();
+    double prev_edge_y = first_y - points.back().y();
+    for (std::size_t i = 1; i <= points.size(); i++)
+    {
+        double end_x       = i < points.size() ? points[i].x() : first_x;
+        double end_y       = i < points.size() ? points[i].y() : first_y;
+        double next_edge_x = end_x - start_x;
+        double next_edge_y = end_y - start_y;
+
+        double cross = prev_edge_x * next_edge_y - prev_edge_y * next_edge_x;
+        if (cross == 0 && prev_edge_x * next_edge_x + prev_edge_y * next_edge_y < 0)
+        {
+            // The polygon turns back on itself
+            return false;
+        }
+        int cross_sign = (cross > 0) - (cross < 0);
+        if (cross_sign != 0)
+        {
+            if (turn_sign != 0 && cross_sign != turn_sign)
+            {
+                return false;
+            }
+            turn_sign = cross_sign;
+        }
+
+        count_sign_flips(next_edge_x, x_sign, x_first_sign, x_flips);
+        count_sign_flips(next_edge_y, y_sign, y_first_sign, y_flips);
+
+        start_x     = end_x;
+        start_y     = end_y;
+        prev_edge_x = next_edge_x;
+        prev_edge_y = next_edge_y;
+    }
+
+    // Count the sign flips between the last and first edges
+    x_flips += x_sign != x_first_sign;
+    y_flips += y_sign != y_first_sign;
+
+    // The polygon is degenerate if it never turns, since all its points are on a line
+    return turn_sign != 0 && x_flips <= 2 && y_flips <= 2;
+}
+
 Point Polygon::centroid() const
 {
     // Explanation of the math/geometry behind this:
@@ -129,6 +273,24 @@ const std::vector<Point>& Polygon::getPoints() const
     return points_;
 }
 
+const std::vector<Vector>& Polygon::getEdgeNormals() const
+{
+    return edge_normals_;
+}
+
+bool Polygon::isConvex() const
+{
+    return is_convex_;
+}
+
+bool Polygon::boundingBoxOverlaps(const Point& box_min, const Point& box_max) const
+{
+    return box_max.x() >= bounding_box_min_.x() - BOUNDARY_TOLERANCE &&
+           box_min.x() <= bounding_box_max_.x() + BOUNDARY_TOLERANCE &&
+           box_max.y() >= bounding_box_min_.y() - BOUNDARY_TOLERANCE &&
+           box_min.y() <= bounding_box_max_.y() + BOUNDARY_TOLERANCE;
+}
+
 bool operator==(const Polygon& poly1, const Polygon& poly2)
 {
     return (poly1.getPoints() == poly2.getPoints());
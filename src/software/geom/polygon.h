@@ -54,15 +54,76 @@ class Polygon : public virtual Shape
      */
     const std::vector<Point>& getPoints() const;
 
+    /**
+     * Returns the outward facing unit normal of each line segment that forms this
+     * polygon, in the same order as the segments. The normal of a segment with zero
+     * length is the zero vector.
+     *
+     * The direction of the normals is found from the winding order of the points, so
+     * for self-intersecting polygons some normals may face inwards.
+     *
+     * @return the outward facing unit normals of the line segments that form this polygon
+     */
+    const std::vector<Vector>& getEdgeNormals() const;
+
+    /**
+     * Returns whether this polygon is convex. Unlike the ConvexPolygon constructor, this
+     * does not allow for any floating point error, so a polygon that is only convex
+     * within a small tolerance is not convex.
+     *
+     * @return whether this polygon is convex
+     */
+    bool isConvex() const;
+
+    /**
+     * Checks whether an axis-aligned box overlaps the axis-aligned bounding box of this
+     * polygon. This is a fast way to rule out a shape touching this polygon before
+     * checking it against every line segment.
+     *
+     * Boxes that miss the bounding box by less than BOUNDARY_TOLERANCE are still
+     * considered to overlap it, so that rounding errors in the checks against the line
+     * segments can not change the result of a check that is ruled out.
+     *
+     * @param box_min The corner of the box with the smallest coordinates
+     * @param box_max The corner of the box with the largest coordinates
+     *
+     * @return whether the box overlaps the bounding box of this polygon
+     */
+    bool boundingBoxOverlaps(const Point& box_min, const Point& box_max) const;
+
+    // Shapes within this distance of the boundary or bounding box of a polygon, in
+    // metres, are never ruled in or out by the fast checks against the polygon, since
+    // rounding errors could give a different result than the exact checks
+    static constexpr double BOUNDARY_TOLERANCE = 1e-9;
+
    protected:
     /**
      * Returns the line segments that connect a list of points.
      * @return the line segments
      */
-    static std::vector<Segment> initSegments(std::vector<Point> points);
+    static std::vector<Segment> initSegments(const std::vector<Point>& points);
+
+    /**
+     * Returns the outward facing unit normals of the line segments that connect a list
+     * of points.
+     * @return the outward facing unit normals
+     */
+    static std::vector<Vector> initEdgeNormals(const std::vector<Point>& points);
+
+    /**
+     * Returns whether the given points form a convex polygon
+     * @return whether the points form a convex polygon
+     */
+    static bool initIsConvex(const std::vector<Point>& points);
 
     std::vector<Point> points_;
     std::vector<Segment> segments_;
+    // These are computed once in the constructor since they are needed by every check
+    // against the polygon
+    std::vector<Vector> edge_normals_;
+    bool is_convex_;
+    Point bounding_box_min_;
+    Point bounding_box_max_;
 };
 
 bool operator==(const Polygon& poly1, const Polygon& poly2);
@@ -78,3 +139,18 @@ bool operator!=(const Polygon& poly1, const Polygon& poly2);
  * @return The output stream with the string representation of the class appended
  */
 std::ostream& operator<<(std::ostream& os, const Polygon& poly);
+
+template <>
+struct std::hash<Polygon>
+{
+    std::size_t operator()(const Polygon& polygon) const
+    {
+        std::size_t hash = 0;
+        for (const Point& point : polygon.getPoints())
+        {
+            // This combines hashes the same way as boost::hash_combine
+            hash ^= std::hash<Point>()(point) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
@@ -50,7 +50,72 @@ TEST(PolygonTest, test_construct_from_initializer_list)
     }
 }
 
+TEST(PolygonEdgeNormalsTest, test_counter_clockwise_square)
+{
+    Polygon poly({{0, 0}, {2, 0}, {2, 2}, {0, 2}});
+    std::vector<Vector> expected = {Vector(0, -1), Vector(1, 0), Vector(0, 1),
+                                    Vector(-1, 0)};
+    EXPECT_EQ(expected, poly.getEdgeNormals());
+}
+
+TEST(PolygonEdgeNormalsTest, test_clockwise_square)
+{
+    Polygon poly({{0, 0}, {0, 2}, {2, 2}, {2, 0}});
+    std::vector<Vector> expected = {Vector(-1, 0), Vector(0, 1), Vector(1, 0),
+                                    Vector(0, -1)};
+    EXPECT_EQ(expected, poly.getEdgeNormals());
+}
+
+TEST(PolygonEdgeNormalsTest, test_non_convex_polygon_with_zero_length_edge)
+{
+    Polygon poly({{1, 1}, {1, 3}, {2, 2}, {2, 2}, {5, 3}, {5, 1}});
+    std::vector<Vector> normals = poly.getEdgeNormals();
+    ASSERT_EQ(6, normals.size());
+    EXPECT_EQ(Vector(-1, 0), normals[0]);
+    EXPECT_EQ(Vector(1, 1).normalize(), normals[1]);
+    EXPECT_EQ(Vector(0, 0), normals[2]);
+    EXPECT_EQ(Vector(-1, 3).normalize(), normals[3]);
+    EXPECT_EQ(Vector(1, 0), normals[4]);
+    EXPECT_EQ(Vector(0, -1), normals[5]);
+}
+
+TEST(PolygonIsConvexTest, test_convex_polygons)
+{
+    EXPECT_TRUE(Polygon({{0, 0}, {1, 0}, {1, 1}}).isConvex());
+    EXPECT_TRUE(Polygon({{0, 0}, {0, 2}, {2, 2}, {2, 0}}).isConvex());
+    // Points on the middle of an edge do not make a polygon non-convex
+    EXPECT_TRUE(Polygon({{0, 0}, {1, 0}, {2, 0}, {2, 2}, {0, 2}}).isConvex());
+}
+
+TEST(PolygonIsConvexTest, test_non_convex_polygons)
+{
+    EXPECT_FALSE(Polygon({{1, 1}, {1, 3}, {2, 2}, {5, 3}, {5, 1}}).isConvex());
+    // Too few points
+    EXPECT_FALSE(Polygon({{0, 0}, {1, 1}}).isConvex());
+    // All points on a line
+    EXPECT_FALSE(Polygon({{0, 3}, {1, 3}, {2, 3}, {3, 3}}).isConvex());
+    // Turns back on itself
+    EXPECT_FALSE(Polygon({{0, 0}, {2, 0}, {1, 0}, {1, 1}}).isConvex());
+    // Self-intersecting ribbon
+    EXPECT_FALSE(Polygon({{0, 0}, {0, 5}, {5, 5}, {-5, 0}}).isConvex());
+    // A star turns the same way at every point, but goes around twice
+    EXPECT_FALSE(
+        Polygon({{0, 3}, {-1.8, -2.4}, {2.9, 0.9}, {-2.9, 0.9}, {1.8, -2.4}}).isConvex());
+}
 
+TEST(PolygonBoundingBoxTest, test_bounding_box_overlaps)
+{
+    Polygon poly({{1, 1}, {1, 3}, {2, 2}, {5, 3}, {5, 1}});
+
+    EXPECT_TRUE(poly.boundingBoxOverlaps(Point(2, 2), Point(2, 2)));
+    EXPECT_TRUE(poly.boundingBoxOverlaps(Point(0, 0), Point(1, 1)));
+    EXPECT_TRUE(poly.boundingBoxOverlaps(Point(0, 0), Point(6, 4)));
+    // Boxes that touch the bounding box within the tolerance overlap it
+    EXPECT_TRUE(poly.boundingBoxOverlaps(Point(5 + 1e-10, 3), Point(6, 4)));
+    EXPECT_FALSE(poly.boundingBoxOverlaps(Point(5.1, 3), Point(6, 4)));
+    EXPECT_FALSE(poly.boundingBoxOverlaps(Point(0, 0), Point(0.9, 4)));
+    EXPECT_FALSE(poly.boundingBoxOverlaps(Point(2, 3.1), Point(3, 4)));
+}
 
 TEST(PolygonCentroidTest, test_triangle)
 {
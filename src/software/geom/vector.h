@@ -38,7 +38,7 @@ class Vector final
      *
      * @param the Vector to duplicate
      */
-    Vector(const Vector &v);
+    Vector(const Vector &other) = default;
 
     /**
      * Returns the magnitude in the x-coordinate of this Vector
@@ -180,7 +180,7 @@ class Vector final
      *
      * @return this Vector
      */
-    Vector &operator=(const Vector &other);
+    Vector &operator=(const Vector &other) = default;
 
    private:
     /**
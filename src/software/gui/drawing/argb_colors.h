@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+
+// Colours that are drawn both with Qt (see colors.h) and with Qt-free draw commands,
+// as 0xAARRGGBB
+static constexpr uint32_t NAVIGATOR_PATH_ARGB     = 0xFFA0A0A4;
+static constexpr uint32_t NAVIGATOR_OBSTACLE_ARGB = 0xFF464646;
@@ -5,13 +5,33 @@
 #include "software/gui/drawing/geom.h"
 #include "software/math/math_functions.h"
 
+// A somewhat arbitrary value that we've determined looks nice in the GUI
+static const double MAX_VELOCITY_LINE_LENGTH = 1.0;
+static const int VELOCITY_LINE_WIDTH         = 2;
+
+/**
+ * Creates the pen to draw the cone between the ball and friendly goal posts with
+ *
+ * @return the pen to draw the cone between the ball and friendly goal posts with
+ */
+static QPen createBallConePen()
+{
+    QColor ball_cone_color = ball_color;
+    ball_cone_color.setAlpha(170);
+
+    QPen pen(ball_cone_color);
+    pen.setWidth(1);
+    // The cap style must be NOT be set to SquareCap. It can be set to anything else.
+    // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
+    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+    pen.setCosmetic(true);
+    return pen;
+}
+
 void drawBallVelocity(QGraphicsScene *scene, const Point &position,
                       const Vector &velocity, const QColor &slow_colour,
                       const QColor &fast_colour)
 {
-    // A somewhat arbitrary value that we've determined looks nice in the GUI
-    static const double MAX_VELOCITY_LINE_LENGTH = 1.0;
-
     QGradient gradient = QLinearGradient(
         createQPointF(position),
         createQPointF(position + velocity.normalize(MAX_VELOCITY_LINE_LENGTH)));
@@ -19,7 +39,7 @@ void drawBallVelocity(QGraphicsScene *scene, const Point &position,
     gradient.setColorAt(1, fast_colour);
 
     auto pen = QPen(gradient, 1);
-    pen.setWidth(2);
+    pen.setWidth(VELOCITY_LINE_WIDTH);
     // The cap style must be NOT be set to SquareCap. It can be set to anything else.
     // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
@@ -75,18 +95,42 @@ void drawBall(QGraphicsScene *scene, const BallDetection &ball)
 void drawBallConeToFriendlyNet(QGraphicsScene *scene, const Point &position,
                                const Field &field)
 {
-    QColor ball_cone_color = ball_color;
-    ball_cone_color.setAlpha(170);
-
-    QPen pen(ball_cone_color);
-    pen.setWidth(1);
-    // The cap style must be NOT be set to SquareCap. It can be set to anything else.
-    // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
-    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
-    pen.setCosmetic(true);
+    QPen pen = createBallConePen();
 
     Segment pos_goalpost_segment(position, field.friendlyGoalpostPos());
     Segment neg_goalpost_segment(position, field.friendlyGoalpostNeg());
     drawSegment(scene, pos_goalpost_segment, pen);
     drawSegment(scene, neg_goalpost_segment, pen);
 }
+
+DrawLayer createBallVelocityDrawLayer(const DrawLayerId &layer_id, const Point &position,
+                                      const Vector &velocity, const QColor &slow_colour,
+                                      const QColor &fast_colour)
+{
+    return createVelocityDrawLayer(
+        layer_id, position, velocity, BALL_MAX_SPEED_METERS_PER_SECOND,
+        MAX_VELOCITY_LINE_LENGTH, VELOCITY_LINE_WIDTH, slow_colour, fast_colour);
+}
+
+DrawLayer createBallPositionDrawLayer(const DrawLayerId &layer_id, const Point &position,
+                                      const double distance_from_ground,
+                                      const QColor &color)
+{
+    return DrawLayer{
+        layer_id, createDrawLayerContentKey(distance_from_ground, color.rgba()),
+        [distance_from_ground, color](QGraphicsScene *scene) {
+            drawBallPosition(scene, Point(0, 0), distance_from_ground, color);
+        },
+        createQTransform(position)};
+}
+
+std::vector<DrawLayer> createBallConeToFriendlyNetDrawLayers(std::string_view layer_name,
+                                                             const Point &position,
+                                                             const Field &field)
+{
+    QPen pen = createBallConePen();
+    return {createSegmentDrawLayer(DrawLayerId{layer_name, 0},
+                                   Segment(position, field.friendlyGoalpostPos()), pen),
+            createSegmentDrawLayer(DrawLayerId{layer_name, 1},
+                                   Segment(position, field.friendlyGoalpostNeg()), pen)};
+}
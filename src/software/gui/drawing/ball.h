@@ -3,6 +3,7 @@
 #include <QtWidgets/QGraphicsScene>
 
 #include "software/gui/drawing/colors.h"
+#include "software/gui/drawing/draw_functions.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/ball_state.h"
 #include "software/world/field.h"
@@ -60,3 +61,47 @@ void drawBall(QGraphicsScene *scene, const BallDetection &ball);
  */
 void drawBallConeToFriendlyNet(QGraphicsScene *scene, const Point &position,
                                const Field &field);
+
+/**
+ * Creates a layer that draws the ball velocity. The layer is only redrawn when the speed
+ * of the ball changes by a large amount.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position of the ball
+ * @param velocity The velocity of the ball
+ * @param slow_colour The velocity line colour when the velocity is slow
+ * @param fast_colour The velocity line colour when the velocity is fast
+ *
+ * @return the layer that draws the ball velocity
+ */
+DrawLayer createBallVelocityDrawLayer(const DrawLayerId &layer_id, const Point &position,
+                                      const Vector &velocity, const QColor &slow_colour,
+                                      const QColor &fast_colour);
+
+/**
+ * Creates a layer that draws the ball's position. The layer is only redrawn when the
+ * distance of the ball off the ground or the colour changes.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position of the ball
+ * @param distance_from_ground the distance of the ball off the ground
+ * @param color The color to draw the ball's position
+ *
+ * @return the layer that draws the ball's position
+ */
+DrawLayer createBallPositionDrawLayer(const DrawLayerId &layer_id, const Point &position,
+                                      double distance_from_ground, const QColor &color);
+
+/**
+ * Creates the layers that draw a cone between the ball and friendly goal posts, one
+ * for each side of the cone. The layers are never redrawn.
+ *
+ * @param layer_name The name of the layers. The layers have the indices 0 and 1.
+ * @param position The position of the ball
+ * @param field The field to draw the cone on
+ *
+ * @return the layers that draw the cone
+ */
+std::vector<DrawLayer> createBallConeToFriendlyNetDrawLayers(std::string_view layer_name,
+                                                             const Point &position,
+                                                             const Field &field);
@@ -2,6 +2,8 @@
 
 #include <QtGui/QColor>
 
+#include "software/gui/drawing/argb_colors.h"
+
 const QColor field_color      = Qt::darkGreen;
 const QColor field_line_color = Qt::white;
 const QColor ball_color(255, 100, 0, 255);
@@ -10,5 +12,5 @@ const QColor ball_speed_fast_color(ball_color);
 const QColor yellow_robot_color(255, 255, 0, 255);
 const QColor blue_robot_color(0, 75, 255, 255);
 const QColor robot_speed_slow_color(Qt::black);
-const QColor navigator_path_color = Qt::gray;
-const QColor navigator_obstacle_color(70, 70, 70, 255);
+const QColor navigator_path_color     = QColor::fromRgba(NAVIGATOR_PATH_ARGB);
+const QColor navigator_obstacle_color = QColor::fromRgba(NAVIGATOR_OBSTACLE_ARGB);
@@ -0,0 +1,164 @@
+#include "software/gui/drawing/draw_command_buffer.h"
+
+#include <functional>
+#include <string_view>
+
+void DrawCommandBuffer::addLine(const Segment& segment, const DrawStyle& style)
+{
+    values.insert(values.end(), {static_cast<float>(segment.getStart().x()),
+                                 static_cast<float>(segment.getStart().y()),
+                                 static_cast<float>(segment.getEnd().x()),
+                                 static_cast<float>(segment.getEnd().y())});
+    addCommandForLastValues(DrawCommandType::LINE, style, 4);
+}
+
+void DrawCommandBuffer::addCircle(const Circle& circle, const DrawStyle& style)
+{
+    values.insert(values.end(), {static_cast<float>(circle.origin().x()),
+                                 static_cast<float>(circle.origin().y()),
+                                 static_cast<float>(circle.radius())});
+    addCommandForLastValues(DrawCommandType::CIRCLE, style, 3);
+}
+
+void DrawCommandBuffer::addPolygon(const Polygon& polygon, const DrawStyle& style)
+{
+    for (const Point& point : polygon.getPoints())
+    {
+        values.insert(values.end(),
+                      {static_cast<float>(point.x()), static_cast<float>(point.y())});
+    }
+    addCommandForLastValues(DrawCommandType::POLYGON, style,
+                            2 * polygon.getPoints().size());
+}
+
+void DrawCommandBuffer::addText(const std::string& text_to_draw, const Point& position,
+                                double height, const DrawStyle& style)
+{
+    values.insert(values.end(),
+                  {static_cast<float>(position.x()), static_cast<float>(position.y()),
+                   static_cast<float>(height)});
+    addCommandForLastValues(DrawCommandType::TEXT, style, 3);
+
+    commands.back().text_begin  = static_cast<uint32_t>(text.size());
+    commands.back().text_length = static_cast<uint32_t>(text_to_draw.size());
+    text.append(text_to_draw);
+}
+
+void DrawCommandBuffer::addCommand(const DrawCommand& command, const float* values_,
+                                   size_t num_values, const char* text_,
+                                   size_t text_length)
+{
+    DrawCommand new_command  = command;
+    new_command.values_begin = static_cast<uint32_t>(values.size());
+    new_command.num_values   = static_cast<uint32_t>(num_values);
+    new_command.text_begin   = static_cast<uint32_t>(text.size());
+    new_command.text_length  = static_cast<uint32_t>(text_length);
+    commands.emplace_back(new_command);
+
+    values.insert(values.end(), values_, values_ + num_values);
+    text.append(text_, text_length);
+}
+
+void DrawCommandBuffer::clear()
+{
+    commands.clear();
+    values.clear();
+    text.clear();
+}
+
+void DrawCommandBuffer::reserve(size_t num_commands, size_t num_values,
+                                size_t text_length)
+{
+    commands.reserve(num_commands);
+    values.reserve(num_values);
+    text.reserve(text_length);
+}
+
+const std::vector<DrawCommand>& DrawCommandBuffer::getCommands() const
+{
+    return commands;
+}
+
+const std::vector<float>& DrawCommandBuffer::getValues() const
+{
+    return values;
+}
+
+const std::string& DrawCommandBuffer::getText() const
+{
+    return text;
+}
+
+std::string DrawCommandBuffer::getText(const DrawCommand& command) const
+{
+    return text.substr(command.text_begin, command.text_length);
+}
+
+std::size_t DrawCommandBuffer::hash() const
+{
+    // The ranges of each command are implied by the order of the commands, so only
+    // the types and styles of the commands need to be hashed along with the values
+    // and text
+    std::size_t hash = std::hash<std::string_view>()(std::string_view(
+        reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float)));
+    auto combine     = [&hash](std::size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+    combine(std::hash<std::string>()(text));
+    for (const DrawCommand& command : commands)
+    {
+        combine(static_cast<std::size_t>(command.type));
+        combine(command.num_values);
+        combine(command.text_length);
+        combine(command.style.outline_colour);
+        combine(std::hash<float>()(command.style.outline_width));
+        combine(command.style.fill_colour);
+        combine(command.style.dashed);
+    }
+    return hash;
+}
+
+bool DrawCommandBuffer::operator==(const DrawCommandBuffer& other) const
+{
+    if (commands.size() != other.commands.size() || values != other.values ||
+        text != other.text)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        const DrawCommand& command       = commands[i];
+        const DrawCommand& other_command = other.commands[i];
+        if (command.type != other_command.type ||
+            command.values_begin != other_command.values_begin ||
+            command.num_values != other_command.num_values ||
+            command.text_begin != other_command.text_begin ||
+            command.text_length != other_command.text_length ||
+            command.style.outline_colour != other_command.style.outline_colour ||
+            command.style.outline_width != other_command.style.outline_width ||
+            command.style.fill_colour != other_command.style.fill_colour ||
+            command.style.dashed != other_command.style.dashed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DrawCommandBuffer::operator!=(const DrawCommandBuffer& other) const
+{
+    return !(*this == other);
+}
+
+void DrawCommandBuffer::addCommandForLastValues(DrawCommandType type,
+                                                const DrawStyle& style, size_t num_values)
+{
+    commands.emplace_back(DrawCommand{
+        .type         = type,
+        .style        = style,
+        .values_begin = static_cast<uint32_t>(values.size() - num_values),
+        .num_values   = static_cast<uint32_t>(num_values),
+        .text_begin   = static_cast<uint32_t>(text.size()),
+        .text_length  = 0,
+    });
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "software/geom/circle.h"
+#include "software/geom/point.h"
+#include "software/geom/polygon.h"
+#include "software/geom/segment.h"
+
+/**
+ * The kinds of primitives that can be drawn with a DrawCommand
+ */
+enum class DrawCommandType : uint8_t
+{
+    // Values are x1, y1, x2, y2
+    LINE,
+    // Values are the x, y of the origin followed by the radius
+    CIRCLE,
+    // Values are the x, y of each point, in order
+    POLYGON,
+    // Values are the x, y of the bottom left corner followed by the height of the
+    // text. The text itself is stored separately from the values.
+    TEXT,
+};
+
+/**
+ * How to draw the outline and fill of a primitive
+ */
+struct DrawStyle
+{
+    // The colour of the outline, as 0xAARRGGBB
+    uint32_t outline_colour;
+    // The width of the outline in pixels, so it is the same at any zoom level
+    float outline_width;
+    // The colour of the fill, as 0xAARRGGBB. A fully transparent colour (ie. 0) is not
+    // filled.
+    uint32_t fill_colour;
+    // Whether the outline is dashed
+    bool dashed;
+};
+
+/**
+ * A single primitive in a DrawCommandBuffer. The geometry of the primitive is stored
+ * in the values of the buffer rather than in the command itself, so that every
+ * command has the same size.
+ */
+struct DrawCommand
+{
+    DrawCommandType type;
+    DrawStyle style;
+    // The range of the values of the buffer used by this command
+    uint32_t values_begin;
+    uint32_t num_values;
+    // The range of the text of the buffer used by this command. This is empty for all
+    // commands except TEXT.
+    uint32_t text_begin;
+    uint32_t text_length;
+};
+
+/**
+ * A DrawCommandBuffer is a flat list of lines, circles, polygons and text that
+ * describes what to draw, without depending on how it is drawn.
+ *
+ * Unlike a DrawFunction, it does not capture any of the objects being drawn, so it can
+ * be filled without copying them (ie. the World) and can be sent to another process
+ * (see software/proto/message_translation/draw_commands.h). Clearing the buffer keeps
+ * its storage, so a buffer that is cleared and refilled each tick stops allocating once
+ * it has grown large enough.
+ */
+class DrawCommandBuffer
+{
+   public:
+    /**
+     * Creates an empty DrawCommandBuffer
+     */
+    DrawCommandBuffer() = default;
+
+    /**
+     * Adds a line to the buffer
+     *
+     * @param segment The line to draw
+     * @param style How to draw the line. The fill colour is ignored.
+     */
+    void addLine(const Segment& segment, const DrawStyle& style);
+
+    /**
+     * Adds a circle to the buffer
+     *
+     * @param circle The circle to draw
+     * @param style How to draw the circle
+     */
+    void addCircle(const Circle& circle, const DrawStyle& style);
+
+    /**
+     * Adds a polygon to the buffer
+     *
+     * @param polygon The polygon to draw
+     * @param style How to draw the polygon
+     */
+    void addPolygon(const Polygon& polygon, const DrawStyle& style);
+
+    /**
+     * Adds text to the buffer
+     *
+     * @param text The text to draw
+     * @param position The position of the bottom left corner of the text
+     * @param height The height of the text, in metres
+     * @param style How to draw the text. The outline colour is used as the colour of
+     * the text and everything else is ignored.
+     */
+    void addText(const std::string& text, const Point& position, double height,
+                 const DrawStyle& style);
+
+    /**
+     * Adds a command to the buffer along with its values and text. The ranges of the
+     * given command are ignored and replaced with the ranges the values and text are
+     * stored in.
+     *
+     * @param command The command to add
+     * @param values The values of the command
+     * @param num_values The number of values of the command
+     * @param text The text of the command
+     * @param text_length The number of characters of text of the command
+     */
+    void addCommand(const DrawCommand& command, const float* values, size_t num_values,
+                    const char* text, size_t text_length);
+
+    /**
+     * Removes all the commands from the buffer without releasing its storage
+     */
+    void clear();
+
+    /**
+     * Reserves storage for at least the given number of commands, values and
+     * characters of text
+     *
+     * @param num_commands The number of commands to reserve storage for
+     * @param num_values The number of values to reserve storage for
+     * @param text_length The number of characters of text to reserve storage for
+     */
+    void reserve(size_t num_commands, size_t num_values, size_t text_length);
+
+    /**
+     * Returns the commands in the buffer, in the order they were added
+     *
+     * @return the commands in the buffer
+     */
+    const std::vector<DrawCommand>& getCommands() const;
+
+    /**
+     * Returns the values of all the commands in the buffer
+     *
+     * @return the values of all the commands in the buffer
+     */
+    const std::vector<float>& getValues() const;
+
+    /**
+     * Returns the text of all the TEXT commands in the buffer, concatenated
+     *
+     * @return the text of all the TEXT commands in the buffer
+     */
+    const std::string& getText() const;
+
+    /**
+     * Returns the text of the given command
+     *
+     * @param command A command in this buffer
+     *
+     * @return the text of the given command
+     */
+    std::string getText(const DrawCommand& command) const;
+
+    /**
+     * Returns a hash of the contents of the buffer. Buffers with the same commands have
+     * the same hash.
+     *
+     * @return a hash of the contents of the buffer
+     */
+    std::size_t hash() const;
+
+    bool operator==(const DrawCommandBuffer& other) const;
+    bool operator!=(const DrawCommandBuffer& other) const;
+
+   private:
+    /**
+     * Adds a command of the given type whose values are the last num_values values
+     * that were added to the buffer
+     *
+     * @param type The type of the command
+     * @param style The style of the command
+     * @param num_values The number of values of the command
+     */
+    void addCommandForLastValues(DrawCommandType type, const DrawStyle& style,
+                                 size_t num_values);
+
+    std::vector<DrawCommand> commands;
+    std::vector<float> values;
+    std::string text;
+};
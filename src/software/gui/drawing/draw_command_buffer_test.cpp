@@ -0,0 +1,131 @@
+#include "software/gui/drawing/draw_command_buffer.h"
+
+#include <gtest/gtest.h>
+
+static constexpr DrawStyle TEST_STYLE = {
+    .outline_colour = 0xFF102030,
+    .outline_width  = 2.0f,
+    .fill_colour    = 0x80405060,
+    .dashed         = true,
+};
+
+TEST(DrawCommandBufferTest, add_line)
+{
+    DrawCommandBuffer buffer;
+    buffer.addLine(Segment(Point(1, 2), Point(-3, 4)), TEST_STYLE);
+
+    ASSERT_EQ(1, buffer.getCommands().size());
+    const DrawCommand& command = buffer.getCommands()[0];
+    EXPECT_EQ(DrawCommandType::LINE, command.type);
+    EXPECT_EQ(TEST_STYLE.outline_colour, command.style.outline_colour);
+    EXPECT_EQ(TEST_STYLE.outline_width, command.style.outline_width);
+    EXPECT_EQ(TEST_STYLE.fill_colour, command.style.fill_colour);
+    EXPECT_EQ(TEST_STYLE.dashed, command.style.dashed);
+    EXPECT_EQ(0, command.values_begin);
+    EXPECT_EQ(4, command.num_values);
+    EXPECT_EQ(0, command.text_length);
+    EXPECT_EQ(std::vector<float>({1, 2, -3, 4}), buffer.getValues());
+}
+
+TEST(DrawCommandBufferTest, add_multiple_commands)
+{
+    DrawCommandBuffer buffer;
+    buffer.addCircle(Circle(Point(1, 2), 3), TEST_STYLE);
+    buffer.addPolygon(Polygon({Point(0, 0), Point(1, 0), Point(0, 1)}), TEST_STYLE);
+    buffer.addText("friendly", Point(5, 6), 0.5, TEST_STYLE);
+    buffer.addText("enemy", Point(-5, 6), 0.25, TEST_STYLE);
+
+    const std::vector<DrawCommand>& commands = buffer.getCommands();
+    ASSERT_EQ(4, commands.size());
+
+    EXPECT_EQ(DrawCommandType::CIRCLE, commands[0].type);
+    EXPECT_EQ(0, commands[0].values_begin);
+    EXPECT_EQ(3, commands[0].num_values);
+
+    EXPECT_EQ(DrawCommandType::POLYGON, commands[1].type);
+    EXPECT_EQ(3, commands[1].values_begin);
+    EXPECT_EQ(6, commands[1].num_values);
+
+    EXPECT_EQ(DrawCommandType::TEXT, commands[2].type);
+    EXPECT_EQ(9, commands[2].values_begin);
+    EXPECT_EQ(3, commands[2].num_values);
+    EXPECT_EQ("friendly", buffer.getText(commands[2]));
+
+    EXPECT_EQ(DrawCommandType::TEXT, commands[3].type);
+    EXPECT_EQ(12, commands[3].values_begin);
+    EXPECT_EQ("enemy", buffer.getText(commands[3]));
+
+    EXPECT_EQ(std::vector<float>({1, 2, 3, 0, 0, 1, 0, 0, 1, 5, 6, 0.5, -5, 6, 0.25}),
+              buffer.getValues());
+    EXPECT_EQ("friendlyenemy", buffer.getText());
+}
+
+TEST(DrawCommandBufferTest, clear_keeps_storage)
+{
+    DrawCommandBuffer buffer;
+    buffer.addPolygon(Polygon({Point(0, 0), Point(1, 0), Point(0, 1)}), TEST_STYLE);
+    buffer.addText("text", Point(0, 0), 1, TEST_STYLE);
+    const float* values_data = buffer.getValues().data();
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.getCommands().empty());
+    EXPECT_TRUE(buffer.getValues().empty());
+    EXPECT_TRUE(buffer.getText().empty());
+
+    // Refilling the buffer with no more than it held before should reuse its storage
+    buffer.addPolygon(Polygon({Point(2, 0), Point(1, 0), Point(0, 2)}), TEST_STYLE);
+    EXPECT_EQ(values_data, buffer.getValues().data());
+    EXPECT_EQ(0, buffer.getCommands()[0].values_begin);
+}
+
+TEST(DrawCommandBufferTest, add_command_replaces_ranges)
+{
+    DrawCommandBuffer buffer;
+    buffer.addCircle(Circle(Point(1, 2), 3), TEST_STYLE);
+
+    const float values[] = {4, 5, 6};
+    DrawCommand command  = {.type         = DrawCommandType::TEXT,
+                           .style        = TEST_STYLE,
+                           .values_begin = 100,
+                           .num_values   = 100,
+                           .text_begin   = 100,
+                           .text_length  = 100};
+    buffer.addCommand(command, values, 3, "hello", 5);
+
+    ASSERT_EQ(2, buffer.getCommands().size());
+    EXPECT_EQ(3, buffer.getCommands()[1].values_begin);
+    EXPECT_EQ(3, buffer.getCommands()[1].num_values);
+    EXPECT_EQ(0, buffer.getCommands()[1].text_begin);
+    EXPECT_EQ("hello", buffer.getText(buffer.getCommands()[1]));
+    EXPECT_EQ(std::vector<float>({1, 2, 3, 4, 5, 6}), buffer.getValues());
+}
+
+TEST(DrawCommandBufferTest, equal_buffers_have_equal_hashes)
+{
+    DrawCommandBuffer buffer1;
+    buffer1.addLine(Segment(Point(1, 2), Point(-3, 4)), TEST_STYLE);
+    buffer1.addText("text", Point(0, 0), 1, TEST_STYLE);
+
+    DrawCommandBuffer buffer2;
+    buffer2.addCircle(Circle(Point(1, 2), 3), TEST_STYLE);
+    buffer2.clear();
+    buffer2.addLine(Segment(Point(1, 2), Point(-3, 4)), TEST_STYLE);
+    buffer2.addText("text", Point(0, 0), 1, TEST_STYLE);
+
+    EXPECT_EQ(buffer1, buffer2);
+    EXPECT_EQ(buffer1.hash(), buffer2.hash());
+}
+
+TEST(DrawCommandBufferTest, buffers_with_different_styles_are_not_equal)
+{
+    DrawCommandBuffer buffer1;
+    buffer1.addLine(Segment(Point(1, 2), Point(-3, 4)), TEST_STYLE);
+
+    DrawStyle other_style = TEST_STYLE;
+    other_style.dashed    = false;
+    DrawCommandBuffer buffer2;
+    buffer2.addLine(Segment(Point(1, 2), Point(-3, 4)), other_style);
+
+    EXPECT_NE(buffer1, buffer2);
+    EXPECT_NE(buffer1.hash(), buffer2.hash());
+}
@@ -0,0 +1,123 @@
+#include "software/gui/drawing/draw_commands.h"
+
+#include <QtWidgets/QGraphicsSimpleTextItem>
+
+#include "software/gui/drawing/geom.h"
+
+/**
+ * Creates a pen that draws outlines with the given style
+ *
+ * @param style The style to create a pen for
+ *
+ * @return a pen that draws outlines with the given style
+ */
+static QPen createPen(const DrawStyle& style)
+{
+    QPen pen(QColor::fromRgba(style.outline_colour));
+    // The cap style must be NOT be set to SquareCap. It can be set to anything else.
+    // Drawing a line of length 0 with the SquareCap style causes a large line to be
+    // drawn
+    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+    pen.setWidthF(style.outline_width);
+    pen.setCosmetic(true);
+    if (style.dashed)
+    {
+        // The default dash pattern doesn't leave enough space between the dashes for
+        // them to be easily distinguishable
+        QVector<qreal> dashes;
+        qreal space = 7;
+        dashes << 2 << space << 2 << space;
+        pen.setDashPattern(dashes);
+    }
+    return pen;
+}
+
+/**
+ * Creates a brush that fills shapes with the given style, if they should be filled
+ *
+ * @param style The style to create a brush for
+ *
+ * @return a brush that fills shapes with the given style, or std::nullopt if shapes
+ * with the given style should not be filled
+ */
+static std::optional<QBrush> createBrush(const DrawStyle& style)
+{
+    if (qAlpha(style.fill_colour) == 0)
+    {
+        return std::nullopt;
+    }
+    return QBrush(QColor::fromRgba(style.fill_colour));
+}
+
+void drawDrawCommands(QGraphicsScene* scene, const DrawCommandBuffer& draw_command_buffer)
+{
+    const std::vector<float>& values = draw_command_buffer.getValues();
+    for (const DrawCommand& command : draw_command_buffer.getCommands())
+    {
+        const float* command_values = values.data() + command.values_begin;
+        switch (command.type)
+        {
+            case DrawCommandType::LINE:
+                drawSegment(scene,
+                            Segment(Point(command_values[0], command_values[1]),
+                                    Point(command_values[2], command_values[3])),
+                            createPen(command.style));
+                break;
+            case DrawCommandType::CIRCLE:
+                drawCircle(scene,
+                           Circle(Point(command_values[0], command_values[1]),
+                                  command_values[2]),
+                           createPen(command.style), createBrush(command.style));
+                break;
+            case DrawCommandType::POLYGON:
+            {
+                QPolygonF polygon;
+                for (uint32_t i = 0; i + 1 < command.num_values; i += 2)
+                {
+                    polygon.append(QPointF(command_values[i], command_values[i + 1]));
+                }
+                std::optional<QBrush> brush = createBrush(command.style);
+                if (brush)
+                {
+                    scene->addPolygon(polygon, createPen(command.style), brush.value());
+                }
+                else
+                {
+                    scene->addPolygon(polygon, createPen(command.style));
+                }
+                break;
+            }
+            case DrawCommandType::TEXT:
+            {
+                QGraphicsSimpleTextItem* text_item = new QGraphicsSimpleTextItem(
+                    QString::fromStdString(draw_command_buffer.getText(command)));
+                QFont sans_font("Helvetica [Cronyx]");
+                sans_font.setPointSizeF(1);
+                text_item->setFont(sans_font);
+                text_item->setBrush(QColor::fromRgba(command.style.outline_colour));
+
+                // Scale the text to the requested height and flip the y-axis so the
+                // text shows right-side-up, since the view flips the y-axis to match
+                // our coordinate system
+                const double scaling_factor =
+                    command_values[2] / text_item->boundingRect().height();
+                text_item->setTransform(
+                    QTransform(scaling_factor, 0, 0, -scaling_factor, 0, 0));
+                text_item->setPos(command_values[0],
+                                  command_values[1] + command_values[2]);
+                scene->addItem(text_item);
+                break;
+            }
+        }
+    }
+}
+
+AIDrawFunction getDrawCommandsFunction(const DrawCommandBuffer& draw_command_buffer,
+                                       const DrawLayerId& layer_id)
+{
+    return AIDrawFunction(
+        std::vector<DrawLayer>{DrawLayer{layer_id, draw_command_buffer.hash(),
+                                         [draw_command_buffer](QGraphicsScene* scene) {
+                                             drawDrawCommands(scene, draw_command_buffer);
+                                         }}});
+}
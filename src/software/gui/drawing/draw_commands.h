@@ -0,0 +1,27 @@
+#pragma once
+
+#include <QtWidgets/QGraphicsScene>
+
+#include "software/gui/drawing/draw_command_buffer.h"
+#include "software/gui/drawing/draw_functions.h"
+
+/**
+ * Draws the commands in the given DrawCommandBuffer on the given scene, in order
+ *
+ * @param scene The scene to draw on
+ * @param draw_command_buffer The commands to draw
+ */
+void drawDrawCommands(QGraphicsScene* scene,
+                      const DrawCommandBuffer& draw_command_buffer);
+
+/**
+ * Returns a function that draws the commands in the given DrawCommandBuffer. The
+ * commands are drawn on a single layer that is only redrawn when the commands change.
+ *
+ * @param draw_command_buffer The commands to draw
+ * @param layer_id The id of the layer to draw the commands on
+ *
+ * @return A function that draws the commands in the given DrawCommandBuffer
+ */
+AIDrawFunction getDrawCommandsFunction(const DrawCommandBuffer& draw_command_buffer,
+                                       const DrawLayerId& layer_id);
@@ -1,10 +1,88 @@
 #pragma once
 
+#include <QtGui/QTransform>
+#include <QtWidgets/QGraphicsItemGroup>
 #include <QtWidgets/QGraphicsScene>
+#include <atomic>
 #include <functional>
+#include <string_view>
+#include <vector>
 
 using DrawFunction = std::function<void(QGraphicsScene* scene)>;
 
+/**
+ * Identifies a DrawLayer between frames. Creating an id never allocates, since ids are
+ * created for every layer on every tick.
+ */
+struct DrawLayerId
+{
+    // The kind of layer, ie. "world/friendly_robot". This is not copied, so it must
+    // refer to a string that outlives the layer, such as a string literal.
+    std::string_view name;
+    // Tells layers of the same kind apart, ie. the id of the robot
+    std::size_t index = 0;
+
+    bool operator==(const DrawLayerId& other) const
+    {
+        return name == other.name && index == other.index;
+    }
+};
+
+template <>
+struct std::hash<DrawLayerId>
+{
+    std::size_t operator()(const DrawLayerId& id) const
+    {
+        std::size_t const h1(std::hash<std::string_view>()(id.name));
+        std::size_t const h2(std::hash<std::size_t>()(id.index));
+        return h1 ^ (h2 << 1);
+    }
+};
+
+/**
+ * A DrawLayer is a named part of a scene that is drawn by its own DrawFunction.
+ *
+ * Visualizers that retain their scene between frames (see
+ * DrawFunctionVisualizer::draw) only redraw a layer when its content key changes, and
+ * move the items already drawn for the layer in place when only its transform changes.
+ * Producers should therefore put parts of the scene that rarely change (ie. the field)
+ * or that change independently of each other (ie. each robot) on their own layers, and
+ * draw things that move around (ie. robots) once around the origin and place them with
+ * the transform of their layer.
+ */
+struct DrawLayer
+{
+    // Identifies the layer between frames
+    DrawLayerId id;
+    // Identifies the contents of the layer. A layer is redrawn whenever its content
+    // key is different from the last time it was drawn.
+    std::size_t content_key;
+    // The function that draws the contents of the layer
+    DrawFunction draw_function;
+    // Places the contents of the layer in the scene
+    QTransform transform = QTransform();
+};
+
+/**
+ * Creates a content key for a DrawLayer by combining the hashes of the given values.
+ * Every value that affects what the layer draws should be given.
+ *
+ * @param values The values to create a content key from. There must be a
+ * specialization of std::hash for each of their types.
+ *
+ * @return a content key for the given values
+ */
+template <typename... Values>
+std::size_t createDrawLayerContentKey(const Values&... values)
+{
+    std::size_t content_key = 0;
+    // This combines hashes the same way as boost::hash_combine
+    ((content_key ^=
+      std::hash<Values>()(values) + 0x9e3779b9 + (content_key << 6) + (content_key >> 2)),
+     ...);
+    return content_key;
+}
+
 /**
  * This class is used to represent a "draw function", which is a function
  * provided to various GUI components that tells them how to draw things.
@@ -32,38 +110,98 @@ class DrawFunctionWrapper
 {
    public:
     /**
-     * Creates a DrawFunctionWrapper
+     * Creates a DrawFunctionWrapper that draws everything on a single layer. Every
+     * DrawFunctionWrapper created this way is given a new content key, so its layer is
+     * redrawn whenever the wrapper is replaced by a new one.
      *
      * @pre draw_function must be callable (ie. operator bool(draw_function) == true)
      *
      * @param draw_function The function to use for drawing
+     * @param layer_id The id of the layer to draw on
      */
     inline explicit DrawFunctionWrapper(
-        const std::function<void(QGraphicsScene* scene)>& draw_function)
+        const std::function<void(QGraphicsScene* scene)>& draw_function,
+        const DrawLayerId& layer_id)
+        : DrawFunctionWrapper(std::vector<DrawLayer>{
+              DrawLayer{layer_id, next_unique_content_key++, draw_function}})
+    {
+    }
+
+    /**
+     * Creates a DrawFunctionWrapper that draws the given layers, in order
+     *
+     * @pre the draw_function of every layer must be callable
+     *
+     * @param draw_layers The layers to draw
+     */
+    inline explicit DrawFunctionWrapper(const std::vector<DrawLayer>& draw_layers)
+        : draw_layers_(draw_layers)
     {
-        if (!draw_function)
+        for (const DrawLayer& draw_layer : draw_layers_)
         {
-            throw std::invalid_argument(
-                "Created a DrawFunctionWrapper with a non-callable function");
+            if (!draw_layer.draw_function)
+            {
+                throw std::invalid_argument(
+                    "Created a DrawFunctionWrapper with a non-callable function");
+            }
         }
-
-        draw_function_ = draw_function;
     }
     DrawFunctionWrapper()          = delete;
     virtual ~DrawFunctionWrapper() = 0;
 
     /**
-     * Returns the internal draw_function
+     * Returns a function that draws all the layers of this DrawFunctionWrapper, in
+     * order
      *
-     * @return the internal draw_function
+     * @return a function that draws all the layers of this DrawFunctionWrapper
      */
     inline std::function<void(QGraphicsScene* scene)> getDrawFunction()
     {
-        return draw_function_;
+        return [draw_layers = draw_layers_](QGraphicsScene* scene) {
+            for (const DrawLayer& draw_layer : draw_layers)
+            {
+                if (draw_layer.transform.isIdentity())
+                {
+                    draw_layer.draw_function(scene);
+                    continue;
+                }
+
+                // Draw the layer on its own scene first, and then move its items into a
+                // group with the transform of the layer
+                QGraphicsScene layer_scene;
+                draw_layer.draw_function(&layer_scene);
+                QGraphicsItemGroup* layer_items = new QGraphicsItemGroup();
+                layer_items->setTransform(draw_layer.transform);
+                for (QGraphicsItem* item : layer_scene.items(Qt::AscendingOrder))
+                {
+                    if (!item->parentItem())
+                    {
+                        layer_scene.removeItem(item);
+                        item->setParentItem(layer_items);
+                    }
+                }
+                scene->addItem(layer_items);
+            }
+        };
+    }
+
+    /**
+     * Returns the layers drawn by this DrawFunctionWrapper, in order
+     *
+     * @return the layers drawn by this DrawFunctionWrapper
+     */
+    inline const std::vector<DrawLayer>& getDrawLayers() const
+    {
+        return draw_layers_;
     }
 
    private:
-    DrawFunction draw_function_;
+    std::vector<DrawLayer> draw_layers_;
+
+    // Content keys for layers that should be redrawn every time they are replaced.
+    // This is shared between threads since DrawFunctions are created by the AI and
+    // the World producers.
+    static inline std::atomic<std::size_t> next_unique_content_key{0};
 };
 
 inline DrawFunctionWrapper::~DrawFunctionWrapper() = default;
@@ -91,7 +229,12 @@ class AIDrawFunction : public DrawFunctionWrapper
    public:
     inline explicit AIDrawFunction(
         const std::function<void(QGraphicsScene* scene)>& draw_function)
-        : DrawFunctionWrapper(draw_function)
+        : DrawFunctionWrapper(draw_function, DrawLayerId{"ai"})
+    {
+    }
+
+    inline explicit AIDrawFunction(const std::vector<DrawLayer>& draw_layers)
+        : DrawFunctionWrapper(draw_layers)
     {
     }
 };
@@ -106,7 +249,12 @@ class WorldDrawFunction : public DrawFunctionWrapper
    public:
     inline explicit WorldDrawFunction(
         const std::function<void(QGraphicsScene* scene)>& draw_function)
-        : DrawFunctionWrapper(draw_function)
+        : DrawFunctionWrapper(draw_function, DrawLayerId{"world"})
+    {
+    }
+
+    inline explicit WorldDrawFunction(const std::vector<DrawLayer>& draw_layers)
+        : DrawFunctionWrapper(draw_layers)
     {
     }
 };
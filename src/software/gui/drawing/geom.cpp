@@ -1,5 +1,7 @@
 #include "software/gui/drawing/geom.h"
 
+#include "software/math/math_functions.h"
+
 void drawRectangle(QGraphicsScene* scene, const Rectangle& rectangle, const QPen& pen,
                    const std::optional<QBrush>& brush_opt)
 {
@@ -52,3 +54,60 @@ void drawSegment(QGraphicsScene* scene, const Segment& segment, const QPen& pen)
     QLineF line = createQLineF(segment);
     scene->addLine(line, pen);
 }
+
+DrawLayer createSegmentDrawLayer(const DrawLayerId& layer_id, const Segment& segment,
+                                 const QPen& pen)
+{
+    return DrawLayer{layer_id,
+                     createDrawLayerContentKey(pen.color().rgba(), pen.width(),
+                                               static_cast<int>(pen.capStyle())),
+                     [pen](QGraphicsScene* scene) {
+                         drawSegment(scene, Segment(Point(0, 0), Point(1, 0)), pen);
+                     },
+                     createQTransform(segment)};
+}
+
+DrawLayer createVelocityDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                  const Vector& velocity, double max_speed,
+                                  double max_line_length, int line_width,
+                                  const QColor& slow_colour, const QColor& fast_colour)
+{
+    // The number of colours between slow_colour and fast_colour that the end of the
+    // line can have
+    static constexpr int NUM_END_COLOURS = 16;
+
+    double line_length = normalizeValueToRange<double>(velocity.length(), 0, max_speed,
+                                                       0.0, max_line_length);
+    int end_colour_index =
+        static_cast<int>(std::round(line_length / max_line_length * NUM_END_COLOURS));
+    double end_colour_fraction = static_cast<double>(end_colour_index) / NUM_END_COLOURS;
+    QColor end_colour          = QColor::fromRgbF(
+        slow_colour.redF() +
+            (fast_colour.redF() - slow_colour.redF()) * end_colour_fraction,
+        slow_colour.greenF() +
+            (fast_colour.greenF() - slow_colour.greenF()) * end_colour_fraction,
+        slow_colour.blueF() +
+            (fast_colour.blueF() - slow_colour.blueF()) * end_colour_fraction,
+        slow_colour.alphaF() +
+            (fast_colour.alphaF() - slow_colour.alphaF()) * end_colour_fraction);
+
+    return DrawLayer{
+        layer_id,
+        createDrawLayerContentKey(end_colour.rgba(), slow_colour.rgba(), line_width),
+        [slow_colour, end_colour, line_width](QGraphicsScene* scene) {
+            QGradient gradient = QLinearGradient(QPointF(0, 0), QPointF(1, 0));
+            gradient.setColorAt(0, slow_colour);
+            gradient.setColorAt(1, end_colour);
+
+            auto pen = QPen(gradient, 1);
+            pen.setWidth(line_width);
+            // The cap style must be NOT be set to SquareCap. It can be set to anything
+            // else. Drawing a line of length 0 with the SquareCap style causes a large
+            // line to be drawn
+            pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+            pen.setCosmetic(true);
+
+            drawSegment(scene, Segment(Point(0, 0), Point(1, 0)), pen);
+        },
+        createQTransform(Segment(position, position + velocity.normalize(line_length)))};
+}
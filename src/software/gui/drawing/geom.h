@@ -10,6 +10,7 @@
 #include "software/geom/polygon.h"
 #include "software/geom/rectangle.h"
 #include "software/geom/segment.h"
+#include "software/gui/drawing/draw_functions.h"
 #include "software/gui/geometry_conversion.h"
 
 /**
@@ -53,3 +54,44 @@ void drawCircle(QGraphicsScene* scene, const Circle& circle, const QPen& pen,
  * @param pen The QPen to draw the Segment
  */
 void drawSegment(QGraphicsScene* scene, const Segment& segment, const QPen& pen);
+
+/**
+ * Creates a layer that draws the given Segment. The segment is drawn along the x axis
+ * and placed with the transform of the layer, so the layer is not redrawn when the
+ * segment moves.
+ *
+ * @param layer_id The id of the layer
+ * @param segment The Segment to draw
+ * @param pen The QPen to draw the Segment. This must be cosmetic, so that its width is
+ * not changed by the transform of the layer.
+ *
+ * @return the layer that draws the given Segment
+ */
+DrawLayer createSegmentDrawLayer(const DrawLayerId& layer_id, const Segment& segment,
+                                 const QPen& pen);
+
+/**
+ * Creates a layer that draws a velocity as a line starting at the given position. The
+ * line is max_line_length long at max_speed, and its colour changes from slow_colour at
+ * the given position to fast_colour at the end of a line for max_speed, so the colour at
+ * the end of the line shows the speed.
+ *
+ * The line is drawn along the x axis and placed with the transform of the layer, and
+ * the colour at its end only takes a few different values, so the layer is only redrawn
+ * when the speed changes by a large amount.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position the line starts at
+ * @param velocity The velocity to draw
+ * @param max_speed The speed at which the line is longest
+ * @param max_line_length The length of the line at max_speed
+ * @param line_width The width of the line, in pixels
+ * @param slow_colour The colour of the line at the given position
+ * @param fast_colour The colour of the end of the line at max_speed
+ *
+ * @return the layer that draws the given velocity
+ */
+DrawLayer createVelocityDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                  const Vector& velocity, double max_speed,
+                                  double max_line_length, int line_width,
+                                  const QColor& slow_colour, const QColor& fast_colour);
@@ -1,49 +1,101 @@
 #include "software/gui/drawing/navigator.h"
 
+#include <unordered_set>
+
+/**
+ * Creates the pen used to draw the paths planned by the navigator
+ *
+ * @return the pen used to draw planned paths
+ */
+static QPen createPathPen()
+{
+    QPen path_pen(navigator_path_color);
+    // The cap style must be NOT be set to SquareCap. It can be set to anything else.
+    // Drawing a line of length 0 with the SquareCap style causes a large line to be
+    // drawn
+    path_pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+    path_pen.setWidth(2);
+    path_pen.setCosmetic(true);
+    path_pen.setStyle(Qt::DashLine);
+    // Create a set a custom dash pattern. We do this because the default
+    // patterns don't have enough space between the dashes so aren't easily
+    // distinguishable as dashed lines.
+    QVector<qreal> dashes;
+    qreal space = 7;
+    dashes << 2 << space << 2 << space;
+    path_pen.setDashPattern(dashes);
+    return path_pen;
+}
+
+/**
+ * Creates the pen used to draw the obstacles used by the navigator
+ *
+ * @return the pen used to draw obstacles
+ */
+static QPen createObstaclePen()
+{
+    QPen obstacle_pen(navigator_obstacle_color);
+    // The cap style must be NOT be set to SquareCap. It can be set to anything else.
+    // Drawing a line of length 0 with the SquareCap style causes a large line to be
+    // drawn
+    obstacle_pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+    obstacle_pen.setWidth(2);
+    obstacle_pen.setCosmetic(true);
+    return obstacle_pen;
+}
+
 AIDrawFunction drawNavigator(std::shared_ptr<Navigator> navigator)
 {
     auto planned_paths = navigator->getPlannedPathPoints();
     auto obstacles     = navigator->getObstacles();
-    auto draw_function = [planned_paths, obstacles](QGraphicsScene* scene) {
-        QPen path_pen(navigator_path_color);
-        // The cap style must be NOT be set to SquareCap. It can be set to anything else.
-        // Drawing a line of length 0 with the SquareCap style causes a large line to be
-        // drawn
-        path_pen.setCapStyle(Qt::PenCapStyle::RoundCap);
-        path_pen.setWidth(2);
-        path_pen.setCosmetic(true);
-        path_pen.setStyle(Qt::DashLine);
-        // Create a set a custom dash pattern. We do this because the default
-        // patterns don't have enough space between the dashes so aren't easily
-        // distinguishable as dashed lines.
-        QVector<qreal> dashes;
-        qreal space = 7;
-        dashes << 2 << space << 2 << space;
-        path_pen.setDashPattern(dashes);
-
-        for (const auto& path : planned_paths)
+
+    std::size_t paths_content_key = 0;
+    for (const auto& path : planned_paths)
+    {
+        for (const Point& point : path)
         {
-            for (size_t i = 1; i < path.size(); i++)
-            {
-                Segment path_segment(path[i - 1], path[i]);
-                drawSegment(scene, path_segment, path_pen);
-            }
+            paths_content_key = createDrawLayerContentKey(paths_content_key, point);
         }
+        // Separate the paths so that moving a point from the end of one path to the
+        // start of the next changes the key
+        paths_content_key = createDrawLayerContentKey(paths_content_key, path.size());
+    }
 
-        QPen obstacle_pen(navigator_obstacle_color);
-        // The cap style must be NOT be set to SquareCap. It can be set to anything else.
-        // Drawing a line of length 0 with the SquareCap style causes a large line to be
-        // drawn
-        obstacle_pen.setCapStyle(Qt::PenCapStyle::RoundCap);
-        obstacle_pen.setWidth(2);
-        obstacle_pen.setCosmetic(true);
+    std::vector<DrawLayer> draw_layers;
+    draw_layers.emplace_back(
+        DrawLayer{DrawLayerId{"ai/navigator/paths"}, paths_content_key,
+                  [planned_paths](QGraphicsScene* scene) {
+                      QPen path_pen = createPathPen();
+                      for (const auto& path : planned_paths)
+                      {
+                          for (size_t i = 1; i < path.size(); i++)
+                          {
+                              Segment path_segment(path[i - 1], path[i]);
+                              drawSegment(scene, path_segment, path_pen);
+                          }
+                      }
+                  }});
 
-        ObstacleArtist obstacle_artist(scene, obstacle_pen);
-        for (const auto& obstacle : obstacles)
+    // Obstacles are mostly static (ie. the defense areas) or move with a single
+    // robot, so each one gets its own layer. Layers are identified by the shape of
+    // their obstacle rather than its position in the list, so that an obstacle keeps
+    // its layer when obstacles before it are added or removed.
+    std::unordered_set<std::size_t> obstacle_hashes;
+    for (const auto& obstacle : obstacles)
+    {
+        std::size_t obstacle_hash = obstacle->hash();
+        if (!obstacle_hashes.insert(obstacle_hash).second)
         {
-            obstacle->accept(obstacle_artist);
+            // The same obstacle only needs to be drawn once
+            continue;
         }
-    };
+        draw_layers.emplace_back(
+            DrawLayer{DrawLayerId{"ai/navigator/obstacle", obstacle_hash}, obstacle_hash,
+                      [obstacle](QGraphicsScene* scene) {
+                          ObstacleArtist obstacle_artist(scene, createObstaclePen());
+                          obstacle->accept(obstacle_artist);
+                      }});
+    }
 
-    return AIDrawFunction(draw_function);
+    return AIDrawFunction(draw_layers);
 }
@@ -0,0 +1,52 @@
+#include "software/gui/drawing/navigator_draw_commands.h"
+
+#include "software/gui/drawing/argb_colors.h"
+
+static constexpr DrawStyle NAVIGATOR_PATH_STYLE = {
+    .outline_colour = NAVIGATOR_PATH_ARGB,
+    .outline_width  = 2.0f,
+    .fill_colour    = 0,
+    .dashed         = true,
+};
+static constexpr DrawStyle NAVIGATOR_OBSTACLE_STYLE = {
+    .outline_colour = NAVIGATOR_OBSTACLE_ARGB,
+    .outline_width  = 2.0f,
+    .fill_colour    = 0,
+    .dashed         = false,
+};
+
+ObstacleDrawCommandWriter::ObstacleDrawCommandWriter(
+    DrawCommandBuffer& draw_command_buffer, const DrawStyle& style)
+    : draw_command_buffer_(draw_command_buffer), style_(style)
+{
+}
+
+void ObstacleDrawCommandWriter::visit(const GeomObstacle<Circle>& geom_obstacle)
+{
+    draw_command_buffer_.addCircle(geom_obstacle.getGeom(), style_);
+}
+
+void ObstacleDrawCommandWriter::visit(const GeomObstacle<Polygon>& geom_obstacle)
+{
+    draw_command_buffer_.addPolygon(geom_obstacle.getGeom(), style_);
+}
+
+void writeNavigatorDrawCommands(Navigator& navigator,
+                                DrawCommandBuffer& draw_command_buffer)
+{
+    for (const auto& path : navigator.getPlannedPathPoints())
+    {
+        for (size_t i = 1; i < path.size(); i++)
+        {
+            draw_command_buffer.addLine(Segment(path[i - 1], path[i]),
+                                        NAVIGATOR_PATH_STYLE);
+        }
+    }
+
+    ObstacleDrawCommandWriter obstacle_writer(draw_command_buffer,
+                                              NAVIGATOR_OBSTACLE_STYLE);
+    for (const auto& obstacle : navigator.getObstacles())
+    {
+        obstacle->accept(obstacle_writer);
+    }
+}
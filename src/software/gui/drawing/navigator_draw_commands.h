@@ -0,0 +1,46 @@
+#pragma once
+
+#include "software/ai/navigator/navigator.h"
+#include "software/ai/navigator/obstacle/obstacle.h"
+#include "software/ai/navigator/obstacle/obstacle_visitor.h"
+#include "software/gui/drawing/draw_command_buffer.h"
+
+/**
+ * The ObstacleDrawCommandWriter adds the commands to draw Obstacles to a
+ * DrawCommandBuffer
+ */
+class ObstacleDrawCommandWriter : public ObstacleVisitor
+{
+   public:
+    /**
+     * Create an ObstacleDrawCommandWriter that adds commands to the given buffer
+     *
+     * @param draw_command_buffer The buffer to add commands to
+     * @param style How to draw the obstacles
+     */
+    explicit ObstacleDrawCommandWriter(DrawCommandBuffer& draw_command_buffer,
+                                       const DrawStyle& style);
+
+    /**
+     * Adds the commands to draw the given Obstacle
+     *
+     * @param The Obstacle to draw
+     */
+    void visit(const GeomObstacle<Circle>& geom_obstacle) override;
+    void visit(const GeomObstacle<Polygon>& geom_obstacle) override;
+
+   private:
+    DrawCommandBuffer& draw_command_buffer_;
+    DrawStyle style_;
+};
+
+/**
+ * Adds the commands to draw the paths and obstacles of the given navigator to the
+ * given buffer. This does not depend on Qt, so it can be used by the AI without
+ * drawing anything itself.
+ *
+ * @param navigator The Navigator to draw
+ * @param draw_command_buffer The buffer to add the commands to
+ */
+void writeNavigatorDrawCommands(Navigator& navigator,
+                                DrawCommandBuffer& draw_command_buffer);
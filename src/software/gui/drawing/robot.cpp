@@ -10,21 +10,22 @@
 #include "software/gui/geometry_conversion.h"
 #include "software/math/math_functions.h"
 
+// A somewhat arbitrary value that we've determined looks nice in the GUI
+static const double MAX_VELOCITY_LINE_LENGTH = 0.5;
+static const int VELOCITY_LINE_WIDTH         = 4;
+
 void drawRobotVelocity(QGraphicsScene* scene, const Point& position,
                        const Vector& velocity, const QColor& slow_colour,
                        const QColor& fast_colour)
 {
-    // A somewhat arbitrary value that we've determined looks nice in the GUI
-    const double max_velocity_line_length = 0.5;
-
     QGradient gradient = QLinearGradient(
         createQPointF(position),
-        createQPointF(position + velocity.normalize(max_velocity_line_length)));
+        createQPointF(position + velocity.normalize(MAX_VELOCITY_LINE_LENGTH)));
     gradient.setColorAt(0, slow_colour);
     gradient.setColorAt(1, fast_colour);
 
     auto pen = QPen(gradient, 1);
-    pen.setWidth(4);
+    pen.setWidth(VELOCITY_LINE_WIDTH);
     // The cap style must be NOT be set to SquareCap. It can be set to anything else.
     // Drawing a line of length 0 with the SquareCap style causes a large line to be drawn
     pen.setCapStyle(Qt::PenCapStyle::RoundCap);
@@ -32,7 +33,7 @@ void drawRobotVelocity(QGraphicsScene* scene, const Point& position,
 
     double speed     = velocity.length();
     auto line_length = normalizeValueToRange<double>(
-        speed, 0, ROBOT_MAX_SPEED_METERS_PER_SECOND, 0.0, max_velocity_line_length);
+        speed, 0, ROBOT_MAX_SPEED_METERS_PER_SECOND, 0.0, MAX_VELOCITY_LINE_LENGTH);
 
     drawSegment(scene, Segment(position, position + velocity.normalize(line_length)),
                 pen);
@@ -148,3 +149,31 @@ void drawRobot(QGraphicsScene* scene, const RobotDetection& robot, const QColor&
     drawRobotAtPosition(scene, robot.position, robot.orientation, color);
     drawRobotId(scene, robot.position, robot.id);
 }
+
+DrawLayer createRobotVelocityDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                       const Vector& velocity, const QColor& slow_colour,
+                                       const QColor& fast_colour)
+{
+    return createVelocityDrawLayer(
+        layer_id, position, velocity, ROBOT_MAX_SPEED_METERS_PER_SECOND,
+        MAX_VELOCITY_LINE_LENGTH, VELOCITY_LINE_WIDTH, slow_colour, fast_colour);
+}
+
+DrawLayer createRobotAtPositionDrawLayer(const DrawLayerId& layer_id,
+                                         const Point& position, const Angle& orientation,
+                                         const QColor& color)
+{
+    return DrawLayer{layer_id, createDrawLayerContentKey(color.rgba()),
+                     [color](QGraphicsScene* scene) {
+                         drawRobotAtPosition(scene, Point(0, 0), Angle::zero(), color);
+                     },
+                     createQTransform(position, orientation)};
+}
+
+DrawLayer createRobotIdDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                 const RobotId id)
+{
+    return DrawLayer{layer_id, createDrawLayerContentKey(id),
+                     [id](QGraphicsScene* scene) { drawRobotId(scene, Point(0, 0), id); },
+                     createQTransform(position)};
+}
@@ -3,6 +3,7 @@
 #include <QtWidgets/QGraphicsScene>
 
 #include "software/gui/drawing/colors.h"
+#include "software/gui/drawing/draw_functions.h"
 #include "software/sensor_fusion/filter/vision_detection.h"
 #include "software/world/robot_state.h"
 
@@ -61,3 +62,47 @@ void drawRobot(QGraphicsScene* scene, const RobotStateWithId& robot, const QColo
  * @param color The color to draw the robot
  */
 void drawRobot(QGraphicsScene* scene, const RobotDetection& robot, const QColor& color);
+
+/**
+ * Creates a layer that draws the robot velocity. The layer is only redrawn when the
+ * speed of the robot changes by a large amount.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position of the robot
+ * @param velocity The velocity of the robot
+ * @param slow_colour The velocity line colour when the speed is slow
+ * @param fast_colour The velocity line colour when the speed is fast
+ *
+ * @return the layer that draws the robot velocity
+ */
+DrawLayer createRobotVelocityDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                       const Vector& velocity, const QColor& slow_colour,
+                                       const QColor& fast_colour);
+
+/**
+ * Creates a layer that draws the robot at the given position. The layer is only redrawn
+ * when the colour changes.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position of the robot
+ * @param orientation The orientation of the robot
+ * @param color The color to draw the robot
+ *
+ * @return the layer that draws the robot
+ */
+DrawLayer createRobotAtPositionDrawLayer(const DrawLayerId& layer_id,
+                                         const Point& position, const Angle& orientation,
+                                         const QColor& color);
+
+/**
+ * Creates a layer that draws the robot's ID. The layer is only redrawn when the ID
+ * changes.
+ *
+ * @param layer_id The id of the layer
+ * @param position The position of the robot
+ * @param id The id of the robot
+ *
+ * @return the layer that draws the robot's ID
+ */
+DrawLayer createRobotIdDrawLayer(const DrawLayerId& layer_id, const Point& position,
+                                 RobotId id);
@@ -4,31 +4,112 @@
 
 #include "software/gui/drawing/ball.h"
 #include "software/gui/drawing/field.h"
+#include "software/gui/drawing/robot.h"
 #include "software/gui/drawing/team.h"
 
-void drawWorld(QGraphicsScene* scene, const World& world, TeamColour friendly_team_colour)
+/**
+ * Returns the colours to draw the friendly and enemy teams with
+ *
+ * @param friendly_team_colour The colour of the friendly team
+ *
+ * @return the colours of the friendly team and the enemy team, in that order
+ */
+static std::pair<QColor, QColor> getTeamColours(TeamColour friendly_team_colour)
 {
-    QColor friendly_team_colour_;
-    QColor enemy_team_colour_;
     switch (friendly_team_colour)
     {
         case TeamColour::YELLOW:
-            friendly_team_colour_ = yellow_robot_color;
-            enemy_team_colour_    = blue_robot_color;
-            break;
+            return {yellow_robot_color, blue_robot_color};
         case TeamColour::BLUE:
-            friendly_team_colour_ = blue_robot_color;
-            enemy_team_colour_    = yellow_robot_color;
-            break;
+            return {blue_robot_color, yellow_robot_color};
     }
-    QColor friendly_goal_colour = friendly_team_colour_;
+    return {};
+}
+
+/**
+ * Draws the field, and the goals highlighted by team, on the given scene
+ *
+ * @param scene The scene to draw on
+ * @param field The field to draw
+ * @param friendly_team_colour The colour of the friendly team
+ */
+static void drawFieldWithGoals(QGraphicsScene* scene, const Field& field,
+                               TeamColour friendly_team_colour)
+{
+    auto [friendly_goal_colour, enemy_goal_colour] = getTeamColours(friendly_team_colour);
     friendly_goal_colour.setAlpha(100);
-    QColor enemy_goal_colour = enemy_team_colour_;
     enemy_goal_colour.setAlpha(100);
 
-    drawField(scene, world.field());
-    drawTeamGoalText(scene, world.field());
-    highlightGoalsByTeam(scene, world.field(), friendly_goal_colour, enemy_goal_colour);
+    drawField(scene, field);
+    drawTeamGoalText(scene, field);
+    highlightGoalsByTeam(scene, field, friendly_goal_colour, enemy_goal_colour);
+}
+
+/**
+ * Creates a content key for everything about the given field that affects how it is
+ * drawn
+ *
+ * @param field The field
+ *
+ * @return a content key for the given field
+ */
+static std::size_t createFieldContentKey(const Field& field)
+{
+    return createDrawLayerContentKey(
+        field.xLength(), field.yLength(), field.goalXLength(), field.goalYLength(),
+        field.defenseAreaXLength(), field.defenseAreaYLength(),
+        field.centerCircleRadius(), field.boundaryMargin());
+}
+
+/**
+ * The names of the layers that draw the robots of a team
+ */
+struct TeamDrawLayerNames
+{
+    std::string_view robot;
+    std::string_view robot_id;
+    std::string_view robot_velocity;
+};
+
+static const TeamDrawLayerNames FRIENDLY_TEAM_DRAW_LAYER_NAMES = {
+    "world/friendly_robot", "world/friendly_robot_id", "world/friendly_robot_velocity"};
+static const TeamDrawLayerNames ENEMY_TEAM_DRAW_LAYER_NAMES = {
+    "world/enemy_robot", "world/enemy_robot_id", "world/enemy_robot_velocity"};
+
+/**
+ * Creates the layers for each robot on the given team. Each robot is drawn once and
+ * moved with the transform of its layers, so robots are only redrawn when their speed
+ * changes by a large amount.
+ *
+ * @param team The team to create layers for
+ * @param layer_names The names of the layers. The id of the robot is the index of each
+ * layer.
+ * @param colour The colour to draw the robots
+ * @param draw_layers [out] The layers are appended to this
+ */
+static void appendTeamDrawLayers(const Team& team, const TeamDrawLayerNames& layer_names,
+                                 const QColor& colour,
+                                 std::vector<DrawLayer>& draw_layers)
+{
+    for (const Robot& robot : team.getAllRobots())
+    {
+        draw_layers.emplace_back(createRobotAtPositionDrawLayer(
+            DrawLayerId{layer_names.robot, robot.id()}, robot.position(),
+            robot.orientation(), colour));
+        draw_layers.emplace_back(createRobotVelocityDrawLayer(
+            DrawLayerId{layer_names.robot_velocity, robot.id()}, robot.position(),
+            robot.velocity(), robot_speed_slow_color, colour));
+        draw_layers.emplace_back(createRobotIdDrawLayer(
+            DrawLayerId{layer_names.robot_id, robot.id()}, robot.position(), robot.id()));
+    }
+}
+
+void drawWorld(QGraphicsScene* scene, const World& world, TeamColour friendly_team_colour)
+{
+    auto [friendly_team_colour_, enemy_team_colour_] =
+        getTeamColours(friendly_team_colour);
+
+    drawFieldWithGoals(scene, world.field(), friendly_team_colour);
     drawTeam(scene, world.friendlyTeam(), friendly_team_colour_);
     drawTeam(scene, world.enemyTeam(), enemy_team_colour_);
     drawBall(scene, world.ball().currentState());
@@ -38,8 +119,34 @@ void drawWorld(QGraphicsScene* scene, const World& world, TeamColour friendly_te
 WorldDrawFunction getDrawWorldFunction(const World& world,
                                        TeamColour friendly_team_colour)
 {
-    auto draw_function = [world, friendly_team_colour](QGraphicsScene* scene) {
-        drawWorld(scene, world, friendly_team_colour);
-    };
-    return WorldDrawFunction(draw_function);
+    auto [friendly_team_colour_, enemy_team_colour_] =
+        getTeamColours(friendly_team_colour);
+    const Field field = world.field();
+    const Ball ball   = world.ball();
+
+    std::vector<DrawLayer> draw_layers;
+    draw_layers.emplace_back(
+        DrawLayer{DrawLayerId{"world/field"},
+                  createDrawLayerContentKey(createFieldContentKey(field),
+                                            static_cast<int>(friendly_team_colour)),
+                  [field, friendly_team_colour](QGraphicsScene* scene) {
+                      drawFieldWithGoals(scene, field, friendly_team_colour);
+                  }});
+    appendTeamDrawLayers(world.friendlyTeam(), FRIENDLY_TEAM_DRAW_LAYER_NAMES,
+                         friendly_team_colour_, draw_layers);
+    appendTeamDrawLayers(world.enemyTeam(), ENEMY_TEAM_DRAW_LAYER_NAMES,
+                         enemy_team_colour_, draw_layers);
+    draw_layers.emplace_back(createBallPositionDrawLayer(
+        DrawLayerId{"world/ball"}, ball.position(),
+        ball.currentState().distanceFromGround(), ball_color));
+    draw_layers.emplace_back(createBallVelocityDrawLayer(
+        DrawLayerId{"world/ball_velocity"}, ball.position(), ball.velocity(),
+        ball_speed_slow_color, ball_speed_fast_color));
+    for (DrawLayer& ball_cone_layer :
+         createBallConeToFriendlyNetDrawLayers("world/ball_cone", ball.position(), field))
+    {
+        draw_layers.emplace_back(std::move(ball_cone_layer));
+    }
+
+    return WorldDrawFunction(draw_layers);
 }
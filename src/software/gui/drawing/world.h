@@ -25,6 +25,9 @@ void drawWorld(QGraphicsScene* scene, const World& world,
  * Returns a function that represents how to draw the provided world. Consumers
  * may call this returned function to draw the provided world onto a QGraphicsScene.
  *
+ * The field, each robot and the ball are drawn on separate layers, so a visualizer
+ * that retains its scene only redraws the robots that moved and the ball.
+ *
  * @param world The world to create a DrawFunctionWrapper for
  * @param friendly_team_colour The colour of the friendly team
  *
@@ -4,12 +4,15 @@
 #include <QtWidgets/QApplication>
 
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/gui/drawing/draw_commands.h"
 #include "software/gui/drawing/world.h"
+#include "software/logger/logger.h"
+#include "software/proto/message_translation/draw_commands.h"
 
 ThreadedFullSystemGUI::ThreadedFullSystemGUI(
     std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config)
     : FirstInFirstOutThreadedObserver<World>(),
-      FirstInFirstOutThreadedObserver<AIDrawFunction>(),
+      FirstInFirstOutThreadedObserver<std::shared_ptr<const DrawCommandsProto>>(),
       FirstInFirstOutThreadedObserver<PlayInfo>(),
       FirstInFirstOutThreadedObserver<SensorProto>(),
       termination_promise_ptr(std::make_shared<std::promise<void>>()),
@@ -27,8 +30,13 @@ ThreadedFullSystemGUI::ThreadedFullSystemGUI(
           std::make_shared<ThreadSafeBuffer<double>>(DATA_PER_SECOND_BUFFER_SIZE, false)),
       primitives_sent_per_second_buffer(
           std::make_shared<ThreadSafeBuffer<double>>(DATA_PER_SECOND_BUFFER_SIZE, false)),
+      latency_statistics_buffer(
+          std::make_shared<ThreadSafeBuffer<std::vector<LatencyStatistics>>>(
+              LATENCY_STATISTICS_BUFFER_SIZE, false)),
       application_shutting_down(false),
       remaining_attempts_to_set_view_area(NUM_ATTEMPTS_TO_SET_INITIAL_VIEW_AREA),
+      latency_tracker(),
+      num_latency_traces_in_window(0),
       mutable_thunderbots_config(mutable_thunderbots_config)
 {
     run_full_system_gui_thread =
@@ -66,7 +74,8 @@ void ThreadedFullSystemGUI::createAndRunFullSystemGUI()
     FullSystemGUI* full_system_gui = new FullSystemGUI(
         world_draw_functions_buffer, ai_draw_functions_buffer, play_info_buffer,
         sensor_msg_buffer, view_area_buffer, worlds_received_per_second_buffer,
-        primitives_sent_per_second_buffer, mutable_thunderbots_config);
+        primitives_sent_per_second_buffer, latency_statistics_buffer,
+        mutable_thunderbots_config);
     full_system_gui->show();
 
     // Run the QApplication and all windows / widgets. This function will block
@@ -103,9 +112,18 @@ void ThreadedFullSystemGUI::onValueReceived(World world)
         FirstInFirstOutThreadedObserver<World>::getDataReceivedPerSecond());
 }
 
-void ThreadedFullSystemGUI::onValueReceived(AIDrawFunction draw_function)
+void ThreadedFullSystemGUI::onValueReceived(
+    std::shared_ptr<const DrawCommandsProto> draw_commands)
 {
-    ai_draw_functions_buffer->push(draw_function);
+    if (auto draw_command_buffer = createDrawCommandBuffer(*draw_commands))
+    {
+        ai_draw_functions_buffer->push(
+            getDrawCommandsFunction(draw_command_buffer.value(), DrawLayerId{"ai"}));
+    }
+    else
+    {
+        LOG(WARNING) << "Received malformed DrawCommandsProto";
+    }
 }
 
 void ThreadedFullSystemGUI::onValueReceived(PlayInfo play_info)
@@ -125,6 +143,18 @@ void ThreadedFullSystemGUI::onValueReceived(TbotsProto::PrimitiveSet primitive_m
             TbotsProto::PrimitiveSet>::getDataReceivedPerSecond());
 }
 
+void ThreadedFullSystemGUI::onValueReceived(TbotsProto::LatencyTrace latency_trace)
+{
+    if (num_latency_traces_in_window >= LATENCY_STATISTICS_WINDOW_SIZE)
+    {
+        latency_tracker.clear();
+        num_latency_traces_in_window = 0;
+    }
+    latency_tracker.addLatencyTrace(latency_trace);
+    num_latency_traces_in_window++;
+    latency_statistics_buffer->push(latency_tracker.getLatencyStatistics());
+}
+
 std::shared_ptr<std::promise<void>> ThreadedFullSystemGUI::getTerminationPromise()
 {
     return termination_promise_ptr;
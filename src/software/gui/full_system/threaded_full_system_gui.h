@@ -6,13 +6,16 @@
 #include <future>
 #include <thread>
 
+#include "shared/proto/latency_trace_msg.pb.h"
 #include "shared/proto/tbots_software_msgs.pb.h"
 #include "software/ai/hl/stp/play_info.h"
+#include "software/backend/latency_tracker.h"
 #include "software/geom/rectangle.h"
 #include "software/gui/drawing/draw_functions.h"
 #include "software/gui/full_system/widgets/full_system_gui.h"
 #include "software/multithreading/first_in_first_out_threaded_observer.h"
 #include "software/multithreading/thread_safe_buffer.h"
+#include "software/proto/draw_commands_msg.pb.h"
 #include "software/proto/sensor_msg.pb.h"
 #include "software/world/world.h"
 
@@ -22,10 +25,11 @@
  */
 class ThreadedFullSystemGUI
     : public FirstInFirstOutThreadedObserver<World>,
-      public FirstInFirstOutThreadedObserver<AIDrawFunction>,
+      public FirstInFirstOutThreadedObserver<std::shared_ptr<const DrawCommandsProto>>,
       public FirstInFirstOutThreadedObserver<PlayInfo>,
       public FirstInFirstOutThreadedObserver<SensorProto>,
-      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>
+      public FirstInFirstOutThreadedObserver<TbotsProto::PrimitiveSet>,
+      public FirstInFirstOutThreadedObserver<TbotsProto::LatencyTrace>
 {
    public:
     explicit ThreadedFullSystemGUI(
@@ -34,10 +38,11 @@ class ThreadedFullSystemGUI
     ~ThreadedFullSystemGUI() override;
 
     void onValueReceived(World world) override;
-    void onValueReceived(AIDrawFunction draw_function) override;
+    void onValueReceived(std::shared_ptr<const DrawCommandsProto> draw_commands) override;
     void onValueReceived(PlayInfo play_info) override;
     void onValueReceived(SensorProto sensor_msg) override;
     void onValueReceived(TbotsProto::PrimitiveSet primitive_msg) override;
+    void onValueReceived(TbotsProto::LatencyTrace latency_trace) override;
 
     /**
      * Returns a shared_ptr to a promise that can be waited on, and that will
@@ -70,6 +75,8 @@ class ThreadedFullSystemGUI
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer;
+    std::shared_ptr<ThreadSafeBuffer<std::vector<LatencyStatistics>>>
+        latency_statistics_buffer;
 
     // We want to show the most recent world and AI data, but also want things to look
     // smooth if the stream of data isn't perfectly consistent, so we use a very small
@@ -86,6 +93,12 @@ class ThreadedFullSystemGUI
     static constexpr std::size_t VIEW_AREA_BUFFER_SIZE = 1;
     // We only care about the most recent "data" per second values
     static constexpr std::size_t DATA_PER_SECOND_BUFFER_SIZE = 1;
+    // We only care about the most recent latency statistics
+    static constexpr std::size_t LATENCY_STATISTICS_BUFFER_SIZE = 1;
+    // The latency statistics are of at most this many of the most recent traces, so
+    // that they reflect the current state of the system. This is about 10 seconds of
+    // traces.
+    static constexpr unsigned int LATENCY_STATISTICS_WINDOW_SIZE = 600;
     // When the application starts up we want to set the initial view area
     // to show all the contents nicely. For some reason doing this only
     // once at the start of the program isn't enough, the GUI seems to need
@@ -99,6 +112,9 @@ class ThreadedFullSystemGUI
     std::atomic_bool application_shutting_down;
     int remaining_attempts_to_set_view_area;
 
+    LatencyTracker latency_tracker;
+    unsigned int num_latency_traces_in_window;
+
     // Top level mutable thunderbots config containing all configs
     std::shared_ptr<ThunderbotsConfig> mutable_thunderbots_config;
 };
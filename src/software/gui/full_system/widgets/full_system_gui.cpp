@@ -1,5 +1,7 @@
 #include "software/gui/full_system/widgets/full_system_gui.h"
 
+#include <QtWidgets/QHeaderView>
+
 #include "software/gui/full_system/widgets/ai_control.h"
 #include "software/gui/generic_widgets/robot_status/robot_status.h"
 
@@ -11,6 +13,8 @@ FullSystemGUI::FullSystemGUI(
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer,
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer,
     std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer,
+    std::shared_ptr<ThreadSafeBuffer<std::vector<LatencyStatistics>>>
+        latency_statistics_buffer,
     std::shared_ptr<ThunderbotsConfig> config)
     : QMainWindow(),
       main_widget(new Ui::AutogeneratedFullSystemMainWidget()),
@@ -23,6 +27,7 @@ FullSystemGUI::FullSystemGUI(
       view_area_buffer(view_area_buffer),
       worlds_received_per_second_buffer(worlds_received_per_second_buffer),
       primitives_sent_per_second_buffer(primitives_sent_per_second_buffer),
+      latency_statistics_buffer(latency_statistics_buffer),
       most_recent_world_draw_function([](QGraphicsScene*) { return; }),
       most_recent_ai_draw_function([](QGraphicsScene*) { return; })
 {
@@ -47,11 +52,14 @@ FullSystemGUI::FullSystemGUI(
     main_widget->dynamic_parameter_widget->setSizePolicy(QSizePolicy::Preferred,
                                                          QSizePolicy::Ignored);
     setupAIControls(main_widget, config);
+    setupLatencyTable();
 
     connect(update_timer, &QTimer::timeout, this, &FullSystemGUI::handleUpdate);
     // This is a separate timer as the update timer is too fast
     connect(data_per_second_timer, &QTimer::timeout, this,
             &FullSystemGUI::updateDataPerSecondLCD);
+    connect(data_per_second_timer, &QTimer::timeout, this,
+            &FullSystemGUI::updateLatencyTable);
     update_timer->start(static_cast<int>(
         Duration::fromSeconds(UPDATE_INTERVAL_SECONDS).toMilliseconds()));
     data_per_second_timer->start(static_cast<int>(
@@ -79,9 +87,12 @@ void FullSystemGUI::draw()
         most_recent_ai_draw_function = ai_draw_function.value();
     }
 
-    main_widget->ai_visualization_graphics_view->clearAndDraw(
-        {most_recent_world_draw_function.getDrawFunction(),
-         most_recent_ai_draw_function.getDrawFunction()});
+    // The AI layers are drawn after the world layers so they show on top
+    std::vector<DrawLayer> draw_layers = most_recent_world_draw_function.getDrawLayers();
+    const std::vector<DrawLayer>& ai_draw_layers =
+        most_recent_ai_draw_function.getDrawLayers();
+    draw_layers.insert(draw_layers.end(), ai_draw_layers.begin(), ai_draw_layers.end());
+    main_widget->ai_visualization_graphics_view->draw(draw_layers);
 }
 
 void FullSystemGUI::updatePlayInfo()
@@ -128,3 +139,42 @@ void FullSystemGUI::updateDataPerSecondLCD()
         main_widget->primitives_sent_lcd->display(primitives_sent_int);
     }
 }
+
+void FullSystemGUI::setupLatencyTable()
+{
+    QTableWidget* table = main_widget->latency_table_widget;
+    table->setColumnCount(5);
+    table->setHorizontalHeaderLabels(
+        {"Mean (ms)", "Median (ms)", "99th % (ms)", "Max (ms)", "Samples"});
+    table->setRowCount(static_cast<int>(sizeLatencyStage()));
+    QStringList stage_names;
+    for (const std::string& stage_name : allStringValuesLatencyStage())
+    {
+        stage_names.append(QString::fromStdString(stage_name));
+    }
+    table->setVerticalHeaderLabels(stage_names);
+    table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+}
+
+void FullSystemGUI::updateLatencyTable()
+{
+    if (auto latency_statistics = latency_statistics_buffer->popLeastRecentlyAddedValue())
+    {
+        QTableWidget* table = main_widget->latency_table_widget;
+        for (const LatencyStatistics& stage_statistics : latency_statistics.value())
+        {
+            int row                     = static_cast<int>(stage_statistics.stage);
+            std::vector<QString> values = {
+                QString::number(stage_statistics.mean_latency.toMilliseconds(), 'f', 2),
+                QString::number(stage_statistics.median_latency.toMilliseconds(), 'f', 2),
+                QString::number(stage_statistics.percentile_99_latency.toMilliseconds(),
+                                'f', 2),
+                QString::number(stage_statistics.max_latency.toMilliseconds(), 'f', 2),
+                QString::number(stage_statistics.num_latencies)};
+            for (int column = 0; column < static_cast<int>(values.size()); column++)
+            {
+                table->setItem(row, column, new QTableWidgetItem(values[column]));
+            }
+        }
+    }
+}
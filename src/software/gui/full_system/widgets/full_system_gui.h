@@ -7,6 +7,7 @@
 // .ui files are autogenerated to 'ui_<filename>.h`
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/ai/hl/stp/play_info.h"
+#include "software/backend/latency_tracker.h"
 #include "software/gui/drawing/draw_functions.h"
 #include "software/gui/full_system/ui/ui_main_widget.h"
 #include "software/multithreading/thread_safe_buffer.h"
@@ -36,6 +37,13 @@ class FullSystemGUI : public QMainWindow
      * @param sensor_msg_buffer The buffer used to receive new SensorProtos
      * @param view_area_buffer The buffer used to receive Rectangles that specify the area
      * of the world to display in the view
+     * @param worlds_received_per_second_buffer The buffer used to receive the rate
+     * Worlds are received at
+     * @param primitives_sent_per_second_buffer The buffer used to receive the rate
+     * primitives are sent at
+     * @param latency_statistics_buffer The buffer used to receive the statistics of the
+     * latency of each stage of the full system
+     * @param config The config to display and modify
      */
     explicit FullSystemGUI(
         std::shared_ptr<ThreadSafeBuffer<WorldDrawFunction>> world_draw_functions_buffer,
@@ -45,6 +53,8 @@ class FullSystemGUI : public QMainWindow
         std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer,
         std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer,
         std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer,
+        std::shared_ptr<ThreadSafeBuffer<std::vector<LatencyStatistics>>>
+            latency_statistics_buffer,
         std::shared_ptr<ThunderbotsConfig> config);
 
    private:
@@ -81,6 +91,16 @@ class FullSystemGUI : public QMainWindow
      */
     void updateDataPerSecondLCD();
 
+    /**
+     * Sets up the rows and columns of the latency table
+     */
+    void setupLatencyTable();
+
+    /**
+     * Updates the latency table with the newly provided latency statistics
+     */
+    void updateLatencyTable();
+
     // The "parent" of each of these widgets is set during construction, meaning that
     // the Qt system takes ownership of the pointer and is responsible for de-allocating
     // it, so we don't have to
@@ -95,6 +115,8 @@ class FullSystemGUI : public QMainWindow
     std::shared_ptr<ThreadSafeBuffer<Rectangle>> view_area_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> worlds_received_per_second_buffer;
     std::shared_ptr<ThreadSafeBuffer<double>> primitives_sent_per_second_buffer;
+    std::shared_ptr<ThreadSafeBuffer<std::vector<LatencyStatistics>>>
+        latency_statistics_buffer;
 
     WorldDrawFunction most_recent_world_draw_function;
     AIDrawFunction most_recent_ai_draw_function;
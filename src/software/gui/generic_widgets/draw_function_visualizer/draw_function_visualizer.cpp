@@ -1,7 +1,7 @@
 #include "software/gui/generic_widgets/draw_function_visualizer/draw_function_visualizer.h"
 
 #include <QtWidgets/QMenu>
-#include <string>
+#include <unordered_set>
 
 #include "software/gui/drawing/colors.h"
 #include "software/gui/geometry_conversion.h"
@@ -11,6 +11,7 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
     : ZoomableQGraphicsView(parent),
       graphics_scene(new QGraphicsScene(this)),
       open_gl_widget(new QOpenGLWidget(this)),
+      staging_scene(new QGraphicsScene(this)),
       // Placeholder Rectangle
       last_view_area(Rectangle(Point(1, 1), Point(0, 0)))
 
@@ -60,6 +61,8 @@ DrawFunctionVisualizer::DrawFunctionVisualizer(QWidget *parent)
 
 void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_functions)
 {
+    // Clearing the scene deletes the items of every retained layer
+    retained_layers.clear();
     graphics_scene->clear();
     for (auto draw_function : draw_functions)
     {
@@ -74,6 +77,94 @@ void DrawFunctionVisualizer::clearAndDraw(const std::vector<DrawFunction> &draw_
     }
 }
 
+void DrawFunctionVisualizer::draw(const std::vector<DrawLayer> &draw_layers)
+{
+    std::unordered_set<DrawLayerId> drawn_layer_ids;
+    for (const DrawLayer &draw_layer : draw_layers)
+    {
+        if (!drawn_layer_ids.insert(draw_layer.id).second)
+        {
+            LOG(WARNING) << "Attempted to draw multiple layers with the id "
+                         << draw_layer.id.name << "/" << draw_layer.id.index;
+            continue;
+        }
+
+        auto [retained_layer_iter, is_new_layer] =
+            retained_layers.try_emplace(draw_layer.id);
+        RetainedLayer &retained_layer = retained_layer_iter->second;
+        if (is_new_layer)
+        {
+            retained_layer.content_key = draw_layer.content_key;
+            retained_layer.items       = new QGraphicsItemGroup();
+            graphics_scene->addItem(retained_layer.items);
+            drawLayer(draw_layer, retained_layer.items);
+        }
+        else if (retained_layer.content_key != draw_layer.content_key)
+        {
+            // The group of the layer is kept, and only the items in it are replaced
+            for (QGraphicsItem *item : retained_layer.items->childItems())
+            {
+                delete item;
+            }
+            retained_layer.content_key = draw_layer.content_key;
+            drawLayer(draw_layer, retained_layer.items);
+        }
+
+        // Moving a layer only changes the transform of its group, so the items that
+        // were already drawn are moved in place
+        if (retained_layer.items->transform() != draw_layer.transform)
+        {
+            retained_layer.items->setTransform(draw_layer.transform);
+        }
+
+        // Stack the layers in the order they were given
+        const qreal z_value = static_cast<qreal>(drawn_layer_ids.size());
+        if (retained_layer.items->zValue() != z_value)
+        {
+            retained_layer.items->setZValue(z_value);
+        }
+    }
+
+    for (auto iter = retained_layers.begin(); iter != retained_layers.end();)
+    {
+        if (drawn_layer_ids.count(iter->first) == 0)
+        {
+            delete iter->second.items;
+            iter = retained_layers.erase(iter);
+        }
+        else
+        {
+            iter++;
+        }
+    }
+}
+
+void DrawFunctionVisualizer::drawLayer(const DrawLayer &draw_layer,
+                                       QGraphicsItemGroup *items)
+{
+    if (!draw_layer.draw_function)
+    {
+        LOG(WARNING) << "Attempted to draw a non-callable DrawFunction for the layer "
+                     << draw_layer.id.name << "/" << draw_layer.id.index;
+        return;
+    }
+
+    draw_layer.draw_function(staging_scene);
+
+    // The items are drawn around the origin of the layer, so they are made children of
+    // the group rather than added with addToGroup, which would keep their positions in
+    // the scene. They are added in the order they were drawn so they keep the same
+    // stacking order.
+    for (QGraphicsItem *item : staging_scene->items(Qt::AscendingOrder))
+    {
+        if (!item->parentItem())
+        {
+            staging_scene->removeItem(item);
+            item->setParentItem(items);
+        }
+    }
+}
+
 void DrawFunctionVisualizer::setViewArea(const Rectangle &view_area)
 {
     // Moves and scales the view to fit the view_area in the scene
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <QtWidgets/QGraphicsItemGroup>
 #include <QtWidgets/QGraphicsScene>
 #include <QtWidgets/QOpenGLWidget>
+#include <unordered_map>
 
 #include "software/geom/rectangle.h"
 #include "software/gui/drawing/draw_functions.h"
@@ -26,6 +28,20 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
      */
     void clearAndDraw(const std::vector<DrawFunction>& draw_functions);
 
+    /**
+     * Draws each of the provided DrawLayers in order, with later layers drawn on top of
+     * earlier ones.
+     *
+     * Unlike clearAndDraw, the items in the scene are retained between calls. A layer
+     * is only redrawn if it was not drawn in the last call or if its content key has
+     * changed since then. If only its transform has changed, the items drawn for it are
+     * moved in place. Layers that are not provided are removed from the scene.
+     *
+     * @param draw_layers The DrawLayers to draw on the scene, in order. Each layer
+     * should have a unique id.
+     */
+    void draw(const std::vector<DrawLayer>& draw_layers);
+
     /**
      * Sets the area of the scene that's visible in the view
      *
@@ -34,12 +50,40 @@ class DrawFunctionVisualizer : public ZoomableQGraphicsView
     void setViewArea(const Rectangle& view_area);
 
    private:
+    /**
+     * The items that were drawn for a DrawLayer
+     */
+    struct RetainedLayer
+    {
+        // The content key of the layer when it was drawn
+        std::size_t content_key = 0;
+        // The group of the items drawn for the layer, which is placed with the
+        // transform of the layer. This is owned by the graphics_scene.
+        QGraphicsItemGroup* items = nullptr;
+    };
+
+    /**
+     * Draws the given layer and adds the items it drew to the given group
+     *
+     * @param draw_layer The layer to draw
+     * @param items The group in the graphics_scene to add the drawn items to
+     */
+    void drawLayer(const DrawLayer& draw_layer, QGraphicsItemGroup* items);
+
     // The "parent" of each of these widgets is set during construction, meaning that
     // the Qt system takes ownership of the pointer and is responsible for de-allocating
     // it, so we don't have to
     QGraphicsScene* graphics_scene;
     QOpenGLWidget* open_gl_widget;
 
+    // Layers are drawn on this scene first so that the items drawn for each layer can
+    // be told apart from the rest of the graphics_scene. The items are then moved into
+    // the graphics_scene, so this scene is always empty between calls to draw.
+    QGraphicsScene* staging_scene;
+
+    // The layers currently in the graphics_scene, by id
+    std::unordered_map<DrawLayerId, RetainedLayer> retained_layers;
+
    protected:
     /**
      * When the context menu is called by right-clicking on the simulator field
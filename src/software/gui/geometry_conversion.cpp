@@ -1,5 +1,7 @@
 #include "software/gui/geometry_conversion.h"
 
+#include <algorithm>
+
 QPointF createQPointF(const Point& point)
 {
     return QPointF(point.x(), point.y());
@@ -51,3 +53,22 @@ int createQAngle(const Angle& angle)
     // our convention.
     return -static_cast<int>(angle.toDegrees() * 16);
 }
+
+QTransform createQTransform(const Point& position, const Angle& orientation)
+{
+    // The transformations are applied to points in the opposite order they are added
+    QTransform transform;
+    transform.translate(position.x(), position.y());
+    transform.rotateRadians(orientation.toRadians());
+    return transform;
+}
+
+QTransform createQTransform(const Segment& segment)
+{
+    static constexpr double MIN_SEGMENT_LENGTH = 1e-9;
+
+    Vector direction     = segment.toVector();
+    QTransform transform = createQTransform(segment.getStart(), direction.orientation());
+    transform.scale(std::max(direction.length(), MIN_SEGMENT_LENGTH), 1);
+    return transform;
+}
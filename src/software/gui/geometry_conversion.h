@@ -4,6 +4,7 @@
 #include <QtCore/QPoint>
 #include <QtCore/QRect>
 #include <QtGui/QPolygonF>
+#include <QtGui/QTransform>
 
 #include "software/geom/point.h"
 #include "software/geom/rectangle.h"
@@ -56,3 +57,28 @@ Point createPoint(const QPoint& point);
  * @return The Qt angle representation of the given Angle
  */
 int createQAngle(const Angle& angle);
+
+/**
+ * Creates a transform that rotates by the given orientation about the origin, and then
+ * moves the origin to the given position
+ *
+ * @param position The position to move the origin to
+ * @param orientation The orientation to rotate by
+ *
+ * @return The QTransform that places something drawn at the origin at the given
+ * position and orientation
+ */
+QTransform createQTransform(const Point& position,
+                            const Angle& orientation = Angle::zero());
+
+/**
+ * Creates a transform that maps the segment from (0, 0) to (1, 0) onto the given
+ * segment. A segment of length 0 is mapped onto a very short segment instead, so that
+ * the transform can still be inverted.
+ *
+ * @param segment The segment to map onto
+ *
+ * @return The QTransform that maps the unit segment along the x axis onto the given
+ * segment
+ */
+QTransform createQTransform(const Segment& segment);
@@ -62,3 +62,30 @@ TEST(QtGeometryConversionTest, create_qangle_from_negative_angle)
     int expected = -(-204 * 16);
     EXPECT_EQ(expected, result);
 }
+
+TEST(QtGeometryConversionTest, create_qtransform_from_position_and_orientation)
+{
+    auto result = createQTransform(Point(1, 2), Angle::quarter());
+    // Points are rotated about the origin first, and then moved to the position
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(1, 3), createPoint(result.map(QPointF(1, 0))), 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(0, 2), createPoint(result.map(QPointF(0, 1))), 1e-9));
+}
+
+TEST(QtGeometryConversionTest, create_qtransform_from_segment)
+{
+    auto result = createQTransform(Segment(Point(1, 2), Point(1, 5)));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(1, 2), createPoint(result.map(QPointF(0, 0))), 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(1, 5), createPoint(result.map(QPointF(1, 0))), 1e-9));
+}
+
+TEST(QtGeometryConversionTest, create_qtransform_from_segment_of_length_zero)
+{
+    auto result = createQTransform(Segment(Point(1, 2), Point(1, 2)));
+    EXPECT_TRUE(result.isInvertible());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        Point(1, 2), createPoint(result.map(QPointF(1, 0))), 1e-6));
+}
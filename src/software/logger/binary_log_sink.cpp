@@ -0,0 +1,172 @@
+#include "software/logger/binary_log_sink.h"
+
+bool BinaryLogField::operator==(const BinaryLogField& other) const
+{
+    return name == other.name && type == other.type;
+}
+
+/**
+ * Writes the given value to the file in the byte order of this machine
+ *
+ * @param file The file to write to
+ * @param value The value to write
+ */
+template <typename T>
+static void writeValue(std::ostream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Reads a value written by writeValue from the file
+ *
+ * @param file The file to read from
+ *
+ * @throws std::runtime_error if the file ends before the value
+ *
+ * @return the value read
+ */
+template <typename T>
+static T readValue(std::istream& file)
+{
+    T value;
+    if (!file.read(reinterpret_cast<char*>(&value), sizeof(value)))
+    {
+        throw std::runtime_error("Binary log ended unexpectedly");
+    }
+    return value;
+}
+
+BinaryLogWriter::BinaryLogWriter(const std::string& file_path,
+                                 const std::vector<BinaryLogField>& fields)
+    : file(file_path, std::ios::out | std::ios::binary | std::ios::trunc),
+      pending_records(),
+      records_to_write(),
+      num_bytes_appended(0),
+      num_bytes_written(0),
+      flush_requested(false),
+      in_destructor(false)
+{
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Could not open binary log " + file_path);
+    }
+
+    file.write(MAGIC.data(), MAGIC.size());
+    writeValue(file, FORMAT_VERSION);
+    writeValue(file, static_cast<uint32_t>(fields.size()));
+    for (const BinaryLogField& field : fields)
+    {
+        writeValue(file, static_cast<uint8_t>(field.type));
+        writeValue(file, static_cast<uint32_t>(field.name.size()));
+        file.write(field.name.data(), static_cast<std::streamsize>(field.name.size()));
+    }
+    file.flush();
+
+    pending_records.reserve(WRITE_THRESHOLD_BYTES);
+    records_to_write.reserve(WRITE_THRESHOLD_BYTES);
+
+    // The thread is only started once the header has been written
+    write_thread = std::thread([this]() { writeContinuously(); });
+}
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+    {
+        std::scoped_lock lock(pending_records_mutex);
+        in_destructor = true;
+    }
+    pending_records_cv.notify_one();
+    write_thread.join();
+}
+
+void BinaryLogWriter::append(const char* record, std::size_t size)
+{
+    bool should_write_early;
+    {
+        std::scoped_lock lock(pending_records_mutex);
+        pending_records.insert(pending_records.end(), record, record + size);
+        num_bytes_appended += size;
+        should_write_early = pending_records.size() >= WRITE_THRESHOLD_BYTES;
+    }
+    if (should_write_early)
+    {
+        pending_records_cv.notify_one();
+    }
+}
+
+void BinaryLogWriter::flush()
+{
+    std::unique_lock lock(pending_records_mutex);
+    std::size_t num_bytes_to_flush = num_bytes_appended;
+    flush_requested                = true;
+    pending_records_cv.notify_one();
+    records_written_cv.wait(lock,
+                            [&]() { return num_bytes_written >= num_bytes_to_flush; });
+}
+
+void BinaryLogWriter::writeContinuously()
+{
+    bool done = false;
+    while (!done)
+    {
+        {
+            std::unique_lock lock(pending_records_mutex);
+            pending_records_cv.wait_for(lock, WRITE_PERIOD, [this]() {
+                return in_destructor || flush_requested ||
+                       pending_records.size() >= WRITE_THRESHOLD_BYTES;
+            });
+            done            = in_destructor;
+            flush_requested = false;
+            std::swap(pending_records, records_to_write);
+        }
+
+        file.write(records_to_write.data(),
+                   static_cast<std::streamsize>(records_to_write.size()));
+        file.flush();
+
+        {
+            std::scoped_lock lock(pending_records_mutex);
+            num_bytes_written += records_to_write.size();
+        }
+        records_to_write.clear();
+        records_written_cv.notify_all();
+    }
+}
+
+std::vector<BinaryLogField> readBinaryLogFields(std::istream& file)
+{
+    std::array<char, BinaryLogWriter::MAGIC.size()> magic;
+    if (!file.read(magic.data(), magic.size()) || magic != BinaryLogWriter::MAGIC)
+    {
+        throw std::runtime_error("File is not a binary log");
+    }
+
+    uint32_t version = readValue<uint32_t>(file);
+    if (version != BinaryLogWriter::FORMAT_VERSION)
+    {
+        throw std::runtime_error("Unsupported binary log version " +
+                                 std::to_string(version));
+    }
+
+    uint32_t num_fields = readValue<uint32_t>(file);
+    std::vector<BinaryLogField> fields;
+    for (uint32_t i = 0; i < num_fields; i++)
+    {
+        uint8_t type = readValue<uint8_t>(file);
+        if (type >= sizeBinaryLogFieldType())
+        {
+            throw std::runtime_error("Unknown binary log field type " +
+                                     std::to_string(type));
+        }
+
+        std::string name(readValue<uint32_t>(file), '\0');
+        if (!file.read(name.data(), static_cast<std::streamsize>(name.size())))
+        {
+            throw std::runtime_error("Binary log ended unexpectedly");
+        }
+
+        fields.push_back(BinaryLogField{name, static_cast<BinaryLogFieldType>(type)});
+    }
+    return fields;
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "software/util/make_enum/make_enum.h"
+
+MAKE_ENUM(BinaryLogFieldType, BOOL, INT32, INT64, UINT32, UINT64, FLOAT, DOUBLE);
+
+/**
+ * The name and type of a single field of the records in a binary log
+ */
+struct BinaryLogField
+{
+    std::string name;
+    BinaryLogFieldType type;
+
+    bool operator==(const BinaryLogField& other) const;
+};
+
+/**
+ * Returns the BinaryLogFieldType of the given C++ type
+ *
+ * @tparam T The type of the field
+ *
+ * @return the BinaryLogFieldType of T
+ */
+template <typename T>
+constexpr BinaryLogFieldType getBinaryLogFieldType();
+
+/**
+ * The BinaryLogWriter writes the records of a binary log to a file in the background.
+ * Records are appended to an in-memory buffer by the caller, and written to the file by
+ * a separate thread either periodically or once enough records have been appended.
+ *
+ * A binary log is:
+ * - The 8 characters "TBOTSBIN"
+ * - The version of the format, as a uint32
+ * - The number of fields in each record, as a uint32
+ * - For each field, its BinaryLogFieldType as a uint8, the length of its name as a
+ *   uint32 and its name
+ * - The records, each of which is the values of its fields with no padding
+ *
+ * All values are in the byte order of the machine that wrote the log.
+ *
+ * Use BinaryLogSink rather than this class directly, so that the records are typed.
+ */
+class BinaryLogWriter
+{
+   public:
+    /**
+     * Creates a BinaryLogWriter that writes a new binary log to the given file
+     *
+     * @param file_path The path of the file to write to. The file is overwritten if it
+     * exists.
+     * @param fields The fields of each record
+     *
+     * @throws std::runtime_error if the file could not be opened
+     */
+    explicit BinaryLogWriter(const std::string& file_path,
+                             const std::vector<BinaryLogField>& fields);
+
+    /**
+     * Writes any records that have not been written yet to the file and closes it
+     */
+    ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    /**
+     * Appends a record to the log
+     *
+     * @param record The values of the fields of the record
+     * @param size The size of the record in bytes
+     */
+    void append(const char* record, std::size_t size);
+
+    /**
+     * Writes all the records that have been appended so far to the file, blocking until
+     * they have been written
+     */
+    void flush();
+
+    static constexpr uint32_t FORMAT_VERSION   = 1;
+    static constexpr std::array<char, 8> MAGIC = {'T', 'B', 'O', 'T', 'S', 'B', 'I', 'N'};
+
+    // How often the appended records are written to the file
+    static constexpr std::chrono::milliseconds WRITE_PERIOD =
+        std::chrono::milliseconds(100);
+    // The appended records are written early once there are this many bytes of them
+    static constexpr std::size_t WRITE_THRESHOLD_BYTES = 64 * 1024;
+
+   private:
+    /**
+     * Writes the appended records to the file until the writer is destroyed. This is
+     * intended to be run in a separate thread.
+     */
+    void writeContinuously();
+
+    std::ofstream file;
+
+    // The records that have been appended but not written yet, and the buffer being
+    // written to the file. These are swapped so the caller never waits on the file.
+    std::vector<char> pending_records;
+    std::vector<char> records_to_write;
+    // The total number of bytes of records appended and written to the file, used to
+    // know when a flush is complete
+    std::size_t num_bytes_appended;
+    std::size_t num_bytes_written;
+    bool flush_requested;
+    bool in_destructor;
+    std::mutex pending_records_mutex;
+    std::condition_variable pending_records_cv;
+    std::condition_variable records_written_cv;
+
+    std::thread write_thread;
+};
+
+/**
+ * The BinaryLogSink writes records of typed fields to a binary log file, for logging
+ * numeric telemetry at high rates. Unlike logging to a CSV file, the values are never
+ * formatted as strings and the caller only copies them into a buffer, since the file is
+ * written in the background.
+ *
+ * Example:
+ *   BinaryLogSink<double, uint32_t, double> sink("speeds.bin",
+ *                                               {"time_s", "robot_id", "speed_m_per_s"});
+ *   sink.log(time.toSeconds(), robot.id(), robot.velocity().length());
+ *
+ * The log can be read with readBinaryLog.
+ *
+ * @tparam FieldTypes The types of the fields of each record, in order
+ */
+template <typename... FieldTypes>
+class BinaryLogSink
+{
+   public:
+    /**
+     * Creates a BinaryLogSink that writes a new binary log to the given file
+     *
+     * @param file_path The path of the file to write to. The file is overwritten if it
+     * exists.
+     * @param field_names The names of the fields of each record, in order
+     *
+     * @throws std::runtime_error if the file could not be opened
+     */
+    explicit BinaryLogSink(
+        const std::string& file_path,
+        const std::array<std::string, sizeof...(FieldTypes)>& field_names);
+
+    /**
+     * Logs a record with the given field values. This is safe to call from multiple
+     * threads.
+     *
+     * @param fields The values of the fields of the record
+     */
+    void log(const FieldTypes&... fields);
+
+    /**
+     * Writes all the records that have been logged so far to the file, blocking until
+     * they have been written
+     */
+    void flush();
+
+    // The size of each record in the log, in bytes
+    static constexpr std::size_t RECORD_SIZE = (sizeof(FieldTypes) + ... + 0);
+
+   private:
+    BinaryLogWriter writer;
+};
+
+/**
+ * Reads the fields of the records in a binary log
+ *
+ * @param file The binary log to read, which is read up to the first record
+ *
+ * @throws std::runtime_error if the file is not a binary log
+ *
+ * @return the fields of the records in the binary log
+ */
+std::vector<BinaryLogField> readBinaryLogFields(std::istream& file);
+
+/**
+ * Reads all the records in a binary log written by a BinaryLogSink
+ *
+ * @tparam FieldTypes The types of the fields of each record, in order
+ * @param file_path The path of the binary log to read
+ *
+ * @throws std::runtime_error if the file could not be read, is not a binary log, or
+ * its fields are not of the given types
+ *
+ * @return the records in the binary log, in the order they were logged
+ */
+template <typename... FieldTypes>
+std::vector<std::tuple<FieldTypes...>> readBinaryLog(const std::string& file_path);
+
+#include "software/logger/binary_log_sink.tpp"
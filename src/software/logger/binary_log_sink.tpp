@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "software/logger/binary_log_sink.h"
+
+template <typename T>
+constexpr BinaryLogFieldType getBinaryLogFieldType()
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return BinaryLogFieldType::BOOL;
+    }
+    else if constexpr (std::is_same_v<T, int32_t>)
+    {
+        return BinaryLogFieldType::INT32;
+    }
+    else if constexpr (std::is_same_v<T, int64_t>)
+    {
+        return BinaryLogFieldType::INT64;
+    }
+    else if constexpr (std::is_same_v<T, uint32_t>)
+    {
+        return BinaryLogFieldType::UINT32;
+    }
+    else if constexpr (std::is_same_v<T, uint64_t>)
+    {
+        return BinaryLogFieldType::UINT64;
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return BinaryLogFieldType::FLOAT;
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, double>,
+                      "Binary log fields must be a bool, int32_t, int64_t, uint32_t, "
+                      "uint64_t, float or double");
+        return BinaryLogFieldType::DOUBLE;
+    }
+}
+
+/**
+ * Creates the fields of a binary log with the given field types
+ *
+ * @param field_names The names of the fields
+ *
+ * @return the fields of a binary log with the given names and types
+ */
+template <typename... FieldTypes>
+std::vector<BinaryLogField> createBinaryLogFields(
+    const std::array<std::string, sizeof...(FieldTypes)>& field_names)
+{
+    std::array<BinaryLogFieldType, sizeof...(FieldTypes)> field_types = {
+        getBinaryLogFieldType<FieldTypes>()...};
+
+    std::vector<BinaryLogField> fields;
+    for (std::size_t i = 0; i < sizeof...(FieldTypes); i++)
+    {
+        fields.push_back(BinaryLogField{field_names[i], field_types[i]});
+    }
+    return fields;
+}
+
+template <typename... FieldTypes>
+BinaryLogSink<FieldTypes...>::BinaryLogSink(
+    const std::string& file_path,
+    const std::array<std::string, sizeof...(FieldTypes)>& field_names)
+    : writer(file_path, createBinaryLogFields<FieldTypes...>(field_names))
+{
+}
+
+template <typename... FieldTypes>
+void BinaryLogSink<FieldTypes...>::log(const FieldTypes&... fields)
+{
+    std::array<char, RECORD_SIZE> record;
+    std::size_t offset = 0;
+    ((std::memcpy(record.data() + offset, &fields, sizeof(FieldTypes)),
+      offset += sizeof(FieldTypes)),
+     ...);
+    writer.append(record.data(), record.size());
+}
+
+template <typename... FieldTypes>
+void BinaryLogSink<FieldTypes...>::flush()
+{
+    writer.flush();
+}
+
+template <typename... FieldTypes>
+std::vector<std::tuple<FieldTypes...>> readBinaryLog(const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Could not open binary log " + file_path);
+    }
+
+    std::vector<BinaryLogField> fields                   = readBinaryLogFields(file);
+    std::vector<BinaryLogFieldType> expected_field_types = {
+        getBinaryLogFieldType<FieldTypes>()...};
+    if (fields.size() != expected_field_types.size())
+    {
+        throw std::runtime_error("Binary log " + file_path + " has " +
+                                 std::to_string(fields.size()) + " fields, expected " +
+                                 std::to_string(expected_field_types.size()));
+    }
+    for (std::size_t i = 0; i < fields.size(); i++)
+    {
+        if (fields[i].type != expected_field_types[i])
+        {
+            throw std::runtime_error("Field " + fields[i].name + " of binary log " +
+                                     file_path + " is not of the expected type");
+        }
+    }
+
+    static constexpr std::size_t RECORD_SIZE = BinaryLogSink<FieldTypes...>::RECORD_SIZE;
+    std::vector<std::tuple<FieldTypes...>> records;
+    std::array<char, RECORD_SIZE> record;
+    while (file.read(record.data(), RECORD_SIZE))
+    {
+        std::tuple<FieldTypes...> values;
+        std::size_t offset = 0;
+        std::apply(
+            [&](auto&... value) {
+                ((std::memcpy(&value, record.data() + offset, sizeof(value)),
+                  offset += sizeof(value)),
+                 ...);
+            },
+            values);
+        records.push_back(values);
+    }
+    return records;
+}
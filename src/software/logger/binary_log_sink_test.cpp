@@ -0,0 +1,121 @@
+#include "software/logger/binary_log_sink.h"
+
+#include <gtest/gtest.h>
+
+#include <experimental/filesystem>
+#include <fstream>
+
+class BinaryLogSinkTest : public ::testing::Test
+{
+   protected:
+    BinaryLogSinkTest()
+        : log_path((std::experimental::filesystem::temp_directory_path() / "test_log.bin")
+                       .string())
+    {
+    }
+
+    void TearDown() override
+    {
+        std::experimental::filesystem::remove(log_path);
+    }
+
+    const std::string log_path;
+};
+
+TEST_F(BinaryLogSinkTest, test_read_fields)
+{
+    {
+        BinaryLogSink<double, uint32_t, bool> sink(log_path,
+                                                   {"time_s", "robot_id", "has_ball"});
+    }
+
+    std::ifstream file(log_path, std::ios::in | std::ios::binary);
+    std::vector<BinaryLogField> expected_fields = {
+        {"time_s", BinaryLogFieldType::DOUBLE},
+        {"robot_id", BinaryLogFieldType::UINT32},
+        {"has_ball", BinaryLogFieldType::BOOL}};
+    EXPECT_EQ(expected_fields, readBinaryLogFields(file));
+}
+
+TEST_F(BinaryLogSinkTest, test_records_are_written_on_flush)
+{
+    BinaryLogSink<double, int32_t, float> sink(log_path, {"a", "b", "c"});
+    sink.log(1.5, -3, 2.5f);
+    sink.log(-0.25, 7, 0.0f);
+    sink.flush();
+
+    std::vector<std::tuple<double, int32_t, float>> expected_records = {{1.5, -3, 2.5f},
+                                                                        {-0.25, 7, 0.0f}};
+    EXPECT_EQ(expected_records, (readBinaryLog<double, int32_t, float>(log_path)));
+}
+
+TEST_F(BinaryLogSinkTest, test_records_are_written_on_destruction)
+{
+    {
+        BinaryLogSink<uint64_t, int64_t> sink(log_path, {"a", "b"});
+        for (int64_t i = 0; i < 10000; i++)
+        {
+            sink.log(static_cast<uint64_t>(i), -i);
+        }
+    }
+
+    auto records = readBinaryLog<uint64_t, int64_t>(log_path);
+    ASSERT_EQ(10000, records.size());
+    for (int64_t i = 0; i < 10000; i++)
+    {
+        EXPECT_EQ(std::make_tuple(static_cast<uint64_t>(i), -i), records[i]);
+    }
+}
+
+TEST_F(BinaryLogSinkTest, test_records_from_multiple_threads_are_all_written)
+{
+    {
+        BinaryLogSink<uint32_t, uint32_t> sink(log_path, {"thread", "index"});
+        std::vector<std::thread> threads;
+        for (uint32_t thread = 0; thread < 4; thread++)
+        {
+            threads.emplace_back([&sink, thread]() {
+                for (uint32_t i = 0; i < 1000; i++)
+                {
+                    sink.log(thread, i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    auto records = readBinaryLog<uint32_t, uint32_t>(log_path);
+    ASSERT_EQ(4000, records.size());
+    std::array<uint32_t, 4> next_index = {0, 0, 0, 0};
+    for (const auto& [thread, index] : records)
+    {
+        // Each thread's records must be in the order they were logged
+        ASSERT_LT(thread, next_index.size());
+        EXPECT_EQ(next_index[thread], index);
+        next_index[thread]++;
+    }
+}
+
+TEST_F(BinaryLogSinkTest, test_read_with_wrong_field_types_throws)
+{
+    {
+        BinaryLogSink<double, uint32_t> sink(log_path, {"a", "b"});
+        sink.log(1.0, 2);
+    }
+
+    EXPECT_THROW((readBinaryLog<double, int32_t>(log_path)), std::runtime_error);
+    EXPECT_THROW((readBinaryLog<double>(log_path)), std::runtime_error);
+}
+
+TEST_F(BinaryLogSinkTest, test_read_file_that_is_not_a_binary_log_throws)
+{
+    {
+        std::ofstream file(log_path);
+        file << "t1,t2,t3\n";
+    }
+
+    EXPECT_THROW((readBinaryLog<double>(log_path)), std::runtime_error);
+}
@@ -1,24 +1,74 @@
 #include "software/logger/csv_sink.h"
 
-#include <experimental/filesystem>
+#include <string_view>
 
-CSVSink::CSVSink(const std::string& log_directory) : log_directory(log_directory) {}
+CSVSink::CSVSink(const std::string& log_directory)
+    : log_directory(log_directory),
+      in_destructor(false),
+      flush_thread([this]() { flushPeriodically(); })
+{
+}
+
+CSVSink::~CSVSink()
+{
+    {
+        std::scoped_lock lock(files_mutex);
+        in_destructor = true;
+    }
+    in_destructor_cv.notify_one();
+    flush_thread.join();
+
+    // The files are flushed and closed when they are destroyed
+}
 
 void CSVSink::appendToFile(g3::LogMessageMover log_entry)
 {
     if (log_entry.get()._level.value == CSV.value)
     {
-        std::string msg = log_entry.get()._message;
-        size_t pos      = msg.find(file_ext) + file_ext.length();
+        const std::string& msg = log_entry.get()._message;
+        size_t pos             = msg.find(file_ext);
 
-        if (pos != std::string::npos + file_ext.length())
+        if (pos != std::string::npos)
+        {
+            pos += file_ext.length();
+            std::string_view file_name(msg.data(), pos);
+
+            std::scoped_lock lock(files_mutex);
+            auto file_iter = files.find(file_name);
+            if (file_iter == files.end())
+            {
+                std::string file_name_str(file_name);
+                file_iter =
+                    files
+                        .emplace(file_name_str,
+                                 std::ofstream(log_directory + "/" + file_name_str,
+                                               std::ios::out | std::ios_base::app))
+                        .first;
+            }
+            file_iter->second.write(msg.data() + pos,
+                                    static_cast<std::streamsize>(msg.length() - pos));
+        }
+    }
+}
+
+void CSVSink::flush()
+{
+    std::scoped_lock lock(files_mutex);
+    for (auto& [file_name, file] : files)
+    {
+        file.flush();
+    }
+}
+
+void CSVSink::flushPeriodically()
+{
+    std::unique_lock lock(files_mutex);
+    while (!in_destructor_cv.wait_for(lock, FLUSH_PERIOD,
+                                      [this]() { return in_destructor; }))
+    {
+        for (auto& [file_name, file] : files)
         {
-            std::string file_name = msg.substr(0, pos);
-            std::string file_data = msg.substr(pos, msg.length());
-            std::ofstream csv_file(log_directory + "/" + file_name,
-                                   std::ios::out | std::ios_base::app);
-            csv_file << file_data;
-            csv_file.close();
+            file.flush();
         }
     }
 }
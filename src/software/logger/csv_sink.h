@@ -1,13 +1,22 @@
 #pragma once
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <g3log/logmessage.hpp>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include "software/logger/custom_logging_levels.h"
 
 /**
  * This class acts as a customer sink for g3log. In particular, it allows us to log to csv
  * files.
+ *
+ * Each file is opened once and kept open with buffered writes, rather than being opened
+ * and closed for every message, since we log to some files on every tick. The files are
+ * flushed periodically in the background and when the sink is destroyed.
  */
 class CSVSink
 {
@@ -18,6 +27,15 @@ class CSVSink
      * @param log_directory the directory to save files to
      */
     CSVSink(const std::string& log_directory);
+
+    /**
+     * Flushes and closes all the files that have been logged to
+     */
+    ~CSVSink();
+
+    CSVSink(const CSVSink&) = delete;
+    CSVSink& operator=(const CSVSink&) = delete;
+
     /**
      * This function is called on every call to LOG(CSV, filename). It appends to the
      * specified file the message in log_entry. Note for .csv files: columns are separated
@@ -27,7 +45,31 @@ class CSVSink
      */
     void appendToFile(g3::LogMessageMover log_entry);
 
+    /**
+     * Writes everything that has been appended to the files so far to disk
+     */
+    void flush();
+
+    // How often the files are flushed in the background
+    static constexpr std::chrono::milliseconds FLUSH_PERIOD =
+        std::chrono::milliseconds(250);
+
    private:
+    /**
+     * Flushes the files every FLUSH_PERIOD until the sink is destroyed. This is intended
+     * to be run in a separate thread.
+     */
+    void flushPeriodically();
+
     std::string log_directory;
     const std::string file_ext = ".csv";
+
+    // The open files, by file name. The transparent comparator lets files be looked up
+    // without copying the file name out of the message.
+    std::map<std::string, std::ofstream, std::less<>> files;
+    std::mutex files_mutex;
+
+    bool in_destructor;
+    std::condition_variable in_destructor_cv;
+    std::thread flush_thread;
 };
@@ -31,6 +31,25 @@ TEST(CSVSinkTest, test_csv_log_appends)
     EXPECT_EQ(output, "t1,t2,t3t7,t8,t9t4,t5,t6\ns1,s2,s3");
 }
 
+TEST(CSVSinkTest, test_csv_log_written_when_logger_destroyed)
+{
+    std::unique_ptr<g3::LogWorker> logWorker = g3::LogWorker::createLogWorker();
+    auto csv_sink_handle = logWorker->addSink(std::make_unique<CSVSink>(logging_dir),
+                                              &CSVSink::appendToFile);
+    g3::initializeLogging(logWorker.get());
+
+    LOG(CSV, "test_file3.csv") << "u1,u2,u3\n";
+    LOG(CSV, "test_file3.csv") << "u4,u5,u6\n";
+
+    // destroying the logger destroys the sink, which must flush the open files
+    logWorker.reset();
+
+    std::ifstream read_test(logging_dir + "/test_file3.csv", std::ios::in);
+    std::string output((std::istreambuf_iterator<char>(read_test)),
+                       std::istreambuf_iterator<char>());
+    EXPECT_EQ(output, "u1,u2,u3\nu4,u5,u6\n");
+}
+
 TEST_P(CSVSinkTest, test_csv_log_levels_not_logging)
 {
     std::unique_ptr<g3::LogWorker> logWorker = g3::LogWorker::createLogWorker();
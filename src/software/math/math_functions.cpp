@@ -1,6 +1,8 @@
 #include "software/math/math_functions.h"
 
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 double linear(double value, double offset, double linear_width)
 {
@@ -51,3 +53,59 @@ double sigmoid(const double& v, const double& offset, const double& sig_width)
 
     return 1 / (1 + std::exp(sig_change_factor * (offset - v)));
 }
+
+std::vector<unsigned int> allocateProportionally(const std::vector<double>& weights,
+                                                 unsigned int budget,
+                                                 unsigned int min_units_per_item)
+{
+    std::vector<unsigned int> allocation(weights.size(), min_units_per_item);
+    unsigned int min_budget =
+        static_cast<unsigned int>(weights.size()) * min_units_per_item;
+    if (weights.empty() || budget <= min_budget)
+    {
+        return allocation;
+    }
+    unsigned int remaining_budget = budget - min_budget;
+
+    std::vector<double> clamped_weights(weights.size());
+    std::transform(weights.begin(), weights.end(), clamped_weights.begin(),
+                   [](double weight) { return std::max(weight, 0.0); });
+    double total_weight =
+        std::accumulate(clamped_weights.begin(), clamped_weights.end(), 0.0);
+    if (total_weight <= 0)
+    {
+        std::fill(clamped_weights.begin(), clamped_weights.end(), 1.0);
+        total_weight = static_cast<double>(clamped_weights.size());
+    }
+
+    // Give each item the whole part of its share first, then give the units left over
+    // to the items with the largest fractional parts of their shares
+    std::vector<double> remainders(weights.size());
+    unsigned int num_units_allocated = 0;
+    for (std::size_t i = 0; i < weights.size(); i++)
+    {
+        double share = remaining_budget * clamped_weights[i] / total_weight;
+        // The shares can add up to slightly more than the budget due to floating point
+        // error, so the whole shares are limited to the units that are left
+        double whole_share =
+            std::min(std::floor(share),
+                     static_cast<double>(remaining_budget - num_units_allocated));
+        allocation[i] += static_cast<unsigned int>(whole_share);
+        num_units_allocated += static_cast<unsigned int>(whole_share);
+        remainders[i] = share - whole_share;
+    }
+
+    std::vector<std::size_t> indices_by_remainder(weights.size());
+    std::iota(indices_by_remainder.begin(), indices_by_remainder.end(), 0);
+    std::stable_sort(indices_by_remainder.begin(), indices_by_remainder.end(),
+                     [&remainders](std::size_t a, std::size_t b) {
+                         return remainders[a] > remainders[b];
+                     });
+    for (std::size_t i = 0; num_units_allocated < remaining_budget; i++)
+    {
+        allocation[indices_by_remainder[i % indices_by_remainder.size()]]++;
+        num_units_allocated++;
+    }
+
+    return allocation;
+}
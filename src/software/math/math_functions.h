@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <vector>
 
 #include "software/geom/circle.h"
 #include "software/geom/point.h"
@@ -67,6 +68,24 @@ double circleSigmoid(const Circle& circle, const Point& point, const double& sig
  */
 double sigmoid(const double& v, const double& offset, const double& sig_width);
 
+/**
+ * Splits a budget of discrete units between some items in proportion to their weights.
+ * Each item gets at least the given minimum number of units, and the remaining units are
+ * split using the largest remainder method, so the allocations always add up to the
+ * budget.
+ *
+ * @param weights The weight of each item. Negative weights are treated as 0, and the
+ * remaining units are split evenly if every weight is 0.
+ * @param budget The total number of units to split between the items. If this is less
+ * than the minimum number of units for all the items, each item gets the minimum.
+ * @param min_units_per_item The minimum number of units each item gets
+ *
+ * @return The number of units allocated to each item, in the same order as the weights
+ */
+std::vector<unsigned int> allocateProportionally(const std::vector<double>& weights,
+                                                 unsigned int budget,
+                                                 unsigned int min_units_per_item);
+
 /**
  * Normalizes the given value in the range [value_min, value max] to the new
  * range [range_min, range_max]
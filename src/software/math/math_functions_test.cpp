@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <random>
+
 TEST(LinearUtilFunctionTest, testZeroCase)
 {
     double out = linear(0, 0, 2);
@@ -230,3 +233,66 @@ TEST(NormalizeToRangeTest, test_floating_point_type_initial_value_out_of_range)
     double result = normalizeValueToRange<double>(300, 0, 255, 0, 6);
     EXPECT_DOUBLE_EQ(6.0, result);
 }
+
+TEST(AllocateProportionallyTest, test_allocation_proportional_to_weights)
+{
+    std::vector<unsigned int> expected = {2, 4, 6};
+    EXPECT_EQ(expected, allocateProportionally({1, 2, 3}, 12, 0));
+}
+
+TEST(AllocateProportionallyTest, test_allocation_includes_minimum_units)
+{
+    std::vector<unsigned int> expected = {1, 1, 10};
+    EXPECT_EQ(expected, allocateProportionally({0, 0, 1}, 12, 1));
+}
+
+TEST(AllocateProportionallyTest, test_left_over_units_go_to_largest_remainders)
+{
+    // The shares are 3.33, 3.33 and 3.33, so the unit left over goes to the first item
+    std::vector<unsigned int> expected = {4, 3, 3};
+    EXPECT_EQ(expected, allocateProportionally({1, 1, 1}, 10, 0));
+
+    // The shares are 1.4, 2.8 and 5.8
+    expected = {1, 3, 6};
+    EXPECT_EQ(expected, allocateProportionally({0.14, 0.28, 0.58}, 10, 0));
+}
+
+TEST(AllocateProportionallyTest, test_all_zero_weights_are_split_evenly)
+{
+    std::vector<unsigned int> expected = {2, 2, 2};
+    EXPECT_EQ(expected, allocateProportionally({0, -1, 0}, 6, 0));
+}
+
+TEST(AllocateProportionallyTest, test_budget_less_than_minimum)
+{
+    std::vector<unsigned int> expected = {2, 2, 2};
+    EXPECT_EQ(expected, allocateProportionally({1, 2, 3}, 3, 2));
+}
+
+TEST(AllocateProportionallyTest, test_allocation_always_adds_up_to_budget)
+{
+    // Weights whose shares are whole numbers, up to floating point error
+    std::mt19937 random_num_gen(0);
+    std::uniform_int_distribution<unsigned int> units_distribution(0, 10);
+    std::uniform_real_distribution<double> scale_distribution(0.001, 1000);
+    for (int i = 0; i < 10000; i++)
+    {
+        std::vector<double> weights;
+        unsigned int budget = 0;
+        double scale        = scale_distribution(random_num_gen);
+        for (int j = 0; j < 5; j++)
+        {
+            unsigned int units = units_distribution(random_num_gen);
+            weights.push_back(units * scale);
+            budget += units;
+        }
+
+        std::vector<unsigned int> allocation = allocateProportionally(weights, budget, 0);
+        EXPECT_EQ(budget, std::accumulate(allocation.begin(), allocation.end(), 0u));
+    }
+}
+
+TEST(AllocateProportionallyTest, test_no_weights)
+{
+    EXPECT_TRUE(allocateProportionally({}, 10, 1).empty());
+}
@@ -0,0 +1,103 @@
+#include "software/multithreading/worker_pool.h"
+
+WorkerPool::WorkerPool(unsigned int num_threads)
+    : workers(),
+      batch_task(nullptr),
+      batch_num_tasks(0),
+      batch_number(0),
+      num_busy_workers(0),
+      stopping(false),
+      next_task(0)
+{
+    // The thread that calls parallelFor is one of the threads
+    for (unsigned int i = 1; i < num_threads; i++)
+    {
+        workers.emplace_back([this]() { runWorker(); });
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::scoped_lock lock(batch_mutex);
+        stopping = true;
+    }
+    batch_started.notify_all();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::parallelFor(std::size_t num_tasks,
+                             const std::function<void(std::size_t)>& task)
+{
+    if (workers.empty() || num_tasks <= 1)
+    {
+        for (std::size_t i = 0; i < num_tasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::scoped_lock lock(batch_mutex);
+        batch_task       = &task;
+        batch_num_tasks  = num_tasks;
+        num_busy_workers = workers.size();
+        next_task        = 0;
+        batch_number++;
+    }
+    batch_started.notify_all();
+
+    runTasks(num_tasks, task);
+
+    std::unique_lock lock(batch_mutex);
+    batch_finished.wait(lock, [this]() { return num_busy_workers == 0; });
+    batch_task = nullptr;
+}
+
+unsigned int WorkerPool::numThreads() const
+{
+    return static_cast<unsigned int>(workers.size()) + 1;
+}
+
+void WorkerPool::runWorker()
+{
+    unsigned long last_batch_number = 0;
+    while (true)
+    {
+        const std::function<void(std::size_t)>* task;
+        std::size_t num_tasks;
+        {
+            std::unique_lock lock(batch_mutex);
+            batch_started.wait(
+                lock, [&]() { return stopping || batch_number != last_batch_number; });
+            if (stopping)
+            {
+                return;
+            }
+            last_batch_number = batch_number;
+            task              = batch_task;
+            num_tasks         = batch_num_tasks;
+        }
+
+        runTasks(num_tasks, *task);
+
+        {
+            std::scoped_lock lock(batch_mutex);
+            num_busy_workers--;
+        }
+        batch_finished.notify_one();
+    }
+}
+
+void WorkerPool::runTasks(std::size_t num_tasks,
+                          const std::function<void(std::size_t)>& task)
+{
+    for (std::size_t i = next_task++; i < num_tasks; i = next_task++)
+    {
+        task(i);
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of threads that repeatedly run a batch of tasks in parallel.
+ *
+ * Unlike creating a new thread for each batch, the threads are created once and wait
+ * between batches, so this is suitable for running many small batches, ie. once per
+ * step of a simulation. The thread calling parallelFor runs tasks as well, so a
+ * WorkerPool with a single thread runs every task in the calling thread.
+ */
+class WorkerPool
+{
+   public:
+    /**
+     * Creates a new WorkerPool
+     *
+     * @param num_threads The number of threads to run tasks in, including the thread
+     * that calls parallelFor. If this is 0, a single thread is used.
+     */
+    explicit WorkerPool(unsigned int num_threads);
+    WorkerPool() = delete;
+
+    // Copying this class is not permitted
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Stops and joins all the threads
+     */
+    ~WorkerPool();
+
+    /**
+     * Calls the given task once for each index from 0 to num_tasks - 1, spread across
+     * the threads, and returns once every call has returned. The order the tasks run
+     * in, and which thread runs each task, is not specified.
+     *
+     * The task must not throw, and must not call parallelFor on this WorkerPool.
+     *
+     * @param num_tasks The number of times to call the task
+     * @param task The task to call, with the index of each call
+     */
+    void parallelFor(std::size_t num_tasks, const std::function<void(std::size_t)>& task);
+
+    /**
+     * Returns the number of threads tasks run in, including the calling thread
+     *
+     * @return the number of threads tasks run in
+     */
+    unsigned int numThreads() const;
+
+   private:
+    /**
+     * Waits for batches of tasks, and runs tasks from each batch until all of them have
+     * been claimed, until the WorkerPool is destroyed
+     */
+    void runWorker();
+
+    /**
+     * Claims and runs tasks from the current batch until all of them have been claimed
+     *
+     * @param num_tasks The number of tasks in the current batch
+     * @param task The task of the current batch
+     */
+    void runTasks(std::size_t num_tasks, const std::function<void(std::size_t)>& task);
+
+    std::vector<std::thread> workers;
+
+    // Protects all of the state of the current batch below, except for next_task
+    std::mutex batch_mutex;
+    std::condition_variable batch_started;
+    std::condition_variable batch_finished;
+    const std::function<void(std::size_t)>* batch_task;
+    std::size_t batch_num_tasks;
+    // Incremented for each batch, so that workers can tell when a new batch starts
+    unsigned long batch_number;
+    // The number of workers that have not finished running tasks from the current
+    // batch
+    std::size_t num_busy_workers;
+    bool stopping;
+
+    std::atomic<std::size_t> next_task;
+};
@@ -0,0 +1,77 @@
+#include "software/multithreading/worker_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+TEST(WorkerPoolTest, single_thread_runs_every_task_in_calling_thread_in_order)
+{
+    WorkerPool worker_pool(1);
+    std::vector<std::size_t> indices;
+
+    const std::thread::id calling_thread_id = std::this_thread::get_id();
+
+    worker_pool.parallelFor(5, [&](std::size_t i) {
+        EXPECT_EQ(calling_thread_id, std::this_thread::get_id());
+        indices.emplace_back(i);
+    });
+
+    EXPECT_EQ(1, worker_pool.numThreads());
+    EXPECT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), indices);
+}
+
+TEST(WorkerPoolTest, zero_threads_uses_a_single_thread)
+{
+    WorkerPool worker_pool(0);
+    EXPECT_EQ(1, worker_pool.numThreads());
+}
+
+TEST(WorkerPoolTest, every_task_runs_exactly_once_in_many_batches)
+{
+    WorkerPool worker_pool(4);
+    const std::size_t num_tasks = 37;
+
+    for (unsigned int batch = 0; batch < 200; batch++)
+    {
+        std::vector<std::atomic<unsigned int>> num_calls(num_tasks);
+        worker_pool.parallelFor(num_tasks, [&](std::size_t i) { num_calls[i]++; });
+
+        for (std::size_t i = 0; i < num_tasks; i++)
+        {
+            ASSERT_EQ(1, num_calls[i]) << "Task " << i << " in batch " << batch;
+        }
+    }
+    EXPECT_EQ(4, worker_pool.numThreads());
+}
+
+TEST(WorkerPoolTest, tasks_run_in_multiple_threads)
+{
+    WorkerPool worker_pool(2);
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    std::atomic<unsigned int> num_waiting(0);
+
+    // Each task waits until both tasks have started, which can only happen if they
+    // run in different threads
+    worker_pool.parallelFor(2, [&](std::size_t i) {
+        num_waiting++;
+        while (num_waiting < 2)
+        {
+            std::this_thread::yield();
+        }
+        std::scoped_lock lock(mutex);
+        thread_ids.insert(std::this_thread::get_id());
+    });
+
+    EXPECT_EQ(2, thread_ids.size());
+}
+
+TEST(WorkerPoolTest, empty_batch_returns_immediately)
+{
+    WorkerPool worker_pool(3);
+    bool called = false;
+
+    worker_pool.parallelFor(0, [&](std::size_t i) { called = true; });
+
+    EXPECT_FALSE(called);
+}
@@ -0,0 +1,9 @@
+#include "software/networking/draw_commands_listener.h"
+
+DrawCommandsListener::DrawCommandsListener(unsigned short port)
+    : listener(port, [this](DrawCommandsProto draw_commands) {
+          sendValueToObservers(
+              std::make_shared<const DrawCommandsProto>(std::move(draw_commands)));
+      })
+{
+}
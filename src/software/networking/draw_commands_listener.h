@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+#include "software/multithreading/subject.h"
+#include "software/networking/threaded_proto_udp_listener.h"
+#include "software/proto/draw_commands_msg.pb.h"
+
+/**
+ * Receives the DrawCommandsProto sent by a ThreadedDrawCommandsSender in another
+ * process, and passes them on to its observers
+ */
+class DrawCommandsListener : public Subject<std::shared_ptr<const DrawCommandsProto>>
+{
+   public:
+    /**
+     * Creates a DrawCommandsListener that listens for draw commands on any local
+     * address with the given port
+     *
+     * @param port The port to listen for draw commands on
+     */
+    explicit DrawCommandsListener(unsigned short port);
+
+   private:
+    ThreadedProtoUdpListener<DrawCommandsProto> listener;
+};
@@ -0,0 +1,106 @@
+#include "software/networking/draw_commands_listener.h"
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "software/multithreading/observer.h"
+#include "software/networking/threaded_draw_commands_sender.h"
+
+class DrawCommandsObserver : public Observer<std::shared_ptr<const DrawCommandsProto>>
+{
+   public:
+    void receiveValue(std::shared_ptr<const DrawCommandsProto> draw_commands) override
+    {
+        std::scoped_lock lock(mutex);
+        received_draw_commands.emplace_back(std::move(draw_commands));
+    }
+
+    std::vector<std::shared_ptr<const DrawCommandsProto>> getReceivedDrawCommands()
+    {
+        std::scoped_lock lock(mutex);
+        return received_draw_commands;
+    }
+
+   private:
+    std::mutex mutex;
+    std::vector<std::shared_ptr<const DrawCommandsProto>> received_draw_commands;
+};
+
+class DrawCommandsListenerTest : public ::testing::Test
+{
+   protected:
+    static constexpr unsigned short PORT = 42191;
+
+    /**
+     * Sends the given draw commands and waits until the observer has received the
+     * given number of draw commands
+     */
+    void sendAndWait(const DrawCommandsProto& draw_commands,
+                     std::size_t num_draw_commands_expected)
+    {
+        sender->receiveValue(std::make_shared<const DrawCommandsProto>(draw_commands));
+        for (unsigned int i = 0; i < 500 && observer->getReceivedDrawCommands().size() <
+                                                num_draw_commands_expected;
+             i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    static DrawCommandsProto createLine(float length)
+    {
+        DrawCommandsProto draw_commands;
+        draw_commands.add_types(DrawCommandsProto::LINE);
+        draw_commands.add_outline_colours(0xFF00FF00);
+        draw_commands.add_outline_widths(2.0f);
+        draw_commands.add_fill_colours(0);
+        draw_commands.add_dashed(false);
+        draw_commands.add_num_values(4);
+        draw_commands.add_text_lengths(0);
+        for (float value : {0.0f, 0.0f, length, 0.0f})
+        {
+            draw_commands.add_values(value);
+        }
+        return draw_commands;
+    }
+
+    std::shared_ptr<DrawCommandsObserver> observer =
+        std::make_shared<DrawCommandsObserver>();
+    DrawCommandsListener listener{PORT};
+    std::shared_ptr<ThreadedDrawCommandsSender> sender =
+        std::make_shared<ThreadedDrawCommandsSender>("127.0.0.1", PORT);
+};
+
+TEST_F(DrawCommandsListenerTest, draw_commands_are_received_over_loopback)
+{
+    listener.registerObserver(observer);
+    DrawCommandsProto draw_commands = createLine(1.0f);
+
+    sendAndWait(draw_commands, 1);
+
+    auto received_draw_commands = observer->getReceivedDrawCommands();
+    ASSERT_EQ(1, received_draw_commands.size());
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+        draw_commands, *received_draw_commands.front()));
+}
+
+TEST_F(DrawCommandsListenerTest, draw_commands_too_large_for_a_packet_are_not_sent)
+{
+    listener.registerObserver(observer);
+    DrawCommandsProto too_large = createLine(1.0f);
+    too_large.set_text(
+        std::string(ProtoUdpListener<DrawCommandsProto>::MAX_BUFFER_LENGTH, 'a'));
+    DrawCommandsProto draw_commands = createLine(2.0f);
+
+    sendAndWait(too_large, 1);
+    sendAndWait(draw_commands, 1);
+
+    auto received_draw_commands = observer->getReceivedDrawCommands();
+    ASSERT_EQ(1, received_draw_commands.size());
+    EXPECT_TRUE(google::protobuf::util::MessageDifferencer::Equals(
+        draw_commands, *received_draw_commands.front()));
+}
@@ -44,6 +44,9 @@ class ProtoUdpListener
 
     virtual ~ProtoUdpListener();
 
+    // The largest packet that can be received, larger packets are truncated
+    static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
+
    private:
     /**
      * This function is setup as the callback to handle packets received over the network.
@@ -64,7 +67,6 @@ class ProtoUdpListener
     // The endpoint for the sender
     boost::asio::ip::udp::endpoint sender_endpoint_;
 
-    static constexpr unsigned int MAX_BUFFER_LENGTH = 9000;
     std::array<char, MAX_BUFFER_LENGTH> raw_received_data_;
 
     // The function to call on every received packet of ReceiveProtoT data
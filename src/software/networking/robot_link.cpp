@@ -0,0 +1,443 @@
+#include "software/networking/robot_link.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * Returns the given state of a robot or the ball in fixed point
+ *
+ * @param robot_id The id of the robot
+ * @param robot_state The state of the robot
+ * @param ball_state The state of the ball
+ *
+ * @return the given state in fixed point
+ */
+static TbotsProto::QuantizedRobotState quantizeRobotState(
+    uint32_t robot_id, const TbotsProto::RobotState& robot_state)
+{
+    TbotsProto::QuantizedRobotState quantized_state;
+    quantized_state.set_robot_id(robot_id);
+    quantized_state.set_x_mm(
+        quantizeRobotLinkValue(robot_state.global_position().x_meters()));
+    quantized_state.set_y_mm(
+        quantizeRobotLinkValue(robot_state.global_position().y_meters()));
+    quantized_state.set_orientation_mrad(
+        quantizeRobotLinkValue(robot_state.global_orientation().radians()));
+    quantized_state.set_velocity_x_mm_per_s(
+        quantizeRobotLinkValue(robot_state.global_velocity().x_component_meters()));
+    quantized_state.set_velocity_y_mm_per_s(
+        quantizeRobotLinkValue(robot_state.global_velocity().y_component_meters()));
+    quantized_state.set_angular_velocity_mrad_per_s(quantizeRobotLinkValue(
+        robot_state.global_angular_velocity().radians_per_second()));
+    return quantized_state;
+}
+
+static TbotsProto::QuantizedBallState quantizeBallState(
+    const TbotsProto::BallState& ball_state)
+{
+    TbotsProto::QuantizedBallState quantized_state;
+    quantized_state.set_x_mm(
+        quantizeRobotLinkValue(ball_state.global_position().x_meters()));
+    quantized_state.set_y_mm(
+        quantizeRobotLinkValue(ball_state.global_position().y_meters()));
+    quantized_state.set_velocity_x_mm_per_s(
+        quantizeRobotLinkValue(ball_state.global_velocity().x_component_meters()));
+    quantized_state.set_velocity_y_mm_per_s(
+        quantizeRobotLinkValue(ball_state.global_velocity().y_component_meters()));
+    return quantized_state;
+}
+
+/**
+ * Returns the difference between the given fixed point states, or their sum. Adding
+ * the difference between two states to the second state gives the first state.
+ *
+ * @param a The first state
+ * @param b The second state
+ *
+ * @return a - b, or a + b
+ */
+static TbotsProto::QuantizedRobotState subtractRobotStates(
+    const TbotsProto::QuantizedRobotState& a, const TbotsProto::QuantizedRobotState& b)
+{
+    TbotsProto::QuantizedRobotState difference;
+    difference.set_robot_id(a.robot_id());
+    difference.set_x_mm(a.x_mm() - b.x_mm());
+    difference.set_y_mm(a.y_mm() - b.y_mm());
+    difference.set_orientation_mrad(a.orientation_mrad() - b.orientation_mrad());
+    difference.set_velocity_x_mm_per_s(a.velocity_x_mm_per_s() - b.velocity_x_mm_per_s());
+    difference.set_velocity_y_mm_per_s(a.velocity_y_mm_per_s() - b.velocity_y_mm_per_s());
+    difference.set_angular_velocity_mrad_per_s(a.angular_velocity_mrad_per_s() -
+                                               b.angular_velocity_mrad_per_s());
+    return difference;
+}
+
+static TbotsProto::QuantizedRobotState addRobotStates(
+    const TbotsProto::QuantizedRobotState& a, const TbotsProto::QuantizedRobotState& b)
+{
+    TbotsProto::QuantizedRobotState sum;
+    sum.set_robot_id(a.robot_id());
+    sum.set_x_mm(a.x_mm() + b.x_mm());
+    sum.set_y_mm(a.y_mm() + b.y_mm());
+    sum.set_orientation_mrad(a.orientation_mrad() + b.orientation_mrad());
+    sum.set_velocity_x_mm_per_s(a.velocity_x_mm_per_s() + b.velocity_x_mm_per_s());
+    sum.set_velocity_y_mm_per_s(a.velocity_y_mm_per_s() + b.velocity_y_mm_per_s());
+    sum.set_angular_velocity_mrad_per_s(a.angular_velocity_mrad_per_s() +
+                                        b.angular_velocity_mrad_per_s());
+    return sum;
+}
+
+static TbotsProto::QuantizedBallState subtractBallStates(
+    const TbotsProto::QuantizedBallState& a, const TbotsProto::QuantizedBallState& b)
+{
+    TbotsProto::QuantizedBallState difference;
+    difference.set_x_mm(a.x_mm() - b.x_mm());
+    difference.set_y_mm(a.y_mm() - b.y_mm());
+    difference.set_velocity_x_mm_per_s(a.velocity_x_mm_per_s() - b.velocity_x_mm_per_s());
+    difference.set_velocity_y_mm_per_s(a.velocity_y_mm_per_s() - b.velocity_y_mm_per_s());
+    return difference;
+}
+
+static TbotsProto::QuantizedBallState addBallStates(
+    const TbotsProto::QuantizedBallState& a, const TbotsProto::QuantizedBallState& b)
+{
+    TbotsProto::QuantizedBallState sum;
+    sum.set_x_mm(a.x_mm() + b.x_mm());
+    sum.set_y_mm(a.y_mm() + b.y_mm());
+    sum.set_velocity_x_mm_per_s(a.velocity_x_mm_per_s() + b.velocity_x_mm_per_s());
+    sum.set_velocity_y_mm_per_s(a.velocity_y_mm_per_s() + b.velocity_y_mm_per_s());
+    return sum;
+}
+
+/**
+ * Returns whether the given fixed point difference between two states is zero
+ *
+ * @param difference The difference between two states
+ *
+ * @return whether the states are the same
+ */
+static bool isZero(const TbotsProto::QuantizedRobotState& difference)
+{
+    return difference.x_mm() == 0 && difference.y_mm() == 0 &&
+           difference.orientation_mrad() == 0 && difference.velocity_x_mm_per_s() == 0 &&
+           difference.velocity_y_mm_per_s() == 0 &&
+           difference.angular_velocity_mrad_per_s() == 0;
+}
+
+static bool isZero(const TbotsProto::QuantizedBallState& difference)
+{
+    return difference.x_mm() == 0 && difference.y_mm() == 0 &&
+           difference.velocity_x_mm_per_s() == 0 && difference.velocity_y_mm_per_s() == 0;
+}
+
+RobotLinkEncoder::RobotLinkEncoder()
+    : next_sequence_number(1), sent_states(), decoded_sequence_numbers()
+{
+}
+
+TbotsProto::RobotLinkFrame RobotLinkEncoder::createFrame(
+    const TbotsProto::Vision& vision, const TbotsProto::PrimitiveSet& primitive_set,
+    const DefendingSideProto& defending_side)
+{
+    RobotLinkState state;
+    for (const auto& [robot_id, robot_state] : vision.robot_states())
+    {
+        state.robot_states[robot_id] = quantizeRobotState(robot_id, robot_state);
+    }
+    if (vision.has_ball_state())
+    {
+        state.ball_state = quantizeBallState(vision.ball_state());
+    }
+    state.defending_positive_side =
+        defending_side.defending_side() == DefendingSideProto::POS_X;
+
+    TbotsProto::RobotLinkFrame frame;
+    frame.set_sequence_number(next_sequence_number);
+    *frame.mutable_time_sent()     = vision.time_sent();
+    *frame.mutable_primitive_set() = primitive_set;
+    // The robots have no use for the latency trace
+    frame.mutable_primitive_set()->clear_latency_trace();
+
+    std::optional<uint32_t> reference_sequence_number = findReferenceSequenceNumber();
+    // Key frames are sent periodically so that new robots can start decoding frames. A
+    // delta frame can not say that the ball has disappeared, so a key frame is sent
+    // instead.
+    if (next_sequence_number % KEY_FRAME_PERIOD == 1 ||
+        (reference_sequence_number &&
+         sent_states.at(*reference_sequence_number).ball_state && !state.ball_state))
+    {
+        reference_sequence_number = std::nullopt;
+    }
+
+    if (reference_sequence_number)
+    {
+        const RobotLinkState& reference_state =
+            sent_states.at(*reference_sequence_number);
+        frame.set_reference_sequence_number(*reference_sequence_number);
+
+        for (const auto& [robot_id, robot_state] : state.robot_states)
+        {
+            auto reference_robot_state = reference_state.robot_states.find(robot_id);
+            if (reference_robot_state == reference_state.robot_states.end())
+            {
+                *frame.add_robot_states() = robot_state;
+                continue;
+            }
+            TbotsProto::QuantizedRobotState difference =
+                subtractRobotStates(robot_state, reference_robot_state->second);
+            if (!isZero(difference))
+            {
+                *frame.add_robot_states() = difference;
+            }
+        }
+        for (const auto& [robot_id, robot_state] : reference_state.robot_states)
+        {
+            if (state.robot_states.find(robot_id) == state.robot_states.end())
+            {
+                frame.add_removed_robot_ids(robot_id);
+            }
+        }
+
+        if (state.ball_state && reference_state.ball_state)
+        {
+            TbotsProto::QuantizedBallState difference =
+                subtractBallStates(*state.ball_state, *reference_state.ball_state);
+            if (!isZero(difference))
+            {
+                *frame.mutable_ball_state() = difference;
+            }
+        }
+        else if (state.ball_state)
+        {
+            *frame.mutable_ball_state() = *state.ball_state;
+        }
+
+        if (state.defending_positive_side != reference_state.defending_positive_side)
+        {
+            frame.mutable_defending_side()->set_defending_positive_side(
+                state.defending_positive_side);
+        }
+    }
+    else
+    {
+        for (const auto& [robot_id, robot_state] : state.robot_states)
+        {
+            *frame.add_robot_states() = robot_state;
+        }
+        if (state.ball_state)
+        {
+            *frame.mutable_ball_state() = *state.ball_state;
+        }
+        frame.mutable_defending_side()->set_defending_positive_side(
+            state.defending_positive_side);
+    }
+
+    sent_states[next_sequence_number] = std::move(state);
+    while (sent_states.size() > MAX_NUM_REFERENCE_FRAMES)
+    {
+        sent_states.erase(sent_states.begin());
+    }
+    next_sequence_number++;
+
+    return frame;
+}
+
+void RobotLinkEncoder::acknowledge(uint32_t robot_id, const TbotsProto::RobotLinkAck& ack)
+{
+    if (ack.last_sequence_number() == 0 ||
+        ack.last_sequence_number() >= next_sequence_number)
+    {
+        // The robot has not decoded any frames, or the ack is not for frames from this
+        // encoder
+        return;
+    }
+
+    std::set<uint32_t>& decoded = decoded_sequence_numbers[robot_id];
+    decoded.insert(ack.last_sequence_number());
+    for (uint32_t i = 0; i < 32 && i + 1 < ack.last_sequence_number(); i++)
+    {
+        if (ack.previous_frames_decoded() & (1u << i))
+        {
+            decoded.insert(ack.last_sequence_number() - 1 - i);
+        }
+    }
+
+    // Only the frames that can still be used as references are needed
+    if (!sent_states.empty())
+    {
+        decoded.erase(decoded.begin(), decoded.lower_bound(sent_states.begin()->first));
+    }
+}
+
+std::optional<uint32_t> RobotLinkEncoder::findReferenceSequenceNumber() const
+{
+    // Robots that have not decoded any of the recently sent frames are not waited for.
+    // They can start decoding frames again from the next key frame.
+    std::vector<const std::set<uint32_t>*> robots_decoded;
+    for (const auto& [robot_id, decoded] : decoded_sequence_numbers)
+    {
+        if (!decoded.empty() && !sent_states.empty() &&
+            *decoded.rbegin() >= sent_states.begin()->first)
+        {
+            robots_decoded.emplace_back(&decoded);
+        }
+    }
+    if (robots_decoded.empty())
+    {
+        return std::nullopt;
+    }
+
+    for (auto sent_state = sent_states.rbegin(); sent_state != sent_states.rend();
+         sent_state++)
+    {
+        const uint32_t sequence_number = sent_state->first;
+        if (std::all_of(robots_decoded.begin(), robots_decoded.end(),
+                        [sequence_number](const std::set<uint32_t>* decoded) {
+                            return decoded->count(sequence_number) > 0;
+                        }))
+        {
+            return sequence_number;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<RobotLinkMessages> RobotLinkDecoder::decode(
+    const TbotsProto::RobotLinkFrame& frame)
+{
+    RobotLinkState state;
+    if (frame.reference_sequence_number() == 0)
+    {
+        for (const auto& robot_state : frame.robot_states())
+        {
+            state.robot_states[robot_state.robot_id()] = robot_state;
+        }
+        if (frame.has_ball_state())
+        {
+            state.ball_state = frame.ball_state();
+        }
+        state.defending_positive_side = frame.defending_side().defending_positive_side();
+    }
+    else
+    {
+        auto reference_state = decoded_states.find(frame.reference_sequence_number());
+        if (reference_state == decoded_states.end())
+        {
+            return std::nullopt;
+        }
+
+        state = reference_state->second;
+        for (const auto& robot_state : frame.robot_states())
+        {
+            auto existing_state = state.robot_states.find(robot_state.robot_id());
+            if (existing_state == state.robot_states.end())
+            {
+                state.robot_states[robot_state.robot_id()] = robot_state;
+            }
+            else
+            {
+                existing_state->second =
+                    addRobotStates(existing_state->second, robot_state);
+            }
+        }
+        for (uint32_t robot_id : frame.removed_robot_ids())
+        {
+            state.robot_states.erase(robot_id);
+        }
+        if (frame.has_ball_state())
+        {
+            state.ball_state = state.ball_state
+                                   ? addBallStates(*state.ball_state, frame.ball_state())
+                                   : frame.ball_state();
+        }
+        if (frame.has_defending_side())
+        {
+            state.defending_positive_side =
+                frame.defending_side().defending_positive_side();
+        }
+    }
+
+    RobotLinkMessages messages;
+    *messages.vision.mutable_time_sent() = frame.time_sent();
+    auto& robot_states_map               = *messages.vision.mutable_robot_states();
+    for (const auto& [robot_id, robot_state] : state.robot_states)
+    {
+        TbotsProto::RobotState& vision_robot_state = robot_states_map[robot_id];
+        vision_robot_state.mutable_global_position()->set_x_meters(
+            static_cast<float>(dequantizeRobotLinkValue(robot_state.x_mm())));
+        vision_robot_state.mutable_global_position()->set_y_meters(
+            static_cast<float>(dequantizeRobotLinkValue(robot_state.y_mm())));
+        vision_robot_state.mutable_global_orientation()->set_radians(
+            static_cast<float>(dequantizeRobotLinkValue(robot_state.orientation_mrad())));
+        vision_robot_state.mutable_global_velocity()->set_x_component_meters(
+            static_cast<float>(
+                dequantizeRobotLinkValue(robot_state.velocity_x_mm_per_s())));
+        vision_robot_state.mutable_global_velocity()->set_y_component_meters(
+            static_cast<float>(
+                dequantizeRobotLinkValue(robot_state.velocity_y_mm_per_s())));
+        vision_robot_state.mutable_global_angular_velocity()->set_radians_per_second(
+            static_cast<float>(
+                dequantizeRobotLinkValue(robot_state.angular_velocity_mrad_per_s())));
+    }
+    if (state.ball_state)
+    {
+        TbotsProto::BallState& ball_state = *messages.vision.mutable_ball_state();
+        ball_state.mutable_global_position()->set_x_meters(
+            static_cast<float>(dequantizeRobotLinkValue(state.ball_state->x_mm())));
+        ball_state.mutable_global_position()->set_y_meters(
+            static_cast<float>(dequantizeRobotLinkValue(state.ball_state->y_mm())));
+        ball_state.mutable_global_velocity()->set_x_component_meters(static_cast<float>(
+            dequantizeRobotLinkValue(state.ball_state->velocity_x_mm_per_s())));
+        ball_state.mutable_global_velocity()->set_y_component_meters(static_cast<float>(
+            dequantizeRobotLinkValue(state.ball_state->velocity_y_mm_per_s())));
+    }
+    messages.primitive_set = frame.primitive_set();
+    messages.defending_side.set_defending_side(state.defending_positive_side
+                                                   ? DefendingSideProto::POS_X
+                                                   : DefendingSideProto::NEG_X);
+
+    decoded_states[frame.sequence_number()] = std::move(state);
+    while (decoded_states.size() > RobotLinkEncoder::MAX_NUM_REFERENCE_FRAMES)
+    {
+        decoded_states.erase(decoded_states.begin());
+    }
+
+    return messages;
+}
+
+TbotsProto::RobotLinkAck RobotLinkDecoder::createAck() const
+{
+    TbotsProto::RobotLinkAck ack;
+    if (decoded_states.empty())
+    {
+        return ack;
+    }
+
+    const uint32_t last_sequence_number = decoded_states.rbegin()->first;
+    uint32_t previous_frames_decoded    = 0;
+    for (const auto& [sequence_number, state] : decoded_states)
+    {
+        if (sequence_number < last_sequence_number &&
+            last_sequence_number - sequence_number <= 32)
+        {
+            previous_frames_decoded |= 1u << (last_sequence_number - sequence_number - 1);
+        }
+    }
+    ack.set_last_sequence_number(last_sequence_number);
+    ack.set_previous_frames_decoded(previous_frames_decoded);
+    return ack;
+}
+
+int32_t quantizeRobotLinkValue(double value)
+{
+    const double quantized_value = std::round(value * 1000.0);
+    return static_cast<int32_t>(std::clamp(
+        quantized_value, static_cast<double>(std::numeric_limits<int32_t>::min()),
+        static_cast<double>(std::numeric_limits<int32_t>::max())));
+}
+
+double dequantizeRobotLinkValue(int32_t value)
+{
+    return static_cast<double>(value) / 1000.0;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <set>
+
+#include "shared/proto/robot_link_msg.pb.h"
+#include "shared/proto/tbots_software_msgs.pb.h"
+#include "software/proto/defending_side_msg.pb.h"
+
+/**
+ * The absolute state of everything in a RobotLinkFrame that delta frames are encoded
+ * relative to, in fixed point
+ */
+struct RobotLinkState
+{
+    // The state of each robot, by robot id. The robot_id of each state is also set.
+    std::map<uint32_t, TbotsProto::QuantizedRobotState> robot_states;
+    std::optional<TbotsProto::QuantizedBallState> ball_state;
+    bool defending_positive_side = false;
+};
+
+/**
+ * Everything the robots need for a single tick of the AI, as decoded from a
+ * RobotLinkFrame
+ */
+struct RobotLinkMessages
+{
+    TbotsProto::Vision vision;
+    TbotsProto::PrimitiveSet primitive_set;
+    DefendingSideProto defending_side;
+};
+
+/**
+ * The RobotLinkEncoder combines the vision, primitives and defending side for a tick of
+ * the AI into a single RobotLinkFrame, so that the robots only receive a single datagram
+ * per tick.
+ *
+ * Positions and velocities are quantized to millimetres and milliradians, and each
+ * frame is encoded relative to the most recent frame that every robot has acknowledged
+ * decoding, so that usually only the small changes since that frame are sent. If there
+ * is no such frame, or periodically so that new robots can start decoding frames, a key
+ * frame with the absolute state of everything is sent instead.
+ *
+ * NOTE: The backends do not send RobotLinkFrames yet. They will once the robot firmware
+ * can decode them and acknowledge the frames it has decoded.
+ */
+class RobotLinkEncoder
+{
+   public:
+    /**
+     * Creates a new RobotLinkEncoder that has not sent any frames
+     */
+    explicit RobotLinkEncoder();
+
+    /**
+     * Creates the frame to send for the next tick of the AI
+     *
+     * @param vision The most recent vision for the robots
+     * @param primitive_set The primitives for the robots
+     * @param defending_side The side of the field the robots are defending
+     *
+     * @return the frame to send to the robots
+     */
+    TbotsProto::RobotLinkFrame createFrame(const TbotsProto::Vision& vision,
+                                           const TbotsProto::PrimitiveSet& primitive_set,
+                                           const DefendingSideProto& defending_side);
+
+    /**
+     * Records which frames the given robot has decoded, so that later frames can be
+     * encoded relative to them
+     *
+     * @param robot_id The id of the robot that sent the acknowledgement
+     * @param ack The acknowledgement the robot sent
+     */
+    void acknowledge(uint32_t robot_id, const TbotsProto::RobotLinkAck& ack);
+
+    // Frames are only encoded relative to one of this many most recently sent frames,
+    // and robots are only waited for if they have acknowledged one of them
+    static constexpr unsigned int MAX_NUM_REFERENCE_FRAMES = 64;
+    // A key frame is sent at least this often, in frames
+    static constexpr unsigned int KEY_FRAME_PERIOD = 60;
+
+   private:
+    /**
+     * Returns the sequence number of the most recent frame that every robot that has
+     * recently acknowledged a frame has decoded, if there is one
+     *
+     * @return the sequence number of the frame to encode the next frame relative to
+     */
+    std::optional<uint32_t> findReferenceSequenceNumber() const;
+
+    uint32_t next_sequence_number;
+    // The states in the most recently sent frames, by sequence number
+    std::map<uint32_t, RobotLinkState> sent_states;
+    // The sequence numbers of the recently sent frames each robot has decoded, by
+    // robot id
+    std::map<uint32_t, std::set<uint32_t>> decoded_sequence_numbers;
+};
+
+/**
+ * The RobotLinkDecoder decodes the RobotLinkFrames created by a RobotLinkEncoder, as a
+ * robot would. Frames may be lost or arrive out of order.
+ */
+class RobotLinkDecoder
+{
+   public:
+    /**
+     * Creates a new RobotLinkDecoder that has not decoded any frames
+     */
+    explicit RobotLinkDecoder() = default;
+
+    /**
+     * Decodes the given frame
+     *
+     * @param frame The frame to decode
+     *
+     * @return the messages in the frame, or std::nullopt if the frame is a delta frame
+     * relative to a frame that has not been decoded
+     */
+    std::optional<RobotLinkMessages> decode(const TbotsProto::RobotLinkFrame& frame);
+
+    /**
+     * Returns the acknowledgement to send of the frames that have been decoded
+     *
+     * @return the acknowledgement of the frames that have been decoded
+     */
+    TbotsProto::RobotLinkAck createAck() const;
+
+   private:
+    // The states in the most recently decoded frames, by sequence number
+    std::map<uint32_t, RobotLinkState> decoded_states;
+};
+
+/**
+ * Converts between values in SI units and the fixed point values in RobotLinkFrames,
+ * which are in thousandths of the SI unit
+ *
+ * @param value The value to convert
+ *
+ * @return the converted value
+ */
+int32_t quantizeRobotLinkValue(double value);
+double dequantizeRobotLinkValue(int32_t value);
@@ -0,0 +1,359 @@
+#include "software/networking/robot_link.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "software/networking/threaded_proto_udp_listener.h"
+#include "software/networking/threaded_proto_udp_sender.h"
+
+/**
+ * Creates a Vision with the given robots and a ball
+ *
+ * @param robot_positions The x and y of each robot, by robot id
+ * @param ball_x The x of the ball
+ *
+ * @return a Vision with the given robots and ball
+ */
+static TbotsProto::Vision createVision(
+    const std::map<uint32_t, std::pair<float, float>>& robot_positions, float ball_x)
+{
+    TbotsProto::Vision vision;
+    vision.mutable_time_sent()->set_epoch_timestamp_seconds(100.0);
+    for (const auto& [robot_id, position] : robot_positions)
+    {
+        TbotsProto::RobotState& robot_state = (*vision.mutable_robot_states())[robot_id];
+        robot_state.mutable_global_position()->set_x_meters(position.first);
+        robot_state.mutable_global_position()->set_y_meters(position.second);
+        robot_state.mutable_global_orientation()->set_radians(1.5f);
+        robot_state.mutable_global_velocity()->set_x_component_meters(-0.25f);
+    }
+    vision.mutable_ball_state()->mutable_global_position()->set_x_meters(ball_x);
+    vision.mutable_ball_state()->mutable_global_velocity()->set_y_component_meters(2.0f);
+    return vision;
+}
+
+static DefendingSideProto createDefendingSide(DefendingSideProto::FieldSide side)
+{
+    DefendingSideProto defending_side;
+    defending_side.set_defending_side(side);
+    return defending_side;
+}
+
+/**
+ * Checks that the given vision is the same as the expected vision, to within the
+ * precision of a RobotLinkFrame
+ *
+ * @param expected The expected vision
+ * @param vision The vision to check
+ */
+static void expectVisionEqual(const TbotsProto::Vision& expected,
+                              const TbotsProto::Vision& vision)
+{
+    ASSERT_EQ(expected.robot_states_size(), vision.robot_states_size());
+    for (const auto& [robot_id, expected_state] : expected.robot_states())
+    {
+        ASSERT_EQ(1, vision.robot_states().count(robot_id)) << "Robot " << robot_id;
+        const TbotsProto::RobotState& state = vision.robot_states().at(robot_id);
+        EXPECT_NEAR(expected_state.global_position().x_meters(),
+                    state.global_position().x_meters(), 5e-4);
+        EXPECT_NEAR(expected_state.global_position().y_meters(),
+                    state.global_position().y_meters(), 5e-4);
+        EXPECT_NEAR(expected_state.global_orientation().radians(),
+                    state.global_orientation().radians(), 5e-4);
+        EXPECT_NEAR(expected_state.global_velocity().x_component_meters(),
+                    state.global_velocity().x_component_meters(), 5e-4);
+    }
+    EXPECT_NEAR(expected.ball_state().global_position().x_meters(),
+                vision.ball_state().global_position().x_meters(), 5e-4);
+    EXPECT_NEAR(expected.ball_state().global_velocity().y_component_meters(),
+                vision.ball_state().global_velocity().y_component_meters(), 5e-4);
+    EXPECT_EQ(expected.time_sent().epoch_timestamp_seconds(),
+              vision.time_sent().epoch_timestamp_seconds());
+}
+
+class RobotLinkTest : public ::testing::Test
+{
+   protected:
+    RobotLinkTest() : primitive_set()
+    {
+        (*primitive_set.mutable_robot_primitives())[1].mutable_stop();
+    }
+
+    TbotsProto::PrimitiveSet primitive_set;
+    RobotLinkEncoder encoder;
+};
+
+TEST_F(RobotLinkTest, first_frame_is_a_key_frame)
+{
+    TbotsProto::Vision vision =
+        createVision({{1, {1.0f, 2.0f}}, {2, {-3.0f, 0.5f}}}, 0.1f);
+
+    TbotsProto::RobotLinkFrame frame = encoder.createFrame(
+        vision, primitive_set, createDefendingSide(DefendingSideProto::POS_X));
+
+    EXPECT_EQ(1, frame.sequence_number());
+    EXPECT_EQ(0, frame.reference_sequence_number());
+    EXPECT_EQ(2, frame.robot_states_size());
+    EXPECT_TRUE(frame.has_defending_side());
+
+    RobotLinkDecoder decoder;
+    std::optional<RobotLinkMessages> messages = decoder.decode(frame);
+    ASSERT_TRUE(messages);
+    expectVisionEqual(vision, messages->vision);
+    EXPECT_EQ(1, messages->primitive_set.robot_primitives().count(1));
+    EXPECT_EQ(DefendingSideProto::POS_X, messages->defending_side.defending_side());
+}
+
+TEST_F(RobotLinkTest, frames_are_encoded_relative_to_the_acknowledged_frame)
+{
+    RobotLinkDecoder decoder;
+    TbotsProto::Vision first_vision =
+        createVision({{1, {1.0f, 2.0f}}, {2, {-3.0f, 0.5f}}}, 0.1f);
+    TbotsProto::RobotLinkFrame key_frame = encoder.createFrame(
+        first_vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X));
+    ASSERT_TRUE(decoder.decode(key_frame));
+    encoder.acknowledge(1, decoder.createAck());
+
+    // Only robot 2 and the ball move
+    TbotsProto::Vision second_vision =
+        createVision({{1, {1.0f, 2.0f}}, {2, {-2.9f, 0.5f}}}, 0.2f);
+    TbotsProto::RobotLinkFrame delta_frame = encoder.createFrame(
+        second_vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X));
+
+    EXPECT_EQ(1, delta_frame.reference_sequence_number());
+    ASSERT_EQ(1, delta_frame.robot_states_size());
+    EXPECT_EQ(2, delta_frame.robot_states(0).robot_id());
+    EXPECT_EQ(100, delta_frame.robot_states(0).x_mm());
+    EXPECT_EQ(0, delta_frame.robot_states(0).y_mm());
+    EXPECT_EQ(100, delta_frame.ball_state().x_mm());
+    // The defending side has not changed
+    EXPECT_FALSE(delta_frame.has_defending_side());
+    EXPECT_LT(delta_frame.ByteSizeLong(), key_frame.ByteSizeLong());
+
+    std::optional<RobotLinkMessages> messages = decoder.decode(delta_frame);
+    ASSERT_TRUE(messages);
+    expectVisionEqual(second_vision, messages->vision);
+    EXPECT_EQ(DefendingSideProto::NEG_X, messages->defending_side.defending_side());
+}
+
+TEST_F(RobotLinkTest, defending_side_is_only_sent_when_it_changes)
+{
+    RobotLinkDecoder decoder;
+    TbotsProto::Vision vision = createVision({{1, {1.0f, 2.0f}}}, 0.1f);
+    ASSERT_TRUE(decoder.decode(encoder.createFrame(
+        vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X))));
+    encoder.acknowledge(1, decoder.createAck());
+
+    TbotsProto::RobotLinkFrame frame = encoder.createFrame(
+        vision, primitive_set, createDefendingSide(DefendingSideProto::POS_X));
+    ASSERT_TRUE(frame.has_defending_side());
+    std::optional<RobotLinkMessages> messages = decoder.decode(frame);
+    ASSERT_TRUE(messages);
+    EXPECT_EQ(DefendingSideProto::POS_X, messages->defending_side.defending_side());
+    encoder.acknowledge(1, decoder.createAck());
+
+    frame = encoder.createFrame(vision, primitive_set,
+                                createDefendingSide(DefendingSideProto::POS_X));
+    EXPECT_FALSE(frame.has_defending_side());
+    EXPECT_EQ(0, frame.robot_states_size());
+    EXPECT_FALSE(frame.has_ball_state());
+    messages = decoder.decode(frame);
+    ASSERT_TRUE(messages);
+    EXPECT_EQ(DefendingSideProto::POS_X, messages->defending_side.defending_side());
+}
+
+TEST_F(RobotLinkTest, robots_that_appear_and_disappear)
+{
+    RobotLinkDecoder decoder;
+    ASSERT_TRUE(decoder.decode(encoder.createFrame(
+        createVision({{1, {1.0f, 2.0f}}, {2, {-3.0f, 0.5f}}}, 0.1f), primitive_set,
+        createDefendingSide(DefendingSideProto::NEG_X))));
+    encoder.acknowledge(1, decoder.createAck());
+
+    TbotsProto::Vision vision =
+        createVision({{2, {-3.0f, 0.5f}}, {5, {4.0f, 1.0f}}}, 0.1f);
+    TbotsProto::RobotLinkFrame frame = encoder.createFrame(
+        vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X));
+
+    ASSERT_EQ(1, frame.removed_robot_ids_size());
+    EXPECT_EQ(1, frame.removed_robot_ids(0));
+    ASSERT_EQ(1, frame.robot_states_size());
+    EXPECT_EQ(5, frame.robot_states(0).robot_id());
+    EXPECT_EQ(4000, frame.robot_states(0).x_mm());
+    std::optional<RobotLinkMessages> messages = decoder.decode(frame);
+    ASSERT_TRUE(messages);
+    expectVisionEqual(vision, messages->vision);
+}
+
+TEST_F(RobotLinkTest, frames_are_encoded_relative_to_a_frame_every_robot_decoded)
+{
+    RobotLinkDecoder decoder_1;
+    RobotLinkDecoder decoder_2;
+    std::vector<TbotsProto::RobotLinkFrame> frames;
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        frames.emplace_back(encoder.createFrame(
+            createVision({{1, {0.1f * static_cast<float>(i), 0.0f}}}, 0.0f),
+            primitive_set, createDefendingSide(DefendingSideProto::NEG_X)));
+    }
+    // Robot 1 decodes frames 1, 2 and 4, and robot 2 decodes frames 1, 2 and 3
+    for (unsigned int i : {0, 1, 3})
+    {
+        ASSERT_TRUE(decoder_1.decode(frames[i]));
+    }
+    for (unsigned int i : {0, 1, 2})
+    {
+        ASSERT_TRUE(decoder_2.decode(frames[i]));
+    }
+    encoder.acknowledge(1, decoder_1.createAck());
+    encoder.acknowledge(2, decoder_2.createAck());
+
+    TbotsProto::RobotLinkFrame frame =
+        encoder.createFrame(createVision({{1, {1.0f, 0.0f}}}, 0.0f), primitive_set,
+                            createDefendingSide(DefendingSideProto::NEG_X));
+
+    EXPECT_EQ(2, frame.reference_sequence_number());
+    EXPECT_TRUE(decoder_1.decode(frame));
+    EXPECT_TRUE(decoder_2.decode(frame));
+}
+
+TEST_F(RobotLinkTest, delta_frame_can_not_be_decoded_without_its_reference_frame)
+{
+    RobotLinkDecoder decoder;
+    RobotLinkDecoder other_decoder;
+    ASSERT_TRUE(decoder.decode(
+        encoder.createFrame(createVision({{1, {1.0f, 2.0f}}}, 0.1f), primitive_set,
+                            createDefendingSide(DefendingSideProto::NEG_X))));
+    encoder.acknowledge(1, decoder.createAck());
+
+    TbotsProto::RobotLinkFrame delta_frame =
+        encoder.createFrame(createVision({{1, {1.5f, 2.0f}}}, 0.1f), primitive_set,
+                            createDefendingSide(DefendingSideProto::NEG_X));
+
+    ASSERT_NE(0, delta_frame.reference_sequence_number());
+    EXPECT_FALSE(other_decoder.decode(delta_frame));
+    EXPECT_EQ(0, other_decoder.createAck().last_sequence_number());
+}
+
+TEST_F(RobotLinkTest, key_frames_are_sent_periodically_and_without_acknowledgements)
+{
+    RobotLinkDecoder decoder;
+    TbotsProto::Vision vision = createVision({{1, {1.0f, 2.0f}}}, 0.1f);
+    for (unsigned int i = 1; i <= RobotLinkEncoder::KEY_FRAME_PERIOD * 2 + 1; i++)
+    {
+        TbotsProto::RobotLinkFrame frame = encoder.createFrame(
+            vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X));
+        if (i % RobotLinkEncoder::KEY_FRAME_PERIOD == 1 || i <= 10)
+        {
+            EXPECT_EQ(0, frame.reference_sequence_number()) << "Frame " << i;
+        }
+        else
+        {
+            EXPECT_NE(0, frame.reference_sequence_number()) << "Frame " << i;
+        }
+
+        // The robot stops acknowledging frames for a while
+        if (i >= 10)
+        {
+            ASSERT_TRUE(decoder.decode(frame));
+            encoder.acknowledge(1, decoder.createAck());
+        }
+    }
+}
+
+TEST_F(RobotLinkTest, robot_that_stops_acknowledging_frames_is_not_waited_for)
+{
+    RobotLinkDecoder decoder_1;
+    RobotLinkDecoder decoder_2;
+    TbotsProto::Vision vision = createVision({{1, {1.0f, 2.0f}}}, 0.1f);
+
+    TbotsProto::RobotLinkFrame frame = encoder.createFrame(
+        vision, primitive_set, createDefendingSide(DefendingSideProto::NEG_X));
+    ASSERT_TRUE(decoder_1.decode(frame));
+    ASSERT_TRUE(decoder_2.decode(frame));
+    encoder.acknowledge(1, decoder_1.createAck());
+    encoder.acknowledge(2, decoder_2.createAck());
+
+    for (unsigned int i = 0; i < RobotLinkEncoder::MAX_NUM_REFERENCE_FRAMES + 1; i++)
+    {
+        frame = encoder.createFrame(vision, primitive_set,
+                                    createDefendingSide(DefendingSideProto::NEG_X));
+        ASSERT_TRUE(decoder_1.decode(frame));
+        encoder.acknowledge(1, decoder_1.createAck());
+    }
+
+    frame = encoder.createFrame(vision, primitive_set,
+                                createDefendingSide(DefendingSideProto::NEG_X));
+    EXPECT_EQ(frame.sequence_number() - 1, frame.reference_sequence_number());
+}
+
+TEST(RobotLinkLoopbackTest, fake_robot_decodes_every_frame_sent_over_loopback)
+{
+    static constexpr unsigned short PORT     = 42190;
+    static constexpr unsigned int NUM_FRAMES = 100;
+
+    std::mutex mutex;
+    RobotLinkEncoder encoder;
+    RobotLinkDecoder decoder;
+    std::vector<RobotLinkMessages> received_messages;
+    unsigned int num_delta_frames_received = 0;
+
+    // The fake robot decodes every frame it receives and acknowledges it straight away
+    ThreadedProtoUdpListener<TbotsProto::RobotLinkFrame> fake_robot(
+        "127.0.0.1", PORT,
+        [&](TbotsProto::RobotLinkFrame frame) {
+            std::scoped_lock lock(mutex);
+            std::optional<RobotLinkMessages> messages = decoder.decode(frame);
+            if (messages)
+            {
+                received_messages.emplace_back(*messages);
+                num_delta_frames_received += frame.reference_sequence_number() != 0;
+                encoder.acknowledge(1, decoder.createAck());
+            }
+        },
+        false);
+    ThreadedProtoUdpSender<TbotsProto::RobotLinkFrame> sender("127.0.0.1", PORT, false);
+
+    TbotsProto::PrimitiveSet primitive_set;
+    (*primitive_set.mutable_robot_primitives())[1].mutable_estop();
+    std::vector<TbotsProto::Vision> sent_visions;
+    for (unsigned int i = 0; i < NUM_FRAMES; i++)
+    {
+        sent_visions.emplace_back(createVision(
+            {{1, {0.01f * static_cast<float>(i), 1.0f}}, {2, {-1.0f, -1.0f}}},
+            0.02f * static_cast<float>(i)));
+        TbotsProto::RobotLinkFrame frame;
+        {
+            std::scoped_lock lock(mutex);
+            frame = encoder.createFrame(sent_visions.back(), primitive_set,
+                                        createDefendingSide(DefendingSideProto::NEG_X));
+        }
+        sender.sendProto(frame);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    for (unsigned int i = 0; i < 500; i++)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            if (received_messages.size() == NUM_FRAMES)
+            {
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    std::scoped_lock lock(mutex);
+    ASSERT_EQ(NUM_FRAMES, received_messages.size());
+    for (unsigned int i = 0; i < NUM_FRAMES; i++)
+    {
+        expectVisionEqual(sent_visions[i], received_messages[i].vision);
+        EXPECT_EQ(1, received_messages[i].primitive_set.robot_primitives().count(1));
+    }
+    // Most frames are encoded relative to a frame the fake robot acknowledged
+    EXPECT_GT(num_delta_frames_received, NUM_FRAMES / 2);
+}
@@ -0,0 +1,33 @@
+#include "software/networking/threaded_draw_commands_sender.h"
+
+#include "software/logger/logger.h"
+#include "software/networking/proto_udp_listener.h"
+
+ThreadedDrawCommandsSender::ThreadedDrawCommandsSender(const std::string& ip_address,
+                                                       unsigned short port)
+    : LastInFirstOutThreadedObserver<std::shared_ptr<const DrawCommandsProto>>(),
+      sender(ip_address, port, false),
+      warned_draw_commands_too_large(false)
+{
+}
+
+void ThreadedDrawCommandsSender::onValueReceived(
+    std::shared_ptr<const DrawCommandsProto> draw_commands)
+{
+    // Larger packets would be truncated by the listener, so there is no point
+    // sending them
+    if (draw_commands->ByteSizeLong() >
+        ProtoUdpListener<DrawCommandsProto>::MAX_BUFFER_LENGTH)
+    {
+        if (!warned_draw_commands_too_large)
+        {
+            LOG(WARNING) << "Not sending draw commands of "
+                         << draw_commands->ByteSizeLong()
+                         << " bytes, since they do not fit in a single packet";
+            warned_draw_commands_too_large = true;
+        }
+        return;
+    }
+
+    sender.sendProto(*draw_commands);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "software/multithreading/last_in_first_out_threaded_observer.h"
+#include "software/networking/threaded_proto_udp_sender.h"
+#include "software/proto/draw_commands_msg.pb.h"
+
+/**
+ * Sends the DrawCommandsProto it observes over the network, so that they can be
+ * rendered by a GUI running in another process. Only the most recent commands are
+ * sent, so the subject they come from is never held up by the network.
+ */
+class ThreadedDrawCommandsSender
+    : public LastInFirstOutThreadedObserver<std::shared_ptr<const DrawCommandsProto>>
+{
+   public:
+    /**
+     * Creates a ThreadedDrawCommandsSender that sends draw commands to the given
+     * address and port
+     *
+     * @param ip_address The ip address to send the draw commands to
+     * (IPv4 in dotted decimal or IPv6 in hex string)
+     * @param port The port to send the draw commands on
+     */
+    explicit ThreadedDrawCommandsSender(const std::string& ip_address,
+                                        unsigned short port);
+
+   private:
+    void onValueReceived(std::shared_ptr<const DrawCommandsProto> draw_commands) override;
+
+    ThreadedProtoUdpSender<DrawCommandsProto> sender;
+    // Whether we have warned that the draw commands are too large to send
+    bool warned_draw_commands_too_large;
+};
@@ -0,0 +1,289 @@
+#include "software/physics/ball_predictor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "shared/constants.h"
+
+BallPredictor::BallPredictor(const Rectangle& field_boundary,
+                             const BallModelParameters& parameters)
+    : field_boundary(field_boundary), parameters(parameters)
+{
+}
+
+std::vector<BallState> BallPredictor::predictBallStates(
+    const BallState& ball_state, const std::vector<Duration>& durations_in_future,
+    const std::vector<Point>& robot_positions, std::optional<double> initial_kick_speed,
+    const std::optional<BallFlight>& flight) const
+{
+    double end_time_seconds = 0.0;
+    for (const auto& duration : durations_in_future)
+    {
+        end_time_seconds = std::max(end_time_seconds, duration.toSeconds());
+    }
+    const std::vector<MotionSegment> segments = calculateMotionSegments(
+        ball_state, end_time_seconds, robot_positions, initial_kick_speed, flight);
+
+    std::vector<BallState> ball_states;
+    ball_states.reserve(durations_in_future.size());
+    for (const auto& duration : durations_in_future)
+    {
+        const double seconds = std::max(0.0, duration.toSeconds());
+        // The last segment that starts at or before the given time
+        auto segment = std::upper_bound(segments.begin(), segments.end(), seconds,
+                                        [](double time, const MotionSegment& segment) {
+                                            return time < segment.start_time_seconds;
+                                        });
+        segment      = std::prev(segment);
+        ball_states.emplace_back(calculateBallStateInSegment(
+            *segment, seconds - segment->start_time_seconds, flight));
+    }
+
+    return ball_states;
+}
+
+BallState BallPredictor::predictBallState(const BallState& ball_state,
+                                          const Duration& duration_in_future,
+                                          const std::vector<Point>& robot_positions,
+                                          std::optional<double> initial_kick_speed,
+                                          const std::optional<BallFlight>& flight) const
+{
+    return predictBallStates(ball_state, {duration_in_future}, robot_positions,
+                             initial_kick_speed, flight)
+        .front();
+}
+
+std::vector<BallPredictor::MotionSegment> BallPredictor::calculateMotionSegments(
+    const BallState& ball_state, double end_time_seconds,
+    const std::vector<Point>& robot_positions, std::optional<double> initial_kick_speed,
+    std::optional<BallFlight> flight) const
+{
+    static constexpr double INFINITE = std::numeric_limits<double>::infinity();
+    const double robot_collision_radius =
+        ROBOT_MAX_RADIUS_METERS + BALL_MAX_RADIUS_METERS;
+    const double wall_x_min = field_boundary.xMin() + BALL_MAX_RADIUS_METERS;
+    const double wall_x_max = field_boundary.xMax() - BALL_MAX_RADIUS_METERS;
+    const double wall_y_min = field_boundary.yMin() + BALL_MAX_RADIUS_METERS;
+    const double wall_y_max = field_boundary.yMax() - BALL_MAX_RADIUS_METERS;
+
+    // The ball slides until it slows down to this speed
+    std::optional<double> sliding_to_rolling_speed;
+    if (initial_kick_speed)
+    {
+        sliding_to_rolling_speed =
+            *initial_kick_speed * SLIDING_ROLLING_TRANSITION_FACTOR;
+    }
+
+    std::vector<MotionSegment> segments;
+    double time_seconds = 0.0;
+    Point position      = ball_state.position();
+    Vector velocity     = ball_state.velocity();
+
+    while (segments.size() < MAX_NUM_MOTION_SEGMENTS)
+    {
+        const double speed = velocity.length();
+        if (speed < STOPPED_SPEED_METERS_PER_SECOND)
+        {
+            segments.emplace_back(MotionSegment{.start_time_seconds = time_seconds,
+                                                .start_position     = position,
+                                                .direction          = Vector(),
+                                                .start_speed        = 0.0,
+                                                .deceleration       = 0.0,
+                                                .duration_seconds   = INFINITE,
+                                                .in_flight          = false});
+            break;
+        }
+        const Vector direction = velocity.normalize();
+
+        // The ball decelerates at a constant rate until the end of the current phase,
+        // ie. until it stops sliding or stops moving. A ball in flight has no friction.
+        const bool in_flight =
+            flight && (position - flight->origin).length() < flight->distance_meters;
+        if (!in_flight)
+        {
+            flight = std::nullopt;
+        }
+        double deceleration    = 0.0;
+        double phase_end_speed = 0.0;
+        if (in_flight)
+        {
+            deceleration = 0.0;
+        }
+        else if (sliding_to_rolling_speed && speed > *sliding_to_rolling_speed)
+        {
+            deceleration    = parameters.sliding_friction_acceleration;
+            phase_end_speed = *sliding_to_rolling_speed;
+        }
+        else
+        {
+            sliding_to_rolling_speed = std::nullopt;
+            deceleration             = parameters.rolling_friction_acceleration;
+        }
+        const double phase_duration =
+            deceleration > 0.0 ? (speed - phase_end_speed) / deceleration : INFINITE;
+
+        // Find the closest point along the path of the ball where it lands or bounces
+        double event_distance = INFINITE;
+        std::optional<Vector> bounce_normal;
+        double bounce_restitution = 0.0;
+        if (in_flight)
+        {
+            // The distance along the path where the ball is the flight distance away
+            // from where it was chipped from
+            const Vector from_origin = position - flight->origin;
+            const double b           = direction.dot(from_origin);
+            const double c           = from_origin.lengthSquared() -
+                             flight->distance_meters * flight->distance_meters;
+            event_distance = -b + std::sqrt(b * b - c);
+        }
+        else
+        {
+            auto consider_bounce = [&](double distance, const Vector& normal,
+                                       double restitution) {
+                if (distance < event_distance)
+                {
+                    event_distance     = std::max(0.0, distance);
+                    bounce_normal      = normal;
+                    bounce_restitution = restitution;
+                }
+            };
+
+            if (direction.x() > 0.0)
+            {
+                consider_bounce((wall_x_max - position.x()) / direction.x(),
+                                Vector(-1, 0), parameters.wall_restitution);
+            }
+            else if (direction.x() < 0.0)
+            {
+                consider_bounce((wall_x_min - position.x()) / direction.x(), Vector(1, 0),
+                                parameters.wall_restitution);
+            }
+            if (direction.y() > 0.0)
+            {
+                consider_bounce((wall_y_max - position.y()) / direction.y(),
+                                Vector(0, -1), parameters.wall_restitution);
+            }
+            else if (direction.y() < 0.0)
+            {
+                consider_bounce((wall_y_min - position.y()) / direction.y(), Vector(0, 1),
+                                parameters.wall_restitution);
+            }
+
+            for (const auto& robot_position : robot_positions)
+            {
+                // Solve for where the path of the ball first comes within the collision
+                // radius of the robot. The ball only hits robots it is moving towards
+                // and is not already overlapping.
+                const Vector from_robot = position - robot_position;
+                const double b          = direction.dot(from_robot);
+                const double c          = from_robot.lengthSquared() -
+                                 robot_collision_radius * robot_collision_radius;
+                const double discriminant = b * b - c;
+                if (b >= 0.0 || c <= 0.0 || discriminant < 0.0)
+                {
+                    continue;
+                }
+                const double distance = -b - std::sqrt(discriminant);
+                consider_bounce(distance, (from_robot + direction * distance).normalize(),
+                                parameters.robot_restitution);
+            }
+        }
+        const double event_duration =
+            calculateTimeToTravel(speed, deceleration, event_distance);
+
+        const double segment_duration = std::min(phase_duration, event_duration);
+        MotionSegment segment{.start_time_seconds = time_seconds,
+                              .start_position     = position,
+                              .direction          = direction,
+                              .start_speed        = speed,
+                              .deceleration       = deceleration,
+                              .duration_seconds   = segment_duration,
+                              .in_flight          = in_flight};
+        segments.emplace_back(segment);
+        if (std::isinf(segment_duration) ||
+            time_seconds + segment_duration >= end_time_seconds)
+        {
+            break;
+        }
+
+        const BallState end_state =
+            calculateBallStateInSegment(segment, segment_duration, flight);
+        time_seconds += segment_duration;
+        position = end_state.position();
+        velocity = end_state.velocity();
+        if (event_duration <= phase_duration && bounce_normal)
+        {
+            const Vector normal_velocity = *bounce_normal * velocity.dot(*bounce_normal);
+            velocity = velocity - normal_velocity - normal_velocity * bounce_restitution;
+        }
+        else if (event_duration <= phase_duration)
+        {
+            // The ball has landed
+            flight = std::nullopt;
+        }
+        else if (phase_end_speed == 0.0)
+        {
+            velocity = Vector();
+        }
+        else
+        {
+            // Make sure the ball starts rolling despite any rounding error
+            sliding_to_rolling_speed = std::nullopt;
+        }
+    }
+
+    return segments;
+}
+
+BallState BallPredictor::calculateBallStateInSegment(
+    const MotionSegment& segment, double seconds_since_start,
+    const std::optional<BallFlight>& flight)
+{
+    double t = std::min(seconds_since_start, segment.duration_seconds);
+    if (segment.deceleration > 0.0)
+    {
+        t = std::min(t, segment.start_speed / segment.deceleration);
+    }
+    const double speed = std::max(0.0, segment.start_speed - segment.deceleration * t);
+    const double distance_travelled =
+        segment.start_speed * t - 0.5 * segment.deceleration * t * t;
+    const Point position =
+        segment.start_position + segment.direction * distance_travelled;
+
+    double distance_from_ground = 0.0;
+    if (segment.in_flight && flight)
+    {
+        // The same parabolic trajectory as the PhysicsBall, given the range and angle of
+        // departure of the chip
+        const double x = (position - flight->origin).length();
+        const double initial_speed_squared =
+            flight->distance_meters *
+            ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED /
+            (flight->angle_of_departure * 2).sin();
+        const double y = std::tan(flight->angle_of_departure.toRadians()) * x -
+                         ACCELERATION_DUE_TO_GRAVITY_METERS_PER_SECOND_SQUARED * x * x /
+                             (2 * initial_speed_squared *
+                              std::pow(flight->angle_of_departure.cos(), 2));
+        distance_from_ground = std::max(y, 0.0);
+    }
+
+    return BallState(position, segment.direction * speed, distance_from_ground);
+}
+
+double BallPredictor::calculateTimeToTravel(double speed, double deceleration,
+                                            double distance)
+{
+    if (std::isinf(distance))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    // Solve distance = speed * t - deceleration * t^2 / 2 for the first time the
+    // distance is reached. This form is stable when the deceleration is 0.
+    const double discriminant = speed * speed - 2 * deceleration * distance;
+    if (discriminant < 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return 2 * distance / (speed + std::sqrt(discriminant));
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "software/geom/angle.h"
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/time/duration.h"
+#include "software/world/ball_state.h"
+
+/**
+ * The parameters of the model the BallPredictor uses to predict how the ball moves
+ */
+struct BallModelParameters
+{
+    // The scalar friction acceleration in m/s^2 applied to the ball while it is sliding
+    double sliding_friction_acceleration;
+    // The scalar friction acceleration in m/s^2 applied to the ball while it is rolling
+    double rolling_friction_acceleration;
+    // The fraction of the ball's speed towards a wall or robot that it keeps after
+    // bouncing off it. 0.0 means it does not bounce at all, and 1.0 means it bounces
+    // off at the same speed it hit at.
+    double wall_restitution;
+    double robot_restitution;
+};
+
+/**
+ * Where the ball was chipped from, and how. The ball flies over everything, without
+ * any friction, until it is the given distance from where it was chipped from.
+ */
+struct BallFlight
+{
+    Point origin;
+    double distance_meters;
+    Angle angle_of_departure;
+};
+
+/**
+ * The BallPredictor quickly predicts where the ball will be at many times in the future,
+ * using the same ball model as the simulator, but without stepping a physics
+ * simulation.
+ *
+ * The ball slides after it is kicked, and starts rolling once it has slowed to 5/7 of
+ * the speed it was kicked at. A chipped ball flies until it lands, and then rolls. The
+ * ball bounces off the field boundary and the robots, which are assumed to be circles
+ * that do not move. The walls of the goals are not modelled.
+ *
+ * The motion of the ball is split into pieces between each event (ie. a bounce, or the
+ * ball starting to roll) once per prediction, and each piece has constant
+ * deceleration, so each time in the future is predicted in constant time.
+ */
+class BallPredictor
+{
+   public:
+    /**
+     * Creates a new BallPredictor
+     *
+     * @param field_boundary The walls around the field that the ball bounces off
+     * @param parameters The parameters of the ball model
+     */
+    explicit BallPredictor(const Rectangle& field_boundary,
+                           const BallModelParameters& parameters);
+    BallPredictor() = delete;
+
+    /**
+     * Predicts the state of the ball at each of the given durations in the future
+     *
+     * @param ball_state The current state of the ball
+     * @param durations_in_future The durations in the future to predict the state of
+     * the ball at. These do not need to be sorted.
+     * @param robot_positions The positions of the robots the ball can bounce off
+     * @param initial_kick_speed The speed the ball was most recently kicked at, if it
+     * may still be sliding. If this is not given, the ball is rolling.
+     * @param flight How the ball was chipped, if it may still be in flight
+     *
+     * @return the predicted state of the ball at each of the given durations, in the
+     * same order
+     */
+    std::vector<BallState> predictBallStates(
+        const BallState& ball_state, const std::vector<Duration>& durations_in_future,
+        const std::vector<Point>& robot_positions = {},
+        std::optional<double> initial_kick_speed  = std::nullopt,
+        const std::optional<BallFlight>& flight   = std::nullopt) const;
+
+    /**
+     * Predicts the state of the ball at the given duration in the future
+     *
+     * @param ball_state The current state of the ball
+     * @param duration_in_future The duration in the future to predict the state of the
+     * ball at
+     * @param robot_positions The positions of the robots the ball can bounce off
+     * @param initial_kick_speed The speed the ball was most recently kicked at, if it
+     * may still be sliding. If this is not given, the ball is rolling.
+     * @param flight How the ball was chipped, if it may still be in flight
+     *
+     * @return the predicted state of the ball
+     */
+    BallState predictBallState(
+        const BallState& ball_state, const Duration& duration_in_future,
+        const std::vector<Point>& robot_positions = {},
+        std::optional<double> initial_kick_speed  = std::nullopt,
+        const std::optional<BallFlight>& flight   = std::nullopt) const;
+
+   private:
+    /**
+     * A piece of the motion of the ball, during which it moves in a straight line with
+     * constant deceleration
+     */
+    struct MotionSegment
+    {
+        double start_time_seconds;
+        Point start_position;
+        // The unit vector the ball moves along
+        Vector direction;
+        double start_speed;
+        double deceleration;
+        // May be infinite if the ball never stops moving
+        double duration_seconds;
+        bool in_flight;
+    };
+
+    /**
+     * Splits the motion of the ball into segments of constant deceleration, until at
+     * least the given time in the future
+     *
+     * @param ball_state The current state of the ball
+     * @param end_time_seconds The time in the future to split the motion until
+     * @param robot_positions The positions of the robots the ball can bounce off
+     * @param initial_kick_speed The speed the ball was most recently kicked at, if any
+     * @param flight How the ball was chipped, if it may still be in flight
+     *
+     * @return the segments of the motion of the ball, in order
+     */
+    std::vector<MotionSegment> calculateMotionSegments(
+        const BallState& ball_state, double end_time_seconds,
+        const std::vector<Point>& robot_positions,
+        std::optional<double> initial_kick_speed, std::optional<BallFlight> flight) const;
+
+    /**
+     * Returns the state of the ball the given time after the start of the given
+     * segment. The ball stays at the end of the segment after it ends.
+     *
+     * @param segment The segment the ball is moving along
+     * @param seconds_since_start The time since the start of the segment
+     * @param flight How the ball was chipped, if it may still be in flight
+     *
+     * @return the state of the ball
+     */
+    static BallState calculateBallStateInSegment(const MotionSegment& segment,
+                                                 double seconds_since_start,
+                                                 const std::optional<BallFlight>& flight);
+
+    /**
+     * Returns how long it takes to travel the given distance, starting at the given
+     * speed and slowing down at the given rate
+     *
+     * @param speed The initial speed
+     * @param deceleration The rate the speed decreases at
+     * @param distance The distance to travel
+     *
+     * @return how long it takes to travel the given distance, or infinity if the
+     * distance is never reached
+     */
+    static double calculateTimeToTravel(double speed, double deceleration,
+                                        double distance);
+
+    Rectangle field_boundary;
+    BallModelParameters parameters;
+
+    // Because the ball is a sphere of uniform density, it starts rolling once it has
+    // slowed to 5/7 of the speed it started sliding at. See section 5 of
+    // https://ssl.robocup.org/wp-content/uploads/2020/03/2020_ETDP_ZJUNlict.pdf
+    static constexpr double SLIDING_ROLLING_TRANSITION_FACTOR = 5.0 / 7.0;
+    // The ball never bounces back and forth forever, but a limit keeps the time to make
+    // a prediction bounded if it bounces many times without losing any speed
+    static constexpr unsigned int MAX_NUM_MOTION_SEGMENTS = 64;
+    // The ball is considered stopped below this speed, in m/s
+    static constexpr double STOPPED_SPEED_METERS_PER_SECOND = 1e-6;
+};
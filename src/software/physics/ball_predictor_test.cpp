@@ -0,0 +1,139 @@
+#include "software/physics/ball_predictor.h"
+
+#include <gtest/gtest.h>
+
+#include "shared/constants.h"
+#include "software/test_util/test_util.h"
+
+class BallPredictorTest : public ::testing::Test
+{
+   protected:
+    BallPredictorTest()
+        : field_boundary(Point(-5, -3), Point(5, 3)),
+          parameters{.sliding_friction_acceleration = 5.0,
+                     .rolling_friction_acceleration = 0.5,
+                     .wall_restitution              = 1.0,
+                     .robot_restitution             = 0.5},
+          ball_predictor(field_boundary, parameters)
+    {
+    }
+
+    Rectangle field_boundary;
+    BallModelParameters parameters;
+    BallPredictor ball_predictor;
+};
+
+TEST_F(BallPredictorTest, stationary_ball_does_not_move)
+{
+    BallState ball_state(Point(1, 2), Vector(0, 0));
+
+    BallState prediction =
+        ball_predictor.predictBallState(ball_state, Duration::fromSeconds(2));
+
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(ball_state, prediction, 1e-9));
+}
+
+TEST_F(BallPredictorTest, rolling_ball_slows_down_and_stops)
+{
+    BallState ball_state(Point(0, 0), Vector(1, 0));
+
+    std::vector<BallState> predictions = ball_predictor.predictBallStates(
+        ball_state, {Duration::fromSeconds(1), Duration::fromSeconds(3)});
+
+    ASSERT_EQ(2, predictions.size());
+    // x = v * t - a * t^2 / 2
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(BallState(Point(0.75, 0), Vector(0.5, 0)),
+                                               predictions[0], 1e-9));
+    // The ball stops after 2 seconds, 1 metre away
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(BallState(Point(1, 0), Vector(0, 0)),
+                                               predictions[1], 1e-9));
+}
+
+TEST_F(BallPredictorTest, kicked_ball_slides_then_rolls)
+{
+    BallState ball_state(Point(-4, 0), Vector(7, 0));
+
+    // The ball slides until it slows to 5 m/s after 0.4 seconds, then rolls
+    std::vector<BallState> predictions = ball_predictor.predictBallStates(
+        ball_state, {Duration::fromSeconds(0.2), Duration::fromSeconds(1.4)}, {}, 7.0);
+
+    ASSERT_EQ(2, predictions.size());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        BallState(Point(-4 + 1.3, 0), Vector(6, 0)), predictions[0], 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        BallState(Point(-4 + 2.4 + 4.75, 0), Vector(4.5, 0)), predictions[1], 1e-9));
+}
+
+TEST_F(BallPredictorTest, ball_bounces_off_wall)
+{
+    parameters.rolling_friction_acceleration = 0.0;
+    BallPredictor frictionless_predictor(field_boundary, parameters);
+    BallState ball_state(Point(4, 0), Vector(1, 1));
+
+    BallState prediction =
+        frictionless_predictor.predictBallState(ball_state, Duration::fromSeconds(2));
+
+    const double wall_x = 5 - BALL_MAX_RADIUS_METERS;
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        BallState(Point(wall_x - (2 - (wall_x - 4)), 2), Vector(-1, 1)), prediction,
+        1e-9));
+}
+
+TEST_F(BallPredictorTest, ball_bounces_off_robot_with_restitution)
+{
+    parameters.rolling_friction_acceleration = 0.0;
+    BallPredictor frictionless_predictor(field_boundary, parameters);
+    BallState ball_state(Point(0, 0), Vector(2, 0));
+    const Point robot_position(1, 0);
+
+    BallState prediction = frictionless_predictor.predictBallState(
+        ball_state, Duration::fromSeconds(1), {robot_position});
+
+    const double hit_x          = 1 - ROBOT_MAX_RADIUS_METERS - BALL_MAX_RADIUS_METERS;
+    const double bounce_seconds = 1 - hit_x / 2;
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        BallState(Point(hit_x - bounce_seconds, 0), Vector(-1, 0)), prediction, 1e-9));
+}
+
+TEST_F(BallPredictorTest, chipped_ball_flies_over_robot_and_lands)
+{
+    BallState ball_state(Point(0, 0), Vector(2, 0));
+    const BallFlight flight{.origin             = Point(0, 0),
+                            .distance_meters    = 2.0,
+                            .angle_of_departure = Angle::fromDegrees(45)};
+
+    std::vector<BallState> predictions = ball_predictor.predictBallStates(
+        ball_state, {Duration::fromSeconds(0.5), Duration::fromSeconds(2)},
+        {Point(0.5, 0)}, std::nullopt, flight);
+
+    ASSERT_EQ(2, predictions.size());
+    // There is no friction while the ball is in flight, and the ball is highest half
+    // way through its flight
+    EXPECT_TRUE(
+        TestUtil::equalWithinTolerance(Point(1, 0), predictions[0].position(), 1e-9));
+    EXPECT_NEAR(0.5, predictions[0].distanceFromGround(), 1e-9);
+    // The ball rolls after it lands after 1 second
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        BallState(Point(2 + 1.75, 0), Vector(1.5, 0)), predictions[1], 1e-9));
+}
+
+TEST_F(BallPredictorTest, batched_predictions_match_single_predictions_in_any_order)
+{
+    BallState ball_state(Point(-2, 1), Vector(4, 3));
+    std::vector<Point> robot_positions = {Point(0, 2), Point(2, -1)};
+    std::vector<Duration> durations = {Duration::fromSeconds(3), Duration::fromSeconds(0),
+                                       Duration::fromSeconds(1.5),
+                                       Duration::fromSeconds(0.25)};
+
+    std::vector<BallState> predictions =
+        ball_predictor.predictBallStates(ball_state, durations, robot_positions, 5.0);
+
+    ASSERT_EQ(durations.size(), predictions.size());
+    for (size_t i = 0; i < durations.size(); i++)
+    {
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(
+            ball_predictor.predictBallState(ball_state, durations[i], robot_positions,
+                                            5.0),
+            predictions[i], 1e-9));
+    }
+}
@@ -0,0 +1,120 @@
+#include "software/proto/message_translation/draw_commands.h"
+
+/**
+ * Returns whether a command of the given type can have the given number of values
+ *
+ * @param type The type of the command
+ * @param num_values The number of values of the command
+ *
+ * @return whether a command of the given type can have the given number of values
+ */
+static bool isValidNumValues(DrawCommandsProto::CommandType type, size_t num_values)
+{
+    switch (type)
+    {
+        case DrawCommandsProto::LINE:
+            return num_values == 4;
+        case DrawCommandsProto::CIRCLE:
+        case DrawCommandsProto::TEXT:
+            return num_values == 3;
+        case DrawCommandsProto::POLYGON:
+            return num_values % 2 == 0;
+        default:
+            return false;
+    }
+}
+
+std::unique_ptr<DrawCommandsProto> createDrawCommands(
+    const DrawCommandBuffer& draw_command_buffer)
+{
+    auto draw_commands_proto = std::make_unique<DrawCommandsProto>();
+    updateDrawCommands(draw_command_buffer, *draw_commands_proto);
+    return draw_commands_proto;
+}
+
+void updateDrawCommands(const DrawCommandBuffer& draw_command_buffer,
+                        DrawCommandsProto& draw_commands_proto)
+{
+    // Clearing repeated fields keeps their storage
+    draw_commands_proto.Clear();
+
+    const std::vector<DrawCommand>& commands = draw_command_buffer.getCommands();
+    const int num_commands                   = static_cast<int>(commands.size());
+    draw_commands_proto.mutable_types()->Reserve(num_commands);
+    draw_commands_proto.mutable_outline_colours()->Reserve(num_commands);
+    draw_commands_proto.mutable_outline_widths()->Reserve(num_commands);
+    draw_commands_proto.mutable_fill_colours()->Reserve(num_commands);
+    draw_commands_proto.mutable_dashed()->Reserve(num_commands);
+    draw_commands_proto.mutable_num_values()->Reserve(num_commands);
+    draw_commands_proto.mutable_text_lengths()->Reserve(num_commands);
+    for (const DrawCommand& command : commands)
+    {
+        draw_commands_proto.add_types(
+            static_cast<DrawCommandsProto::CommandType>(command.type));
+        draw_commands_proto.add_outline_colours(command.style.outline_colour);
+        draw_commands_proto.add_outline_widths(command.style.outline_width);
+        draw_commands_proto.add_fill_colours(command.style.fill_colour);
+        draw_commands_proto.add_dashed(command.style.dashed);
+        draw_commands_proto.add_num_values(command.num_values);
+        draw_commands_proto.add_text_lengths(command.text_length);
+    }
+
+    const std::vector<float>& values = draw_command_buffer.getValues();
+    draw_commands_proto.mutable_values()->Add(values.begin(), values.end());
+    draw_commands_proto.set_text(draw_command_buffer.getText());
+}
+
+std::optional<DrawCommandBuffer> createDrawCommandBuffer(
+    const DrawCommandsProto& draw_commands_proto)
+{
+    const int num_commands = draw_commands_proto.types_size();
+    if (draw_commands_proto.outline_colours_size() != num_commands ||
+        draw_commands_proto.outline_widths_size() != num_commands ||
+        draw_commands_proto.fill_colours_size() != num_commands ||
+        draw_commands_proto.dashed_size() != num_commands ||
+        draw_commands_proto.num_values_size() != num_commands ||
+        draw_commands_proto.text_lengths_size() != num_commands)
+    {
+        return std::nullopt;
+    }
+
+    DrawCommandBuffer draw_command_buffer;
+    draw_command_buffer.reserve(static_cast<size_t>(num_commands),
+                                static_cast<size_t>(draw_commands_proto.values_size()),
+                                draw_commands_proto.text().size());
+
+    size_t values_begin = 0;
+    size_t text_begin   = 0;
+    for (int i = 0; i < num_commands; i++)
+    {
+        const size_t num_values  = draw_commands_proto.num_values(i);
+        const size_t text_length = draw_commands_proto.text_lengths(i);
+        if (!isValidNumValues(draw_commands_proto.types(i), num_values) ||
+            values_begin + num_values >
+                static_cast<size_t>(draw_commands_proto.values_size()) ||
+            text_begin + text_length > draw_commands_proto.text().size())
+        {
+            return std::nullopt;
+        }
+
+        DrawCommand command;
+        command.type = static_cast<DrawCommandType>(draw_commands_proto.types(i));
+        command.style.outline_colour = draw_commands_proto.outline_colours(i);
+        command.style.outline_width  = draw_commands_proto.outline_widths(i);
+        command.style.fill_colour    = draw_commands_proto.fill_colours(i);
+        command.style.dashed         = draw_commands_proto.dashed(i);
+        // The ranges are filled in when the command is added to the buffer
+        command.values_begin = 0;
+        command.num_values   = 0;
+        command.text_begin   = 0;
+        command.text_length  = 0;
+        draw_command_buffer.addCommand(
+            command, draw_commands_proto.values().data() + values_begin, num_values,
+            draw_commands_proto.text().data() + text_begin, text_length);
+
+        values_begin += num_values;
+        text_begin += text_length;
+    }
+
+    return draw_command_buffer;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "software/gui/drawing/draw_command_buffer.h"
+#include "software/proto/draw_commands_msg.pb.h"
+
+/**
+ * Creates a DrawCommandsProto from the given DrawCommandBuffer
+ *
+ * @param draw_command_buffer The DrawCommandBuffer to create a DrawCommandsProto from
+ *
+ * @return A DrawCommandsProto containing the commands in the given buffer
+ */
+std::unique_ptr<DrawCommandsProto> createDrawCommands(
+    const DrawCommandBuffer& draw_command_buffer);
+
+/**
+ * Replaces the contents of the given DrawCommandsProto with the commands in the given
+ * DrawCommandBuffer. The storage of the proto is reused, so a proto that is updated
+ * every tick stops allocating once it has grown large enough.
+ *
+ * @param draw_command_buffer The DrawCommandBuffer to copy the commands from
+ * @param draw_commands_proto The DrawCommandsProto to update
+ */
+void updateDrawCommands(const DrawCommandBuffer& draw_command_buffer,
+                        DrawCommandsProto& draw_commands_proto);
+
+/**
+ * Creates a DrawCommandBuffer from the given DrawCommandsProto
+ *
+ * @param draw_commands_proto The DrawCommandsProto to create a DrawCommandBuffer from
+ *
+ * @return A DrawCommandBuffer containing the commands in the given proto, or
+ * std::nullopt if the proto is malformed (ie. the number of values in the proto does
+ * not match the number of values of its commands)
+ */
+std::optional<DrawCommandBuffer> createDrawCommandBuffer(
+    const DrawCommandsProto& draw_commands_proto);
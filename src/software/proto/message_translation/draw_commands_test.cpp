@@ -0,0 +1,95 @@
+#include "software/proto/message_translation/draw_commands.h"
+
+#include <gtest/gtest.h>
+
+class DrawCommandsTest : public testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        DrawStyle line_style = {0xFF102030, 2.0f, 0, true};
+        DrawStyle fill_style = {0xFF000000, 1.0f, 0x80405060, false};
+        draw_command_buffer.addLine(Segment(Point(1, 2), Point(-3, 4)), line_style);
+        draw_command_buffer.addCircle(Circle(Point(1, 2), 3), fill_style);
+        draw_command_buffer.addPolygon(Polygon({Point(0, 0), Point(1, 0), Point(0, 1)}),
+                                       fill_style);
+        draw_command_buffer.addText("friendly", Point(5, 6), 0.5, line_style);
+    }
+
+    DrawCommandBuffer draw_command_buffer;
+};
+
+TEST_F(DrawCommandsTest, create_draw_commands)
+{
+    auto draw_commands = createDrawCommands(draw_command_buffer);
+
+    ASSERT_EQ(4, draw_commands->types_size());
+    EXPECT_EQ(DrawCommandsProto::LINE, draw_commands->types(0));
+    EXPECT_EQ(DrawCommandsProto::CIRCLE, draw_commands->types(1));
+    EXPECT_EQ(DrawCommandsProto::POLYGON, draw_commands->types(2));
+    EXPECT_EQ(DrawCommandsProto::TEXT, draw_commands->types(3));
+    EXPECT_EQ(0xFF102030, draw_commands->outline_colours(0));
+    EXPECT_EQ(2.0f, draw_commands->outline_widths(0));
+    EXPECT_EQ(0x80405060, draw_commands->fill_colours(1));
+    EXPECT_TRUE(draw_commands->dashed(0));
+    EXPECT_FALSE(draw_commands->dashed(1));
+    EXPECT_EQ(6, draw_commands->num_values(2));
+    EXPECT_EQ(8, draw_commands->text_lengths(3));
+    EXPECT_EQ(16, draw_commands->values_size());
+    EXPECT_EQ("friendly", draw_commands->text());
+}
+
+TEST_F(DrawCommandsTest, draw_command_buffer_round_trip)
+{
+    auto draw_commands = createDrawCommands(draw_command_buffer);
+
+    // Serialize the proto as if it was being sent to another process
+    DrawCommandsProto received_draw_commands;
+    ASSERT_TRUE(
+        received_draw_commands.ParseFromString(draw_commands->SerializeAsString()));
+
+    auto received_buffer = createDrawCommandBuffer(received_draw_commands);
+    ASSERT_TRUE(received_buffer);
+    EXPECT_EQ(draw_command_buffer, received_buffer.value());
+}
+
+TEST_F(DrawCommandsTest, update_draw_commands_replaces_contents)
+{
+    DrawCommandsProto draw_commands;
+    updateDrawCommands(draw_command_buffer, draw_commands);
+
+    DrawCommandBuffer smaller_buffer;
+    smaller_buffer.addCircle(Circle(Point(1, 1), 1), {});
+    updateDrawCommands(smaller_buffer, draw_commands);
+
+    EXPECT_EQ(1, draw_commands.types_size());
+    EXPECT_EQ(3, draw_commands.values_size());
+    EXPECT_EQ("", draw_commands.text());
+    EXPECT_EQ(smaller_buffer, createDrawCommandBuffer(draw_commands).value());
+}
+
+TEST_F(DrawCommandsTest, create_draw_command_buffer_with_missing_values)
+{
+    auto draw_commands = createDrawCommands(draw_command_buffer);
+    draw_commands->mutable_values()->RemoveLast();
+
+    EXPECT_FALSE(createDrawCommandBuffer(*draw_commands));
+}
+
+TEST_F(DrawCommandsTest, create_draw_command_buffer_with_wrong_number_of_values)
+{
+    auto draw_commands = createDrawCommands(draw_command_buffer);
+    // Moving a value from the line to the circle keeps the total the same
+    draw_commands->set_num_values(0, 3);
+    draw_commands->set_num_values(1, 4);
+
+    EXPECT_FALSE(createDrawCommandBuffer(*draw_commands));
+}
+
+TEST_F(DrawCommandsTest, create_draw_command_buffer_with_mismatched_styles)
+{
+    auto draw_commands = createDrawCommands(draw_command_buffer);
+    draw_commands->mutable_dashed()->RemoveLast();
+
+    EXPECT_FALSE(createDrawCommandBuffer(*draw_commands));
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <google/protobuf/message.h>
+#include <pb_decode.h>
+
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Converts the given google proto to a NanoPb message by serializing it and decoding
+ * the serialized bytes with NanoPb. This is slow, but converts any message correctly,
+ * so it is used to check and measure faster field by field conversions.
+ *
+ * @tparam NanoPbMessage The type of the NanoPb message
+ *
+ * @param google_message The google proto to convert to a NanoPb message
+ * @param nanopb_fields The NanoPb field descriptors of the NanoPb message
+ * @param initial_nanopb_message The zero value of the NanoPb message
+ *
+ * @throws std::runtime_error if the serialized google proto can not be decoded
+ *
+ * @return The NanoPb message decoded from the serialized google proto
+ */
+template <typename NanoPbMessage>
+NanoPbMessage createNanoPbMessageByRoundTrip(
+    const google::protobuf::Message& google_message, const pb_field_t* nanopb_fields,
+    NanoPbMessage initial_nanopb_message)
+{
+    std::vector<uint8_t> serialized_proto(google_message.ByteSizeLong());
+    google_message.SerializeToArray(serialized_proto.data(),
+                                    static_cast<int>(serialized_proto.size()));
+
+    NanoPbMessage nanopb_message = initial_nanopb_message;
+    pb_istream_t pb_in_stream =
+        pb_istream_from_buffer(serialized_proto.data(), serialized_proto.size());
+    if (!pb_decode(&pb_in_stream, nanopb_fields, &nanopb_message))
+    {
+        throw std::runtime_error(
+            "Failed to decode serialized google proto to NanoPb in round trip");
+    }
+
+    return nanopb_message;
+}
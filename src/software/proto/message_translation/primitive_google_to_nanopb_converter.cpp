@@ -1,23 +1,218 @@
 #include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
 
-#include <pb_decode.h>
+#include <iterator>
+#include <stdexcept>
 
-TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+/**
+ * Convert the given google geometry protos to NanoPb messages
+ *
+ * @param google_* The google geometry proto to convert to a NanoPb message
+ *
+ * @return The NanoPb message representing the given geometry proto
+ */
+static TbotsProto_Point createNanoPbPoint(const TbotsProto::Point& google_point)
+{
+    TbotsProto_Point nanopb_point = TbotsProto_Point_init_zero;
+    nanopb_point.x_meters         = google_point.x_meters();
+    nanopb_point.y_meters         = google_point.y_meters();
+    return nanopb_point;
+}
+
+static TbotsProto_Vector createNanoPbVector(const TbotsProto::Vector& google_vector)
+{
+    TbotsProto_Vector nanopb_vector  = TbotsProto_Vector_init_zero;
+    nanopb_vector.x_component_meters = google_vector.x_component_meters();
+    nanopb_vector.y_component_meters = google_vector.y_component_meters();
+    return nanopb_vector;
+}
+
+static TbotsProto_Angle createNanoPbAngle(const TbotsProto::Angle& google_angle)
+{
+    TbotsProto_Angle nanopb_angle = TbotsProto_Angle_init_zero;
+    nanopb_angle.radians          = google_angle.radians();
+    return nanopb_angle;
+}
+
+static TbotsProto_AngularVelocity createNanoPbAngularVelocity(
+    const TbotsProto::AngularVelocity& google_angular_velocity)
+{
+    TbotsProto_AngularVelocity nanopb_angular_velocity =
+        TbotsProto_AngularVelocity_init_zero;
+    nanopb_angular_velocity.radians_per_second =
+        google_angular_velocity.radians_per_second();
+    return nanopb_angular_velocity;
+}
+
+/**
+ * Convert the given google primitive protos to NanoPb messages
+ *
+ * @param google_*_primitive The google primitive proto to convert to a NanoPb message
+ *
+ * @return The NanoPb message representing the given primitive
+ */
+static TbotsProto_MovePrimitive createNanoPbMovePrimitive(
+    const TbotsProto::MovePrimitive& google_move_primitive)
+{
+    TbotsProto_MovePrimitive nanopb_move_primitive = TbotsProto_MovePrimitive_init_zero;
+    nanopb_move_primitive.has_destination = google_move_primitive.has_destination();
+    nanopb_move_primitive.destination =
+        createNanoPbPoint(google_move_primitive.destination());
+    nanopb_move_primitive.final_speed_m_per_s =
+        google_move_primitive.final_speed_m_per_s();
+    nanopb_move_primitive.has_final_angle = google_move_primitive.has_final_angle();
+    nanopb_move_primitive.final_angle =
+        createNanoPbAngle(google_move_primitive.final_angle());
+    nanopb_move_primitive.dribbler_speed_rpm = google_move_primitive.dribbler_speed_rpm();
+    nanopb_move_primitive.max_speed_m_per_s  = google_move_primitive.max_speed_m_per_s();
+    nanopb_move_primitive.target_spin_rev_per_s =
+        google_move_primitive.target_spin_rev_per_s();
+
+    nanopb_move_primitive.has_auto_chip_or_kick =
+        google_move_primitive.has_auto_chip_or_kick();
+    const TbotsProto::MovePrimitive::AutoChipOrKick& google_auto_chip_or_kick =
+        google_move_primitive.auto_chip_or_kick();
+    TbotsProto_MovePrimitive_AutoChipOrKick& nanopb_auto_chip_or_kick =
+        nanopb_move_primitive.auto_chip_or_kick;
+    switch (google_auto_chip_or_kick.auto_chip_or_kick_case())
+    {
+        case TbotsProto::MovePrimitive::AutoChipOrKick::kAutokickSpeedMPerS:
+            nanopb_auto_chip_or_kick.which_auto_chip_or_kick =
+                TbotsProto_MovePrimitive_AutoChipOrKick_autokick_speed_m_per_s_tag;
+            nanopb_auto_chip_or_kick.auto_chip_or_kick.autokick_speed_m_per_s =
+                google_auto_chip_or_kick.autokick_speed_m_per_s();
+            break;
+        case TbotsProto::MovePrimitive::AutoChipOrKick::kAutochipDistanceMeters:
+            nanopb_auto_chip_or_kick.which_auto_chip_or_kick =
+                TbotsProto_MovePrimitive_AutoChipOrKick_autochip_distance_meters_tag;
+            nanopb_auto_chip_or_kick.auto_chip_or_kick.autochip_distance_meters =
+                google_auto_chip_or_kick.autochip_distance_meters();
+            break;
+        case TbotsProto::MovePrimitive::AutoChipOrKick::AUTO_CHIP_OR_KICK_NOT_SET:
+            break;
+    }
+
+    return nanopb_move_primitive;
+}
+
+static TbotsProto_StopPrimitive createNanoPbStopPrimitive(
+    const TbotsProto::StopPrimitive& google_stop_primitive)
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive.ByteSizeLong());
-    google_primitive.SerializeToArray(serialized_proto.data(),
-                                      static_cast<int>(google_primitive.ByteSizeLong()));
+    TbotsProto_StopPrimitive nanopb_stop_primitive = TbotsProto_StopPrimitive_init_zero;
+    nanopb_stop_primitive.stop_type =
+        static_cast<TbotsProto_StopPrimitive_StopType>(google_stop_primitive.stop_type());
+    return nanopb_stop_primitive;
+}
+
+static TbotsProto_DirectControlPrimitive createNanoPbDirectControlPrimitive(
+    const TbotsProto::DirectControlPrimitive& google_direct_control_primitive)
+{
+    TbotsProto_DirectControlPrimitive nanopb_direct_control_primitive =
+        TbotsProto_DirectControlPrimitive_init_zero;
+
+    switch (google_direct_control_primitive.wheel_control_case())
+    {
+        case TbotsProto::DirectControlPrimitive::kDirectPerWheelControl:
+        {
+            const auto& google_control =
+                google_direct_control_primitive.direct_per_wheel_control();
+            auto& nanopb_control =
+                nanopb_direct_control_primitive.wheel_control.direct_per_wheel_control;
+            nanopb_direct_control_primitive.which_wheel_control =
+                TbotsProto_DirectControlPrimitive_direct_per_wheel_control_tag;
+            nanopb_control.front_left_wheel_rpm  = google_control.front_left_wheel_rpm();
+            nanopb_control.back_left_wheel_rpm   = google_control.back_left_wheel_rpm();
+            nanopb_control.front_right_wheel_rpm = google_control.front_right_wheel_rpm();
+            nanopb_control.back_right_wheel_rpm  = google_control.back_right_wheel_rpm();
+            break;
+        }
+        case TbotsProto::DirectControlPrimitive::kDirectVelocityControl:
+        {
+            const auto& google_control =
+                google_direct_control_primitive.direct_velocity_control();
+            auto& nanopb_control =
+                nanopb_direct_control_primitive.wheel_control.direct_velocity_control;
+            nanopb_direct_control_primitive.which_wheel_control =
+                TbotsProto_DirectControlPrimitive_direct_velocity_control_tag;
+            nanopb_control.has_velocity = google_control.has_velocity();
+            nanopb_control.velocity     = createNanoPbVector(google_control.velocity());
+            nanopb_control.has_angular_velocity = google_control.has_angular_velocity();
+            nanopb_control.angular_velocity =
+                createNanoPbAngularVelocity(google_control.angular_velocity());
+            break;
+        }
+        case TbotsProto::DirectControlPrimitive::WHEEL_CONTROL_NOT_SET:
+            break;
+    }
+
+    nanopb_direct_control_primitive.charge_mode =
+        static_cast<TbotsProto_DirectControlPrimitive_ChargeMode>(
+            google_direct_control_primitive.charge_mode());
+
+    auto& nanopb_chick_command = nanopb_direct_control_primitive.chick_command;
+    switch (google_direct_control_primitive.chick_command_case())
+    {
+        case TbotsProto::DirectControlPrimitive::kKickSpeedMPerS:
+            nanopb_direct_control_primitive.which_chick_command =
+                TbotsProto_DirectControlPrimitive_kick_speed_m_per_s_tag;
+            nanopb_chick_command.kick_speed_m_per_s =
+                google_direct_control_primitive.kick_speed_m_per_s();
+            break;
+        case TbotsProto::DirectControlPrimitive::kChipDistanceMeters:
+            nanopb_direct_control_primitive.which_chick_command =
+                TbotsProto_DirectControlPrimitive_chip_distance_meters_tag;
+            nanopb_chick_command.chip_distance_meters =
+                google_direct_control_primitive.chip_distance_meters();
+            break;
+        case TbotsProto::DirectControlPrimitive::kAutokickSpeedMPerS:
+            nanopb_direct_control_primitive.which_chick_command =
+                TbotsProto_DirectControlPrimitive_autokick_speed_m_per_s_tag;
+            nanopb_chick_command.autokick_speed_m_per_s =
+                google_direct_control_primitive.autokick_speed_m_per_s();
+            break;
+        case TbotsProto::DirectControlPrimitive::kAutochipDistanceMeters:
+            nanopb_direct_control_primitive.which_chick_command =
+                TbotsProto_DirectControlPrimitive_autochip_distance_meters_tag;
+            nanopb_chick_command.autochip_distance_meters =
+                google_direct_control_primitive.autochip_distance_meters();
+            break;
+        case TbotsProto::DirectControlPrimitive::CHICK_COMMAND_NOT_SET:
+            break;
+    }
 
+    nanopb_direct_control_primitive.dribbler_speed_rpm =
+        google_direct_control_primitive.dribbler_speed_rpm();
 
+    return nanopb_direct_control_primitive;
+}
+
+TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_primitive)
+{
+    // The fields are copied one by one rather than serializing the google proto and
+    // decoding it with NanoPb, since this is called for every robot on every tick
     TbotsProto_Primitive nanopb_primitive = TbotsProto_Primitive_init_zero;
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_Primitive_fields, &nanopb_primitive))
+    switch (google_primitive.primitive_case())
     {
-        throw std::runtime_error(
-            "Failed to decode serialized primitive to NanoPb when converting google Primitive proto to NanoPb");
+        case TbotsProto::Primitive::kEstop:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_estop_tag;
+            break;
+        case TbotsProto::Primitive::kMove:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_move_tag;
+            nanopb_primitive.primitive.move =
+                createNanoPbMovePrimitive(google_primitive.move());
+            break;
+        case TbotsProto::Primitive::kStop:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_stop_tag;
+            nanopb_primitive.primitive.stop =
+                createNanoPbStopPrimitive(google_primitive.stop());
+            break;
+        case TbotsProto::Primitive::kDirectControl:
+            nanopb_primitive.which_primitive = TbotsProto_Primitive_direct_control_tag;
+            nanopb_primitive.primitive.direct_control =
+                createNanoPbDirectControlPrimitive(google_primitive.direct_control());
+            break;
+        case TbotsProto::Primitive::PRIMITIVE_NOT_SET:
+            break;
     }
 
     return nanopb_primitive;
@@ -26,20 +221,27 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
     const TbotsProto::PrimitiveSet& google_primitive_set)
 {
-    // Serialize the message to an array of raw values
-    std::vector<uint8_t> serialized_proto(google_primitive_set.ByteSizeLong());
-    google_primitive_set.SerializeToArray(
-        serialized_proto.data(), static_cast<int>(google_primitive_set.ByteSizeLong()));
-
-
     TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
+    nanopb_primitive_set.has_time_sent           = google_primitive_set.has_time_sent();
+    nanopb_primitive_set.time_sent.epoch_timestamp_seconds =
+        google_primitive_set.time_sent().epoch_timestamp_seconds();
 
-    pb_istream_t pb_in_stream = pb_istream_from_buffer(
-        static_cast<uint8_t*>(serialized_proto.data()), serialized_proto.size());
-    if (!pb_decode(&pb_in_stream, TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set))
+    if (google_primitive_set.robot_primitives().size() >
+        std::size(nanopb_primitive_set.robot_primitives))
     {
         throw std::runtime_error(
-            "Failed to decode serialized primitive_set to NanoPb when converting google PrimitiveSet proto to NanoPb");
+            "Too many primitives to convert google PrimitiveSet proto to NanoPb");
+    }
+
+    for (const auto& [robot_id, google_primitive] :
+         google_primitive_set.robot_primitives())
+    {
+        TbotsProto_PrimitiveSet_RobotPrimitivesEntry& entry =
+            nanopb_primitive_set
+                .robot_primitives[nanopb_primitive_set.robot_primitives_count++];
+        entry.key       = robot_id;
+        entry.has_value = true;
+        entry.value     = createNanoPbPrimitive(google_primitive);
     }
 
     return nanopb_primitive_set;
@@ -24,6 +24,9 @@ TbotsProto_Primitive createNanoPbPrimitive(const TbotsProto::Primitive& google_p
  * @param google_primitive_set The google primitive set proto to convert to a NanoPb
  * message
  *
+ * @throws std::runtime_error if there are more primitives than fit in the NanoPb
+ * message
+ *
  * @return The NanoPb message representing the given primitive
  */
 TbotsProto_PrimitiveSet createNanoPbPrimitiveSet(
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include "shared/constants.h"
+#include "software/proto/message_translation/nanopb_round_trip.h"
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+#include "software/proto/primitive/primitive_msg_factory.h"
+
+/**
+ * Creates a PrimitiveSet with a move primitive for every robot on a division A team,
+ * like the AI sends on every tick
+ *
+ * @return a PrimitiveSet with a move primitive for every robot
+ */
+static TbotsProto::PrimitiveSet createPrimitiveSet()
+{
+    TbotsProto::PrimitiveSet primitive_set;
+    primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(10.0);
+    for (unsigned int id = 0; id < DIV_A_NUM_ROBOTS; id++)
+    {
+        (*primitive_set.mutable_robot_primitives())[id] = *createMovePrimitive(
+            Point(-4.0 + id * 0.5, 1.0), 1.0, Angle::fromDegrees(id * 30),
+            DribblerMode::MAX_FORCE, {AutoChipOrKickMode::AUTOKICK, 5.0},
+            MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0);
+    }
+    return primitive_set;
+}
+
+static void BM_createNanoPbPrimitiveSet(benchmark::State &state)
+{
+    TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(createNanoPbPrimitiveSet(primitive_set));
+    }
+    state.SetItemsProcessed(state.iterations() * primitive_set.robot_primitives_size());
+}
+BENCHMARK(BM_createNanoPbPrimitiveSet);
+
+static void BM_createNanoPbPrimitiveSetByRoundTrip(benchmark::State &state)
+{
+    TbotsProto::PrimitiveSet primitive_set = createPrimitiveSet();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(createNanoPbMessageByRoundTrip(
+            primitive_set, TbotsProto_PrimitiveSet_fields,
+            TbotsProto_PrimitiveSet(TbotsProto_PrimitiveSet_init_zero)));
+    }
+    state.SetItemsProcessed(state.iterations() * primitive_set.robot_primitives_size());
+}
+BENCHMARK(BM_createNanoPbPrimitiveSetByRoundTrip);
@@ -3,15 +3,153 @@
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
 #include <math.h>
+#include <pb_encode.h>
 
+#include <algorithm>
+#include <random>
+
+#include "software/proto/message_translation/nanopb_round_trip.h"
 #include "software/proto/primitive/primitive_msg_factory.h"
 
 /**
- * Rather then testing every single primitive to make sure it's converted correctly,
- * we have a single simple integration test to ensure the primitive is being converted
- * at all, as all the code to actually perform the conversion is not here (it's generated
- * from the proto, or defined in other visitors)
+ * Encodes the given NanoPb message, so that messages can be compared without
+ * comparing the unused bytes of their unions
+ *
+ * @param nanopb_fields The NanoPb field descriptors of the message
+ * @param nanopb_message The message to encode
+ *
+ * @return the encoded message
+ */
+static std::vector<uint8_t> encodeNanoPbMessage(const pb_field_t* nanopb_fields,
+                                                const void* nanopb_message)
+{
+    std::vector<uint8_t> buffer(8192);
+    pb_ostream_t pb_out_stream = pb_ostream_from_buffer(buffer.data(), buffer.size());
+    EXPECT_TRUE(pb_encode(&pb_out_stream, nanopb_fields, nanopb_message));
+    buffer.resize(pb_out_stream.bytes_written);
+    return buffer;
+}
+
+/**
+ * Sorts the primitives of the given NanoPb primitive set by robot id, so that primitive
+ * sets can be compared regardless of the order the google proto map was iterated in
+ *
+ * @param nanopb_primitive_set The primitive set to sort
+ */
+static void sortNanoPbPrimitivesByRobotId(TbotsProto_PrimitiveSet& nanopb_primitive_set)
+{
+    std::sort(nanopb_primitive_set.robot_primitives,
+              nanopb_primitive_set.robot_primitives +
+                  nanopb_primitive_set.robot_primitives_count,
+              [](const TbotsProto_PrimitiveSet_RobotPrimitivesEntry& a,
+                 const TbotsProto_PrimitiveSet_RobotPrimitivesEntry& b) {
+                  return a.key < b.key;
+              });
+}
+
+/**
+ * Creates a primitive with random values, which may be any kind of primitive, with any
+ * of the options in each of its oneofs set, or none of them
+ *
+ * @param random_engine The source of randomness
+ *
+ * @return a random primitive
  */
+static TbotsProto::Primitive createRandomPrimitive(std::mt19937& random_engine)
+{
+    std::uniform_real_distribution<float> random_float(-100.0f, 100.0f);
+    std::uniform_int_distribution<int> random_case(0, 4);
+    TbotsProto::Primitive primitive;
+
+    switch (random_case(random_engine))
+    {
+        case 0:
+            primitive.mutable_estop();
+            break;
+        case 1:
+        {
+            auto move = primitive.mutable_move();
+            move->mutable_destination()->set_x_meters(random_float(random_engine));
+            move->mutable_destination()->set_y_meters(random_float(random_engine));
+            move->set_final_speed_m_per_s(random_float(random_engine));
+            move->mutable_final_angle()->set_radians(random_float(random_engine));
+            move->set_dribbler_speed_rpm(random_float(random_engine));
+            move->set_max_speed_m_per_s(random_float(random_engine));
+            move->set_target_spin_rev_per_s(random_float(random_engine));
+            switch (random_case(random_engine) % 3)
+            {
+                case 0:
+                    move->mutable_auto_chip_or_kick()->set_autokick_speed_m_per_s(
+                        random_float(random_engine));
+                    break;
+                case 1:
+                    move->mutable_auto_chip_or_kick()->set_autochip_distance_meters(
+                        random_float(random_engine));
+                    break;
+            }
+            break;
+        }
+        case 2:
+            primitive.mutable_stop()->set_stop_type(
+                random_case(random_engine) % 2 == 0 ? TbotsProto::StopPrimitive::BRAKE
+                                                    : TbotsProto::StopPrimitive::COAST);
+            break;
+        case 3:
+        {
+            auto direct_control = primitive.mutable_direct_control();
+            switch (random_case(random_engine) % 3)
+            {
+                case 0:
+                {
+                    auto wheels = direct_control->mutable_direct_per_wheel_control();
+                    wheels->set_front_left_wheel_rpm(random_float(random_engine));
+                    wheels->set_back_left_wheel_rpm(random_float(random_engine));
+                    wheels->set_front_right_wheel_rpm(random_float(random_engine));
+                    wheels->set_back_right_wheel_rpm(random_float(random_engine));
+                    break;
+                }
+                case 1:
+                {
+                    auto velocity = direct_control->mutable_direct_velocity_control();
+                    velocity->mutable_velocity()->set_x_component_meters(
+                        random_float(random_engine));
+                    velocity->mutable_velocity()->set_y_component_meters(
+                        random_float(random_engine));
+                    velocity->mutable_angular_velocity()->set_radians_per_second(
+                        random_float(random_engine));
+                    break;
+                }
+            }
+            direct_control->set_charge_mode(
+                static_cast<TbotsProto::DirectControlPrimitive::ChargeMode>(
+                    random_case(random_engine) % 3));
+            switch (random_case(random_engine))
+            {
+                case 0:
+                    direct_control->set_kick_speed_m_per_s(random_float(random_engine));
+                    break;
+                case 1:
+                    direct_control->set_chip_distance_meters(random_float(random_engine));
+                    break;
+                case 2:
+                    direct_control->set_autokick_speed_m_per_s(
+                        random_float(random_engine));
+                    break;
+                case 3:
+                    direct_control->set_autochip_distance_meters(
+                        random_float(random_engine));
+                    break;
+            }
+            direct_control->set_dribbler_speed_rpm(random_float(random_engine));
+            break;
+        }
+        default:
+            // No primitive is set
+            break;
+    }
+
+    return primitive;
+}
 
 TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
 {
@@ -22,6 +160,9 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_move_primitive)
     TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
 
     ASSERT_EQ(nanopb_primitive.which_primitive, TbotsProto_Primitive_move_tag);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.has_destination);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.has_final_angle);
+    EXPECT_TRUE(nanopb_primitive.primitive.move.has_auto_chip_or_kick);
     EXPECT_EQ(nanopb_primitive.primitive.move.destination.x_meters, 1.0f);
     EXPECT_EQ(nanopb_primitive.primitive.move.destination.y_meters, 2.0f);
     EXPECT_EQ(nanopb_primitive.primitive.move.final_speed_m_per_s, 100.0f);
@@ -54,9 +195,11 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
 
     // Test below assumes that map is of size 2
     ASSERT_EQ(2, nanopb_primitive_set.robot_primitives_count);
+    EXPECT_FALSE(nanopb_primitive_set.has_time_sent);
 
     for (pb_size_t i = 0; i < nanopb_primitive_set.robot_primitives_count; i++)
     {
+        EXPECT_TRUE(nanopb_primitive_set.robot_primitives[i].has_value);
         auto nanopb_primitive = nanopb_primitive_set.robot_primitives[i].value;
         if (nanopb_primitive_set.robot_primitives[i].key == 0)
         {
@@ -83,3 +226,120 @@ TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set)
         }
     }
 }
+
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_direct_control_primitive)
+{
+    TbotsProto::Primitive google_primitive;
+    auto direct_control = google_primitive.mutable_direct_control();
+    direct_control->mutable_direct_velocity_control()
+        ->mutable_velocity()
+        ->set_x_component_meters(1.5f);
+    direct_control->mutable_direct_velocity_control()
+        ->mutable_angular_velocity()
+        ->set_radians_per_second(-2.0f);
+    direct_control->set_charge_mode(TbotsProto::DirectControlPrimitive::CHARGE);
+    direct_control->set_chip_distance_meters(3.0f);
+    direct_control->set_dribbler_speed_rpm(1000.0f);
+
+    TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+
+    ASSERT_EQ(nanopb_primitive.which_primitive, TbotsProto_Primitive_direct_control_tag);
+    const auto& nanopb_direct_control = nanopb_primitive.primitive.direct_control;
+    ASSERT_EQ(nanopb_direct_control.which_wheel_control,
+              TbotsProto_DirectControlPrimitive_direct_velocity_control_tag);
+    EXPECT_TRUE(nanopb_direct_control.wheel_control.direct_velocity_control.has_velocity);
+    EXPECT_TRUE(
+        nanopb_direct_control.wheel_control.direct_velocity_control.has_angular_velocity);
+    EXPECT_EQ(nanopb_direct_control.wheel_control.direct_velocity_control.velocity
+                  .x_component_meters,
+              1.5f);
+    EXPECT_EQ(nanopb_direct_control.wheel_control.direct_velocity_control.velocity
+                  .y_component_meters,
+              0.0f);
+    EXPECT_EQ(nanopb_direct_control.wheel_control.direct_velocity_control.angular_velocity
+                  .radians_per_second,
+              -2.0f);
+    EXPECT_EQ(nanopb_direct_control.charge_mode,
+              TbotsProto_DirectControlPrimitive_ChargeMode_CHARGE);
+    ASSERT_EQ(nanopb_direct_control.which_chick_command,
+              TbotsProto_DirectControlPrimitive_chip_distance_meters_tag);
+    EXPECT_EQ(nanopb_direct_control.chick_command.chip_distance_meters, 3.0f);
+    EXPECT_EQ(nanopb_direct_control.dribbler_speed_rpm, 1000.0f);
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_empty_primitive)
+{
+    TbotsProto_Primitive nanopb_primitive =
+        createNanoPbPrimitive(TbotsProto::Primitive());
+
+    EXPECT_EQ(nanopb_primitive.which_primitive, 0);
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest, convert_primitive_set_with_too_many_primitives)
+{
+    TbotsProto_PrimitiveSet nanopb_primitive_set = TbotsProto_PrimitiveSet_init_zero;
+    TbotsProto::PrimitiveSet google_primitive_set;
+    for (uint32_t robot_id = 0;
+         robot_id <= std::size(nanopb_primitive_set.robot_primitives); robot_id++)
+    {
+        (*google_primitive_set.mutable_robot_primitives())[robot_id] =
+            *createStopPrimitive(false);
+    }
+
+    EXPECT_THROW(createNanoPbPrimitiveSet(google_primitive_set), std::runtime_error);
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     random_primitives_are_converted_the_same_as_by_serializing_and_decoding)
+{
+    std::mt19937 random_engine(0);
+    for (unsigned int i = 0; i < 10000; i++)
+    {
+        TbotsProto::Primitive google_primitive = createRandomPrimitive(random_engine);
+
+        TbotsProto_Primitive nanopb_primitive = createNanoPbPrimitive(google_primitive);
+        TbotsProto_Primitive round_trip_primitive = createNanoPbMessageByRoundTrip(
+            google_primitive, TbotsProto_Primitive_fields,
+            TbotsProto_Primitive(TbotsProto_Primitive_init_zero));
+
+        ASSERT_EQ(nanopb_primitive.which_primitive, round_trip_primitive.which_primitive)
+            << google_primitive.DebugString();
+        ASSERT_EQ(encodeNanoPbMessage(TbotsProto_Primitive_fields, &round_trip_primitive),
+                  encodeNanoPbMessage(TbotsProto_Primitive_fields, &nanopb_primitive))
+            << google_primitive.DebugString();
+    }
+}
+
+TEST(PrimitiveGoogleToNanoPbConverterTest,
+     random_primitive_sets_are_converted_the_same_as_by_serializing_and_decoding)
+{
+    std::mt19937 random_engine(0);
+    std::uniform_int_distribution<uint32_t> random_robot_id(0, 31);
+    for (unsigned int i = 0; i < 1000; i++)
+    {
+        TbotsProto::PrimitiveSet google_primitive_set;
+        google_primitive_set.mutable_time_sent()->set_epoch_timestamp_seconds(i * 0.5);
+        for (unsigned int j = 0; j < i % 12; j++)
+        {
+            (*google_primitive_set
+                  .mutable_robot_primitives())[random_robot_id(random_engine)] =
+                createRandomPrimitive(random_engine);
+        }
+
+        TbotsProto_PrimitiveSet nanopb_primitive_set =
+            createNanoPbPrimitiveSet(google_primitive_set);
+        TbotsProto_PrimitiveSet round_trip_primitive_set = createNanoPbMessageByRoundTrip(
+            google_primitive_set, TbotsProto_PrimitiveSet_fields,
+            TbotsProto_PrimitiveSet(TbotsProto_PrimitiveSet_init_zero));
+
+        ASSERT_EQ(round_trip_primitive_set.robot_primitives_count,
+                  nanopb_primitive_set.robot_primitives_count);
+        sortNanoPbPrimitivesByRobotId(round_trip_primitive_set);
+        sortNanoPbPrimitivesByRobotId(nanopb_primitive_set);
+        ASSERT_EQ(
+            encodeNanoPbMessage(TbotsProto_PrimitiveSet_fields,
+                                &round_trip_primitive_set),
+            encodeNanoPbMessage(TbotsProto_PrimitiveSet_fields, &nanopb_primitive_set))
+            << google_primitive_set.DebugString();
+    }
+}
@@ -1,5 +1,7 @@
 #include "software/sensor_fusion/threaded_sensor_fusion.h"
 
+#include "software/proto/message_translation/tbots_protobuf.h"
+
 ThreadedSensorFusion::ThreadedSensorFusion(
     std::shared_ptr<const SensorFusionConfig> sensor_fusion_config)
     : sensor_fusion(sensor_fusion_config)
@@ -17,6 +19,17 @@ void ThreadedSensorFusion::onValueReceived(SensorProto sensor_msg)
     std::optional<World> world = sensor_fusion.getWorld();
     if (world)
     {
+        // Only Worlds created from vision data are traced
+        if (sensor_msg.has_latency_trace())
+        {
+            world->setLatencyTrace(WorldLatencyTrace{
+                .camera_capture_time_seconds =
+                    sensor_msg.latency_trace().camera_capture_time_seconds(),
+                .backend_received_time_seconds =
+                    sensor_msg.latency_trace().backend_received_time_seconds(),
+                .sensor_fusion_time_seconds =
+                    createCurrentTimestamp()->epoch_timestamp_seconds()});
+        }
         Subject<World>::sendValueToObservers(world.value());
     }
 }
@@ -6,6 +6,7 @@
 #include "software/logger/logger.h"
 #include "software/proto/message_translation/ssl_wrapper.h"
 #include "software/test_util/test_util.h"
+#include "software/util/profiler/profiler.h"
 
 SimulatedTestFixture::SimulatedTestFixture()
     : mutable_thunderbots_config(std::make_shared<ThunderbotsConfig>()),
@@ -59,6 +60,9 @@ void SimulatedTestFixture::SetUp()
     }
     setupReplayLogging();
 
+    // Only profile this test
+    Profiler::clear();
+
     // Reset tick duration trackers
     total_tick_duration = 0.0;
     // all tick times should be greater than 0
@@ -95,6 +99,7 @@ void SimulatedTestFixture::setupReplayLogging()
     fs::create_directories(out_dir);
 
     LOG(INFO) << "Logging " << test_name << " replay to " << out_dir;
+    test_output_dir = out_dir.string();
 
     fs::path sensorproto_out_dir = out_dir / "Simulator_SensorProto";
     fs::path ssl_wrapper_out_dir = out_dir / "SensorFusion_SSL_WrapperPacket";
@@ -233,6 +238,14 @@ void SimulatedTestFixture::runTest(
     LOG(INFO) << "min tick duration: " << min_tick_duration << "ms" << std::endl;
     LOG(INFO) << "avg tick duration: " << avg_tick_duration << "ms" << std::endl;
 
+    if (test_output_dir)
+    {
+        namespace fs          = std::experimental::filesystem;
+        fs::path profile_path = fs::path(test_output_dir.value()) / "profile.json";
+        Profiler::writeChromeTrace(profile_path.string());
+        LOG(INFO) << "Wrote profile to " << profile_path;
+    }
+
     if (!validation_functions_done && !terminating_validation_functions.empty())
     {
         std::string failure_message =
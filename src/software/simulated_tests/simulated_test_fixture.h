@@ -178,6 +178,9 @@ class SimulatedTestFixture : public ::testing::Test
     // this will only be set to true if the environment variable
     // TEST_UNDECLARED_OUTPUTS_DIR is set, usually by running as a Bazel test
     bool should_log_replay;
+    // The directory the replay logs and profile of the test are output to, if
+    // TEST_UNDECLARED_OUTPUTS_DIR is set
+    std::optional<std::string> test_output_dir;
     // ProtoLoggers for the simulator and SensorFusion, respectively
     std::shared_ptr<ProtoLogger<SensorProto>> simulator_sensorproto_logger;
     std::shared_ptr<ProtoLogger<SSLProto::SSL_WrapperPacket>> sensorfusion_wrapper_logger;
@@ -63,6 +63,8 @@ class ForceWheelSimulatorRobotSingleton : public SimulatorRobotSingleton
         return static_cast<T>(0);
     }
 
-    // The simulator robot being controlled by this class
-    static std::shared_ptr<ForceWheelSimulatorRobot> force_wheel_simulator_robot;
+    // The simulator robot being controlled by this class. This is thread local so that
+    // separate Simulators can run in separate threads.
+    static thread_local std::shared_ptr<ForceWheelSimulatorRobot>
+        force_wheel_simulator_robot;
 };
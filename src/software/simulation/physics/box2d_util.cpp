@@ -59,3 +59,24 @@ float polygonArea(const b2PolygonShape& polygon)
 
     return static_cast<float>(ConvexPolygon(vertices).area());
 }
+
+Box2DBodyState getBodyState(const b2Body* body)
+{
+    return Box2DBodyState{.position         = body->GetPosition(),
+                          .angle            = body->GetAngle(),
+                          .linear_velocity  = body->GetLinearVelocity(),
+                          .angular_velocity = body->GetAngularVelocity(),
+                          .awake            = body->IsAwake()};
+}
+
+void setBodyState(b2Body* body, const Box2DBodyState& body_state)
+{
+    body->SetTransform(body_state.position, body_state.angle);
+    // Putting a body to sleep clears its velocity, so this must be set first
+    body->SetAwake(body_state.awake);
+    if (body_state.awake)
+    {
+        body->SetLinearVelocity(body_state.linear_velocity);
+        body->SetAngularVelocity(body_state.angular_velocity);
+    }
+}
@@ -5,6 +5,19 @@
 #include "software/geom/point.h"
 #include "software/geom/vector.h"
 
+/**
+ * The state of a b2Body that changes as the physics world is simulated. Saving and
+ * restoring this lets a body be recreated exactly where and how it was.
+ */
+struct Box2DBodyState
+{
+    b2Vec2 position;
+    float angle;
+    b2Vec2 linear_velocity;
+    float angular_velocity;
+    bool awake;
+};
+
 /**
  * These functions are utilities and convenience functions to make certain operations
  * with Box2D easier
@@ -68,3 +81,21 @@ Vector createVector(const b2Vec2& vec);
  * @return the area of the polygon, in m^2
  */
 float polygonArea(const b2PolygonShape& polygon);
+
+/**
+ * Returns the state of the given body
+ *
+ * @param body The body to get the state of
+ *
+ * @return the state of the given body
+ */
+Box2DBodyState getBodyState(const b2Body* body);
+
+/**
+ * Sets the state of the given body. This must not be called while the world the body
+ * is in is being stepped.
+ *
+ * @param body The body to set the state of
+ * @param body_state The state to give the body
+ */
+void setBodyState(b2Body* body, const Box2DBodyState& body_state);
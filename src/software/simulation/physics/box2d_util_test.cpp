@@ -175,3 +175,28 @@ TEST(Box2DUtilTest, test_polygon_area_with_irregular_polygon)
     float result = polygonArea(polygon);
     EXPECT_FLOAT_EQ(result, 96.0);
 }
+
+TEST(Box2DUtilTest, test_set_body_state_to_state_of_other_body)
+{
+    b2World world(b2Vec2(0, 0));
+
+    b2BodyDef body_def;
+    body_def.type = b2_dynamicBody;
+    body_def.position.Set(1, 2);
+    body_def.angle = 0.5f;
+    body_def.linearVelocity.Set(-3, 4);
+    body_def.angularVelocity = 5;
+    auto body                = world.CreateBody(&body_def);
+
+    b2BodyDef other_body_def;
+    other_body_def.type = b2_dynamicBody;
+    auto other_body     = world.CreateBody(&other_body_def);
+
+    setBodyState(other_body, getBodyState(body));
+
+    EXPECT_EQ(b2Vec2(1, 2), other_body->GetPosition());
+    EXPECT_FLOAT_EQ(0.5f, other_body->GetAngle());
+    EXPECT_EQ(b2Vec2(-3, 4), other_body->GetLinearVelocity());
+    EXPECT_FLOAT_EQ(5, other_body->GetAngularVelocity());
+    EXPECT_TRUE(other_body->IsAwake());
+}
@@ -76,6 +76,24 @@ BallState PhysicsBall::getBallState() const
     return BallState(position(), velocity(), calculateDistanceFromGround());
 }
 
+PhysicsBallSnapshot PhysicsBall::getSnapshot() const
+{
+    return PhysicsBallSnapshot{.body_state                = getBodyState(ball_body),
+                               .in_flight_origin          = in_flight_origin,
+                               .in_flight_distance_meters = in_flight_distance_meters,
+                               .flight_angle_of_departure = flight_angle_of_departure,
+                               .initial_kick_speed        = initial_kick_speed};
+}
+
+void PhysicsBall::restoreSnapshot(const PhysicsBallSnapshot &snapshot)
+{
+    setBodyState(ball_body, snapshot.body_state);
+    in_flight_origin          = snapshot.in_flight_origin;
+    in_flight_distance_meters = snapshot.in_flight_distance_meters;
+    flight_angle_of_departure = snapshot.flight_angle_of_departure;
+    initial_kick_speed        = snapshot.initial_kick_speed;
+}
+
 Point PhysicsBall::position() const
 {
     return createPoint(ball_body->GetPosition());
@@ -7,9 +7,22 @@
 #include "shared/parameter/cpp_dynamic_parameters.h"
 #include "software/geom/point.h"
 #include "software/geom/vector.h"
+#include "software/simulation/physics/box2d_util.h"
 #include "software/time/duration.h"
 #include "software/world/ball_state.h"
 
+/**
+ * Everything needed to recreate a PhysicsBall exactly as it was
+ */
+struct PhysicsBallSnapshot
+{
+    Box2DBodyState body_state;
+    std::optional<Point> in_flight_origin;
+    double in_flight_distance_meters;
+    Angle flight_angle_of_departure;
+    std::optional<double> initial_kick_speed;
+};
+
 /**
  * This class represents a ball in a Box2D physics simulation. It provides a convenient
  * way for us to abstract the ball and convert to our own Ball class when data is needed.
@@ -51,6 +64,24 @@ class PhysicsBall
      */
     BallState getBallState() const;
 
+    /**
+     * Returns a snapshot of this ball, which can be restored later with
+     * restoreSnapshot. Unlike the BallState, this includes the internal state of the
+     * ball, such as whether it is in flight.
+     *
+     * @return a snapshot of this ball
+     */
+    PhysicsBallSnapshot getSnapshot() const;
+
+    /**
+     * Sets the entire state of this ball to the state it was in when the given
+     * snapshot was taken. This must not be called while the physics world is being
+     * stepped.
+     *
+     * @param snapshot The snapshot to restore
+     */
+    void restoreSnapshot(const PhysicsBallSnapshot& snapshot);
+
     /**
      * Returns the current position of the ball, in global field coordinates, in meters
      *
@@ -219,6 +219,16 @@ RobotState PhysicsRobot::getRobotState() const
     return RobotState(position(), velocity(), orientation(), angularVelocity());
 }
 
+PhysicsRobotSnapshot PhysicsRobot::getSnapshot() const
+{
+    return PhysicsRobotSnapshot{.id = robot_id, .body_state = getBodyState(robot_body)};
+}
+
+void PhysicsRobot::restoreSnapshot(const PhysicsRobotSnapshot& snapshot)
+{
+    setBodyState(robot_body, snapshot.body_state);
+}
+
 Point PhysicsRobot::position() const
 {
     return Point(robot_body->GetPosition().x, robot_body->GetPosition().y);
@@ -3,17 +3,28 @@
 #include <Box2D/Box2D.h>
 
 #include <functional>
+#include <queue>
 
 #include "software/geom/angle.h"
 #include "software/geom/angular_velocity.h"
 #include "software/geom/point.h"
 #include "software/geom/vector.h"
 #include "software/multithreading/thread_safe_buffer.h"
+#include "software/simulation/physics/box2d_util.h"
 #include "software/simulation/physics/physics_ball.h"
 #include "software/world/robot_state.h"
 
 class PhysicsWorld;
 
+/**
+ * Everything needed to recreate a PhysicsRobot exactly as it was
+ */
+struct PhysicsRobotSnapshot
+{
+    RobotId id;
+    Box2DBodyState body_state;
+};
+
 /**
  * This class represent a Robot in a Box2D physics simulation. It provides a convenient
  * way for us to abstract the robot and convert to our own Robot alss when data is needed.
@@ -116,6 +127,23 @@ class PhysicsRobot
      */
     RobotState getRobotState() const;
 
+    /**
+     * Returns a snapshot of this robot, which can be restored later with
+     * restoreSnapshot
+     *
+     * @return a snapshot of this robot
+     */
+    PhysicsRobotSnapshot getSnapshot() const;
+
+    /**
+     * Sets the entire state of this robot to the state it was in when the given
+     * snapshot was taken. This must not be called while the physics world is being
+     * stepped.
+     *
+     * @param snapshot The snapshot to restore
+     */
+    void restoreSnapshot(const PhysicsRobotSnapshot &snapshot);
+
     /**
      * Returns the current position of the robot, in global field coordinates, in meters
      *
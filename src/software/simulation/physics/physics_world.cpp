@@ -5,6 +5,7 @@
 #include "shared/constants.h"
 #include "software/geom/algorithms/distance.h"
 #include "software/logger/logger.h"
+#include "software/simulation/physics/box2d_util.h"
 
 PhysicsWorld::PhysicsWorld(const Field& field,
                            std::shared_ptr<const SimulatorConfig> simulator_config)
@@ -279,3 +280,75 @@ void PhysicsWorld::removeRobot(std::weak_ptr<PhysicsRobot> robot)
             blue_physics_robots.end());
     }
 }
+
+PhysicsWorldSnapshot PhysicsWorld::getSnapshot() const
+{
+    PhysicsWorldSnapshot snapshot{.timestamp     = current_timestamp,
+                                  .ball          = std::nullopt,
+                                  .yellow_robots = {},
+                                  .blue_robots   = {}};
+    if (physics_ball)
+    {
+        snapshot.ball = physics_ball->getSnapshot();
+    }
+    for (const auto& robot : yellow_physics_robots)
+    {
+        snapshot.yellow_robots.emplace_back(robot->getSnapshot());
+    }
+    for (const auto& robot : blue_physics_robots)
+    {
+        snapshot.blue_robots.emplace_back(robot->getSnapshot());
+    }
+
+    return snapshot;
+}
+
+void PhysicsWorld::restoreSnapshot(const PhysicsWorldSnapshot& snapshot)
+{
+    physics_ball.reset();
+    yellow_physics_robots.clear();
+    blue_physics_robots.clear();
+
+    if (snapshot.ball)
+    {
+        const Box2DBodyState& body_state = snapshot.ball->body_state;
+        physics_ball                     = std::make_shared<PhysicsBall>(
+            b2_world,
+            BallState(createPoint(body_state.position),
+                      createVector(body_state.linear_velocity)),
+            BALL_MASS_KG, simulator_config);
+        physics_ball->restoreSnapshot(*snapshot.ball);
+    }
+
+    auto restore_robots =
+        [this](const std::vector<PhysicsRobotSnapshot>& robot_snapshots,
+               std::vector<std::shared_ptr<PhysicsRobot>>& physics_robots) {
+            for (const auto& robot_snapshot : robot_snapshots)
+            {
+                const Box2DBodyState& body_state = robot_snapshot.body_state;
+                auto physics_robot               = std::make_shared<PhysicsRobot>(
+                    robot_snapshot.id, b2_world,
+                    RobotState(createPoint(body_state.position),
+                               createVector(body_state.linear_velocity),
+                               Angle::fromRadians(body_state.angle),
+                               AngularVelocity::fromRadians(body_state.angular_velocity)),
+                    ROBOT_WITH_BATTERY_MASS_KG);
+                physics_robot->restoreSnapshot(robot_snapshot);
+                physics_robots.emplace_back(physics_robot);
+            }
+        };
+    restore_robots(snapshot.yellow_robots, yellow_physics_robots);
+    restore_robots(snapshot.blue_robots, blue_physics_robots);
+
+    // Find the contacts between the recreated bodies without moving them. Otherwise,
+    // objects that were already touching when the snapshot was taken would start
+    // touching again on the next step, and trigger the effects of a new collision
+    // (ie. the dribbler damping the ball). When the time step is zero, Box2D only
+    // finds and updates the contacts: it does not solve or integrate anything, and
+    // leaves the time step used to warm start the next step unchanged. The new robots
+    // do not have any contact callbacks registered yet, so the contact listener has no
+    // effect other than disabling contacts with a ball that is in flight.
+    b2_world->Step(0.0f, velocity_iterations, position_iterations);
+
+    current_timestamp = snapshot.timestamp;
+}
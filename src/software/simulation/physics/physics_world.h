@@ -14,6 +14,18 @@
 #include "software/world/robot_state.h"
 #include "software/world/world.h"
 
+/**
+ * Everything needed to recreate the ball and robots in a PhysicsWorld exactly as they
+ * were. The field is not included because it never changes.
+ */
+struct PhysicsWorldSnapshot
+{
+    Timestamp timestamp;
+    std::optional<PhysicsBallSnapshot> ball;
+    std::vector<PhysicsRobotSnapshot> yellow_robots;
+    std::vector<PhysicsRobotSnapshot> blue_robots;
+};
+
 /**
  * This class represents a World in a Box2D physics simulation. It provides a convenient
  * way for us to abstract and hold a lot of the world's contents. It's also used to
@@ -179,6 +191,28 @@ class PhysicsWorld
      */
     void removeRobot(std::weak_ptr<PhysicsRobot> robot);
 
+    /**
+     * Returns a snapshot of the ball and robots in this world, which can be restored
+     * later with restoreSnapshot
+     *
+     * @return a snapshot of the ball and robots in this world
+     */
+    PhysicsWorldSnapshot getSnapshot() const;
+
+    /**
+     * Replaces the ball and robots in this world with the ball and robots as they were
+     * when the given snapshot was taken, and sets the timestamp to the time the
+     * snapshot was taken. The snapshot may be from another PhysicsWorld with the same
+     * field.
+     *
+     * Box2D bodies can not be copied, so the ball and robots are recreated. Any
+     * pointers to the previous ball and robots are invalidated, and any contact
+     * callbacks must be registered again on the new robots.
+     *
+     * @param snapshot The snapshot to restore
+     */
+    void restoreSnapshot(const PhysicsWorldSnapshot& snapshot);
+
    private:
     /**
      * Returns the states and IDs of all robots of the specified colour.
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "software/physics/ball_predictor.h"
 #include "software/test_util/test_util.h"
 #include "software/world/field.h"
 
@@ -480,3 +481,224 @@ TEST_F(PhysicsWorldTest, test_get_robot_at_position_near_edge_of_robot)
     EXPECT_TRUE(
         ::TestUtil::equalWithinTolerance(physics_robot->position(), Point(1, 2), 1e-3));
 }
+
+TEST_F(PhysicsWorldTest, test_restore_snapshot_into_another_physics_world)
+{
+    BallState ball_state(Point(0, 1), Vector(2, -3));
+    std::vector<RobotStateWithId> yellow_robot_states = {RobotStateWithId{
+        .id          = 3,
+        .robot_state = RobotState(Point(1, 0), Vector(3, 0), Angle::quarter(),
+                                  AngularVelocity::half())}};
+    std::vector<RobotStateWithId> blue_robot_states   = {RobotStateWithId{
+        .id          = 5,
+        .robot_state = RobotState(Point(-1, -1), Vector(-2, 1), Angle::half(),
+                                  AngularVelocity::quarter())}};
+    physics_world->setBallState(ball_state);
+    physics_world->addYellowRobots(yellow_robot_states);
+    physics_world->addBlueRobots(blue_robot_states);
+    physics_world->stepSimulation(Duration::fromSeconds(0.1));
+
+    PhysicsWorldSnapshot snapshot = physics_world->getSnapshot();
+
+    PhysicsWorld other_physics_world(Field::createSSLDivisionBField(), simulator_config);
+    other_physics_world.addYellowRobots({RobotStateWithId{
+        .id          = 0,
+        .robot_state = RobotState(Point(2, 2), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    other_physics_world.restoreSnapshot(snapshot);
+
+    EXPECT_EQ(physics_world->getTimestamp(), other_physics_world.getTimestamp());
+    ASSERT_TRUE(other_physics_world.getBallState());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(physics_world->getBallState().value(),
+                                               other_physics_world.getBallState().value(),
+                                               1e-6));
+    EXPECT_THAT(physics_world->getYellowRobotStates(),
+                ::testing::Pointwise(RobotStateWithIdEq(),
+                                     other_physics_world.getYellowRobotStates()));
+    EXPECT_THAT(physics_world->getBlueRobotStates(),
+                ::testing::Pointwise(RobotStateWithIdEq(),
+                                     other_physics_world.getBlueRobotStates()));
+
+    // Both worlds continue the same way from the snapshot
+    physics_world->stepSimulation(Duration::fromSeconds(0.1));
+    other_physics_world.stepSimulation(Duration::fromSeconds(0.1));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(physics_world->getBallState().value(),
+                                               other_physics_world.getBallState().value(),
+                                               1e-6));
+    EXPECT_THAT(physics_world->getYellowRobotStates(),
+                ::testing::Pointwise(RobotStateWithIdEq(),
+                                     other_physics_world.getYellowRobotStates()));
+}
+
+TEST_F(PhysicsWorldTest, test_restore_snapshot_reproduces_trajectory)
+{
+    physics_world->setBallState(BallState(Point(-2, 0), Vector(4, 1)));
+    physics_world->addYellowRobots({RobotStateWithId{
+        .id          = 1,
+        .robot_state = RobotState(Point(1, -1), Vector(0.5, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    physics_world->addBlueRobots({RobotStateWithId{
+        .id          = 2,
+        .robot_state = RobotState(Point(-1, 2), Vector(0, -1), Angle::half(),
+                                  AngularVelocity::quarter())}});
+
+    // Drives the robots with the same wheel forces on every step, so that both branches
+    // receive exactly the same inputs
+    auto step = [this]() {
+        for (const auto& robot : physics_world->getYellowPhysicsRobots())
+        {
+            robot.lock()->applyWheelForceFrontLeft(1.0);
+            robot.lock()->applyWheelForceBackRight(-0.5);
+        }
+        for (const auto& robot : physics_world->getBluePhysicsRobots())
+        {
+            robot.lock()->applyWheelForceFrontRight(0.8);
+            robot.lock()->applyWheelForceBackLeft(0.8);
+        }
+        physics_world->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    };
+
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        step();
+    }
+    // Restore into a ball that is in flight, so the chip state is part of the snapshot
+    physics_world->getPhysicsBall().lock()->setInFlightForDistance(
+        1.5, Angle::fromDegrees(45));
+    PhysicsWorldSnapshot snapshot = physics_world->getSnapshot();
+
+    std::vector<BallState> ball_trajectory;
+    std::vector<bool> ball_in_flight;
+    std::vector<std::vector<RobotStateWithId>> yellow_robot_trajectory;
+    std::vector<std::vector<RobotStateWithId>> blue_robot_trajectory;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        step();
+        ball_trajectory.emplace_back(physics_world->getBallState().value());
+        ball_in_flight.emplace_back(physics_world->getPhysicsBall().lock()->isInFlight());
+        yellow_robot_trajectory.emplace_back(physics_world->getYellowRobotStates());
+        blue_robot_trajectory.emplace_back(physics_world->getBlueRobotStates());
+    }
+
+    physics_world->restoreSnapshot(snapshot);
+
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        step();
+        ASSERT_TRUE(physics_world->getBallState());
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(
+            ball_trajectory[i], physics_world->getBallState().value(), 1e-6))
+            << "Step " << i;
+        EXPECT_EQ(ball_in_flight[i], physics_world->getPhysicsBall().lock()->isInFlight())
+            << "Step " << i;
+        EXPECT_THAT(yellow_robot_trajectory[i],
+                    ::testing::Pointwise(RobotStateWithIdEq(),
+                                         physics_world->getYellowRobotStates()))
+            << "Step " << i;
+        EXPECT_THAT(blue_robot_trajectory[i],
+                    ::testing::Pointwise(RobotStateWithIdEq(),
+                                         physics_world->getBlueRobotStates()))
+            << "Step " << i;
+    }
+}
+
+TEST_F(PhysicsWorldTest, test_restore_snapshot_without_ball)
+{
+    PhysicsWorldSnapshot snapshot = physics_world->getSnapshot();
+    physics_world->setBallState(BallState(Point(0, 1), Vector(2, -3)));
+    physics_world->addBlueRobots({RobotStateWithId{
+        .id          = 0,
+        .robot_state = RobotState(Point(2, 2), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    physics_world->stepSimulation(Duration::fromSeconds(0.1));
+
+    physics_world->restoreSnapshot(snapshot);
+
+    EXPECT_EQ(Timestamp::fromSeconds(0), physics_world->getTimestamp());
+    EXPECT_FALSE(physics_world->getBallState());
+    EXPECT_TRUE(physics_world->getYellowRobotStates().empty());
+    EXPECT_TRUE(physics_world->getBlueRobotStates().empty());
+}
+
+class PhysicsWorldBallPredictorTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        auto mutable_simulator_config = std::make_shared<SimulatorConfig>();
+        mutable_simulator_config->getMutableSlidingFrictionAcceleration()->setValue(5.0);
+        mutable_simulator_config->getMutableRollingFrictionAcceleration()->setValue(0.5);
+        simulator_config = mutable_simulator_config;
+        physics_world    = std::make_shared<PhysicsWorld>(field, simulator_config);
+
+        // Box2D uses the larger restitution of the two objects that collide, and the
+        // walls and robots are less bouncy than the ball
+        const double restitution = simulator_config->getBallRestitution()->value();
+        ball_predictor           = std::make_shared<BallPredictor>(
+            field.fieldBoundary(),
+            BallModelParameters{.sliding_friction_acceleration = 5.0,
+                                .rolling_friction_acceleration = 0.5,
+                                .wall_restitution              = restitution,
+                                .robot_restitution             = restitution});
+    }
+
+    /**
+     * Checks that the ball in the physics world is where the BallPredictor predicted it
+     * would be, once every 0.25 seconds for the given duration
+     *
+     * @param duration How long to simulate for
+     * @param robot_positions The positions of the robots in the physics world
+     * @param initial_kick_speed The speed the ball was kicked at, if any
+     */
+    void expectBallFollowsPrediction(const Duration& duration,
+                                     const std::vector<Point>& robot_positions,
+                                     std::optional<double> initial_kick_speed)
+    {
+        const BallState initial_ball_state = physics_world->getBallState().value();
+        std::vector<Duration> durations;
+        for (double t = 0.25; t <= duration.toSeconds(); t += 0.25)
+        {
+            durations.emplace_back(Duration::fromSeconds(t));
+        }
+        const std::vector<BallState> predictions = ball_predictor->predictBallStates(
+            initial_ball_state, durations, robot_positions, initial_kick_speed);
+
+        // 15 steps of 1/60 seconds per prediction
+        for (const auto& prediction : predictions)
+        {
+            for (unsigned int i = 0; i < 15; i++)
+            {
+                physics_world->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+            }
+            EXPECT_TRUE(TestUtil::equalWithinTolerance(
+                prediction.position(), physics_world->getBallState()->position(), 0.05))
+                << "At " << physics_world->getTimestamp().toSeconds() << " seconds";
+        }
+    }
+
+    Field field = Field::createSSLDivisionBField();
+    std::shared_ptr<const SimulatorConfig> simulator_config;
+    std::shared_ptr<PhysicsWorld> physics_world;
+    std::shared_ptr<BallPredictor> ball_predictor;
+};
+
+TEST_F(PhysicsWorldBallPredictorTest, kicked_ball_bounces_off_wall)
+{
+    physics_world->setBallState(BallState(Point(2, 1), Vector(4, 1)));
+    physics_world->getPhysicsBall().lock()->setInitialKickSpeed(4.5);
+
+    expectBallFollowsPrediction(Duration::fromSeconds(2), {}, 4.5);
+}
+
+TEST_F(PhysicsWorldBallPredictorTest, rolling_ball_bounces_off_back_of_robot)
+{
+    const Point robot_position(1, 0);
+    physics_world->setBallState(BallState(Point(-1, 0), Vector(2, 0)));
+    physics_world->addYellowRobots({RobotStateWithId{
+        .id          = 0,
+        .robot_state = RobotState(robot_position, Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+
+    expectBallFollowsPrediction(Duration::fromSeconds(1.5), {robot_position},
+                                std::nullopt);
+}
@@ -6,7 +6,15 @@
 #include "software/math/math_functions.h"
 
 PhysicsSimulatorRobot::PhysicsSimulatorRobot(std::weak_ptr<PhysicsRobot> physics_robot)
-    : physics_robot(physics_robot), dribbler_rpm(0)
+    : physics_robot(physics_robot),
+      dribbler_rpm(0),
+      defer_actions(false),
+      deferred_front_left_wheel(),
+      deferred_back_left_wheel(),
+      deferred_back_right_wheel(),
+      deferred_front_right_wheel(),
+      deferred_kick_speed_m_per_s(),
+      deferred_chip_distance_m()
 {
     if (auto robot = this->physics_robot.lock())
     {
@@ -107,6 +115,12 @@ float PhysicsSimulatorRobot::getBatteryVoltage()
 
 void PhysicsSimulatorRobot::kick(float speed_m_per_s)
 {
+    if (defer_actions)
+    {
+        deferred_kick_speed_m_per_s = speed_m_per_s;
+        return;
+    }
+
     checkValidAndExecuteVoid([this, speed_m_per_s](auto robot) {
         if (ball_in_dribbler_area && ball_in_dribbler_area->can_be_controlled)
         {
@@ -163,6 +177,12 @@ void PhysicsSimulatorRobot::kick(float speed_m_per_s)
 
 void PhysicsSimulatorRobot::chip(float distance_m)
 {
+    if (defer_actions)
+    {
+        deferred_chip_distance_m = distance_m;
+        return;
+    }
+
     checkValidAndExecuteVoid([this, distance_m](auto robot) {
         if (ball_in_dribbler_area && ball_in_dribbler_area->can_be_controlled)
         {
@@ -247,6 +267,13 @@ void PhysicsSimulatorRobot::dribblerCoast()
 
 void PhysicsSimulatorRobot::applyWheelForceFrontLeft(float force_in_newtons)
 {
+    if (defer_actions)
+    {
+        deferred_front_left_wheel.force_in_newtons =
+            deferred_front_left_wheel.force_in_newtons.value_or(0) + force_in_newtons;
+        return;
+    }
+
     checkValidAndExecuteVoid([force_in_newtons](auto robot) {
         robot->applyWheelForceFrontLeft(force_in_newtons);
     });
@@ -254,6 +281,13 @@ void PhysicsSimulatorRobot::applyWheelForceFrontLeft(float force_in_newtons)
 
 void PhysicsSimulatorRobot::applyWheelForceBackLeft(float force_in_newtons)
 {
+    if (defer_actions)
+    {
+        deferred_back_left_wheel.force_in_newtons =
+            deferred_back_left_wheel.force_in_newtons.value_or(0) + force_in_newtons;
+        return;
+    }
+
     checkValidAndExecuteVoid([force_in_newtons](auto robot) {
         robot->applyWheelForceBackLeft(force_in_newtons);
     });
@@ -261,6 +295,13 @@ void PhysicsSimulatorRobot::applyWheelForceBackLeft(float force_in_newtons)
 
 void PhysicsSimulatorRobot::applyWheelForceBackRight(float force_in_newtons)
 {
+    if (defer_actions)
+    {
+        deferred_back_right_wheel.force_in_newtons =
+            deferred_back_right_wheel.force_in_newtons.value_or(0) + force_in_newtons;
+        return;
+    }
+
     checkValidAndExecuteVoid([force_in_newtons](auto robot) {
         robot->applyWheelForceBackRight(force_in_newtons);
     });
@@ -268,6 +309,13 @@ void PhysicsSimulatorRobot::applyWheelForceBackRight(float force_in_newtons)
 
 void PhysicsSimulatorRobot::applyWheelForceFrontRight(float force_in_newtons)
 {
+    if (defer_actions)
+    {
+        deferred_front_right_wheel.force_in_newtons =
+            deferred_front_right_wheel.force_in_newtons.value_or(0) + force_in_newtons;
+        return;
+    }
+
     checkValidAndExecuteVoid([force_in_newtons](auto robot) {
         robot->applyWheelForceFrontRight(force_in_newtons);
     });
@@ -319,21 +367,45 @@ void PhysicsSimulatorRobot::coastMotorFrontRight()
 
 void PhysicsSimulatorRobot::brakeMotorFrontLeft()
 {
+    if (defer_actions)
+    {
+        deferred_front_left_wheel.brake = true;
+        return;
+    }
+
     checkValidAndExecuteVoid([](auto robot) { robot->brakeMotorFrontLeft(); });
 }
 
 void PhysicsSimulatorRobot::brakeMotorBackLeft()
 {
+    if (defer_actions)
+    {
+        deferred_back_left_wheel.brake = true;
+        return;
+    }
+
     checkValidAndExecuteVoid([](auto robot) { robot->brakeMotorBackLeft(); });
 }
 
 void PhysicsSimulatorRobot::brakeMotorBackRight()
 {
+    if (defer_actions)
+    {
+        deferred_back_right_wheel.brake = true;
+        return;
+    }
+
     checkValidAndExecuteVoid([](auto robot) { robot->brakeMotorBackRight(); });
 }
 
 void PhysicsSimulatorRobot::brakeMotorFrontRight()
 {
+    if (defer_actions)
+    {
+        deferred_front_right_wheel.brake = true;
+        return;
+    }
+
     checkValidAndExecuteVoid([](auto robot) { robot->brakeMotorFrontRight(); });
 }
 
@@ -421,6 +493,109 @@ void PhysicsSimulatorRobot::clearBallInDribblerArea()
     ball_in_dribbler_area = std::nullopt;
 }
 
+PhysicsSimulatorRobotSnapshot PhysicsSimulatorRobot::getSnapshot(
+    std::shared_ptr<FirmwareWorld_t> firmware_world) const
+{
+    std::vector<uint8_t> primitive_manager_state(
+        app_primitive_manager_getSavedStateSize(primitive_manager.get()));
+    app_primitive_manager_saveState(primitive_manager.get(),
+                                    primitive_manager_state.data());
+
+    std::optional<bool> ball_in_dribbler_area_can_be_controlled;
+    if (ball_in_dribbler_area)
+    {
+        ball_in_dribbler_area_can_be_controlled =
+            ball_in_dribbler_area->can_be_controlled;
+    }
+
+    const FirmwareRobot_t *firmware_robot =
+        app_firmware_world_getRobot(firmware_world.get());
+
+    return PhysicsSimulatorRobotSnapshot{
+        .dribbler_rpm           = dribbler_rpm,
+        .autokick_speed_m_per_s = autokick_speed_m_per_s,
+        .autochip_distance_m    = autochip_distance_m,
+        .ball_in_dribbler_area_can_be_controlled =
+            ball_in_dribbler_area_can_be_controlled,
+        .primitive_manager_state = primitive_manager_state,
+        .controller_state = *app_firmware_robot_getControllerState(firmware_robot)};
+}
+
+void PhysicsSimulatorRobot::restoreSnapshot(
+    const PhysicsSimulatorRobotSnapshot &snapshot,
+    std::shared_ptr<FirmwareWorld_t> firmware_world,
+    std::weak_ptr<PhysicsBall> physics_ball)
+{
+    dribbler_rpm           = snapshot.dribbler_rpm;
+    autokick_speed_m_per_s = snapshot.autokick_speed_m_per_s;
+    autochip_distance_m    = snapshot.autochip_distance_m;
+
+    ball_in_dribbler_area = std::nullopt;
+    auto ball             = physics_ball.lock();
+    if (snapshot.ball_in_dribbler_area_can_be_controlled && ball)
+    {
+        ball_in_dribbler_area = DribblerBall{
+            .ball              = ball.get(),
+            .can_be_controlled = *snapshot.ball_in_dribbler_area_can_be_controlled};
+    }
+
+    app_primitive_manager_restoreState(primitive_manager.get(),
+                                       snapshot.primitive_manager_state.data());
+
+    const FirmwareRobot_t *firmware_robot =
+        app_firmware_world_getRobot(firmware_world.get());
+    *app_firmware_robot_getControllerState(firmware_robot) = snapshot.controller_state;
+}
+
+void PhysicsSimulatorRobot::startDeferringActions()
+{
+    defer_actions = true;
+}
+
+void PhysicsSimulatorRobot::applyDeferredActions()
+{
+    // Stop deferring first, so that the actions are actually performed
+    defer_actions = false;
+
+    auto apply_wheel_actions =
+        [this](DeferredWheelActions &wheel_actions,
+               void (PhysicsSimulatorRobot::*apply_wheel_force)(float),
+               void (PhysicsSimulatorRobot::*brake_motor)()) {
+            if (wheel_actions.force_in_newtons)
+            {
+                (this->*apply_wheel_force)(*wheel_actions.force_in_newtons);
+            }
+            if (wheel_actions.brake)
+            {
+                (this->*brake_motor)();
+            }
+            wheel_actions = DeferredWheelActions();
+        };
+    apply_wheel_actions(deferred_front_left_wheel,
+                        &PhysicsSimulatorRobot::applyWheelForceFrontLeft,
+                        &PhysicsSimulatorRobot::brakeMotorFrontLeft);
+    apply_wheel_actions(deferred_back_left_wheel,
+                        &PhysicsSimulatorRobot::applyWheelForceBackLeft,
+                        &PhysicsSimulatorRobot::brakeMotorBackLeft);
+    apply_wheel_actions(deferred_back_right_wheel,
+                        &PhysicsSimulatorRobot::applyWheelForceBackRight,
+                        &PhysicsSimulatorRobot::brakeMotorBackRight);
+    apply_wheel_actions(deferred_front_right_wheel,
+                        &PhysicsSimulatorRobot::applyWheelForceFrontRight,
+                        &PhysicsSimulatorRobot::brakeMotorFrontRight);
+
+    if (deferred_kick_speed_m_per_s)
+    {
+        kick(*deferred_kick_speed_m_per_s);
+        deferred_kick_speed_m_per_s.reset();
+    }
+    if (deferred_chip_distance_m)
+    {
+        chip(*deferred_chip_distance_m);
+        deferred_chip_distance_m.reset();
+    }
+}
+
 void PhysicsSimulatorRobot::applyDribblerForce(PhysicsRobot *physics_robot,
                                                PhysicsBall *physics_ball)
 {
@@ -1,12 +1,33 @@
 #pragma once
 
 #include <cinttypes>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "software/simulation/force_wheel_simulator_robot.h"
 #include "software/simulation/physics/physics_ball.h"
 #include "software/simulation/physics/physics_robot.h"
 
+/**
+ * Everything needed to restore the simulated hardware and firmware of a
+ * PhysicsSimulatorRobot exactly as they were
+ */
+struct PhysicsSimulatorRobotSnapshot
+{
+    uint32_t dribbler_rpm;
+    std::optional<float> autokick_speed_m_per_s;
+    std::optional<float> autochip_distance_m;
+    // Whether the ball was in the dribbler area, and if so whether the robot could
+    // control it
+    std::optional<bool> ball_in_dribbler_area_can_be_controlled;
+    // The primitive the robot was running and its state, as saved by the primitive
+    // manager
+    std::vector<uint8_t> primitive_manager_state;
+    ControllerState_t controller_state;
+};
+
 /**
  * The PhysicsSimulatorRobot class acts as a wrapper for a PhysicsRobot that deals with
  * more logic-focused elements for simulation, such as whether or not autokick is enabled.
@@ -32,6 +53,48 @@ class PhysicsSimulatorRobot : public ForceWheelSimulatorRobot
      */
     void clearBallInDribblerArea();
 
+    /**
+     * Returns a snapshot of the simulated hardware and firmware of this robot, which
+     * can be restored later with restoreSnapshot
+     *
+     * @param firmware_world The world the firmware of this robot runs in
+     *
+     * @return a snapshot of the simulated hardware and firmware of this robot
+     */
+    PhysicsSimulatorRobotSnapshot getSnapshot(
+        std::shared_ptr<FirmwareWorld_t> firmware_world) const;
+
+    /**
+     * Sets the simulated hardware and firmware of this robot to the state they were in
+     * when the given snapshot was taken. The snapshot may be from another
+     * PhysicsSimulatorRobot.
+     *
+     * @param snapshot The snapshot to restore
+     * @param firmware_world The world the firmware of this robot runs in
+     * @param physics_ball The ball in the physics world, which is the ball in the
+     * dribbler area if there was one when the snapshot was taken
+     */
+    void restoreSnapshot(const PhysicsSimulatorRobotSnapshot& snapshot,
+                         std::shared_ptr<FirmwareWorld_t> firmware_world,
+                         std::weak_ptr<PhysicsBall> physics_ball);
+
+    /**
+     * Starts deferring the actions the firmware of this robot takes that change the
+     * physics world, ie. applying wheel forces, braking, kicking and chipping. Until
+     * applyDeferredActions is called, these actions are recorded instead of performed,
+     * so the firmware only reads from the physics world and the firmware of many robots
+     * can run at the same time.
+     */
+    void startDeferringActions();
+
+    /**
+     * Performs the deferred actions and stops deferring actions. The forces applied to
+     * each wheel are summed and applied before the wheel is braked, and the robot kicks
+     * before it chips. This must not be called while the firmware of any robot is
+     * running or the physics world is being stepped.
+     */
+    void applyDeferredActions();
+
    protected:
     float getPositionX() override;
 
@@ -163,6 +226,26 @@ class PhysicsSimulatorRobot : public ForceWheelSimulatorRobot
 
     std::optional<DribblerBall> ball_in_dribbler_area;
 
+    /**
+     * The actions the firmware took on a wheel while actions were deferred
+     */
+    struct DeferredWheelActions
+    {
+        // The sum of the forces applied to the wheel, if any were
+        std::optional<float> force_in_newtons;
+        bool brake = false;
+    };
+
+    // The actions the firmware took while actions were deferred. These are plain values
+    // rather than a list of callbacks so that deferring an action never allocates.
+    bool defer_actions;
+    DeferredWheelActions deferred_front_left_wheel;
+    DeferredWheelActions deferred_back_left_wheel;
+    DeferredWheelActions deferred_back_right_wheel;
+    DeferredWheelActions deferred_front_right_wheel;
+    std::optional<float> deferred_kick_speed_m_per_s;
+    std::optional<float> deferred_chip_distance_m;
+
     // How much the dribbler damps the ball when they collide. Each component
     // of the damping can be changed separately so we have the flexibility to tune
     // this behavior to match real life. These values have been manually tuned
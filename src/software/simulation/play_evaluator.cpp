@@ -0,0 +1,295 @@
+#include "software/simulation/play_evaluator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#include "software/ai/ai.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
+
+PlayEvaluator::PlayEvaluator(std::shared_ptr<const ThunderbotsConfig> yellow_config,
+                             std::shared_ptr<const ThunderbotsConfig> blue_config,
+                             const std::vector<Polygon>& zones,
+                             double initial_position_standard_deviation_meters)
+    : yellow_config(yellow_config),
+      blue_config(blue_config),
+      zones(zones),
+      initial_position_standard_deviation_meters(
+          initial_position_standard_deviation_meters)
+{
+}
+
+GameOutcome PlayEvaluator::runGame(const World& initial_world,
+                                   const Duration& game_duration,
+                                   unsigned int random_seed) const
+{
+    std::mt19937 random_number_generator(random_seed);
+    const World start_world     = perturbWorld(initial_world, random_number_generator);
+    const GameState& game_state = initial_world.gameState();
+    const auto yellow_goalie_id = initial_world.friendlyTeam().getGoalieId();
+    const auto blue_goalie_id   = initial_world.enemyTeam().getGoalieId();
+
+    GameOutcome outcome{.random_seed            = random_seed,
+                        .yellow_goals           = 0,
+                        .blue_goals             = 0,
+                        .yellow_possession_time = Duration::fromSeconds(0),
+                        .blue_possession_time   = Duration::fromSeconds(0),
+                        .ball_in_zone_times     = std::vector<Duration>(zones.size()),
+                        .game_duration          = game_duration};
+
+    const Duration ai_tick_period = Duration::fromSeconds(AI_TICK_PERIOD_SECONDS);
+    const auto num_ticks          = static_cast<unsigned int>(
+        std::ceil(game_duration.toSeconds() / AI_TICK_PERIOD_SECONDS));
+
+    // Each point (ie. the play from the initial positions until a goal is scored) is
+    // simulated with a new Simulator and AIs, so no state carries over from the
+    // previous point
+    std::unique_ptr<Simulator> simulator;
+    std::unique_ptr<AI> yellow_ai;
+    std::unique_ptr<AI> blue_ai;
+    auto start_point = [&]() {
+        simulator = createSimulator(start_world);
+        yellow_ai = std::make_unique<AI>(
+            yellow_config->getAiConfig(), yellow_config->getAiControlConfig(),
+            yellow_config->getPlayConfig(), random_number_generator());
+        blue_ai = std::make_unique<AI>(
+            blue_config->getAiConfig(), blue_config->getAiControlConfig(),
+            blue_config->getPlayConfig(), random_number_generator());
+    };
+    start_point();
+
+    for (unsigned int tick = 0; tick < num_ticks; tick++)
+    {
+        const World yellow_world = updateWorld(simulator->getWorld(), game_state,
+                                               yellow_goalie_id, blue_goalie_id);
+        const World blue_world   = updateWorld(createBlueWorld(yellow_world), game_state,
+                                             blue_goalie_id, yellow_goalie_id);
+
+        simulator->setYellowRobotPrimitiveSet(
+            createNanoPbPrimitiveSet(*yellow_ai->getPrimitives(yellow_world)));
+        simulator->setBlueRobotPrimitiveSet(
+            createNanoPbPrimitiveSet(*blue_ai->getPrimitives(blue_world)));
+        simulator->stepSimulation(ai_tick_period);
+
+        const World world         = simulator->getWorld();
+        const Point ball_point    = world.ball().position();
+        const auto has_possession = [&ball_point](const Team& team) {
+            const auto& robots = team.getAllRobots();
+            return std::any_of(robots.begin(), robots.end(), [&](const Robot& robot) {
+                return robot.isNearDribbler(ball_point);
+            });
+        };
+        if (has_possession(world.friendlyTeam()))
+        {
+            outcome.yellow_possession_time =
+                outcome.yellow_possession_time + ai_tick_period;
+        }
+        if (has_possession(world.enemyTeam()))
+        {
+            outcome.blue_possession_time = outcome.blue_possession_time + ai_tick_period;
+        }
+        for (size_t i = 0; i < zones.size(); i++)
+        {
+            if (contains(zones[i], ball_point))
+            {
+                outcome.ball_in_zone_times[i] =
+                    outcome.ball_in_zone_times[i] + ai_tick_period;
+            }
+        }
+
+        if (contains(world.field().enemyGoal(), ball_point))
+        {
+            outcome.yellow_goals++;
+            start_point();
+        }
+        else if (contains(world.field().friendlyGoal(), ball_point))
+        {
+            outcome.blue_goals++;
+            start_point();
+        }
+    }
+
+    return outcome;
+}
+
+PlayEvaluationResults PlayEvaluator::runGames(
+    const World& initial_world, const Duration& game_duration,
+    const std::vector<unsigned int>& random_seeds, unsigned int num_threads) const
+{
+    num_threads = std::max(1u, num_threads);
+    std::vector<GameOutcome> game_outcomes(random_seeds.size());
+    std::atomic<size_t> next_game(0);
+
+    const auto wall_start_time = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back([&]() {
+            for (size_t game = next_game++; game < random_seeds.size();
+                 game        = next_game++)
+            {
+                game_outcomes[game] =
+                    runGame(initial_world, game_duration, random_seeds[game]);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const double wall_time_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start_time)
+            .count();
+
+    PlayEvaluationResults results{
+        .game_outcomes                   = game_outcomes,
+        .mean_yellow_goals               = 0.0,
+        .mean_blue_goals                 = 0.0,
+        .mean_yellow_possession_fraction = 0.0,
+        .mean_blue_possession_fraction   = 0.0,
+        .mean_ball_in_zone_fractions     = std::vector<double>(zones.size(), 0.0),
+        .simulated_seconds_per_wall_second_per_thread = 0.0,
+        .num_threads                                  = num_threads};
+    if (game_outcomes.empty())
+    {
+        return results;
+    }
+
+    const double num_games        = static_cast<double>(game_outcomes.size());
+    const double duration_seconds = game_duration.toSeconds();
+    for (const auto& outcome : game_outcomes)
+    {
+        results.mean_yellow_goals += outcome.yellow_goals / num_games;
+        results.mean_blue_goals += outcome.blue_goals / num_games;
+        results.mean_yellow_possession_fraction +=
+            outcome.yellow_possession_time.toSeconds() / duration_seconds / num_games;
+        results.mean_blue_possession_fraction +=
+            outcome.blue_possession_time.toSeconds() / duration_seconds / num_games;
+        for (size_t i = 0; i < zones.size(); i++)
+        {
+            results.mean_ball_in_zone_fractions[i] +=
+                outcome.ball_in_zone_times[i].toSeconds() / duration_seconds / num_games;
+        }
+    }
+    results.simulated_seconds_per_wall_second_per_thread =
+        duration_seconds * num_games / wall_time_seconds / num_threads;
+
+    return results;
+}
+
+World PlayEvaluator::perturbWorld(const World& world,
+                                  std::mt19937& random_number_generator) const
+{
+    std::normal_distribution<double> distribution(
+        0.0, initial_position_standard_deviation_meters);
+    auto perturb = [&](const Point& position) {
+        return position + Vector(distribution(random_number_generator),
+                                 distribution(random_number_generator));
+    };
+
+    const Timestamp timestamp  = world.getMostRecentTimestamp();
+    const BallState ball_state = world.ball().currentState();
+    Ball ball(BallState(perturb(ball_state.position()), ball_state.velocity(),
+                        ball_state.distanceFromGround()),
+              timestamp);
+
+    auto perturb_team = [&](const Team& team) {
+        std::vector<Robot> robots;
+        for (const auto& robot : team.getAllRobots())
+        {
+            const RobotState state = robot.currentState();
+            robots.emplace_back(robot.id(),
+                                RobotState(perturb(state.position()), state.velocity(),
+                                           state.orientation(), state.angularVelocity()),
+                                timestamp);
+        }
+        return Team(robots);
+    };
+
+    World perturbed_world(world.field(), ball, perturb_team(world.friendlyTeam()),
+                          perturb_team(world.enemyTeam()));
+    return updateWorld(perturbed_world, world.gameState(),
+                       world.friendlyTeam().getGoalieId(),
+                       world.enemyTeam().getGoalieId());
+}
+
+std::unique_ptr<Simulator> PlayEvaluator::createSimulator(const World& world) const
+{
+    auto simulator =
+        std::make_unique<Simulator>(world.field(), yellow_config->getSimulatorConfig());
+    simulator->resetCurrentFirmwareTime();
+    simulator->setBallState(world.ball().currentState());
+
+    auto robot_states = [](const Team& team) {
+        std::vector<RobotStateWithId> states;
+        for (const auto& robot : team.getAllRobots())
+        {
+            states.emplace_back(
+                RobotStateWithId{.id = robot.id(), .robot_state = robot.currentState()});
+        }
+        return states;
+    };
+    simulator->addYellowRobots(robot_states(world.friendlyTeam()));
+    simulator->addBlueRobots(robot_states(world.enemyTeam()));
+
+    // The blue AI is given a World where it defends the negative x side, so its
+    // primitives must be flipped back
+    DefendingSideProto blue_defending_side;
+    blue_defending_side.set_defending_side(
+        DefendingSideProto::FieldSide::DefendingSideProto_FieldSide_POS_X);
+    simulator->setBlueTeamDefendingSide(blue_defending_side);
+
+    return simulator;
+}
+
+World PlayEvaluator::createBlueWorld(const World& yellow_world)
+{
+    auto rotate = [](const Point& point) { return Point(-point.x(), -point.y()); };
+
+    const BallState ball_state = yellow_world.ball().currentState();
+    Ball ball(BallState(rotate(ball_state.position()), -ball_state.velocity(),
+                        ball_state.distanceFromGround()),
+              yellow_world.ball().timestamp());
+
+    auto rotate_team = [&](const Team& team) {
+        std::vector<Robot> robots;
+        for (const auto& robot : team.getAllRobots())
+        {
+            const RobotState state = robot.currentState();
+            robots.emplace_back(
+                robot.id(),
+                RobotState(rotate(state.position()), -state.velocity(),
+                           state.orientation() + Angle::half(), state.angularVelocity()),
+                robot.timestamp());
+        }
+        return Team(robots);
+    };
+
+    return World(yellow_world.field(), ball, rotate_team(yellow_world.enemyTeam()),
+                 rotate_team(yellow_world.friendlyTeam()));
+}
+
+World PlayEvaluator::updateWorld(const World& world, const GameState& game_state,
+                                 std::optional<unsigned int> friendly_goalie_id,
+                                 std::optional<unsigned int> enemy_goalie_id)
+{
+    World updated_world = world;
+    updated_world.updateGameState(game_state);
+
+    Team friendly_team = updated_world.friendlyTeam();
+    if (friendly_goalie_id && friendly_team.getRobotById(*friendly_goalie_id))
+    {
+        friendly_team.assignGoalie(*friendly_goalie_id);
+        updated_world.updateFriendlyTeamState(friendly_team);
+    }
+    Team enemy_team = updated_world.enemyTeam();
+    if (enemy_goalie_id && enemy_team.getRobotById(*enemy_goalie_id))
+    {
+        enemy_team.assignGoalie(*enemy_goalie_id);
+        updated_world.updateEnemyTeamState(enemy_team);
+    }
+
+    return updated_world;
+}
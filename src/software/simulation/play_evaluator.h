@@ -0,0 +1,171 @@
+#pragma once
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/geom/polygon.h"
+#include "software/simulation/simulator.h"
+#include "software/time/duration.h"
+#include "software/world/world.h"
+
+/**
+ * The outcome of a single simulated game
+ */
+struct GameOutcome
+{
+    // The seed the game was simulated with
+    unsigned int random_seed;
+    unsigned int yellow_goals;
+    unsigned int blue_goals;
+    // How long a robot on each team had the ball near its dribbler. Both teams can have
+    // possession at the same time.
+    Duration yellow_possession_time;
+    Duration blue_possession_time;
+    // How long the ball was in each of the zones of the PlayEvaluator, in order
+    std::vector<Duration> ball_in_zone_times;
+    Duration game_duration;
+};
+
+/**
+ * The outcomes of many simulated games, and statistics across all of them
+ */
+struct PlayEvaluationResults
+{
+    // The outcome of each game, in the order of the seeds they were simulated with
+    std::vector<GameOutcome> game_outcomes;
+
+    double mean_yellow_goals;
+    double mean_blue_goals;
+    // The mean fraction of each game that each team had possession of the ball
+    double mean_yellow_possession_fraction;
+    double mean_blue_possession_fraction;
+    // The mean fraction of each game that the ball was in each zone
+    std::vector<double> mean_ball_in_zone_fractions;
+
+    // The number of seconds of games simulated per second of wall-clock time, divided
+    // by the number of threads the games were simulated in
+    double simulated_seconds_per_wall_second_per_thread;
+    unsigned int num_threads;
+};
+
+/**
+ * The PlayEvaluator evaluates how well two AIs play against each other by simulating
+ * many short games between them and collecting statistics about the outcomes.
+ *
+ * Unlike the SimulatedTestFixture, there is no SensorFusion, validation or
+ * visualization: the Simulator and both AIs are stepped in lock-step, as fast as
+ * possible, with each AI given the true state of the simulation. Every game is
+ * deterministic, so simulating a game with the same seed always has the same outcome.
+ * The seed determines the random decisions of each AI and a small random perturbation
+ * of the initial positions of the ball and robots, so that games with different seeds
+ * play out differently.
+ *
+ * The yellow team is the friendly team of the initial World and defends the negative x
+ * side of the field. The blue team is its enemy team. Each AI is given the World from
+ * its own perspective, with the same GameState. When either team scores, the ball and
+ * robots are reset to their initial positions and the game continues.
+ */
+class PlayEvaluator
+{
+   public:
+    /**
+     * Creates a new PlayEvaluator
+     *
+     * @param yellow_config The config of the yellow team's AI, which is also used to
+     * configure the Simulator
+     * @param blue_config The config of the blue team's AI
+     * @param zones The zones to measure how long the ball spends in, in the coordinates
+     * of the yellow team
+     * @param initial_position_standard_deviation_meters The standard deviation of the
+     * random perturbation of the initial positions of the ball and robots
+     */
+    explicit PlayEvaluator(std::shared_ptr<const ThunderbotsConfig> yellow_config,
+                           std::shared_ptr<const ThunderbotsConfig> blue_config,
+                           const std::vector<Polygon>& zones                 = {},
+                           double initial_position_standard_deviation_meters = 0.05);
+    PlayEvaluator() = delete;
+
+    /**
+     * Simulates a single game, in the calling thread
+     *
+     * @param initial_world The initial state of the game
+     * @param game_duration How long to simulate the game for
+     * @param random_seed The seed to simulate the game with
+     *
+     * @return the outcome of the game
+     */
+    GameOutcome runGame(const World& initial_world, const Duration& game_duration,
+                        unsigned int random_seed) const;
+
+    /**
+     * Simulates a game for each of the given seeds, spread across the given number of
+     * threads
+     *
+     * @param initial_world The initial state of every game
+     * @param game_duration How long to simulate each game for
+     * @param random_seeds The seeds to simulate the games with
+     * @param num_threads The number of threads to simulate games in
+     *
+     * @return the outcomes of the games and statistics across all of them
+     */
+    PlayEvaluationResults runGames(const World& initial_world,
+                                   const Duration& game_duration,
+                                   const std::vector<unsigned int>& random_seeds,
+                                   unsigned int num_threads) const;
+
+   private:
+    /**
+     * Returns a copy of the given World with the positions of the ball and robots
+     * randomly perturbed
+     *
+     * @param world The World to perturb
+     * @param random_number_generator The random number generator to perturb it with
+     *
+     * @return the perturbed World
+     */
+    World perturbWorld(const World& world, std::mt19937& random_number_generator) const;
+
+    /**
+     * Creates a Simulator containing the ball and robots of the given World
+     *
+     * @param world The World to create the Simulator from
+     *
+     * @return a Simulator containing the ball and robots of the given World
+     */
+    std::unique_ptr<Simulator> createSimulator(const World& world) const;
+
+    /**
+     * Returns the World from the perspective of the blue team, given the World from
+     * the perspective of the yellow team. The teams are swapped and everything is
+     * rotated by half a turn, so that the blue team defends the negative x side.
+     *
+     * @param yellow_world The World from the perspective of the yellow team
+     *
+     * @return the World from the perspective of the blue team
+     */
+    static World createBlueWorld(const World& yellow_world);
+
+    /**
+     * Returns the given World with the given GameState and goalies
+     *
+     * @param world The World to update
+     * @param game_state The GameState to give the World
+     * @param friendly_goalie_id The goalie of the friendly team, if any
+     * @param enemy_goalie_id The goalie of the enemy team, if any
+     *
+     * @return the updated World
+     */
+    static World updateWorld(const World& world, const GameState& game_state,
+                             std::optional<unsigned int> friendly_goalie_id,
+                             std::optional<unsigned int> enemy_goalie_id);
+
+    std::shared_ptr<const ThunderbotsConfig> yellow_config;
+    std::shared_ptr<const ThunderbotsConfig> blue_config;
+    std::vector<Polygon> zones;
+    double initial_position_standard_deviation_meters;
+
+    // How often each AI is ticked, matching the simulated tests
+    static constexpr double AI_TICK_PERIOD_SECONDS = 1.0 / 30.0;
+};
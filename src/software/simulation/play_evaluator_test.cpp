@@ -0,0 +1,99 @@
+#include "software/simulation/play_evaluator.h"
+
+#include <gtest/gtest.h>
+
+#include "software/geom/rectangle.h"
+#include "software/test_util/test_util.h"
+
+class PlayEvaluatorTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // Robots that do nothing make the outcome of each game easy to predict
+        auto mutable_config = std::make_shared<ThunderbotsConfig>();
+        mutable_config->getMutableAiControlConfig()->getMutableOverrideAiPlay()->setValue(
+            true);
+        mutable_config->getMutableAiControlConfig()->getMutableCurrentAiPlay()->setValue(
+            "HaltPlay");
+        config = mutable_config;
+
+        world = ::TestUtil::createBlankTestingWorld();
+        world = ::TestUtil::setFriendlyRobotPositions(world, {Point(-3, 0), Point(-2, 1)},
+                                                      Timestamp::fromSeconds(0));
+        world = ::TestUtil::setEnemyRobotPositions(world, {Point(3, 0), Point(2, -1)},
+                                                   Timestamp::fromSeconds(0));
+    }
+
+    std::shared_ptr<const ThunderbotsConfig> config;
+    World world = ::TestUtil::createBlankTestingWorld();
+};
+
+TEST_F(PlayEvaluatorTest, games_with_the_same_seed_have_the_same_outcome)
+{
+    world = ::TestUtil::setBallVelocity(world, Vector(2, 0.5), Timestamp::fromSeconds(0));
+    PlayEvaluator play_evaluator(config, config, {Rectangle(Point(0, 0), Point(2, 2))});
+
+    GameOutcome first_outcome =
+        play_evaluator.runGame(world, Duration::fromSeconds(1), 7);
+    GameOutcome second_outcome =
+        play_evaluator.runGame(world, Duration::fromSeconds(1), 7);
+
+    EXPECT_EQ(first_outcome.yellow_goals, second_outcome.yellow_goals);
+    EXPECT_EQ(first_outcome.blue_goals, second_outcome.blue_goals);
+    EXPECT_EQ(first_outcome.yellow_possession_time,
+              second_outcome.yellow_possession_time);
+    EXPECT_EQ(first_outcome.blue_possession_time, second_outcome.blue_possession_time);
+    EXPECT_EQ(first_outcome.ball_in_zone_times, second_outcome.ball_in_zone_times);
+}
+
+TEST_F(PlayEvaluatorTest, ball_shot_into_enemy_goal_scores_for_yellow)
+{
+    world =
+        ::TestUtil::setBallPosition(world, Point(3.5, 0.5), Timestamp::fromSeconds(0));
+    world = ::TestUtil::setBallVelocity(world, Vector(5, 0), Timestamp::fromSeconds(0));
+    PlayEvaluator play_evaluator(config, config, {}, 0.0);
+
+    GameOutcome outcome = play_evaluator.runGame(world, Duration::fromSeconds(1), 0);
+
+    EXPECT_GE(outcome.yellow_goals, 1u);
+    EXPECT_EQ(outcome.blue_goals, 0u);
+}
+
+TEST_F(PlayEvaluatorTest, time_the_ball_spends_in_each_zone)
+{
+    PlayEvaluator play_evaluator(config, config,
+                                 {Rectangle(Point(-0.5, -0.5), Point(0.5, 0.5)),
+                                  Rectangle(Point(1, 1), Point(2, 2))},
+                                 0.0);
+
+    GameOutcome outcome = play_evaluator.runGame(world, Duration::fromSeconds(0.5), 0);
+
+    ASSERT_EQ(outcome.ball_in_zone_times.size(), 2u);
+    EXPECT_NEAR(outcome.ball_in_zone_times[0].toSeconds(), 0.5, 1e-6);
+    EXPECT_EQ(outcome.ball_in_zone_times[1], Duration::fromSeconds(0));
+    EXPECT_EQ(outcome.yellow_possession_time, Duration::fromSeconds(0));
+    EXPECT_EQ(outcome.blue_possession_time, Duration::fromSeconds(0));
+}
+
+TEST_F(PlayEvaluatorTest, run_games_in_parallel_returns_outcomes_in_seed_order)
+{
+    world = ::TestUtil::setBallVelocity(world, Vector(1, 1), Timestamp::fromSeconds(0));
+    PlayEvaluator play_evaluator(config, config, {Rectangle(Point(0, 0), Point(1, 1))});
+    std::vector<unsigned int> random_seeds = {3, 1, 4, 1, 5};
+
+    PlayEvaluationResults results = play_evaluator.runGames(
+        world, Duration::fromSeconds(0.5), random_seeds, /* num_threads = */ 2);
+
+    ASSERT_EQ(results.game_outcomes.size(), random_seeds.size());
+    for (size_t i = 0; i < random_seeds.size(); i++)
+    {
+        EXPECT_EQ(results.game_outcomes[i].random_seed, random_seeds[i]);
+    }
+    // Games with the same seed may be simulated in different threads, but must still
+    // have the same outcome
+    EXPECT_EQ(results.game_outcomes[1].ball_in_zone_times,
+              results.game_outcomes[3].ball_in_zone_times);
+    EXPECT_EQ(results.num_threads, 2u);
+    EXPECT_GT(results.simulated_seconds_per_wall_second_per_thread, 0.0);
+}
@@ -0,0 +1,298 @@
+#include "software/simulation/simulated_vision.h"
+
+#include <algorithm>
+
+#include "shared/constants.h"
+#include "software/geom/algorithms/contains.h"
+#include "software/geom/algorithms/distance.h"
+#include "software/geom/segment.h"
+#include "software/proto/message_translation/ssl_detection.h"
+
+SimulatedVisionConfig SimulatedVisionConfig::createIdealSingleCamera(
+    const Field& field, const Duration& frame_period)
+{
+    // The field boundary is walled off in simulation, so a camera that sees the whole
+    // boundary sees every object
+    SimulatedCamera camera{.camera_id                  = 0,
+                           .field_of_view              = field.fieldBoundary(),
+                           .position                   = field.centerPoint(),
+                           .height_meters              = 4.0,
+                           .frame_period               = frame_period,
+                           .capture_offset             = Duration::fromSeconds(0),
+                           .latency                    = Duration::fromSeconds(0),
+                           .latency_standard_deviation = Duration::fromSeconds(0)};
+
+    return SimulatedVisionConfig{.cameras                                      = {camera},
+                                 .ball_position_standard_deviation_meters      = 0.0,
+                                 .robot_position_standard_deviation_meters     = 0.0,
+                                 .robot_orientation_standard_deviation_radians = 0.0,
+                                 .missed_detection_probability                 = 0.0,
+                                 .dropped_frame_probability                    = 0.0,
+                                 .simulate_occlusion                           = false,
+                                 .geometry_period = Duration::fromSeconds(0),
+                                 .random_seed     = 0};
+}
+
+SimulatedVisionConfig SimulatedVisionConfig::createCameraGrid(
+    const Field& field, unsigned int num_cameras_x, unsigned int num_cameras_y,
+    double overlap_meters, const Duration& frame_period, unsigned int random_seed)
+{
+    const Rectangle boundary       = field.fieldBoundary();
+    const double cell_x_length     = boundary.xLength() / num_cameras_x;
+    const double cell_y_length     = boundary.yLength() / num_cameras_y;
+    const unsigned int num_cameras = num_cameras_x * num_cameras_y;
+
+    std::vector<SimulatedCamera> cameras;
+    for (unsigned int row = 0; row < num_cameras_y; row++)
+    {
+        for (unsigned int column = 0; column < num_cameras_x; column++)
+        {
+            const unsigned int camera_id = row * num_cameras_x + column;
+            const Point cell_min(boundary.xMin() + column * cell_x_length,
+                                 boundary.yMin() + row * cell_y_length);
+            const Point cell_max = cell_min + Vector(cell_x_length, cell_y_length);
+            const Vector overlap(overlap_meters, overlap_meters);
+
+            cameras.emplace_back(SimulatedCamera{
+                .camera_id      = camera_id,
+                .field_of_view  = Rectangle(cell_min - overlap, cell_max + overlap),
+                .position       = cell_min + (cell_max - cell_min) / 2,
+                .height_meters  = 4.0,
+                .frame_period   = frame_period,
+                .capture_offset = Duration::fromSeconds(frame_period.toSeconds() *
+                                                        camera_id / num_cameras),
+                .latency        = Duration::fromMilliseconds(10),
+                .latency_standard_deviation = Duration::fromMilliseconds(2)});
+        }
+    }
+
+    return SimulatedVisionConfig{.cameras                                      = cameras,
+                                 .ball_position_standard_deviation_meters      = 0.002,
+                                 .robot_position_standard_deviation_meters     = 0.002,
+                                 .robot_orientation_standard_deviation_radians = 0.01,
+                                 .missed_detection_probability                 = 0.01,
+                                 .dropped_frame_probability                    = 0.005,
+                                 .simulate_occlusion                           = true,
+                                 .geometry_period = Duration::fromSeconds(3),
+                                 .random_seed     = random_seed};
+}
+
+SimulatedVision::SimulatedVision(const SimulatedVisionConfig& config,
+                                 const SSLProto::SSL_GeometryData& geometry_data,
+                                 const Timestamp& start_time)
+    : config(config),
+      geometry_data(geometry_data),
+      camera_states(),
+      next_capture_time(start_time),
+      next_geometry_time(start_time),
+      unsent_packets(),
+      detected_balls(),
+      detected_yellow_robots(),
+      detected_blue_robots(),
+      random_number_generator(config.random_seed),
+      standard_normal_distribution(0.0, 1.0),
+      uniform_distribution(0.0, 1.0)
+{
+    for (const auto& camera : config.cameras)
+    {
+        camera_states.emplace_back(
+            CameraState{.next_capture_time = start_time + camera.capture_offset,
+                        .last_sent_time    = start_time,
+                        .frame_number      = 0});
+    }
+
+    if (!camera_states.empty())
+    {
+        next_capture_time =
+            std::min_element(camera_states.begin(), camera_states.end(),
+                             [](const CameraState& a, const CameraState& b) {
+                                 return a.next_capture_time < b.next_capture_time;
+                             })
+                ->next_capture_time;
+    }
+}
+
+const SimulatedVisionConfig& SimulatedVision::getConfig() const
+{
+    return config;
+}
+
+const Timestamp& SimulatedVision::getNextCaptureTime() const
+{
+    return next_capture_time;
+}
+
+void SimulatedVision::captureFrames(const Timestamp& current_time,
+                                    const std::optional<BallState>& ball_state,
+                                    const std::vector<RobotStateWithId>& yellow_robots,
+                                    const std::vector<RobotStateWithId>& blue_robots)
+{
+    if (current_time < next_capture_time || camera_states.empty())
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < config.cameras.size(); i++)
+    {
+        const SimulatedCamera& camera = config.cameras[i];
+        CameraState& camera_state     = camera_states[i];
+        if (current_time < camera_state.next_capture_time)
+        {
+            continue;
+        }
+
+        // We only know the state of the simulation at the current time, so a frame
+        // that was due earlier in the step is captured now. If the simulation steps
+        // by more than a frame period, the frames in between are skipped.
+        captureFrame(camera, camera_state, current_time, ball_state, yellow_robots,
+                     blue_robots);
+        while (camera_state.next_capture_time <= current_time)
+        {
+            camera_state.next_capture_time =
+                camera_state.next_capture_time + camera.frame_period;
+        }
+    }
+
+    next_capture_time = camera_states.front().next_capture_time;
+    for (const auto& camera_state : camera_states)
+    {
+        next_capture_time = std::min(next_capture_time, camera_state.next_capture_time);
+    }
+}
+
+void SimulatedVision::captureFrame(const SimulatedCamera& camera,
+                                   CameraState& camera_state,
+                                   const Timestamp& capture_time,
+                                   const std::optional<BallState>& ball_state,
+                                   const std::vector<RobotStateWithId>& yellow_robots,
+                                   const std::vector<RobotStateWithId>& blue_robots)
+{
+    const unsigned int frame_number = camera_state.frame_number++;
+    if (config.dropped_frame_probability > 0.0 &&
+        uniform_distribution(random_number_generator) < config.dropped_frame_probability)
+    {
+        return;
+    }
+
+    detected_balls.clear();
+    if (ball_state && contains(camera.field_of_view, ball_state->position()) &&
+        !missesDetection() &&
+        !(config.simulate_occlusion &&
+          (isBallOccluded(camera, ball_state->position(), yellow_robots) ||
+           isBallOccluded(camera, ball_state->position(), blue_robots))))
+    {
+        const Vector noise(standard_normal_distribution(random_number_generator),
+                           standard_normal_distribution(random_number_generator));
+        detected_balls.emplace_back(
+            ball_state->position() +
+                noise * config.ball_position_standard_deviation_meters,
+            ball_state->velocity(), ball_state->distanceFromGround());
+    }
+
+    detected_yellow_robots.clear();
+    detectRobots(camera, yellow_robots, detected_yellow_robots);
+    detected_blue_robots.clear();
+    detectRobots(camera, blue_robots, detected_blue_robots);
+
+    auto detection_frame = createSSLDetectionFrame(
+        camera.camera_id, capture_time, frame_number, detected_balls,
+        detected_yellow_robots, detected_blue_robots);
+
+    // Frames from the same camera are sent over the same connection, so they can not
+    // arrive out of order even if their latency varies
+    const double latency_seconds = camera.latency.toSeconds() +
+                                   standard_normal_distribution(random_number_generator) *
+                                       camera.latency_standard_deviation.toSeconds();
+    Timestamp sent_time =
+        capture_time + Duration::fromSeconds(std::max(latency_seconds, 0.0));
+    sent_time                   = std::max(sent_time, camera_state.last_sent_time);
+    camera_state.last_sent_time = sent_time;
+    detection_frame->set_t_sent(sent_time.toSeconds());
+
+    SSLProto::SSL_WrapperPacket packet;
+    packet.set_allocated_detection(detection_frame.release());
+    unsent_packets.emplace(sent_time, std::move(packet));
+}
+
+void SimulatedVision::detectRobots(const SimulatedCamera& camera,
+                                   const std::vector<RobotStateWithId>& robots,
+                                   std::vector<RobotStateWithId>& detections)
+{
+    for (const auto& robot : robots)
+    {
+        const RobotState& state = robot.robot_state;
+        if (!contains(camera.field_of_view, state.position()) || missesDetection())
+        {
+            continue;
+        }
+
+        const Vector position_noise(
+            standard_normal_distribution(random_number_generator),
+            standard_normal_distribution(random_number_generator));
+        const double orientation_noise =
+            standard_normal_distribution(random_number_generator);
+        detections.emplace_back(RobotStateWithId{
+            .id          = robot.id,
+            .robot_state = RobotState(
+                state.position() +
+                    position_noise * config.robot_position_standard_deviation_meters,
+                state.velocity(),
+                state.orientation() +
+                    Angle::fromRadians(
+                        orientation_noise *
+                        config.robot_orientation_standard_deviation_radians),
+                state.angularVelocity())});
+    }
+}
+
+bool SimulatedVision::missesDetection()
+{
+    return config.missed_detection_probability > 0.0 &&
+           uniform_distribution(random_number_generator) <
+               config.missed_detection_probability;
+}
+
+bool SimulatedVision::isBallOccluded(const SimulatedCamera& camera,
+                                     const Point& ball_position,
+                                     const std::vector<RobotStateWithId>& robots)
+{
+    // The line from the camera to the centre of the ball is below the top of a robot
+    // between the ball and the point where it reaches the height of a robot. The ball
+    // is hidden if a robot covers any part of the line between these two points.
+    const double height_fraction = (ROBOT_MAX_HEIGHT_METERS - BALL_MAX_RADIUS_METERS) /
+                                   (camera.height_meters - BALL_MAX_RADIUS_METERS);
+    const Segment line_below_robot_height(
+        ball_position,
+        ball_position + (camera.position - ball_position) * height_fraction);
+
+    return std::any_of(robots.begin(), robots.end(), [&](const RobotStateWithId& robot) {
+        return distanceSquared(line_below_robot_height, robot.robot_state.position()) <
+               ROBOT_MAX_RADIUS_METERS * ROBOT_MAX_RADIUS_METERS;
+    });
+}
+
+std::vector<SSLProto::SSL_WrapperPacket> SimulatedVision::popPacketsSentBy(
+    const Timestamp& current_time)
+{
+    std::vector<SSLProto::SSL_WrapperPacket> packets;
+    auto last_sent_packet = unsent_packets.upper_bound(current_time);
+    for (auto iter = unsent_packets.begin(); iter != last_sent_packet; iter++)
+    {
+        const Timestamp& sent_time = iter->first;
+        packets.emplace_back(std::move(iter->second));
+        if (sent_time >= next_geometry_time)
+        {
+            *(packets.back().mutable_geometry()) = geometry_data;
+            // Keep to the geometry's own schedule, unless it has fallen more than a
+            // period behind
+            next_geometry_time = next_geometry_time + config.geometry_period;
+            if (next_geometry_time <= sent_time)
+            {
+                next_geometry_time = sent_time + config.geometry_period;
+            }
+        }
+    }
+    unsent_packets.erase(unsent_packets.begin(), last_sent_packet);
+
+    return packets;
+}
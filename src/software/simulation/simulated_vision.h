@@ -0,0 +1,246 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "software/geom/point.h"
+#include "software/geom/rectangle.h"
+#include "software/proto/messages_robocup_ssl_geometry.pb.h"
+#include "software/proto/messages_robocup_ssl_wrapper.pb.h"
+#include "software/time/duration.h"
+#include "software/time/timestamp.h"
+#include "software/world/ball_state.h"
+#include "software/world/field.h"
+#include "software/world/robot_state.h"
+
+/**
+ * A single simulated SSL-Vision camera
+ */
+struct SimulatedCamera
+{
+    // The id of the camera, which is published in each of its detection frames
+    unsigned int camera_id;
+    // The area of the field the camera can see. Cameras next to each other should
+    // overlap, so that objects on the border between them are seen by both.
+    Rectangle field_of_view;
+    // The point on the field directly beneath the camera, and how high above the field
+    // the camera is. This is used to determine when the ball is hidden behind a robot.
+    Point position;
+    double height_meters;
+    // The time between frames captured by the camera, and the time of the first frame.
+    // Real cameras are not synchronized, so cameras should not all share the same
+    // capture offset.
+    Duration frame_period;
+    Duration capture_offset;
+    // The mean time between when a frame is captured and when it is sent, and the
+    // standard deviation of that time
+    Duration latency;
+    Duration latency_standard_deviation;
+};
+
+/**
+ * The configuration of the simulated vision system, which describes the layout of the
+ * cameras and how imperfect their detections are
+ */
+struct SimulatedVisionConfig
+{
+    std::vector<SimulatedCamera> cameras;
+
+    // The standard deviation of the Gaussian noise added to each detection
+    double ball_position_standard_deviation_meters;
+    double robot_position_standard_deviation_meters;
+    double robot_orientation_standard_deviation_radians;
+
+    // The probability that an object in view of a camera is missing from one of its
+    // frames, and the probability that a whole frame is lost
+    double missed_detection_probability;
+    double dropped_frame_probability;
+
+    // Whether the ball can be hidden from a camera by a robot between them
+    bool simulate_occlusion;
+
+    // The time between packets that include the field geometry. Geometry is included
+    // in every packet if this is zero.
+    Duration geometry_period;
+
+    // The seed of the random number generator used to add noise, so that simulations
+    // can be repeated exactly
+    unsigned int random_seed;
+
+    /**
+     * Creates the configuration of a single camera that sees the whole field perfectly,
+     * with no latency, noise, dropouts or occlusion, and sends the geometry with every
+     * frame
+     *
+     * @param field The field the camera sees
+     * @param frame_period The time between frames captured by the camera
+     *
+     * @return the configuration of a single perfect camera
+     */
+    static SimulatedVisionConfig createIdealSingleCamera(const Field& field,
+                                                         const Duration& frame_period);
+
+    /**
+     * Creates the configuration of a grid of cameras that together see the whole field,
+     * like the camera layouts used at RoboCup. The cameras are numbered in row-major
+     * order starting from the -x, -y corner of the field. Their captures are spread
+     * evenly over one frame period, and they have the typical latency, noise and
+     * dropouts of SSL-Vision.
+     *
+     * @param field The field the cameras see
+     * @param num_cameras_x The number of columns of cameras along the x axis
+     * @param num_cameras_y The number of rows of cameras along the y axis
+     * @param overlap_meters How far each camera sees into its neighbours' areas
+     * @param frame_period The time between frames captured by each camera
+     * @param random_seed The seed of the random number generator used to add noise
+     *
+     * @return the configuration of a grid of cameras
+     */
+    static SimulatedVisionConfig createCameraGrid(const Field& field,
+                                                  unsigned int num_cameras_x,
+                                                  unsigned int num_cameras_y,
+                                                  double overlap_meters,
+                                                  const Duration& frame_period,
+                                                  unsigned int random_seed = 0);
+};
+
+/**
+ * SimulatedVision turns the true state of a simulation into the SSL-Vision packets
+ * that a real set of cameras would send. Each camera captures frames at its own
+ * frame rate, only detects the objects in its field of view, adds noise to and drops
+ * some of its detections, and sends each frame after a random latency. The field
+ * geometry is created once and only sent at its own, much slower, rate.
+ */
+class SimulatedVision
+{
+   public:
+    /**
+     * Creates a new SimulatedVision
+     *
+     * @param config The configuration of the cameras
+     * @param geometry_data The geometry of the field the cameras see
+     * @param start_time The time the cameras start capturing at
+     */
+    explicit SimulatedVision(const SimulatedVisionConfig& config,
+                             const SSLProto::SSL_GeometryData& geometry_data,
+                             const Timestamp& start_time);
+    SimulatedVision() = delete;
+
+    /**
+     * Returns the configuration of the cameras
+     *
+     * @return the configuration of the cameras
+     */
+    const SimulatedVisionConfig& getConfig() const;
+
+    /**
+     * Returns the earliest time any camera will capture its next frame. Nothing is
+     * captured if captureFrames is called before this time, so callers can skip
+     * gathering the state of the simulation until then.
+     *
+     * @return the earliest time any camera will capture its next frame
+     */
+    const Timestamp& getNextCaptureTime() const;
+
+    /**
+     * Captures a frame from each camera that is due to capture one by the given time
+     *
+     * @param current_time The current time of the simulation
+     * @param ball_state The state of the ball, if there is a ball
+     * @param yellow_robots The states of the yellow robots
+     * @param blue_robots The states of the blue robots
+     */
+    void captureFrames(const Timestamp& current_time,
+                       const std::optional<BallState>& ball_state,
+                       const std::vector<RobotStateWithId>& yellow_robots,
+                       const std::vector<RobotStateWithId>& blue_robots);
+
+    /**
+     * Removes and returns the packets that have been sent by the given time, in the
+     * order they were sent
+     *
+     * @param current_time The current time of the simulation
+     *
+     * @return the packets that have been sent by the given time
+     */
+    std::vector<SSLProto::SSL_WrapperPacket> popPacketsSentBy(
+        const Timestamp& current_time);
+
+   private:
+    // What a camera has captured so far
+    struct CameraState
+    {
+        Timestamp next_capture_time;
+        Timestamp last_sent_time;
+        unsigned int frame_number;
+    };
+
+    /**
+     * Captures a frame from the given camera
+     *
+     * @param camera The camera to capture the frame from
+     * @param camera_state The state of the camera
+     * @param capture_time The time the frame is captured at
+     * @param ball_state The state of the ball, if there is a ball
+     * @param yellow_robots The states of the yellow robots
+     * @param blue_robots The states of the blue robots
+     */
+    void captureFrame(const SimulatedCamera& camera, CameraState& camera_state,
+                      const Timestamp& capture_time,
+                      const std::optional<BallState>& ball_state,
+                      const std::vector<RobotStateWithId>& yellow_robots,
+                      const std::vector<RobotStateWithId>& blue_robots);
+
+    /**
+     * Adds the robots the given camera detects to the given detections
+     *
+     * @param camera The camera detecting the robots
+     * @param robots The true states of the robots
+     * @param detections The detections to add to
+     */
+    void detectRobots(const SimulatedCamera& camera,
+                      const std::vector<RobotStateWithId>& robots,
+                      std::vector<RobotStateWithId>& detections);
+
+    /**
+     * Returns whether the camera fails to detect an object it can see, at random
+     *
+     * @return whether the camera fails to detect an object it can see
+     */
+    bool missesDetection();
+
+    /**
+     * Returns whether the ball is hidden from the given camera by any of the robots.
+     * The ball is hidden if the line from the camera to the centre of the ball passes
+     * through a robot.
+     *
+     * @param camera The camera looking at the ball
+     * @param ball_position The position of the ball
+     * @param robots The robots that could hide the ball
+     *
+     * @return whether the ball is hidden from the camera
+     */
+    static bool isBallOccluded(const SimulatedCamera& camera, const Point& ball_position,
+                               const std::vector<RobotStateWithId>& robots);
+
+    SimulatedVisionConfig config;
+    SSLProto::SSL_GeometryData geometry_data;
+    std::vector<CameraState> camera_states;
+    Timestamp next_capture_time;
+    Timestamp next_geometry_time;
+
+    // Captured frames that have not been sent yet, keyed by the time they are sent
+    std::multimap<Timestamp, SSLProto::SSL_WrapperPacket> unsent_packets;
+
+    // The detections of the frame being captured. These are kept between frames so
+    // that capturing a frame does not allocate once they have grown large enough.
+    std::vector<BallState> detected_balls;
+    std::vector<RobotStateWithId> detected_yellow_robots;
+    std::vector<RobotStateWithId> detected_blue_robots;
+
+    std::mt19937 random_number_generator;
+    std::normal_distribution<double> standard_normal_distribution;
+    std::uniform_real_distribution<double> uniform_distribution;
+};
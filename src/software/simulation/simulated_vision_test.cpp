@@ -0,0 +1,292 @@
+#include "software/simulation/simulated_vision.h"
+
+#include <gtest/gtest.h>
+
+#include "software/proto/message_translation/ssl_geometry.h"
+
+class SimulatedVisionTest : public ::testing::Test
+{
+   protected:
+    SimulatedVisionTest()
+        : field(Field::createSSLDivisionBField()),
+          geometry_data(*createGeometryData(field, 0.01f)),
+          ball_state(BallState(Point(1, 1), Vector(0, 0))),
+          yellow_robots({RobotStateWithId{
+              .id          = 1,
+              .robot_state = RobotState(Point(-1, 0), Vector(0, 0), Angle::quarter(),
+                                        AngularVelocity::zero())}}),
+          blue_robots({RobotStateWithId{
+              .id          = 2,
+              .robot_state = RobotState(Point(2, -2), Vector(0, 0), Angle::zero(),
+                                        AngularVelocity::zero())}})
+    {
+    }
+
+    /**
+     * Runs the given simulated vision for the given duration, capturing the state of
+     * the ball and robots every millisecond, and returns all the packets it sent
+     *
+     * @param simulated_vision The simulated vision to run
+     * @param duration How long to run the simulated vision for
+     *
+     * @return all the packets the simulated vision sent
+     */
+    std::vector<SSLProto::SSL_WrapperPacket> run(SimulatedVision& simulated_vision,
+                                                 const Duration& duration)
+    {
+        std::vector<SSLProto::SSL_WrapperPacket> packets;
+        const Timestamp end_time = current_time + duration;
+        while (current_time < end_time)
+        {
+            current_time = current_time + Duration::fromMilliseconds(1);
+            simulated_vision.captureFrames(current_time, ball_state, yellow_robots,
+                                           blue_robots);
+            for (auto& packet : simulated_vision.popPacketsSentBy(current_time))
+            {
+                packets.emplace_back(std::move(packet));
+            }
+        }
+        return packets;
+    }
+
+    Field field;
+    SSLProto::SSL_GeometryData geometry_data;
+    std::optional<BallState> ball_state;
+    std::vector<RobotStateWithId> yellow_robots;
+    std::vector<RobotStateWithId> blue_robots;
+    Timestamp current_time = Timestamp::fromSeconds(0);
+};
+
+TEST_F(SimulatedVisionTest, ideal_camera_sends_perfect_detections_at_its_frame_rate)
+{
+    SimulatedVision simulated_vision(
+        SimulatedVisionConfig::createIdealSingleCamera(field, Duration::fromSeconds(0.1)),
+        geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(0.95));
+
+    ASSERT_EQ(10, packets.size());
+    for (unsigned int i = 0; i < packets.size(); i++)
+    {
+        ASSERT_TRUE(packets[i].has_detection());
+        ASSERT_TRUE(packets[i].has_geometry());
+        const auto& detection = packets[i].detection();
+        EXPECT_EQ(0, detection.camera_id());
+        EXPECT_EQ(i, detection.frame_number());
+        EXPECT_NEAR(0.1 * i, detection.t_capture(), 0.002);
+        EXPECT_DOUBLE_EQ(detection.t_capture(), detection.t_sent());
+
+        ASSERT_EQ(1, detection.balls_size());
+        EXPECT_FLOAT_EQ(1000.0f, detection.balls(0).x());
+        EXPECT_FLOAT_EQ(1000.0f, detection.balls(0).y());
+        ASSERT_EQ(1, detection.robots_yellow_size());
+        EXPECT_FLOAT_EQ(-1000.0f, detection.robots_yellow(0).x());
+        EXPECT_FLOAT_EQ(0.0f, detection.robots_yellow(0).y());
+        ASSERT_EQ(1, detection.robots_blue_size());
+        EXPECT_FLOAT_EQ(2000.0f, detection.robots_blue(0).x());
+        EXPECT_FLOAT_EQ(-2000.0f, detection.robots_blue(0).y());
+    }
+}
+
+TEST_F(SimulatedVisionTest, cameras_only_detect_objects_in_their_field_of_view)
+{
+    // Four cameras, one for each quadrant of the field. The yellow robots are on the
+    // border between the two cameras on each side of the field.
+    auto config = SimulatedVisionConfig::createCameraGrid(field, 2, 2, 0.5,
+                                                          Duration::fromSeconds(0.1));
+    config.missed_detection_probability = 0.0;
+    config.dropped_frame_probability    = 0.0;
+    yellow_robots.emplace_back(RobotStateWithId{
+        .id          = 3,
+        .robot_state = RobotState(Point(3, 0.1), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())});
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(1));
+
+    std::map<unsigned int, unsigned int> num_frames;
+    for (const auto& packet : packets)
+    {
+        const auto& detection = packet.detection();
+        num_frames[detection.camera_id()]++;
+        switch (detection.camera_id())
+        {
+            case 0:
+                // The -x, -y quadrant
+                EXPECT_EQ(0, detection.balls_size());
+                EXPECT_EQ(1, detection.robots_yellow_size());
+                EXPECT_EQ(0, detection.robots_blue_size());
+                break;
+            case 1:
+                // The +x, -y quadrant
+                EXPECT_EQ(0, detection.balls_size());
+                EXPECT_EQ(1, detection.robots_yellow_size());
+                EXPECT_EQ(1, detection.robots_blue_size());
+                break;
+            case 2:
+                // The -x, +y quadrant
+                EXPECT_EQ(0, detection.balls_size());
+                EXPECT_EQ(1, detection.robots_yellow_size());
+                EXPECT_EQ(0, detection.robots_blue_size());
+                break;
+            case 3:
+                // The +x, +y quadrant
+                EXPECT_EQ(1, detection.balls_size());
+                EXPECT_EQ(1, detection.robots_yellow_size());
+                EXPECT_EQ(0, detection.robots_blue_size());
+                break;
+            default:
+                ADD_FAILURE() << "Unexpected camera id " << detection.camera_id();
+        }
+    }
+
+    // The last frame of some cameras may not have been sent yet
+    ASSERT_EQ(4, num_frames.size());
+    for (const auto& [camera_id, frames] : num_frames)
+    {
+        EXPECT_GE(frames, 9) << "Camera " << camera_id;
+        EXPECT_LE(frames, 10) << "Camera " << camera_id;
+    }
+}
+
+TEST_F(SimulatedVisionTest, frames_are_sent_after_their_latency)
+{
+    auto config =
+        SimulatedVisionConfig::createIdealSingleCamera(field, Duration::fromSeconds(0.1));
+    config.cameras[0].latency = Duration::fromMilliseconds(30);
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    simulated_vision.captureFrames(current_time, ball_state, yellow_robots, blue_robots);
+    EXPECT_TRUE(
+        simulated_vision.popPacketsSentBy(current_time + Duration::fromMilliseconds(29))
+            .empty());
+
+    auto packets =
+        simulated_vision.popPacketsSentBy(current_time + Duration::fromMilliseconds(30));
+    ASSERT_EQ(1, packets.size());
+    EXPECT_DOUBLE_EQ(0.0, packets[0].detection().t_capture());
+    EXPECT_DOUBLE_EQ(0.03, packets[0].detection().t_sent());
+}
+
+TEST_F(SimulatedVisionTest, frames_from_a_camera_are_sent_in_order_despite_jitter)
+{
+    auto config = SimulatedVisionConfig::createCameraGrid(field, 1, 1, 0.0,
+                                                          Duration::fromMilliseconds(5));
+    config.cameras[0].latency_standard_deviation = Duration::fromMilliseconds(10);
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(1));
+
+    ASSERT_FALSE(packets.empty());
+    for (unsigned int i = 1; i < packets.size(); i++)
+    {
+        EXPECT_GT(packets[i].detection().frame_number(),
+                  packets[i - 1].detection().frame_number());
+        EXPECT_GE(packets[i].detection().t_sent(), packets[i - 1].detection().t_sent());
+        EXPECT_GE(packets[i].detection().t_sent(), packets[i].detection().t_capture());
+    }
+}
+
+TEST_F(SimulatedVisionTest, geometry_is_only_sent_at_its_own_rate)
+{
+    auto config =
+        SimulatedVisionConfig::createIdealSingleCamera(field, Duration::fromSeconds(0.1));
+    config.geometry_period = Duration::fromSeconds(0.5);
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(0.95));
+
+    ASSERT_EQ(10, packets.size());
+    for (unsigned int i = 0; i < packets.size(); i++)
+    {
+        EXPECT_EQ(i % 5 == 0, packets[i].has_geometry()) << "Packet " << i;
+    }
+    EXPECT_EQ(geometry_data.SerializeAsString(),
+              packets[0].geometry().SerializeAsString());
+}
+
+TEST_F(SimulatedVisionTest, ball_is_hidden_by_robot_between_it_and_the_camera)
+{
+    auto config =
+        SimulatedVisionConfig::createIdealSingleCamera(field, Duration::fromSeconds(0.1));
+    config.simulate_occlusion = true;
+    // The camera is above the centre of the field, so a robot just on the centre side
+    // of the ball hides it, but a robot on the other side does not
+    ball_state    = BallState(Point(3, 0), Vector(0, 0));
+    yellow_robots = {RobotStateWithId{
+        .id          = 1,
+        .robot_state = RobotState(Point(2.92, 0), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}};
+    blue_robots   = {};
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(0.05));
+    ASSERT_EQ(1, packets.size());
+    EXPECT_EQ(0, packets[0].detection().balls_size());
+
+    yellow_robots[0].robot_state =
+        RobotState(Point(3.1, 0), Vector(0, 0), Angle::zero(), AngularVelocity::zero());
+    packets = run(simulated_vision, Duration::fromSeconds(0.1));
+    ASSERT_EQ(1, packets.size());
+    EXPECT_EQ(1, packets[0].detection().balls_size());
+}
+
+TEST_F(SimulatedVisionTest, missed_detections_and_dropped_frames)
+{
+    auto config = SimulatedVisionConfig::createIdealSingleCamera(
+        field, Duration::fromSeconds(0.01));
+    config.missed_detection_probability = 1.0;
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+
+    auto packets = run(simulated_vision, Duration::fromSeconds(0.095));
+    ASSERT_EQ(10, packets.size());
+    for (const auto& packet : packets)
+    {
+        EXPECT_EQ(0, packet.detection().balls_size());
+        EXPECT_EQ(0, packet.detection().robots_yellow_size());
+        EXPECT_EQ(0, packet.detection().robots_blue_size());
+    }
+
+    config.missed_detection_probability = 0.0;
+    config.dropped_frame_probability    = 0.5;
+    simulated_vision = SimulatedVision(config, geometry_data, current_time);
+
+    packets = run(simulated_vision, Duration::fromSeconds(1));
+    EXPECT_GT(packets.size(), 25);
+    EXPECT_LT(packets.size(), 75);
+}
+
+TEST_F(SimulatedVisionTest, noise_is_repeatable_with_the_same_seed)
+{
+    auto config = SimulatedVisionConfig::createCameraGrid(
+        field, 2, 1, 0.5, Duration::fromSeconds(1.0 / 60.0), 42);
+
+    SimulatedVision simulated_vision(config, geometry_data, current_time);
+    auto packets = run(simulated_vision, Duration::fromSeconds(1));
+
+    current_time = Timestamp::fromSeconds(0);
+    SimulatedVision repeated_simulated_vision(config, geometry_data, current_time);
+    auto repeated_packets = run(repeated_simulated_vision, Duration::fromSeconds(1));
+
+    ASSERT_EQ(packets.size(), repeated_packets.size());
+    double total_squared_error = 0.0;
+    unsigned int num_robots    = 0;
+    for (unsigned int i = 0; i < packets.size(); i++)
+    {
+        EXPECT_EQ(packets[i].SerializeAsString(),
+                  repeated_packets[i].SerializeAsString());
+        for (const auto& robot : packets[i].detection().robots_yellow())
+        {
+            const double error_x = robot.x() / 1000.0 - (-1.0);
+            const double error_y = robot.y() / 1000.0;
+            total_squared_error += error_x * error_x + error_y * error_y;
+            num_robots++;
+        }
+    }
+
+    // The noise should be on the order of millimetres
+    ASSERT_GT(num_robots, 0);
+    const double rms_error = std::sqrt(total_squared_error / (2 * num_robots));
+    EXPECT_GT(rms_error, 0.0005);
+    EXPECT_LT(rms_error, 0.005);
+}
@@ -1,5 +1,7 @@
 #include "software/simulation/simulator.h"
 
+#include <algorithm>
+
 #include "software/proto/message_translation/primitive_google_to_nanopb_converter.h"
 #include "software/proto/message_translation/ssl_detection.h"
 #include "software/proto/message_translation/ssl_geometry.h"
@@ -23,7 +25,15 @@ Simulator::Simulator(const Field& field,
       yellow_team_defending_side(FieldSide::NEG_X),
       blue_team_defending_side(FieldSide::NEG_X),
       frame_number(0),
-      physics_time_step(physics_time_step)
+      geometry_data(*createGeometryData(field, FIELD_LINE_THICKNESS_METRES)),
+      simulated_vision(
+          SimulatedVisionConfig::createIdealSingleCamera(
+              field, Duration::fromSeconds(DEFAULT_CAMERA_FRAME_PERIOD_SECONDS)),
+          geometry_data, physics_world.getTimestamp()),
+      physics_time_step(physics_time_step),
+      unsimulated_time(Duration::fromSeconds(0)),
+      firmware_worker_pool(std::make_unique<WorkerPool>(
+          static_cast<unsigned int>(simulator_config->getNumFirmwareThreads()->value())))
 {
     this->resetCurrentFirmwareTime();
 }
@@ -107,14 +117,16 @@ void Simulator::setYellowRobotPrimitive(RobotId id,
                                         const TbotsProto_Primitive& primitive_msg)
 {
     setRobotPrimitive(id, primitive_msg, yellow_simulator_robots, simulator_ball,
-                      yellow_team_defending_side);
+                      yellow_team_defending_side, TeamColour::YELLOW,
+                      physics_world.getTimestamp());
 }
 
 void Simulator::setBlueRobotPrimitive(RobotId id,
                                       const TbotsProto_Primitive& primitive_msg)
 {
     setRobotPrimitive(id, primitive_msg, blue_simulator_robots, simulator_ball,
-                      blue_team_defending_side);
+                      blue_team_defending_side, TeamColour::BLUE,
+                      physics_world.getTimestamp());
 }
 
 void Simulator::setYellowRobotPrimitiveSet(
@@ -140,8 +152,18 @@ void Simulator::setRobotPrimitive(
     RobotId id, const TbotsProto_Primitive& primitive_msg,
     std::map<std::shared_ptr<PhysicsSimulatorRobot>, std::shared_ptr<FirmwareWorld_t>>&
         simulator_robots,
-    const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball, FieldSide defending_side)
+    const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball, FieldSide defending_side,
+    TeamColour team_colour, const Timestamp& current_time)
 {
+    // Primitives are usually set from a different thread than the one the firmware is
+    // ticked in, and the current firmware time and logger are thread local, so they
+    // must be set up here for the primitive to start at the right time and log
+    current_firmware_time = current_time;
+    app_logger_init(id,
+                    team_colour == TeamColour::YELLOW
+                        ? &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto
+                        : &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
+
     SimulatorBallSingleton::setSimulatorBall(simulator_ball, defending_side);
     auto simulator_robots_iter =
         std::find_if(simulator_robots.begin(), simulator_robots.end(),
@@ -198,52 +220,89 @@ void Simulator::stepSimulation(const Duration& time_step)
     // We only need to do this a single time since all robots
     // can see and interact with the same ball
 
-    Duration remaining_time = time_step;
-    while (remaining_time > Duration::fromSeconds(0))
+    // Physics is only ever stepped by whole physics time steps, so that the simulation
+    // doesn't depend on how time is split between calls. Time that doesn't make up a
+    // whole step is carried over to the next call.
+    unsimulated_time = unsimulated_time + time_step;
+    while (unsimulated_time >= physics_time_step)
     {
-        current_firmware_time = physics_world.getTimestamp();
-
-        for (auto& iter : blue_simulator_robots)
-        {
-            auto simulator_robot = iter.first;
-            auto firmware_world  = iter.second;
+        tickFirmware();
 
-            app_logger_init(simulator_robot->getRobotId(),
-                            &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
+        physics_world.stepSimulation(physics_time_step);
+        unsimulated_time = unsimulated_time - physics_time_step;
 
-            ForceWheelSimulatorRobotSingleton::setSimulatorRobot(
-                simulator_robot, blue_team_defending_side);
-            SimulatorBallSingleton::setSimulatorBall(simulator_ball,
-                                                     blue_team_defending_side);
-            ForceWheelSimulatorRobotSingleton::runPrimitiveOnCurrentSimulatorRobot(
-                firmware_world);
+        if (physics_world.getTimestamp() >= simulated_vision.getNextCaptureTime())
+        {
+            simulated_vision.captureFrames(
+                physics_world.getTimestamp(), physics_world.getBallState(),
+                physics_world.getYellowRobotStates(), physics_world.getBlueRobotStates());
         }
+    }
 
-        for (auto& iter : yellow_simulator_robots)
-        {
-            auto simulator_robot = iter.first;
-            auto firmware_world  = iter.second;
+    frame_number++;
+}
 
-            app_logger_init(
-                simulator_robot->getRobotId(),
-                &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto);
+std::vector<Simulator::SimulatedFirmware> Simulator::getSimulatedFirmware() const
+{
+    std::vector<SimulatedFirmware> simulated_firmware;
+    auto add_team =
+        [&](const std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                           std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
+            TeamColour team_colour, FieldSide defending_side) {
+            const size_t team_begin = simulated_firmware.size();
+            for (const auto& [simulator_robot, firmware_world] : simulator_robots)
+            {
+                simulated_firmware.emplace_back(SimulatedFirmware{
+                    simulator_robot, firmware_world, team_colour, defending_side});
+            }
+            // The robots are stored by pointer, so they must be sorted to be in the same
+            // order in every run
+            std::sort(simulated_firmware.begin() + team_begin, simulated_firmware.end(),
+                      [](const SimulatedFirmware& a, const SimulatedFirmware& b) {
+                          return a.simulator_robot->getRobotId() <
+                                 b.simulator_robot->getRobotId();
+                      });
+        };
+    add_team(blue_simulator_robots, TeamColour::BLUE, blue_team_defending_side);
+    add_team(yellow_simulator_robots, TeamColour::YELLOW, yellow_team_defending_side);
+    return simulated_firmware;
+}
 
-            ForceWheelSimulatorRobotSingleton::setSimulatorRobot(
-                simulator_robot, yellow_team_defending_side);
-            SimulatorBallSingleton::setSimulatorBall(simulator_ball,
-                                                     yellow_team_defending_side);
-            ForceWheelSimulatorRobotSingleton::runPrimitiveOnCurrentSimulatorRobot(
-                firmware_world);
-        }
+void Simulator::tickFirmware()
+{
+    const std::vector<SimulatedFirmware> simulated_firmware = getSimulatedFirmware();
+    const Timestamp timestamp = physics_world.getTimestamp();
 
-        // We take as many steps of `physics_time_step` as possible, and then
-        // simulate the remainder of the time
-        Duration dt = std::min(remaining_time, physics_time_step);
-        physics_world.stepSimulation(dt);
-        remaining_time = remaining_time - physics_time_step;
+    for (const auto& firmware : simulated_firmware)
+    {
+        firmware.simulator_robot->startDeferringActions();
     }
 
-    frame_number++;
+    // The firmware singletons, logger and current firmware time are all thread local,
+    // so they are set up in whichever thread ticks each robot
+    firmware_worker_pool->parallelFor(simulated_firmware.size(), [&](std::size_t i) {
+        const SimulatedFirmware& firmware = simulated_firmware[i];
+        current_firmware_time             = timestamp;
+
+        app_logger_init(
+            firmware.simulator_robot->getRobotId(),
+            firmware.team_colour == TeamColour::YELLOW
+                ? &ForceWheelSimulatorRobotSingleton::handleYellowRobotLogProto
+                : &ForceWheelSimulatorRobotSingleton::handleBlueRobotLogProto);
+
+        ForceWheelSimulatorRobotSingleton::setSimulatorRobot(firmware.simulator_robot,
+                                                             firmware.defending_side);
+        SimulatorBallSingleton::setSimulatorBall(simulator_ball, firmware.defending_side);
+        ForceWheelSimulatorRobotSingleton::runPrimitiveOnCurrentSimulatorRobot(
+            firmware.firmware_world);
+    });
+
+    for (const auto& firmware : simulated_firmware)
+    {
+        firmware.simulator_robot->applyDeferredActions();
+    }
+
+    current_firmware_time = timestamp;
 }
 
 World Simulator::getWorld() const
@@ -284,13 +343,23 @@ std::unique_ptr<SSLProto::SSL_WrapperPacket> Simulator::getSSLWrapperPacket() co
     auto detection_frame = createSSLDetectionFrame(
         CAMERA_ID, physics_world.getTimestamp(), frame_number, ball_states,
         physics_world.getYellowRobotStates(), physics_world.getBlueRobotStates());
-    auto geometry_data =
-        createGeometryData(physics_world.getField(), FIELD_LINE_THICKNESS_METRES);
-    auto wrapper_packet =
-        createSSLWrapperPacket(std::move(geometry_data), std::move(detection_frame));
+    auto wrapper_packet = createSSLWrapperPacket(
+        std::make_unique<SSLProto::SSL_GeometryData>(geometry_data),
+        std::move(detection_frame));
     return wrapper_packet;
 }
 
+void Simulator::setVisionConfig(const SimulatedVisionConfig& vision_config)
+{
+    simulated_vision =
+        SimulatedVision(vision_config, geometry_data, physics_world.getTimestamp());
+}
+
+std::vector<SSLProto::SSL_WrapperPacket> Simulator::popSSLWrapperPackets()
+{
+    return simulated_vision.popPacketsSentBy(physics_world.getTimestamp());
+}
+
 Field Simulator::getField() const
 {
     return physics_world.getField();
@@ -329,6 +398,79 @@ void Simulator::removeRobot(std::weak_ptr<PhysicsRobot> robot)
     physics_world.removeRobot(robot);
 }
 
+SimulatorSnapshot Simulator::getSnapshot() const
+{
+    return SimulatorSnapshot{
+        .physics_world              = physics_world.getSnapshot(),
+        .yellow_robots              = getSimulatorRobotSnapshots(yellow_simulator_robots),
+        .blue_robots                = getSimulatorRobotSnapshots(blue_simulator_robots),
+        .yellow_team_defending_side = yellow_team_defending_side,
+        .blue_team_defending_side   = blue_team_defending_side,
+        .frame_number               = frame_number,
+        .unsimulated_time           = unsimulated_time};
+}
+
+void Simulator::restoreSnapshot(const SimulatorSnapshot& snapshot)
+{
+    // The simulator ball and robots wrap the physics ball and robots, which are
+    // recreated when the physics world is restored, so they must be recreated too
+    simulator_ball.reset();
+    yellow_simulator_robots.clear();
+    blue_simulator_robots.clear();
+
+    physics_world.restoreSnapshot(snapshot.physics_world);
+    if (snapshot.physics_world.ball)
+    {
+        simulator_ball =
+            std::make_shared<PhysicsSimulatorBall>(physics_world.getPhysicsBall());
+    }
+    updateSimulatorRobots(physics_world.getYellowPhysicsRobots(), yellow_simulator_robots,
+                          TeamColour::YELLOW);
+    updateSimulatorRobots(physics_world.getBluePhysicsRobots(), blue_simulator_robots,
+                          TeamColour::BLUE);
+    restoreSimulatorRobotSnapshots(snapshot.yellow_robots, yellow_simulator_robots,
+                                   physics_world.getPhysicsBall());
+    restoreSimulatorRobotSnapshots(snapshot.blue_robots, blue_simulator_robots,
+                                   physics_world.getPhysicsBall());
+
+    yellow_team_defending_side = snapshot.yellow_team_defending_side;
+    blue_team_defending_side   = snapshot.blue_team_defending_side;
+    frame_number               = snapshot.frame_number;
+    unsimulated_time           = snapshot.unsimulated_time;
+    simulated_vision = SimulatedVision(simulated_vision.getConfig(), geometry_data,
+                                       physics_world.getTimestamp());
+}
+
+std::map<RobotId, PhysicsSimulatorRobotSnapshot> Simulator::getSimulatorRobotSnapshots(
+    const std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                   std::shared_ptr<FirmwareWorld_t>>& simulator_robots)
+{
+    std::map<RobotId, PhysicsSimulatorRobotSnapshot> snapshots;
+    for (const auto& [simulator_robot, firmware_world] : simulator_robots)
+    {
+        snapshots.emplace(simulator_robot->getRobotId(),
+                          simulator_robot->getSnapshot(firmware_world));
+    }
+    return snapshots;
+}
+
+void Simulator::restoreSimulatorRobotSnapshots(
+    const std::map<RobotId, PhysicsSimulatorRobotSnapshot>& snapshots,
+    std::map<std::shared_ptr<PhysicsSimulatorRobot>, std::shared_ptr<FirmwareWorld_t>>&
+        simulator_robots,
+    std::weak_ptr<PhysicsBall> physics_ball)
+{
+    for (auto& [simulator_robot, firmware_world] : simulator_robots)
+    {
+        auto snapshot = snapshots.find(simulator_robot->getRobotId());
+        if (snapshot != snapshots.end())
+        {
+            simulator_robot->restoreSnapshot(snapshot->second, firmware_world,
+                                             physics_ball);
+        }
+    }
+}
+
 void Simulator::resetCurrentFirmwareTime()
 {
     current_firmware_time = Timestamp::fromSeconds(0);
@@ -341,4 +483,4 @@ float Simulator::getCurrentFirmwareTimeSeconds()
 
 // We must give this variable a value here, as non-const static variables must be
 // initialized out-of-line
-Timestamp Simulator::current_firmware_time = Timestamp::fromSeconds(0);
+thread_local Timestamp Simulator::current_firmware_time = Timestamp::fromSeconds(0);
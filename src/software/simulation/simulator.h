@@ -1,12 +1,16 @@
 #pragma once
 
+#include <map>
+
 #include "shared/parameter/cpp_dynamic_parameters.h"
+#include "software/multithreading/worker_pool.h"
 #include "software/proto/defending_side_msg.pb.h"
 #include "software/proto/messages_robocup_ssl_wrapper.pb.h"
 #include "software/simulation/firmware_object_deleter.h"
 #include "software/simulation/physics/physics_world.h"
 #include "software/simulation/physics_simulator_ball.h"
 #include "software/simulation/physics_simulator_robot.h"
+#include "software/simulation/simulated_vision.h"
 #include "software/world/field.h"
 #include "software/world/team_types.h"
 #include "software/world/world.h"
@@ -17,6 +21,23 @@ extern "C"
 #include "shared/proto/tbots_software_msgs.nanopb.h"
 }
 
+/**
+ * Everything needed to restore a Simulator exactly as it was, so that many simulations
+ * can be branched from the same state without simulating how that state was reached
+ * each time. The field, config and camera layout of the Simulator are not included.
+ */
+struct SimulatorSnapshot
+{
+    PhysicsWorldSnapshot physics_world;
+    // The simulated hardware and firmware of each robot, by robot id
+    std::map<RobotId, PhysicsSimulatorRobotSnapshot> yellow_robots;
+    std::map<RobotId, PhysicsSimulatorRobotSnapshot> blue_robots;
+    FieldSide yellow_team_defending_side;
+    FieldSide blue_team_defending_side;
+    unsigned int frame_number;
+    Duration unsimulated_time;
+};
+
 /**
  * The Simulator abstracts away the physics simulation of all objects in the world,
  * as well as the firmware simulation for the robots. This provides a simple interface
@@ -115,6 +136,10 @@ class Simulator
      * Advances the simulation by the given time step. This will simulate
      * one "camera frame" of data and increase the camera_frame value by 1.
      *
+     * Physics is simulated in whole physics time steps, so the simulation time only
+     * advances by a multiple of the physics time step. The rest of the given time step
+     * is simulated in a later call.
+     *
      * @param time_step how much to advance the simulation by
      */
     void stepSimulation(const Duration& time_step);
@@ -128,13 +153,34 @@ class Simulator
 
     /**
      * Returns an SSLProto::SSL_WrapperPacket representing the most recent state
-     * of the simulation
+     * of the simulation, as seen by a single perfect camera
      *
      * @return an SSLProto::SSL_WrapperPacket representing the most recent state
      * of the simulation
      */
     std::unique_ptr<SSLProto::SSL_WrapperPacket> getSSLWrapperPacket() const;
 
+    /**
+     * Sets the layout and imperfections of the simulated cameras used by
+     * popSSLWrapperPackets. Any frames the previous cameras have captured but not yet
+     * sent are discarded. By default, a single perfect camera captures the whole field
+     * at 60Hz.
+     *
+     * @param vision_config The configuration of the simulated cameras
+     */
+    void setVisionConfig(const SimulatedVisionConfig& vision_config);
+
+    /**
+     * Removes and returns the SSLProto::SSL_WrapperPackets the simulated cameras have
+     * sent since this was last called, in the order they were sent. Unlike
+     * getSSLWrapperPacket, the packets are captured at the frame rate of each camera
+     * and include its noise, latency, dropouts and occlusion.
+     *
+     * @return the SSLProto::SSL_WrapperPackets the simulated cameras have sent since
+     * this was last called
+     */
+    std::vector<SSLProto::SSL_WrapperPacket> popSSLWrapperPackets();
+
     /**
      * Returns the field in the simulation
      *
@@ -168,6 +214,28 @@ class Simulator
      */
     void removeRobot(std::weak_ptr<PhysicsRobot> robot);
 
+    /**
+     * Returns a snapshot of the entire state of the simulation, which can be restored
+     * later with restoreSnapshot
+     *
+     * @return a snapshot of the entire state of the simulation
+     */
+    SimulatorSnapshot getSnapshot() const;
+
+    /**
+     * Sets the entire state of the simulation to the state it was in when the given
+     * snapshot was taken, including the time. The snapshot may be from another
+     * Simulator with the same field and config.
+     *
+     * The ball and robots are recreated, so any pointers to the previous ball and
+     * robots are invalidated. Any frames the simulated cameras have captured but not
+     * yet sent are discarded, and the cameras start capturing again from the time of
+     * the snapshot.
+     *
+     * @param snapshot The snapshot to restore
+     */
+    void restoreSnapshot(const SimulatorSnapshot& snapshot);
+
     /**
      * Resets the current firmware time to 0
      */
@@ -206,13 +274,73 @@ class Simulator
      * @param simulator_robots The robots to set the primitives on
      * @param simulator_ball The simulator ball to use in the primitives
      * @param defending_side The side of the field the robot is defending
+     * @param team_colour The colour of the team the robot is on
+     * @param current_time The current time of the simulation, which the primitive
+     * starts at
      */
     static void setRobotPrimitive(
         RobotId id, const TbotsProto_Primitive& primitive_msg,
         std::map<std::shared_ptr<PhysicsSimulatorRobot>,
                  std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
         const std::shared_ptr<PhysicsSimulatorBall>& simulator_ball,
-        FieldSide defending_side);
+        FieldSide defending_side, TeamColour team_colour, const Timestamp& current_time);
+
+    /**
+     * The simulated hardware and firmware of a single robot, and everything needed to
+     * tick its firmware
+     */
+    struct SimulatedFirmware
+    {
+        std::shared_ptr<PhysicsSimulatorRobot> simulator_robot;
+        std::shared_ptr<FirmwareWorld_t> firmware_world;
+        TeamColour team_colour;
+        FieldSide defending_side;
+    };
+
+    /**
+     * Returns the simulated firmware of every robot, in a fixed order that does not
+     * depend on where the robots are stored in memory
+     *
+     * @return the simulated firmware of every robot, blue robots first, each team
+     * sorted by robot id
+     */
+    std::vector<SimulatedFirmware> getSimulatedFirmware() const;
+
+    /**
+     * Ticks the firmware of every robot once at the current time.
+     *
+     * The firmware of each robot is ticked in parallel by the firmware_worker_pool, and
+     * only reads the physics world while doing so. The forces and impulses each
+     * robot's firmware applies are deferred until every tick has finished, and then
+     * applied in the order of getSimulatedFirmware, so the simulation is the same
+     * regardless of the number of threads.
+     */
+    void tickFirmware();
+
+    /**
+     * Returns snapshots of the simulated hardware and firmware of the given robots
+     *
+     * @param simulator_robots The robots to get snapshots of
+     *
+     * @return snapshots of the given robots, by robot id
+     */
+    static std::map<RobotId, PhysicsSimulatorRobotSnapshot> getSimulatorRobotSnapshots(
+        const std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                       std::shared_ptr<FirmwareWorld_t>>& simulator_robots);
+
+    /**
+     * Restores the simulated hardware and firmware of the given robots from the given
+     * snapshots
+     *
+     * @param snapshots The snapshots to restore, by robot id
+     * @param simulator_robots The robots to restore
+     * @param physics_ball The ball in the physics world
+     */
+    static void restoreSimulatorRobotSnapshots(
+        const std::map<RobotId, PhysicsSimulatorRobotSnapshot>& snapshots,
+        std::map<std::shared_ptr<PhysicsSimulatorRobot>,
+                 std::shared_ptr<FirmwareWorld_t>>& simulator_robots,
+        std::weak_ptr<PhysicsBall> physics_ball);
 
     PhysicsWorld physics_world;
     std::shared_ptr<PhysicsSimulatorBall> simulator_ball;
@@ -225,8 +353,18 @@ class Simulator
 
     unsigned int frame_number;
 
+    // The geometry of the field never changes, so it is only created once
+    SSLProto::SSL_GeometryData geometry_data;
+    SimulatedVision simulated_vision;
+
     // The time step used to simulate physics and primitives
     const Duration physics_time_step;
+    // The time that stepSimulation has been asked to simulate but that doesn't add up
+    // to a whole physics time step yet
+    Duration unsimulated_time;
+
+    // The threads used to tick the firmware of the robots
+    std::unique_ptr<WorkerPool> firmware_worker_pool;
 
     // The camera ID of all SSLDetectionFrames published by the simulator.
     // This simulates having a single camera that can see the entire field
@@ -235,8 +373,11 @@ class Simulator
     // 200Hz is approximately how fast our robot firmware runs, so we
     // mimic that here for physics and primitive updates
     static constexpr double DEFAULT_PHYSICS_TIME_STEP_SECONDS = 1.0 / 200.0;
+    // The frame rate of the default simulated camera
+    static constexpr double DEFAULT_CAMERA_FRAME_PERIOD_SECONDS = 1.0 / 60.0;
 
     // The current time. This is static so that it may be used by the firmware,
-    // and so must be set before each firmware tick
-    static Timestamp current_firmware_time;
+    // and so must be set before each firmware tick or primitive start. It is thread
+    // local so that separate Simulators can run in separate threads.
+    static thread_local Timestamp current_firmware_time;
 };
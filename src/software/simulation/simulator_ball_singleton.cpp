@@ -2,8 +2,9 @@
 
 #include "software/logger/logger.h"
 
-std::shared_ptr<SimulatorBall> SimulatorBallSingleton::simulator_ball = nullptr;
-FieldSide SimulatorBallSingleton::field_side_                         = FieldSide::NEG_X;
+thread_local std::shared_ptr<SimulatorBall> SimulatorBallSingleton::simulator_ball =
+    nullptr;
+thread_local FieldSide SimulatorBallSingleton::field_side_ = FieldSide::NEG_X;
 
 void SimulatorBallSingleton::setSimulatorBall(std::shared_ptr<SimulatorBall> ball,
                                               FieldSide field_side)
@@ -120,7 +120,8 @@ class SimulatorBallSingleton
      */
     static float invertValueToMatchFieldSide(double value);
 
-    // The simulator ball being controlled by this class
-    static std::shared_ptr<SimulatorBall> simulator_ball;
-    static FieldSide field_side_;
+    // The simulator ball being controlled by this class. This is thread local so that
+    // separate Simulators can run in separate threads.
+    static thread_local std::shared_ptr<SimulatorBall> simulator_ball;
+    static thread_local FieldSide field_side_;
 };
@@ -8,8 +8,9 @@ extern "C"
 #include "firmware/app/world/charger.h"
 }
 
-std::shared_ptr<SimulatorRobot> SimulatorRobotSingleton::simulator_robot = nullptr;
-FieldSide SimulatorRobotSingleton::field_side_ = FieldSide::NEG_X;
+thread_local std::shared_ptr<SimulatorRobot> SimulatorRobotSingleton::simulator_robot =
+    nullptr;
+thread_local FieldSide SimulatorRobotSingleton::field_side_ = FieldSide::NEG_X;
 
 void SimulatorRobotSingleton::setSimulatorRobot(std::shared_ptr<SimulatorRobot> robot,
                                                 FieldSide field_side)
@@ -274,7 +274,8 @@ class SimulatorRobotSingleton
     static void handleRobotLogProto(TbotsProto_RobotLog log,
                                     const std::string& robot_colour);
 
-    // The simulator robot being controlled by this class
-    static std::shared_ptr<SimulatorRobot> simulator_robot;
-    static FieldSide field_side_;
+    // The simulator robot being controlled by this class. This is thread local so that
+    // separate Simulators can run in separate threads.
+    static thread_local std::shared_ptr<SimulatorRobot> simulator_robot;
+    static thread_local FieldSide field_side_;
 };
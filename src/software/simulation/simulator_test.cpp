@@ -34,8 +34,52 @@ TEST_F(SimulatorTest, get_initial_timestamp)
 
 TEST_F(SimulatorTest, timestamp_updates_with_simulation_steps)
 {
+    // Only whole physics time steps of 5ms are simulated, and the rest is carried over
+    // to the next step
     simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
-    EXPECT_EQ(Timestamp::fromSeconds(1.0 / 60.0), simulator->getTimestamp());
+    EXPECT_EQ(Timestamp::fromSeconds(0.015), simulator->getTimestamp());
+    simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    EXPECT_EQ(Timestamp::fromSeconds(0.030), simulator->getTimestamp());
+    simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    EXPECT_EQ(Timestamp::fromSeconds(0.050), simulator->getTimestamp());
+}
+
+TEST_F(SimulatorTest, simulation_does_not_depend_on_how_time_is_split_between_steps)
+{
+    Simulator other_simulator(Field::createSSLDivisionBField(), simulator_config);
+    for (Simulator* sim : {simulator.get(), &other_simulator})
+    {
+        sim->setBallState(BallState(Point(0, 0.5), Vector(1, 0)));
+        sim->addYellowRobots({RobotStateWithId{
+            .id          = 1,
+            .robot_state = RobotState(Point(0, 0), Vector(0, 0), Angle::zero(),
+                                      AngularVelocity::zero())}});
+        sim->setYellowRobotPrimitive(
+            1,
+            createNanoPbPrimitive(*createMovePrimitive(
+                Point(1, 1), 0.0, Angle::quarter(), DribblerMode::OFF,
+                {AutoChipOrKickMode::OFF, 0}, MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0)));
+    }
+
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    }
+    for (unsigned int i = 0; i < 50; i++)
+    {
+        other_simulator.stepSimulation(Duration::fromSeconds(0.01));
+    }
+
+    World world       = simulator->getWorld();
+    World other_world = other_simulator.getWorld();
+    EXPECT_EQ(Timestamp::fromSeconds(0.5), world.getMostRecentTimestamp());
+    EXPECT_EQ(world.getMostRecentTimestamp(), other_world.getMostRecentTimestamp());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(world.ball().currentState(),
+                                               other_world.ball().currentState(), 1e-9));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        world.friendlyTeam().getRobotById(1)->currentState(),
+        other_world.friendlyTeam().getRobotById(1)->currentState(), 1e-9,
+        Angle::fromDegrees(1e-6)));
 }
 
 TEST_F(SimulatorTest, set_ball_state_when_ball_does_not_already_exist)
@@ -636,3 +680,202 @@ TEST_F(SimulatorTest, simulate_multiple_blue_and_yellow_robots_with_primitives)
         Angle::half(), Angle::fromRadians(blue_robot_2->orientation()),
         Angle::fromDegrees(10)));
 }
+
+TEST_F(SimulatorTest, simulated_camera_sends_frames_at_its_frame_rate)
+{
+    simulator->addYellowRobot(Point(1, 1));
+
+    std::vector<SSLProto::SSL_WrapperPacket> packets;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+        auto new_packets = simulator->popSSLWrapperPackets();
+        packets.insert(packets.end(), new_packets.begin(), new_packets.end());
+    }
+
+    // The camera captures a frame at the start and then once every frame period, so it
+    // captures up to 61 frames in the first second
+    EXPECT_GE(packets.size(), 60);
+    EXPECT_LE(packets.size(), 61);
+    for (const auto& packet : packets)
+    {
+        ASSERT_TRUE(packet.has_detection());
+        EXPECT_TRUE(packet.has_geometry());
+        EXPECT_EQ(1, packet.detection().robots_yellow_size());
+    }
+    // Frames are captured on the first physics step after they are due
+    for (size_t i = 1; i < packets.size(); i++)
+    {
+        double frame_period =
+            packets[i].detection().t_capture() - packets[i - 1].detection().t_capture();
+        EXPECT_GT(frame_period, 1.0 / 60.0 - 0.005) << "Frame " << i;
+        EXPECT_LT(frame_period, 1.0 / 60.0 + 0.005) << "Frame " << i;
+    }
+}
+
+TEST_F(SimulatorTest, simulated_camera_grid_sends_frames_from_every_camera)
+{
+    simulator->setVisionConfig(SimulatedVisionConfig::createCameraGrid(
+        Field::createSSLDivisionBField(), 2, 2, 0.5, Duration::fromSeconds(1.0 / 75.0)));
+
+    std::map<unsigned int, unsigned int> num_frames;
+    unsigned int num_geometry_packets = 0;
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+        for (const auto& packet : simulator->popSSLWrapperPackets())
+        {
+            num_frames[packet.detection().camera_id()]++;
+            num_geometry_packets += packet.has_geometry() ? 1 : 0;
+        }
+    }
+
+    ASSERT_EQ(4, num_frames.size());
+    for (const auto& [camera_id, frames] : num_frames)
+    {
+        // Some frames may have been dropped or not sent yet
+        EXPECT_GE(frames, 65) << "Camera " << camera_id;
+        EXPECT_LE(frames, 75) << "Camera " << camera_id;
+    }
+    EXPECT_EQ(1, num_geometry_packets);
+}
+
+TEST_F(SimulatorTest, simulation_continues_the_same_way_after_restoring_a_snapshot)
+{
+    simulator->setBallState(BallState(Point(0, 0.5), Vector(1, 0)));
+    simulator->addYellowRobots({RobotStateWithId{
+        .id          = 1,
+        .robot_state = RobotState(Point(0, 0), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    simulator->setYellowRobotPrimitive(
+        1, createNanoPbPrimitive(*createMovePrimitive(
+               Point(1, 1), 0.0, Angle::quarter(), DribblerMode::OFF,
+               {AutoChipOrKickMode::OFF, 0}, MaxAllowedSpeedMode::PHYSICAL_LIMIT, 0.0)));
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    }
+
+    SimulatorSnapshot snapshot = simulator->getSnapshot();
+    std::vector<World> first_branch_worlds;
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+        first_branch_worlds.emplace_back(simulator->getWorld());
+    }
+
+    simulator->restoreSnapshot(snapshot);
+    EXPECT_EQ(Timestamp::fromSeconds(0.5), simulator->getTimestamp());
+    for (unsigned int i = 0; i < 30; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+        World first_branch_world  = first_branch_worlds[i];
+        World second_branch_world = simulator->getWorld();
+
+        EXPECT_EQ(first_branch_world.getMostRecentTimestamp(),
+                  second_branch_world.getMostRecentTimestamp())
+            << "Step " << i;
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(
+            first_branch_world.ball().currentState(),
+            second_branch_world.ball().currentState(), 1e-3))
+            << "Step " << i;
+        auto first_branch_robot  = first_branch_world.friendlyTeam().getRobotById(1);
+        auto second_branch_robot = second_branch_world.friendlyTeam().getRobotById(1);
+        ASSERT_TRUE(first_branch_robot);
+        ASSERT_TRUE(second_branch_robot);
+        EXPECT_TRUE(TestUtil::equalWithinTolerance(first_branch_robot->currentState(),
+                                                   second_branch_robot->currentState(),
+                                                   1e-3, Angle::fromDegrees(0.1)))
+            << "Step " << i;
+    }
+}
+
+TEST_F(SimulatorTest, restore_snapshot_into_another_simulator)
+{
+    simulator->setBallState(BallState(Point(-1, 0.5), Vector(0, 2)));
+    simulator->addYellowRobots({RobotStateWithId{
+        .id          = 2,
+        .robot_state = RobotState(Point(1, 1), Vector(1, 0), Angle::half(),
+                                  AngularVelocity::zero())}});
+    simulator->addBlueRobots({RobotStateWithId{
+        .id          = 3,
+        .robot_state = RobotState(Point(2, -1), Vector(0, 0), Angle::zero(),
+                                  AngularVelocity::zero())}});
+    simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+
+    Simulator other_simulator(Field::createSSLDivisionBField(), simulator_config);
+    other_simulator.restoreSnapshot(simulator->getSnapshot());
+
+    World world       = simulator->getWorld();
+    World other_world = other_simulator.getWorld();
+    EXPECT_EQ(world.getMostRecentTimestamp(), other_world.getMostRecentTimestamp());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(world.ball().currentState(),
+                                               other_world.ball().currentState(), 1e-6));
+    ASSERT_EQ(1, other_world.friendlyTeam().numRobots());
+    ASSERT_EQ(1, other_world.enemyTeam().numRobots());
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        world.friendlyTeam().getRobotById(2)->currentState(),
+        other_world.friendlyTeam().getRobotById(2)->currentState(), 1e-6,
+        Angle::fromDegrees(1e-3)));
+    EXPECT_TRUE(TestUtil::equalWithinTolerance(
+        world.enemyTeam().getRobotById(3)->currentState(),
+        other_world.enemyTeam().getRobotById(3)->currentState(), 1e-6,
+        Angle::fromDegrees(1e-3)));
+}
+
+TEST_F(SimulatorTest, simulation_is_the_same_with_any_number_of_firmware_threads)
+{
+    auto multithreaded_simulator_config = std::make_shared<SimulatorConfig>();
+    multithreaded_simulator_config->getMutableNumFirmwareThreads()->setValue(4);
+    Simulator multithreaded_simulator(Field::createSSLDivisionBField(),
+                                      multithreaded_simulator_config);
+
+    for (Simulator* sim : {simulator.get(), &multithreaded_simulator})
+    {
+        sim->setBallState(BallState(Point(0, 0), Vector(-1, 0.5)));
+        std::vector<RobotStateWithId> robot_states;
+        for (RobotId id = 0; id < 6; id++)
+        {
+            robot_states.emplace_back(RobotStateWithId{
+                .id          = id,
+                .robot_state = RobotState(Point(-3 + id, 1), Vector(0, 0), Angle::zero(),
+                                          AngularVelocity::zero())});
+        }
+        sim->addBlueRobots(robot_states);
+        sim->addYellowRobots(robot_states);
+        for (RobotId id = 0; id < 6; id++)
+        {
+            auto primitive = createNanoPbPrimitive(*createMovePrimitive(
+                Point(0, -1 + 0.2 * id), 0.0, Angle::quarter(), DribblerMode::OFF,
+                {AutoChipOrKickMode::AUTOKICK, 3.0}, MaxAllowedSpeedMode::PHYSICAL_LIMIT,
+                0.0));
+            sim->setBlueRobotPrimitive(id, primitive);
+            sim->setYellowRobotPrimitive(id, primitive);
+        }
+    }
+
+    for (unsigned int i = 0; i < 60; i++)
+    {
+        simulator->stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+        multithreaded_simulator.stepSimulation(Duration::fromSeconds(1.0 / 60.0));
+    }
+
+    // The simulations must be exactly the same, not just within a tolerance
+    World world               = simulator->getWorld();
+    World multithreaded_world = multithreaded_simulator.getWorld();
+    EXPECT_EQ(world.ball().position(), multithreaded_world.ball().position());
+    EXPECT_EQ(world.ball().velocity(), multithreaded_world.ball().velocity());
+    auto expect_teams_equal = [](const Team& team, const Team& multithreaded_team) {
+        ASSERT_EQ(team.numRobots(), multithreaded_team.numRobots());
+        for (const Robot& robot : team.getAllRobots())
+        {
+            auto multithreaded_robot = multithreaded_team.getRobotById(robot.id());
+            ASSERT_TRUE(multithreaded_robot);
+            EXPECT_EQ(robot.position(), multithreaded_robot->position());
+            EXPECT_EQ(robot.velocity(), multithreaded_robot->velocity());
+            EXPECT_EQ(robot.orientation(), multithreaded_robot->orientation());
+        }
+    };
+    expect_teams_equal(world.friendlyTeam(), multithreaded_world.friendlyTeam());
+    expect_teams_equal(world.enemyTeam(), multithreaded_world.enemyTeam());
+}
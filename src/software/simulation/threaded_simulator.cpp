@@ -69,7 +69,7 @@ void ThreadedSimulator::setBallState(const BallState &ball_state)
     simulator_mutex.lock();
     simulator.setBallState(ball_state);
     simulator_mutex.unlock();
-    updateCallbacks();
+    updateCallbacksWithCurrentState();
 }
 
 void ThreadedSimulator::removeBall()
@@ -77,7 +77,7 @@ void ThreadedSimulator::removeBall()
     simulator_mutex.lock();
     simulator.removeBall();
     simulator_mutex.unlock();
-    updateCallbacks();
+    updateCallbacksWithCurrentState();
 }
 
 void ThreadedSimulator::addYellowRobots(const std::vector<RobotStateWithId> &robots)
@@ -85,7 +85,7 @@ void ThreadedSimulator::addYellowRobots(const std::vector<RobotStateWithId> &rob
     simulator_mutex.lock();
     simulator.addYellowRobots(robots);
     simulator_mutex.unlock();
-    updateCallbacks();
+    updateCallbacksWithCurrentState();
 }
 
 void ThreadedSimulator::addBlueRobots(const std::vector<RobotStateWithId> &robots)
@@ -93,7 +93,7 @@ void ThreadedSimulator::addBlueRobots(const std::vector<RobotStateWithId> &robot
     simulator_mutex.lock();
     simulator.addBlueRobots(robots);
     simulator_mutex.unlock();
-    updateCallbacks();
+    updateCallbacksWithCurrentState();
 }
 
 void ThreadedSimulator::setYellowRobotPrimitive(RobotId id,
@@ -138,6 +138,12 @@ void ThreadedSimulator::setBlueTeamDefendingSide(
     simulator.setBlueTeamDefendingSide(defending_side_proto);
 }
 
+void ThreadedSimulator::setVisionConfig(const SimulatedVisionConfig &vision_config)
+{
+    std::scoped_lock lock(simulator_mutex);
+    simulator.setVisionConfig(vision_config);
+}
+
 void ThreadedSimulator::runSimulationLoop()
 {
     Duration time_step = Duration::fromSeconds(TIME_STEP_SECONDS);
@@ -162,17 +168,33 @@ void ThreadedSimulator::runSimulationLoop()
 }
 
 void ThreadedSimulator::updateCallbacks()
+{
+    simulator_mutex.lock();
+    auto ssl_wrapper_packets = simulator.popSSLWrapperPackets();
+    simulator_mutex.unlock();
+
+    publishSSLWrapperPackets(ssl_wrapper_packets);
+}
+
+void ThreadedSimulator::updateCallbacksWithCurrentState()
 {
     simulator_mutex.lock();
     auto ssl_wrapper_packet_ptr = simulator.getSSLWrapperPacket();
     simulator_mutex.unlock();
     assert(ssl_wrapper_packet_ptr);
 
+    publishSSLWrapperPackets({*ssl_wrapper_packet_ptr});
+}
+
+void ThreadedSimulator::publishSSLWrapperPackets(
+    const std::vector<SSLProto::SSL_WrapperPacket> &ssl_wrapper_packets)
+{
+    std::scoped_lock lock(callback_mutex);
+    for (const auto &ssl_wrapper_packet : ssl_wrapper_packets)
     {
-        std::scoped_lock lock(callback_mutex);
         for (const auto &callback : ssl_wrapper_packet_callbacks)
         {
-            callback(*ssl_wrapper_packet_ptr);
+            callback(ssl_wrapper_packet);
         }
     }
 }
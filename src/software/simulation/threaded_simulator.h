@@ -153,6 +153,16 @@ class ThreadedSimulator
     void setYellowTeamDefendingSide(const DefendingSideProto& defending_side_proto);
     void setBlueTeamDefendingSide(const DefendingSideProto& defending_side_proto);
 
+    /**
+     * Sets the layout and imperfections of the simulated cameras that the
+     * SSLProto::SSL_WrapperPackets passed to the registered callbacks come from
+     *
+     * Note: This function is threadsafe
+     *
+     * @param vision_config The configuration of the simulated cameras
+     */
+    void setVisionConfig(const SimulatedVisionConfig& vision_config);
+
     /**
      * Returns the PhysicsRobot at the given position. This function accounts
      * for robot radius, so a robot will be returned if the given position is
@@ -186,11 +196,27 @@ class ThreadedSimulator
     void runSimulationLoop();
 
     /**
-     * A helper function to update the callback functions with the latest
-     * data from the simulator
+     * A helper function to update the callback functions with the frames the
+     * simulated cameras have captured since the last update
      */
     void updateCallbacks();
 
+    /**
+     * A helper function to update the callback functions with a perfect view of the
+     * current state of the simulation. This is used after the state is changed
+     * directly (ie. from the GUI), so that the change is shown immediately even if
+     * the simulation is paused and no camera captures a new frame.
+     */
+    void updateCallbacksWithCurrentState();
+
+    /**
+     * Passes the given packets to the registered callbacks
+     *
+     * @param ssl_wrapper_packets The packets to pass to the callbacks
+     */
+    void publishSSLWrapperPackets(
+        const std::vector<SSLProto::SSL_WrapperPacket>& ssl_wrapper_packets);
+
     std::vector<std::function<void(SSLProto::SSL_WrapperPacket)>>
         ssl_wrapper_packet_callbacks;
     std::mutex callback_mutex;
@@ -0,0 +1,88 @@
+#include "software/time/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+LatencyHistogram::LatencyHistogram(const Duration& bucket_width, unsigned int num_buckets)
+    : bucket_width(bucket_width),
+      bucket_counts(num_buckets + 1, 0),
+      num_latencies(0),
+      total_latency_seconds(0),
+      max_latency()
+{
+    if (bucket_width <= Duration::fromSeconds(0) || num_buckets == 0)
+    {
+        throw std::invalid_argument(
+            "LatencyHistogram needs a positive bucket width and at least one bucket");
+    }
+}
+
+void LatencyHistogram::addLatency(const Duration& latency)
+{
+    double latency_seconds = std::max(latency.toSeconds(), 0.0);
+    // The bucket index is computed in floating point first so that very long latencies
+    // can not overflow the index
+    double bucket            = std::floor(latency_seconds / bucket_width.toSeconds());
+    std::size_t bucket_index = bucket < static_cast<double>(bucket_counts.size() - 1)
+                                   ? static_cast<std::size_t>(bucket)
+                                   : bucket_counts.size() - 1;
+
+    bucket_counts[bucket_index]++;
+    num_latencies++;
+    total_latency_seconds += latency_seconds;
+    max_latency = std::max(max_latency, Duration::fromSeconds(latency_seconds));
+}
+
+void LatencyHistogram::clear()
+{
+    std::fill(bucket_counts.begin(), bucket_counts.end(), 0);
+    num_latencies         = 0;
+    total_latency_seconds = 0;
+    max_latency           = Duration();
+}
+
+unsigned int LatencyHistogram::getNumLatencies() const
+{
+    return num_latencies;
+}
+
+Duration LatencyHistogram::getMeanLatency() const
+{
+    if (num_latencies == 0)
+    {
+        return Duration();
+    }
+    return Duration::fromSeconds(total_latency_seconds / num_latencies);
+}
+
+Duration LatencyHistogram::getMaxLatency() const
+{
+    return max_latency;
+}
+
+Duration LatencyHistogram::getPercentileLatency(double percentile) const
+{
+    if (num_latencies == 0)
+    {
+        return Duration();
+    }
+
+    // The number of latencies at or below the percentile, rounded up so that the 0th
+    // percentile is the shortest latency
+    double rank =
+        std::max(std::ceil(std::clamp(percentile, 0.0, 1.0) * num_latencies), 1.0);
+    unsigned int num_latencies_seen = 0;
+    for (std::size_t i = 0; i < bucket_counts.size() - 1; i++)
+    {
+        num_latencies_seen += bucket_counts[i];
+        if (num_latencies_seen >= rank)
+        {
+            // The longest latency is a tighter bound if it is in this bucket
+            return std::min(Duration::fromSeconds(bucket_width.toSeconds() *
+                                                  static_cast<double>(i + 1)),
+                            max_latency);
+        }
+    }
+    return max_latency;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include "software/time/duration.h"
+
+/**
+ * A LatencyHistogram counts latencies in buckets of a fixed width, so that statistics
+ * like percentiles can be found in constant memory no matter how many latencies are
+ * added. Latencies longer than all the buckets are counted in an overflow bucket.
+ */
+class LatencyHistogram
+{
+   public:
+    /**
+     * Creates a new LatencyHistogram with no latencies
+     *
+     * @param bucket_width The range of latencies counted in each bucket
+     * @param num_buckets The number of buckets, not including the overflow bucket
+     *
+     * @throws std::invalid_argument if bucket_width is not positive or num_buckets is 0
+     */
+    explicit LatencyHistogram(const Duration& bucket_width, unsigned int num_buckets);
+
+    /**
+     * Adds a latency to the histogram. Negative latencies, which can happen when
+     * comparing times from unsynchronized clocks, are counted as 0.
+     *
+     * @param latency The latency to add
+     */
+    void addLatency(const Duration& latency);
+
+    /**
+     * Removes all the latencies from the histogram
+     */
+    void clear();
+
+    /**
+     * Returns the number of latencies that have been added
+     *
+     * @return the number of latencies that have been added
+     */
+    unsigned int getNumLatencies() const;
+
+    /**
+     * Returns the mean latency, or 0 if no latencies have been added
+     *
+     * @return the mean latency
+     */
+    Duration getMeanLatency() const;
+
+    /**
+     * Returns the longest latency, or 0 if no latencies have been added
+     *
+     * @return the longest latency
+     */
+    Duration getMaxLatency() const;
+
+    /**
+     * Returns an upper bound on the given percentile of the latencies, accurate to
+     * the bucket width. Percentiles in the overflow bucket are the longest latency.
+     *
+     * @param percentile The percentile to find, in the range [0, 1]
+     *
+     * @return the upper bound of the bucket the percentile is in, or 0 if no latencies
+     * have been added
+     */
+    Duration getPercentileLatency(double percentile) const;
+
+   private:
+    Duration bucket_width;
+    // The last bucket is the overflow bucket
+    std::vector<unsigned int> bucket_counts;
+    unsigned int num_latencies;
+    double total_latency_seconds;
+    Duration max_latency;
+};
@@ -0,0 +1,71 @@
+#include "software/time/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+TEST(LatencyHistogramTest, invalid_arguments)
+{
+    EXPECT_THROW(LatencyHistogram(Duration::fromMilliseconds(0), 10),
+                 std::invalid_argument);
+    EXPECT_THROW(LatencyHistogram(Duration::fromMilliseconds(1), 0),
+                 std::invalid_argument);
+}
+
+TEST(LatencyHistogramTest, empty_histogram)
+{
+    LatencyHistogram histogram(Duration::fromMilliseconds(1), 100);
+    EXPECT_EQ(histogram.getNumLatencies(), 0);
+    EXPECT_EQ(histogram.getMeanLatency(), Duration());
+    EXPECT_EQ(histogram.getMaxLatency(), Duration());
+    EXPECT_EQ(histogram.getPercentileLatency(0.5), Duration());
+}
+
+TEST(LatencyHistogramTest, statistics_of_uniform_latencies)
+{
+    LatencyHistogram histogram(Duration::fromMilliseconds(1), 200);
+    for (int i = 0; i < 100; i++)
+    {
+        // 0.5ms, 1.5ms, ..., 99.5ms
+        histogram.addLatency(Duration::fromMilliseconds(i + 0.5));
+    }
+
+    EXPECT_EQ(histogram.getNumLatencies(), 100);
+    EXPECT_NEAR(histogram.getMeanLatency().toMilliseconds(), 50, 1e-6);
+    EXPECT_NEAR(histogram.getMaxLatency().toMilliseconds(), 99.5, 1e-6);
+    EXPECT_NEAR(histogram.getPercentileLatency(0).toMilliseconds(), 1, 1e-6);
+    EXPECT_NEAR(histogram.getPercentileLatency(0.5).toMilliseconds(), 50, 1e-6);
+    EXPECT_NEAR(histogram.getPercentileLatency(0.99).toMilliseconds(), 99, 1e-6);
+    // The longest latency is a tighter bound than its bucket
+    EXPECT_NEAR(histogram.getPercentileLatency(1).toMilliseconds(), 99.5, 1e-6);
+}
+
+TEST(LatencyHistogramTest, latencies_past_the_last_bucket_overflow)
+{
+    LatencyHistogram histogram(Duration::fromMilliseconds(1), 10);
+    histogram.addLatency(Duration::fromMilliseconds(2.5));
+    histogram.addLatency(Duration::fromSeconds(1e12));
+
+    EXPECT_EQ(histogram.getNumLatencies(), 2);
+    EXPECT_NEAR(histogram.getPercentileLatency(0.5).toMilliseconds(), 3, 1e-6);
+    EXPECT_EQ(histogram.getPercentileLatency(0.99), Duration::fromSeconds(1e12));
+    EXPECT_EQ(histogram.getMaxLatency(), Duration::fromSeconds(1e12));
+}
+
+TEST(LatencyHistogramTest, negative_latencies_are_zero)
+{
+    LatencyHistogram histogram(Duration::fromMilliseconds(1), 10);
+    histogram.addLatency(Duration::fromMilliseconds(-5));
+
+    EXPECT_EQ(histogram.getMeanLatency(), Duration());
+    EXPECT_EQ(histogram.getPercentileLatency(1), Duration());
+}
+
+TEST(LatencyHistogramTest, clear)
+{
+    LatencyHistogram histogram(Duration::fromMilliseconds(1), 10);
+    histogram.addLatency(Duration::fromMilliseconds(5));
+    histogram.clear();
+
+    EXPECT_EQ(histogram.getNumLatencies(), 0);
+    EXPECT_EQ(histogram.getMaxLatency(), Duration());
+    EXPECT_EQ(histogram.getPercentileLatency(0.5), Duration());
+}
@@ -39,18 +39,17 @@ class Time
      */
     double toMilliseconds() const;
 
+   protected:
     /**
      * Destructor
      *
-     * We declare this virtual because no one should use this class directly, but instead
-     * should use one of it's subclasses.
-     *
-     * Note however that we give it an implementation, so subclasses will by default not
-     * be abstract.
+     * This is protected because no one should use this class directly, but instead
+     * should use one of it's subclasses. We deliberately do not make it virtual so
+     * that Time and its subclasses stay trivially copyable, since they are copied
+     * constantly as part of the Robots and Balls in a World.
      */
-    virtual ~Time() = 0;
+    ~Time() = default;
 
-   protected:
     /**
      * Constructs a Time value from a value in seconds.
      *
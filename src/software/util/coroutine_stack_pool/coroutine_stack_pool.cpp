@@ -0,0 +1,165 @@
+#include "software/util/coroutine_stack_pool/coroutine_stack_pool.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+/**
+ * Rounds the given size up to a whole number of pages
+ *
+ * @param size The size to round up, in bytes
+ *
+ * @return the given size rounded up to a whole number of pages
+ */
+static std::size_t roundUpToPageSize(std::size_t size)
+{
+    const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return std::max(page_size, ((size + page_size - 1) / page_size) * page_size);
+}
+
+CoroutineStackPool::CoroutineStackPool(std::size_t stack_size)
+    : stack_size(roundUpToPageSize(stack_size)),
+      guard_size(roundUpToPageSize(1)),
+      free_stacks(),
+      num_stacks(0),
+      high_water_mark(0)
+{
+}
+
+CoroutineStackPool::~CoroutineStackPool()
+{
+    for (void* mapping : free_stacks)
+    {
+        munmap(mapping, guard_size + stack_size);
+    }
+}
+
+boost::context::stack_context CoroutineStackPool::allocate()
+{
+    void* mapping = nullptr;
+    {
+        std::scoped_lock lock(mutex);
+        if (!free_stacks.empty())
+        {
+            mapping = free_stacks.back();
+            free_stacks.pop_back();
+        }
+    }
+
+    if (!mapping)
+    {
+        // Newly mapped memory is zeroed, which measureAndClearStack relies on
+        mapping = mmap(nullptr, guard_size + stack_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        // Stacks grow down, so the guard page goes below the stack
+        if (mprotect(mapping, guard_size, PROT_NONE) != 0)
+        {
+            munmap(mapping, guard_size + stack_size);
+            throw std::bad_alloc();
+        }
+
+        std::scoped_lock lock(mutex);
+        num_stacks++;
+    }
+
+    boost::context::stack_context stack_context;
+    stack_context.size = stack_size;
+    stack_context.sp   = static_cast<char*>(mapping) + guard_size + stack_size;
+    return stack_context;
+}
+
+void CoroutineStackPool::deallocate(boost::context::stack_context& stack_context) noexcept
+{
+    char* stack_bottom           = static_cast<char*>(stack_context.sp) - stack_size;
+    const std::size_t stack_used = measureAndClearStack(stack_bottom);
+
+    std::scoped_lock lock(mutex);
+    high_water_mark = std::max(high_water_mark, stack_used);
+    try
+    {
+        free_stacks.emplace_back(stack_bottom - guard_size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        // If the stack can't be kept for later, give it back to the OS instead
+        munmap(stack_bottom - guard_size, guard_size + stack_size);
+        num_stacks--;
+    }
+}
+
+std::size_t CoroutineStackPool::getStackSize() const
+{
+    return stack_size;
+}
+
+std::size_t CoroutineStackPool::getHighWaterMark() const
+{
+    std::scoped_lock lock(mutex);
+    return high_water_mark;
+}
+
+std::size_t CoroutineStackPool::getNumStacks() const
+{
+    std::scoped_lock lock(mutex);
+    return num_stacks;
+}
+
+std::size_t CoroutineStackPool::getNumFreeStacks() const
+{
+    std::scoped_lock lock(mutex);
+    return free_stacks.size();
+}
+
+std::shared_ptr<CoroutineStackPool> CoroutineStackPool::getAIStackPool()
+{
+    static std::shared_ptr<CoroutineStackPool> ai_stack_pool =
+        std::make_shared<CoroutineStackPool>();
+    return ai_stack_pool;
+}
+
+std::size_t CoroutineStackPool::measureAndClearStack(char* stack_bottom) const
+{
+    // Stacks are zeroed whenever they are returned to the pool, and grow down from the
+    // top, so the lowest byte that is not zero is (very nearly) the deepest the stack
+    // has grown. Only the used part of the stack is cleared, so this costs about as
+    // much as the coroutine's own use of the stack.
+    const std::size_t word_size = sizeof(std::uintptr_t);
+    std::size_t offset          = 0;
+    while (offset < stack_size)
+    {
+        std::uintptr_t word;
+        std::memcpy(&word, stack_bottom + offset, word_size);
+        if (word != 0)
+        {
+            break;
+        }
+        offset += word_size;
+    }
+
+    std::memset(stack_bottom + offset, 0, stack_size - offset);
+    return stack_size - offset;
+}
+
+CoroutineStackAllocator::CoroutineStackAllocator(std::shared_ptr<CoroutineStackPool> pool)
+    : pool(pool)
+{
+}
+
+boost::context::stack_context CoroutineStackAllocator::allocate()
+{
+    return pool->allocate();
+}
+
+void CoroutineStackAllocator::deallocate(
+    boost::context::stack_context& stack_context) noexcept
+{
+    pool->deallocate(stack_context);
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <boost/context/stack_context.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * A CoroutineStackPool hands out fixed-size coroutine stacks and keeps them once they
+ * are returned, so that creating a coroutine reuses an existing stack rather than
+ * mapping a new one.
+ *
+ * Every stack has a guard page below it, so a coroutine that overflows its stack
+ * crashes immediately rather than silently corrupting other memory. The pool also
+ * records the most stack space any coroutine has used, which can be used to choose a
+ * smaller stack size.
+ *
+ * The pool is thread-safe.
+ */
+class CoroutineStackPool
+{
+   public:
+    // The default size of the stacks of the AI's coroutines, in bytes
+    static constexpr std::size_t DEFAULT_STACK_SIZE = 128 * 1024;
+
+    /**
+     * Creates a CoroutineStackPool
+     *
+     * @param stack_size The usable size of each stack, in bytes. This is rounded up to
+     * a whole number of pages.
+     */
+    explicit CoroutineStackPool(std::size_t stack_size = DEFAULT_STACK_SIZE);
+
+    CoroutineStackPool(const CoroutineStackPool&) = delete;
+    CoroutineStackPool& operator=(const CoroutineStackPool&) = delete;
+
+    /**
+     * Unmaps all the stacks in the pool. Every stack must have been returned to the
+     * pool before it is destroyed.
+     */
+    ~CoroutineStackPool();
+
+    /**
+     * Returns a stack from the pool, mapping a new one if there are no free stacks
+     *
+     * @throws std::bad_alloc if a new stack could not be mapped
+     *
+     * @return the stack
+     */
+    boost::context::stack_context allocate();
+
+    /**
+     * Returns a stack to the pool so that it can be reused
+     *
+     * @param stack_context A stack that was allocated by this pool
+     */
+    void deallocate(boost::context::stack_context& stack_context) noexcept;
+
+    /**
+     * Returns the usable size of each stack in the pool
+     *
+     * @return the usable size of each stack in the pool, in bytes
+     */
+    std::size_t getStackSize() const;
+
+    /**
+     * Returns the most stack space used by any coroutine that has returned its stack to
+     * the pool
+     *
+     * @return the most stack space used by any coroutine, in bytes
+     */
+    std::size_t getHighWaterMark() const;
+
+    /**
+     * Returns the number of stacks that have been mapped by the pool
+     *
+     * @return the number of stacks that have been mapped by the pool
+     */
+    std::size_t getNumStacks() const;
+
+    /**
+     * Returns the number of stacks in the pool that are not in use
+     *
+     * @return the number of stacks in the pool that are not in use
+     */
+    std::size_t getNumFreeStacks() const;
+
+    /**
+     * Returns the pool shared by all the coroutines in the AI
+     *
+     * @return the pool shared by all the coroutines in the AI
+     */
+    static std::shared_ptr<CoroutineStackPool> getAIStackPool();
+
+   private:
+    /**
+     * Returns how much of the given stack has been written to since it was last
+     * cleared, and clears it so it can be measured again the next time it is used
+     *
+     * @param stack_bottom The lowest usable address of the stack
+     *
+     * @return how much of the stack has been used, in bytes
+     */
+    std::size_t measureAndClearStack(char* stack_bottom) const;
+
+    // The usable size of each stack and the size of its guard page
+    const std::size_t stack_size;
+    const std::size_t guard_size;
+
+    mutable std::mutex mutex;
+    // The mappings (including the guard pages) of the stacks that are not in use
+    std::vector<void*> free_stacks;
+    std::size_t num_stacks;
+    std::size_t high_water_mark;
+};
+
+/**
+ * A stack allocator for boost coroutines that uses the stacks in a CoroutineStackPool.
+ * Use it by passing it to the constructor of a coroutine, ie.
+ * ```
+ * ActionCoroutine::pull_type(CoroutineStackAllocator(), function);
+ * ```
+ */
+class CoroutineStackAllocator
+{
+   public:
+    /**
+     * Creates a CoroutineStackAllocator that uses the stacks in the given pool
+     *
+     * @param pool The pool to use the stacks of. The pool is kept alive until every
+     * coroutine created with this allocator has been destroyed.
+     */
+    explicit CoroutineStackAllocator(
+        std::shared_ptr<CoroutineStackPool> pool = CoroutineStackPool::getAIStackPool());
+
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context& stack_context) noexcept;
+
+   private:
+    std::shared_ptr<CoroutineStackPool> pool;
+};
@@ -0,0 +1,125 @@
+#include "software/util/coroutine_stack_pool/coroutine_stack_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <boost/coroutine2/all.hpp>
+
+using IntCoroutine = boost::coroutines2::coroutine<int>;
+
+/**
+ * Uses about the given amount of stack space and returns a value that depends on all
+ * of it, so the compiler can't optimize the stack usage away
+ *
+ * @param num_bytes The number of bytes of stack space to use
+ *
+ * @return a value that depends on all the stack space used
+ */
+static int __attribute__((noinline)) useStack(std::size_t num_bytes)
+{
+    volatile char buffer[1024];
+    for (std::size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<char>(i + 1);
+    }
+    int sum = 0;
+    if (num_bytes > sizeof(buffer))
+    {
+        sum += useStack(num_bytes - sizeof(buffer));
+    }
+    // Reading the buffer after the recursive call keeps every frame alive at once
+    return sum + buffer[0] + buffer[sizeof(buffer) - 1];
+}
+
+/**
+ * Creates a coroutine with a stack from the given pool, which uses about the given
+ * amount of stack space and then yields once
+ *
+ * @param pool The pool to take the stack from
+ * @param num_bytes The number of bytes of stack space to use
+ *
+ * @return the coroutine
+ */
+static IntCoroutine::pull_type createCoroutine(std::shared_ptr<CoroutineStackPool> pool,
+                                               std::size_t num_bytes)
+{
+    return IntCoroutine::pull_type(
+        CoroutineStackAllocator(pool),
+        [num_bytes](IntCoroutine::push_type& yield) { yield(useStack(num_bytes)); });
+}
+
+TEST(CoroutineStackPoolTest, stack_size_is_rounded_up_to_pages)
+{
+    CoroutineStackPool pool(1000);
+    EXPECT_EQ(0, pool.getStackSize() % static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+    EXPECT_GE(pool.getStackSize(), 1000);
+}
+
+TEST(CoroutineStackPoolTest, stacks_are_reused)
+{
+    auto pool = std::make_shared<CoroutineStackPool>();
+    for (int i = 0; i < 10; i++)
+    {
+        auto coroutine = createCoroutine(pool, 1024);
+        EXPECT_TRUE(coroutine);
+    }
+
+    EXPECT_EQ(1, pool->getNumStacks());
+    EXPECT_EQ(1, pool->getNumFreeStacks());
+}
+
+TEST(CoroutineStackPoolTest, concurrent_coroutines_get_different_stacks)
+{
+    auto pool = std::make_shared<CoroutineStackPool>();
+    {
+        auto coroutine1 = createCoroutine(pool, 1024);
+        auto coroutine2 = createCoroutine(pool, 1024);
+        EXPECT_EQ(2, pool->getNumStacks());
+        EXPECT_EQ(0, pool->getNumFreeStacks());
+
+        // Each coroutine should have kept its own result
+        EXPECT_EQ(coroutine1.get(), coroutine2.get());
+    }
+    EXPECT_EQ(2, pool->getNumFreeStacks());
+}
+
+TEST(CoroutineStackPoolTest, high_water_mark_tracks_deepest_stack)
+{
+    auto pool = std::make_shared<CoroutineStackPool>();
+    createCoroutine(pool, 4 * 1024);
+    const std::size_t shallow_high_water_mark = pool->getHighWaterMark();
+    EXPECT_GE(shallow_high_water_mark, 4 * 1024);
+
+    createCoroutine(pool, 32 * 1024);
+    const std::size_t deep_high_water_mark = pool->getHighWaterMark();
+    EXPECT_GE(deep_high_water_mark, 32 * 1024);
+    EXPECT_LT(deep_high_water_mark, pool->getStackSize());
+
+    // A shallower coroutine on the same (reused) stack should not lower the mark
+    createCoroutine(pool, 4 * 1024);
+    EXPECT_EQ(deep_high_water_mark, pool->getHighWaterMark());
+}
+
+TEST(CoroutineStackPoolTest, pool_outlives_allocator_users)
+{
+    std::weak_ptr<CoroutineStackPool> weak_pool;
+    {
+        auto pool      = std::make_shared<CoroutineStackPool>();
+        weak_pool      = pool;
+        auto coroutine = createCoroutine(pool, 1024);
+        pool.reset();
+
+        // The coroutine still holds the pool through its allocator
+        EXPECT_FALSE(weak_pool.expired());
+    }
+    EXPECT_TRUE(weak_pool.expired());
+}
+
+TEST(CoroutineStackPoolDeathTest, stack_overflow_hits_guard_page)
+{
+    EXPECT_DEATH(
+        {
+            auto pool      = std::make_shared<CoroutineStackPool>(16 * 1024);
+            auto coroutine = createCoroutine(pool, 64 * 1024);
+        },
+        "");
+}
@@ -0,0 +1,259 @@
+#include "software/util/profiler/profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+/**
+ * The ring buffer of events recorded on a single thread. Only the thread the
+ * buffer belongs to writes events, so the only synchronization needed is publishing
+ * the number of events that have been written.
+ */
+struct ProfilerThreadEvents
+{
+    explicit ProfilerThreadEvents(uint32_t thread_id)
+        : thread_id(thread_id), num_events(0)
+    {
+    }
+
+    const uint32_t thread_id;
+    std::atomic<uint64_t> num_events;
+    std::array<ProfilerEvent, Profiler::EVENTS_PER_THREAD> events;
+};
+
+/**
+ * The event buffers of every running thread that has recorded an event, and the events
+ * recorded by threads that have exited
+ */
+struct ProfilerThreadEventsRegistry
+{
+    std::mutex mutex;
+    std::vector<ProfilerThreadEvents*> thread_events;
+    // The buffers of threads are freed when they exit, and only the events they
+    // recorded are kept, oldest first. At most EVENTS_PER_THREAD of them are kept, so
+    // threads that come and go (ie. in a thread pool) don't use more and more memory.
+    std::deque<ProfilerEvent> exited_thread_events;
+    uint32_t next_thread_id = 0;
+};
+
+/**
+ * Returns the registry of the event buffers of every thread
+ *
+ * @return the registry of the event buffers of every thread
+ */
+static ProfilerThreadEventsRegistry& getRegistry()
+{
+    static ProfilerThreadEventsRegistry registry;
+    return registry;
+}
+
+/**
+ * Appends the events in the given buffer to the given events, oldest first
+ *
+ * @param thread_events The buffer to get the events from
+ * @param events The events to append to
+ */
+template <typename EventContainer>
+static void appendThreadEvents(const ProfilerThreadEvents& thread_events,
+                               EventContainer& events)
+{
+    uint64_t num_events = thread_events.num_events.load(std::memory_order_acquire);
+    uint64_t num_events_kept =
+        std::min<uint64_t>(num_events, Profiler::EVENTS_PER_THREAD);
+    for (uint64_t i = num_events - num_events_kept; i < num_events; i++)
+    {
+        events.push_back(thread_events.events[i % Profiler::EVENTS_PER_THREAD]);
+    }
+}
+
+/**
+ * Owns the event buffer of a thread. The buffer is registered when it is created, and
+ * is freed when the thread exits after its events are moved to the registry.
+ */
+class ProfilerThreadEventsOwner
+{
+   public:
+    explicit ProfilerThreadEventsOwner()
+    {
+        ProfilerThreadEventsRegistry& registry = getRegistry();
+        std::scoped_lock lock(registry.mutex);
+        thread_events = std::make_unique<ProfilerThreadEvents>(registry.next_thread_id++);
+        registry.thread_events.push_back(thread_events.get());
+    }
+
+    ~ProfilerThreadEventsOwner()
+    {
+        ProfilerThreadEventsRegistry& registry = getRegistry();
+        std::scoped_lock lock(registry.mutex);
+        appendThreadEvents(*thread_events, registry.exited_thread_events);
+        while (registry.exited_thread_events.size() > Profiler::EVENTS_PER_THREAD)
+        {
+            registry.exited_thread_events.pop_front();
+        }
+        registry.thread_events.erase(std::find(registry.thread_events.begin(),
+                                               registry.thread_events.end(),
+                                               thread_events.get()));
+    }
+
+    ProfilerThreadEventsOwner(const ProfilerThreadEventsOwner&) = delete;
+    ProfilerThreadEventsOwner& operator=(const ProfilerThreadEventsOwner&) = delete;
+
+    ProfilerThreadEvents& get()
+    {
+        return *thread_events;
+    }
+
+   private:
+    std::unique_ptr<ProfilerThreadEvents> thread_events;
+};
+
+/**
+ * Returns the event buffer of the calling thread
+ *
+ * @return the event buffer of the calling thread
+ */
+static ProfilerThreadEvents& getThreadEvents()
+{
+    // The buffer is only created and registered the first time a thread records an
+    // event, so threads that are never profiled do not use any memory
+    thread_local ProfilerThreadEventsOwner thread_events;
+    return thread_events.get();
+}
+
+/**
+ * Converts the given time to nanoseconds since the steady clock's epoch
+ *
+ * @param time The time to convert
+ *
+ * @return the time in nanoseconds since the steady clock's epoch
+ */
+static int64_t toNanoseconds(const std::chrono::steady_clock::time_point& time)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch())
+        .count();
+}
+
+/**
+ * Writes the given string as a JSON string, with quotes and escapes
+ *
+ * @param output_stream The stream to write the string to
+ * @param string The string to write
+ */
+static void writeJsonString(std::ostream& output_stream, const char* string)
+{
+    output_stream << '"';
+    for (const char* c = string; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            output_stream << '\\' << *c;
+        }
+        else if (static_cast<unsigned char>(*c) < 0x20)
+        {
+            // Control characters can't appear in JSON strings, and shouldn't be in
+            // scope names anyways
+            output_stream << ' ';
+        }
+        else
+        {
+            output_stream << *c;
+        }
+    }
+    output_stream << '"';
+}
+
+void Profiler::recordEvent(const char* name,
+                           const std::chrono::steady_clock::time_point& start_time,
+                           const std::chrono::steady_clock::time_point& end_time)
+{
+    ProfilerThreadEvents& thread_events = getThreadEvents();
+    uint64_t num_events = thread_events.num_events.load(std::memory_order_relaxed);
+    thread_events.events[num_events % EVENTS_PER_THREAD] =
+        ProfilerEvent{.name          = name,
+                      .thread_id     = thread_events.thread_id,
+                      .start_time_ns = toNanoseconds(start_time),
+                      .duration_ns = toNanoseconds(end_time) - toNanoseconds(start_time)};
+    thread_events.num_events.store(num_events + 1, std::memory_order_release);
+}
+
+std::vector<ProfilerEvent> Profiler::getEvents()
+{
+    std::vector<ProfilerEvent> events;
+    ProfilerThreadEventsRegistry& registry = getRegistry();
+    {
+        std::scoped_lock lock(registry.mutex);
+        events.assign(registry.exited_thread_events.begin(),
+                      registry.exited_thread_events.end());
+        for (const ProfilerThreadEvents* thread_events : registry.thread_events)
+        {
+            appendThreadEvents(*thread_events, events);
+        }
+    }
+
+    // Events on a thread are recorded when they end, so nested events are recorded
+    // before the events they are nested in
+    std::stable_sort(events.begin(), events.end(),
+                     [](const ProfilerEvent& a, const ProfilerEvent& b) {
+                         return a.start_time_ns < b.start_time_ns;
+                     });
+    return events;
+}
+
+void Profiler::clear()
+{
+    ProfilerThreadEventsRegistry& registry = getRegistry();
+    std::scoped_lock lock(registry.mutex);
+    registry.exited_thread_events.clear();
+    for (ProfilerThreadEvents* thread_events : registry.thread_events)
+    {
+        thread_events->num_events.store(0, std::memory_order_release);
+    }
+}
+
+void Profiler::writeChromeTrace(std::ostream& output_stream)
+{
+    std::vector<ProfilerEvent> events = getEvents();
+    // Chrome traces are in microseconds, relative to the first event so that the
+    // timestamps are readable
+    int64_t first_start_time_ns = events.empty() ? 0 : events.front().start_time_ns;
+
+    output_stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        const ProfilerEvent& event = events[i];
+        output_stream << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString(output_stream, event.name);
+        output_stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id
+                      << ",\"ts\":"
+                      << static_cast<double>(event.start_time_ns - first_start_time_ns) /
+                             1000.0
+                      << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0
+                      << "}";
+    }
+    output_stream << "\n]}\n";
+}
+
+void Profiler::writeChromeTrace(const std::string& file_path)
+{
+    std::ofstream output_file(file_path, std::ios::out | std::ios::trunc);
+    writeChromeTrace(output_file);
+    if (!output_file)
+    {
+        throw std::runtime_error("Failed to write Chrome trace to " + file_path);
+    }
+}
+
+ScopedProfilerEvent::ScopedProfilerEvent(const char* name)
+    : name(name), start_time(std::chrono::steady_clock::now())
+{
+}
+
+ScopedProfilerEvent::~ScopedProfilerEvent()
+{
+    Profiler::recordEvent(name, start_time, std::chrono::steady_clock::now());
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * A single scope that was timed by the Profiler
+ */
+struct ProfilerEvent
+{
+    // The name of the scope. This must outlive the Profiler, so it is usually a string
+    // literal.
+    const char* name;
+    // A small number that identifies the thread the scope ran on
+    uint32_t thread_id;
+    // When the scope started, in nanoseconds since an arbitrary point in time
+    int64_t start_time_ns;
+    int64_t duration_ns;
+};
+
+/**
+ * The Profiler records how long named scopes take on each thread, so that it can be
+ * seen where the time in a slow AI tick was spent. Scopes are usually timed with the
+ * PROFILE_SCOPE macro below rather than by calling the Profiler directly.
+ *
+ * Events are recorded in a fixed-size ring buffer per thread without locking or
+ * allocating, so that profiling is cheap enough to leave in the hot paths of the AI.
+ * When a thread's ring buffer is full, its oldest events are overwritten. The ring
+ * buffer of a thread is allocated the first time it records an event and freed when it
+ * exits, keeping only the events it recorded.
+ *
+ * The recorded events can be written in the Chrome trace event format, which can be
+ * viewed in chrome://tracing or https://ui.perfetto.dev
+ */
+class Profiler
+{
+   public:
+    Profiler() = delete;
+
+    /**
+     * Records that the named scope ran between the given times on the calling thread
+     *
+     * @param name The name of the scope, which must outlive the Profiler
+     * @param start_time When the scope started
+     * @param end_time When the scope ended
+     */
+    static void recordEvent(const char* name,
+                            const std::chrono::steady_clock::time_point& start_time,
+                            const std::chrono::steady_clock::time_point& end_time);
+
+    /**
+     * Returns the events recorded on all threads, ordered by when they started.
+     *
+     * NOTE: Events that are recorded while this is called may be torn, so this should
+     * only be called while the profiled threads are idle, such as between AI ticks.
+     *
+     * @return the events recorded on all threads
+     */
+    static std::vector<ProfilerEvent> getEvents();
+
+    /**
+     * Removes the events recorded on all threads. Like getEvents, this should only be
+     * called while the profiled threads are idle.
+     */
+    static void clear();
+
+    /**
+     * Writes the recorded events in the Chrome trace event JSON format
+     *
+     * @param output_stream The stream to write the events to
+     */
+    static void writeChromeTrace(std::ostream& output_stream);
+
+    /**
+     * Writes the recorded events in the Chrome trace event JSON format to a file,
+     * replacing it if it exists
+     *
+     * @param file_path The path of the file to write the events to
+     *
+     * @throws std::runtime_error if the file could not be written
+     */
+    static void writeChromeTrace(const std::string& file_path);
+
+    // The number of events that are kept for each thread
+    static constexpr std::size_t EVENTS_PER_THREAD = 1 << 15;
+};
+
+/**
+ * Times the scope it is created in, recording an event with the Profiler when it is
+ * destroyed
+ */
+class ScopedProfilerEvent
+{
+   public:
+    /**
+     * Starts timing a scope
+     *
+     * @param name The name of the scope, which must outlive the Profiler
+     */
+    explicit ScopedProfilerEvent(const char* name);
+
+    ~ScopedProfilerEvent();
+
+    ScopedProfilerEvent(const ScopedProfilerEvent&) = delete;
+    ScopedProfilerEvent& operator=(const ScopedProfilerEvent&) = delete;
+
+   private:
+    const char* name;
+    std::chrono::steady_clock::time_point start_time;
+};
+
+// Profiling is compiled out unless TBOTS_ENABLE_PROFILING is defined, which is done by
+// building with `--config=profile` (see .bazelrc)
+#ifndef TBOTS_ENABLE_PROFILING
+#define PROFILE_SCOPE(name)
+#else
+#define PROFILE_SCOPE_CONCAT_INNER(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_INNER(a, b)
+/**
+ * Times the rest of the enclosing scope with the Profiler under the given name
+ *
+ * @param name The name of the scope, which must be a string literal
+ */
+#define PROFILE_SCOPE(name)                                                              \
+    ScopedProfilerEvent PROFILE_SCOPE_CONCAT(scoped_profiler_event_, __LINE__)(name)
+#endif
@@ -0,0 +1,134 @@
+#include "software/util/profiler/profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+class ProfilerTest : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        Profiler::clear();
+    }
+};
+
+TEST_F(ProfilerTest, nested_scopes_are_ordered_by_start_time)
+{
+    {
+        ScopedProfilerEvent outer_event("outer");
+        {
+            ScopedProfilerEvent inner_event("inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    std::vector<ProfilerEvent> events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_STREQ(events[0].name, "outer");
+    EXPECT_STREQ(events[1].name, "inner");
+    EXPECT_EQ(events[0].thread_id, events[1].thread_id);
+    EXPECT_LE(events[0].start_time_ns, events[1].start_time_ns);
+    EXPECT_GE(events[1].duration_ns, 2'000'000);
+    EXPECT_GE(events[0].duration_ns, events[1].duration_ns);
+}
+
+TEST_F(ProfilerTest, events_are_kept_for_each_thread)
+{
+    std::thread first_thread(
+        []() { ScopedProfilerEvent first_thread_event("first_thread"); });
+    first_thread.join();
+    std::thread second_thread(
+        []() { ScopedProfilerEvent second_thread_event("second_thread"); });
+    second_thread.join();
+
+    std::vector<ProfilerEvent> events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_STREQ(events[0].name, "first_thread");
+    EXPECT_STREQ(events[1].name, "second_thread");
+    EXPECT_NE(events[0].thread_id, events[1].thread_id);
+}
+
+TEST_F(ProfilerTest, oldest_events_are_overwritten_when_buffer_is_full)
+{
+    auto time = std::chrono::steady_clock::time_point();
+    for (std::size_t i = 0; i < Profiler::EVENTS_PER_THREAD + 10; i++)
+    {
+        Profiler::recordEvent("event", time + std::chrono::nanoseconds(i),
+                              time + std::chrono::nanoseconds(i + 1));
+    }
+
+    std::vector<ProfilerEvent> events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), Profiler::EVENTS_PER_THREAD);
+    EXPECT_EQ(events.front().start_time_ns, 10);
+    EXPECT_EQ(events.back().start_time_ns, Profiler::EVENTS_PER_THREAD + 9);
+}
+
+TEST_F(ProfilerTest, only_newest_events_of_exited_threads_are_kept)
+{
+    auto time = std::chrono::steady_clock::time_point();
+    std::thread first_thread([time]() {
+        for (std::size_t i = 0; i < Profiler::EVENTS_PER_THREAD; i++)
+        {
+            Profiler::recordEvent("first_thread", time + std::chrono::nanoseconds(i),
+                                  time + std::chrono::nanoseconds(i + 1));
+        }
+    });
+    first_thread.join();
+    std::thread second_thread([time]() {
+        for (std::size_t i = Profiler::EVENTS_PER_THREAD;
+             i < Profiler::EVENTS_PER_THREAD + 10; i++)
+        {
+            Profiler::recordEvent("second_thread", time + std::chrono::nanoseconds(i),
+                                  time + std::chrono::nanoseconds(i + 1));
+        }
+    });
+    second_thread.join();
+
+    std::vector<ProfilerEvent> events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), Profiler::EVENTS_PER_THREAD);
+    EXPECT_EQ(events.front().start_time_ns, 10);
+    EXPECT_STREQ(events.back().name, "second_thread");
+}
+
+TEST_F(ProfilerTest, profile_scope_is_only_recorded_when_profiling_is_enabled)
+{
+    {
+        PROFILE_SCOPE("scope");
+    }
+#ifdef TBOTS_ENABLE_PROFILING
+    EXPECT_EQ(Profiler::getEvents().size(), 1);
+#else
+    EXPECT_TRUE(Profiler::getEvents().empty());
+#endif
+}
+
+TEST_F(ProfilerTest, clear_removes_events)
+{
+    {
+        ScopedProfilerEvent scope_event("scope");
+    }
+    Profiler::clear();
+    EXPECT_TRUE(Profiler::getEvents().empty());
+}
+
+TEST_F(ProfilerTest, write_chrome_trace)
+{
+    auto time = std::chrono::steady_clock::time_point();
+    Profiler::recordEvent("a \"quoted\" name", time + std::chrono::microseconds(100),
+                          time + std::chrono::microseconds(250));
+    Profiler::recordEvent("second", time + std::chrono::microseconds(300),
+                          time + std::chrono::microseconds(301));
+
+    std::ostringstream output;
+    Profiler::writeChromeTrace(output);
+    std::string thread_id = std::to_string(Profiler::getEvents()[0].thread_id);
+    EXPECT_EQ(output.str(),
+              "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+              "{\"name\":\"a \\\"quoted\\\" name\",\"ph\":\"X\",\"pid\":0,\"tid\":" +
+                  thread_id +
+                  ",\"ts\":0,\"dur\":150},\n"
+                  "{\"name\":\"second\",\"ph\":\"X\",\"pid\":0,\"tid\":" +
+                  thread_id + ",\"ts\":200,\"dur\":1}\n]}\n");
+}
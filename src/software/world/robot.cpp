@@ -10,7 +10,7 @@ Robot::Robot(RobotId id, const Point &position, const Vector &velocity,
     : id_(id),
       current_state_(position, velocity, orientation, angular_velocity),
       timestamp_(timestamp),
-      unavailable_capabilities_(unavailable_capabilities)
+      unavailable_capabilities_(RobotCapabilityMask(unavailable_capabilities))
 {
 }
 
@@ -19,7 +19,7 @@ Robot::Robot(RobotId id, const RobotState &initial_state, const Timestamp &times
     : id_(id),
       current_state_(initial_state),
       timestamp_(timestamp),
-      unavailable_capabilities_(unavailable_capabilities)
+      unavailable_capabilities_(RobotCapabilityMask(unavailable_capabilities))
 {
 }
 
@@ -95,26 +95,29 @@ bool Robot::operator!=(const Robot &other) const
     return !(*this == other);
 }
 
-const std::set<RobotCapability> &Robot::getUnavailableCapabilities() const
+std::set<RobotCapability> Robot::getUnavailableCapabilities() const
 {
-    return unavailable_capabilities_;
+    return unavailable_capabilities_.toSet();
 }
 
 std::set<RobotCapability> Robot::getAvailableCapabilities() const
 {
     // robot capabilities = all possible capabilities - unavailable capabilities
+    return getAvailableCapabilityMask().toSet();
+}
 
-    std::set<RobotCapability> all_capabilities = allRobotCapabilities();
-    std::set<RobotCapability> robot_capabilities;
-    std::set_difference(all_capabilities.begin(), all_capabilities.end(),
-                        getUnavailableCapabilities().begin(),
-                        getUnavailableCapabilities().end(),
-                        std::inserter(robot_capabilities, robot_capabilities.begin()));
+RobotCapabilityMask Robot::getUnavailableCapabilityMask() const
+{
+    return unavailable_capabilities_;
+}
 
-    return robot_capabilities;
+RobotCapabilityMask Robot::getAvailableCapabilityMask() const
+{
+    return unavailable_capabilities_.complement();
 }
 
-std::set<RobotCapability> &Robot::getMutableRobotCapabilities()
+void Robot::setUnavailableCapabilities(
+    const std::set<RobotCapability> &unavailable_capabilities)
 {
-    return unavailable_capabilities_;
+    unavailable_capabilities_ = RobotCapabilityMask(unavailable_capabilities);
 }
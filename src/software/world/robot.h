@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <type_traits>
 
 #include "software/time/timestamp.h"
 #include "software/world/robot_capabilities.h"
@@ -107,7 +108,7 @@ class Robot
      *
      * @return the missing capabilities of the robot
      */
-    const std::set<RobotCapability> &getUnavailableCapabilities() const;
+    std::set<RobotCapability> getUnavailableCapabilities() const;
 
     /**
      * Returns all available capabilities this robot has
@@ -117,11 +118,28 @@ class Robot
     std::set<RobotCapability> getAvailableCapabilities() const;
 
     /**
-     * Returns the mutable hardware capabilities of the robot
+     * Returns the missing capabilities of the robot as a mask. This is cheaper than
+     * getUnavailableCapabilities() and should be preferred in hot code.
      *
-     * @return the mutable hardware capabilities of the robot
+     * @return the missing capabilities of the robot
+     */
+    RobotCapabilityMask getUnavailableCapabilityMask() const;
+
+    /**
+     * Returns all available capabilities this robot has as a mask. This is cheaper
+     * than getAvailableCapabilities() and should be preferred in hot code.
+     *
+     * @return all available capabilities this robot has
      */
-    std::set<RobotCapability> &getMutableRobotCapabilities();
+    RobotCapabilityMask getAvailableCapabilityMask() const;
+
+    /**
+     * Sets the missing capabilities of the robot
+     *
+     * @param unavailable_capabilities The new set of unavailable capabilities
+     */
+    void setUnavailableCapabilities(
+        const std::set<RobotCapability> &unavailable_capabilities);
 
     /**
      * Decides if a point is near the dribbler of the robot
@@ -177,6 +195,13 @@ class Robot
     RobotState current_state_;
     Timestamp timestamp_;
     // The hardware capabilities of the robot, generated from
-    // RobotCapabilityFlags::broken_dribblers/chippers/kickers dynamic parameters
-    std::set<RobotCapability> unavailable_capabilities_;
+    // RobotCapabilityFlags::broken_dribblers/chippers/kickers dynamic parameters.
+    // These are stored as a mask rather than a std::set so that copying a Robot
+    // never allocates
+    RobotCapabilityMask unavailable_capabilities_;
 };
+
+// Robots are copied constantly as part of Teams and Worlds, so we make sure they
+// stay cheap to copy
+static_assert(std::is_trivially_copyable<Robot>::value,
+              "Robot must be trivially copyable");
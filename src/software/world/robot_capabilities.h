@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <bitset>
+#include <cstdint>
 #include <set>
 
 #include "software/util/make_enum/make_enum.h"
@@ -17,6 +19,163 @@ inline std::set<RobotCapability> allRobotCapabilities()
             RobotCapability::Move};
 }
 
+/**
+ * A compact set of RobotCapabilities, stored as a bitmask with one bit per capability.
+ *
+ * Unlike a std::set<RobotCapability>, this type is trivially copyable and never
+ * allocates, so it can be stored in objects that are copied very frequently (such as
+ * the Robots in a World) without making those copies expensive.
+ */
+class RobotCapabilityMask
+{
+   public:
+    /**
+     * Creates an empty RobotCapabilityMask
+     */
+    constexpr RobotCapabilityMask() : mask_(0) {}
+
+    /**
+     * Creates a RobotCapabilityMask containing the given capabilities
+     *
+     * @param capabilities The capabilities to put in the mask
+     */
+    explicit RobotCapabilityMask(const std::set<RobotCapability>& capabilities) : mask_(0)
+    {
+        for (RobotCapability capability : capabilities)
+        {
+            insert(capability);
+        }
+    }
+
+    /**
+     * Returns a mask containing every RobotCapability
+     *
+     * @return a mask containing every RobotCapability
+     */
+    static RobotCapabilityMask all()
+    {
+        static const RobotCapabilityMask all_capabilities(allRobotCapabilities());
+        return all_capabilities;
+    }
+
+    /**
+     * Adds the given capability to this mask
+     *
+     * @param capability The capability to add
+     */
+    void insert(RobotCapability capability)
+    {
+        mask_ = static_cast<uint8_t>(mask_ | bit(capability));
+    }
+
+    /**
+     * Removes the given capability from this mask
+     *
+     * @param capability The capability to remove
+     */
+    void erase(RobotCapability capability)
+    {
+        mask_ = static_cast<uint8_t>(mask_ & ~bit(capability));
+    }
+
+    /**
+     * Returns true if this mask contains the given capability
+     *
+     * @param capability The capability to check for
+     * @return true if this mask contains the given capability, false otherwise
+     */
+    bool contains(RobotCapability capability) const
+    {
+        return (mask_ & bit(capability)) != 0;
+    }
+
+    /**
+     * Returns true if this mask contains no capabilities
+     *
+     * @return true if this mask contains no capabilities, false otherwise
+     */
+    bool empty() const
+    {
+        return mask_ == 0;
+    }
+
+    /**
+     * Returns the number of capabilities in this mask
+     *
+     * @return the number of capabilities in this mask
+     */
+    size_t size() const
+    {
+        return std::bitset<MAX_NUM_CAPABILITIES>(mask_).count();
+    }
+
+    /**
+     * Returns a mask with every capability not contained in this mask
+     *
+     * @return a mask with every capability not contained in this mask
+     */
+    RobotCapabilityMask complement() const
+    {
+        return RobotCapabilityMask(static_cast<uint8_t>(all().mask_ & ~mask_));
+    }
+
+    /**
+     * Converts this mask to a std::set of capabilities
+     *
+     * @return a set containing every capability in this mask
+     */
+    std::set<RobotCapability> toSet() const
+    {
+        std::set<RobotCapability> capabilities;
+        for (unsigned int i = 0; i < MAX_NUM_CAPABILITIES; i++)
+        {
+            if ((mask_ >> i) & 1u)
+            {
+                capabilities.insert(static_cast<RobotCapability>(i));
+            }
+        }
+        return capabilities;
+    }
+
+    /**
+     * Returns the intersection and union of two masks respectively
+     *
+     * @param other The mask to combine with this mask
+     * @return the combined mask
+     */
+    RobotCapabilityMask operator&(const RobotCapabilityMask& other) const
+    {
+        return RobotCapabilityMask(static_cast<uint8_t>(mask_ & other.mask_));
+    }
+    RobotCapabilityMask operator|(const RobotCapabilityMask& other) const
+    {
+        return RobotCapabilityMask(static_cast<uint8_t>(mask_ | other.mask_));
+    }
+
+    bool operator==(const RobotCapabilityMask& other) const
+    {
+        return mask_ == other.mask_;
+    }
+    bool operator!=(const RobotCapabilityMask& other) const
+    {
+        return !(*this == other);
+    }
+
+   private:
+    explicit constexpr RobotCapabilityMask(uint8_t mask) : mask_(mask) {}
+
+    static uint8_t bit(RobotCapability capability)
+    {
+        return static_cast<uint8_t>(1u << static_cast<unsigned int>(capability));
+    }
+
+    // The number of capabilities that fit in the mask
+    static constexpr unsigned int MAX_NUM_CAPABILITIES = 8;
+
+    // One bit per RobotCapability, indexed by the underlying value of the enum
+    uint8_t mask_;
+};
+
 // utility operators below for comparing capabilities
 
 /**
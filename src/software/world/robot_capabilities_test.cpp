@@ -39,3 +39,62 @@ TEST(RobotCapabilitiesTest, test_all_capabilities)
         (all == std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Move,
                                           RobotCapability::Chip, RobotCapability::Kick}));
 }
+
+TEST(RobotCapabilityMaskTest, default_mask_is_empty)
+{
+    RobotCapabilityMask mask;
+    EXPECT_TRUE(mask.empty());
+    EXPECT_EQ(0, mask.size());
+    EXPECT_EQ(std::set<RobotCapability>(), mask.toSet());
+}
+
+TEST(RobotCapabilityMaskTest, construct_from_set_and_convert_back)
+{
+    std::set<RobotCapability> capabilities{RobotCapability::Kick, RobotCapability::Move};
+    RobotCapabilityMask mask(capabilities);
+    EXPECT_EQ(2, mask.size());
+    EXPECT_TRUE(mask.contains(RobotCapability::Kick));
+    EXPECT_TRUE(mask.contains(RobotCapability::Move));
+    EXPECT_FALSE(mask.contains(RobotCapability::Chip));
+    EXPECT_FALSE(mask.contains(RobotCapability::Dribble));
+    EXPECT_EQ(capabilities, mask.toSet());
+}
+
+TEST(RobotCapabilityMaskTest, insert_and_erase)
+{
+    RobotCapabilityMask mask;
+    mask.insert(RobotCapability::Chip);
+    EXPECT_TRUE(mask.contains(RobotCapability::Chip));
+    mask.erase(RobotCapability::Chip);
+    EXPECT_FALSE(mask.contains(RobotCapability::Chip));
+    EXPECT_TRUE(mask.empty());
+}
+
+TEST(RobotCapabilityMaskTest, all_contains_every_capability)
+{
+    EXPECT_EQ(allRobotCapabilities(), RobotCapabilityMask::all().toSet());
+}
+
+TEST(RobotCapabilityMaskTest, complement)
+{
+    RobotCapabilityMask mask(
+        std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Chip});
+    EXPECT_EQ(RobotCapabilityMask(std::set<RobotCapability>{RobotCapability::Kick,
+                                                            RobotCapability::Move}),
+              mask.complement());
+    EXPECT_EQ(RobotCapabilityMask::all(), RobotCapabilityMask().complement());
+}
+
+TEST(RobotCapabilityMaskTest, intersection_and_union)
+{
+    RobotCapabilityMask lhs(
+        std::set<RobotCapability>{RobotCapability::Dribble, RobotCapability::Chip});
+    RobotCapabilityMask rhs(
+        std::set<RobotCapability>{RobotCapability::Chip, RobotCapability::Kick});
+    EXPECT_EQ(RobotCapabilityMask(std::set<RobotCapability>{RobotCapability::Chip}),
+              lhs & rhs);
+    EXPECT_EQ(
+        RobotCapabilityMask(std::set<RobotCapability>{
+            RobotCapability::Dribble, RobotCapability::Chip, RobotCapability::Kick}),
+        lhs | rhs);
+}
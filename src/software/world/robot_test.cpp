@@ -278,3 +278,33 @@ TEST_F(RobotTest, get_available_capabilities)
 
     EXPECT_EQ(expected_capabilities, robot.getAvailableCapabilities());
 }
+
+TEST_F(RobotTest, set_unavailable_capabilities)
+{
+    Robot robot = Robot(0, Point(3, 1.2), Vector(-3, 1), Angle::fromDegrees(0),
+                        AngularVelocity::fromDegrees(25), current_time);
+    EXPECT_TRUE(robot.getUnavailableCapabilities().empty());
+
+    std::set<RobotCapability> unavailable_capabilities = {RobotCapability::Kick};
+    robot.setUnavailableCapabilities(unavailable_capabilities);
+
+    EXPECT_EQ(unavailable_capabilities, robot.getUnavailableCapabilities());
+    EXPECT_EQ(RobotCapabilityMask(unavailable_capabilities),
+              robot.getUnavailableCapabilityMask());
+}
+
+TEST_F(RobotTest, get_available_capability_mask)
+{
+    std::set<RobotCapability> unavailable_capabilities = {
+        RobotCapability::Dribble,
+        RobotCapability::Chip,
+    };
+
+    Robot robot =
+        Robot(0, Point(3, 1.2), Vector(-3, 1), Angle::fromDegrees(0),
+              AngularVelocity::fromDegrees(25), current_time, unavailable_capabilities);
+
+    EXPECT_EQ(RobotCapabilityMask(std::set<RobotCapability>{RobotCapability::Kick,
+                                                            RobotCapability::Move}),
+              robot.getAvailableCapabilityMask());
+}
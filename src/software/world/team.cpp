@@ -1,7 +1,5 @@
 #include "software/world/team.h"
 
-#include <set>
-
 #include "shared/constants.h"
 #include "software/logger/logger.h"
 
@@ -22,32 +20,73 @@ Team::Team(const std::vector<Robot>& team_robots,
 }
 
 
+/**
+ * Finds the robot in the given range that is closest to a reference point
+ *
+ * @param begin The start of the range of robots
+ * @param end The end of the range of robots
+ * @param ref_point The point where the distance to each robot will be measured.
+ * @return Robot that is closest to the reference point, or std::nullopt if the range
+ * is empty
+ */
+template <typename RobotIterator>
+static std::optional<Robot> findNearestRobot(RobotIterator begin, RobotIterator end,
+                                             const Point& ref_point)
+{
+    if (begin == end)
+    {
+        return std::nullopt;
+    }
+
+    Robot nearest_robot = *begin;
+    for (RobotIterator it = begin; it != end; it++)
+    {
+        double curDistance = (ref_point - it->position()).length();
+        if (curDistance < (nearest_robot.position() - ref_point).length())
+        {
+            nearest_robot = *it;
+        }
+    }
+
+    return nearest_robot;
+}
+
 void Team::updateRobots(const std::vector<Robot>& new_robots)
+{
+    updateRobots(new_robots.begin(), new_robots.end());
+}
+
+template <typename RobotIterator>
+void Team::updateRobots(RobotIterator begin, RobotIterator end)
 {
     // Update the robots, checking that there are no duplicate IDs in the given data
-    std::set<unsigned int> robot_ids;
-    for (const auto& robot : new_robots)
+    for (RobotIterator new_robot = begin; new_robot != end; new_robot++)
     {
-        // The second value of the pair that is returned indicates whether or not the
-        // value was already present in the set. We use this to detect duplicate robots
-        auto duplicate_id = robot_ids.insert(robot.id());
-        if (!duplicate_id.second)
+        // A team never has more than a handful of robots, so a linear search over the
+        // robots we have already seen is cheaper than building a set of their ids
+        RobotId id = new_robot->id();
+        if (std::any_of(begin, new_robot, [id](const Robot& r) { return r.id() == id; }))
         {
             throw std::invalid_argument(
                 "Error: Multiple robots on the same team with the same id");
         }
 
         auto it = std::find_if(team_robots.begin(), team_robots.end(),
-                               [robot](const Robot& r) { return r.id() == robot.id(); });
+                               [id](const Robot& r) { return r.id() == id; });
         if (it != team_robots.end())
         {
             // The robot already exists on the team. Find and update the robot
-            it->updateState(robot.currentState(), robot.timestamp());
+            it->updateState(new_robot->currentState(), new_robot->timestamp());
         }
-        else
+        else if (team_robots.size() < team_robots.capacity())
         {
             // This robot does not exist as part of the team yet. Add the new robot
-            team_robots.emplace_back(robot);
+            team_robots.emplace_back(*new_robot);
+        }
+        else
+        {
+            throw std::invalid_argument(
+                "Error: A team can not have more than MAX_ROBOT_IDS robots");
         }
     }
 
@@ -56,7 +95,7 @@ void Team::updateRobots(const std::vector<Robot>& new_robots)
 
 void Team::updateState(const Team& new_team_data)
 {
-    updateRobots(new_team_data.getAllRobots());
+    updateRobots(new_team_data.team_robots.begin(), new_team_data.team_robots.end());
     this->goalie_id = new_team_data.goalie_id;
 
     updateTimestamp(getMostRecentTimestampFromRobots());
@@ -136,7 +175,7 @@ void Team::setUnavailableRobotCapabilities(
     {
         if (robot.id() == id)
         {
-            robot.getMutableRobotCapabilities() = new_unavailable_robot_capabilities;
+            robot.setUnavailableCapabilities(new_unavailable_robot_capabilities);
             return;
         }
     }
@@ -170,7 +209,7 @@ std::optional<unsigned int> Team::getGoalieId() const
     return goalie_id;
 }
 
-const std::vector<Robot>& Team::getAllRobots() const
+const TeamRobots& Team::getAllRobots() const
 {
     return team_robots;
 }
@@ -193,28 +232,13 @@ std::vector<Robot> Team::getAllRobotsExceptGoalie() const
 
 std::optional<Robot> Team::getNearestRobot(const Point& ref_point) const
 {
-    return getNearestRobot(this->getAllRobots(), ref_point);
+    return findNearestRobot(team_robots.begin(), team_robots.end(), ref_point);
 }
 
 std::optional<Robot> Team::getNearestRobot(const std::vector<Robot>& robots,
                                            const Point& ref_point)
 {
-    if (robots.empty())
-    {
-        return std::nullopt;
-    }
-
-    Robot nearest_robot = robots.at(0);
-    for (const Robot& curRobot : robots)
-    {
-        double curDistance = (ref_point - curRobot.position()).length();
-        if (curDistance < (nearest_robot.position() - ref_point).length())
-        {
-            nearest_robot = curRobot;
-        }
-    }
-
-    return nearest_robot;
+    return findNearestRobot(robots.begin(), robots.end(), ref_point);
 }
 
 void Team::clearAllRobots()
@@ -229,11 +253,9 @@ Timestamp Team::getMostRecentTimestamp() const
 
 Timestamp Team::getMostRecentTimestampFromRobots()
 {
-    std::vector<Robot> robots = this->getAllRobots();
-
     Timestamp most_recent_timestamp = Timestamp::fromSeconds(0);
 
-    for (Robot robot : robots)
+    for (const Robot& robot : team_robots)
     {
         if (robot.timestamp() > most_recent_timestamp)
         {
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <boost/container/static_vector.hpp>
 #include <cstdlib>
 #include <map>
 #include <optional>
 #include <vector>
 
+#include "shared/constants.h"
 #include "software/time/timestamp.h"
 #include "software/world/robot.h"
 
+/**
+ * The robots on a Team. This is a fixed-capacity container that stores its robots
+ * inline, so copying a Team (and therefore a World) never allocates.
+ */
+using TeamRobots = boost::container::static_vector<Robot, MAX_ROBOT_IDS>;
+
 /**
  * A team of robots
  */
@@ -37,7 +45,8 @@ class Team
     /**
      * Updates this team with new robots.
      *
-     * @throws std::invalid_argument if multiple robots have the same id
+     * @throws std::invalid_argument if multiple robots have the same id, or if the
+     * team would contain more than MAX_ROBOT_IDS robots
      * @param team_robots the new robots for this team
      */
     void updateRobots(const std::vector<Robot>& team_robots);
@@ -160,11 +169,11 @@ class Team
     std::optional<unsigned int> getGoalieId() const;
 
     /**
-     * Returns a vector of all the robots on this team.
+     * Returns all the robots on this team.
      *
-     * @return a vector of all the robots on this team.
+     * @return all the robots on this team.
      */
-    const std::vector<Robot>& getAllRobots() const;
+    const TeamRobots& getAllRobots() const;
 
     /**
      * Returns a vector of all the robots on this team excluding the goalie
@@ -232,6 +241,17 @@ class Team
     Timestamp getMostRecentTimestamp() const;
 
    private:
+    /**
+     * Updates this team with the robots in the given range
+     *
+     * @throws std::invalid_argument if multiple robots have the same id, or if the
+     * team would contain more than MAX_ROBOT_IDS robots
+     * @param begin The start of the range of new robots
+     * @param end The end of the range of new robots
+     */
+    template <typename RobotIterator>
+    void updateRobots(RobotIterator begin, RobotIterator end);
+
     /**
      * Updates the last update timestamp
      *
@@ -250,7 +270,7 @@ class Team
     Timestamp getMostRecentTimestampFromRobots();
 
     // The robots on this team
-    std::vector<Robot> team_robots;
+    TeamRobots team_robots;
 
     // The robot id of the goalie for this team
     std::optional<unsigned int> goalie_id;
@@ -38,7 +38,7 @@ TEST_F(TeamTest, construction_with_expiry_duration)
     EXPECT_EQ(std::nullopt, team.getRobotById(0));
     EXPECT_EQ(std::nullopt, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(std::vector<Robot>(), team.getAllRobots());
+    EXPECT_EQ(TeamRobots(), team.getAllRobots());
     EXPECT_EQ(Duration::fromMilliseconds(1000), team.getRobotExpiryBufferDuration());
 }
 
@@ -65,7 +65,7 @@ TEST_F(TeamTest, construction_with_expiry_duration_and_team_robots)
     EXPECT_EQ(robot_2, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.getRobotById(3));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(robot_list, team.getAllRobots());
+    EXPECT_EQ(TeamRobots(robot_list.begin(), robot_list.end()), team.getAllRobots());
 }
 
 TEST_F(TeamTest, update_with_3_robots)
@@ -91,7 +91,7 @@ TEST_F(TeamTest, update_with_3_robots)
     EXPECT_EQ(robot_2, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.getRobotById(3));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(robot_list, team.getAllRobots());
+    EXPECT_EQ(TeamRobots(robot_list.begin(), robot_list.end()), team.getAllRobots());
 }
 
 TEST_F(TeamTest, update_with_new_team)
@@ -121,11 +121,52 @@ TEST_F(TeamTest, update_with_new_team)
     EXPECT_EQ(robot_2, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.getRobotById(3));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(robot_list, team.getAllRobots());
+    EXPECT_EQ(TeamRobots(robot_list.begin(), robot_list.end()), team.getAllRobots());
 
     EXPECT_EQ(team_update, team);
 }
 
+TEST_F(TeamTest, update_with_duplicate_robot_ids_throws)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+
+    Robot robot_0_duplicate = Robot(0, Point(3, -1), Vector(), Angle::zero(),
+                                    AngularVelocity::zero(), current_time);
+
+    EXPECT_THROW(team.updateRobots({robot_0, robot_0_duplicate}), std::invalid_argument);
+}
+
+TEST_F(TeamTest, update_with_more_robots_than_capacity_throws)
+{
+    Team team = Team(Duration::fromMilliseconds(1000));
+
+    std::vector<Robot> robot_list;
+    for (unsigned int id = 0; id <= MAX_ROBOT_IDS; id++)
+    {
+        robot_list.emplace_back(id, Point(id, 0), Vector(), Angle::zero(),
+                                AngularVelocity::zero(), current_time);
+    }
+
+    EXPECT_THROW(team.updateRobots(robot_list), std::invalid_argument);
+}
+
+TEST_F(TeamTest, copied_team_is_independent_of_original)
+{
+    Robot robot_0 = Robot(0, Point(0, 1), Vector(-1, -2), Angle::half(),
+                          AngularVelocity::threeQuarter(), current_time);
+    Team team     = Team({robot_0}, Duration::fromMilliseconds(1000));
+
+    Team team_copy = team;
+    team.updateRobots({Robot(0, Point(2, 2), Vector(), Angle::zero(),
+                             AngularVelocity::zero(), one_second_future)});
+
+    EXPECT_EQ(robot_0, team_copy.getRobotById(0));
+    EXPECT_NE(team, team_copy);
+}
+
 TEST_F(TeamTest, remove_expired_robots_at_current_time_so_no_robots_expire)
 {
     Team team = Team(Duration::fromMilliseconds(1000));
@@ -232,7 +273,7 @@ TEST_F(TeamTest, removeRobotWithId_robot_with_id_on_team)
     team.removeRobotWithId(0);
 
     EXPECT_EQ(1, team.getAllRobots().size());
-    EXPECT_EQ(std::vector<Robot>{robot_1}, team.getAllRobots());
+    EXPECT_EQ(TeamRobots{robot_1}, team.getAllRobots());
 }
 
 TEST_F(TeamTest, removeRobotWithId_robot_with_id_not_on_team)
@@ -248,7 +289,7 @@ TEST_F(TeamTest, removeRobotWithId_robot_with_id_not_on_team)
     team.removeRobotWithId(2);
 
     EXPECT_EQ(2, team.getAllRobots().size());
-    EXPECT_EQ(std::vector<Robot>({robot_0, robot_1}), team.getAllRobots());
+    EXPECT_EQ(TeamRobots({robot_0, robot_1}), team.getAllRobots());
 }
 
 
@@ -271,7 +312,7 @@ TEST_F(TeamTest, clear_all_robots)
     EXPECT_EQ(robot_1, team.getRobotById(1));
     EXPECT_EQ(std::nullopt, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(robot_list, team.getAllRobots());
+    EXPECT_EQ(TeamRobots(robot_list.begin(), robot_list.end()), team.getAllRobots());
 
     team.clearAllRobots();
 
@@ -280,7 +321,7 @@ TEST_F(TeamTest, clear_all_robots)
     EXPECT_EQ(std::nullopt, team.getRobotById(1));
     EXPECT_EQ(std::nullopt, team.getRobotById(2));
     EXPECT_EQ(std::nullopt, team.goalie());
-    EXPECT_EQ(std::vector<Robot>(), team.getAllRobots());
+    EXPECT_EQ(TeamRobots(), team.getAllRobots());
 }
 
 TEST_F(TeamTest, assign_goalie_starting_with_no_goalie)
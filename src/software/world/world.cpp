@@ -1,6 +1,21 @@
 #include "software/world/world.h"
 
-#include "boost/circular_buffer.hpp"
+/**
+ * Adds a value to the back of a fixed-size history buffer, discarding the oldest value
+ * if the buffer is already full
+ *
+ * @param history The history buffer to add to
+ * @param value The value to add
+ */
+template <typename T, std::size_t N>
+static void pushToHistory(boost::container::static_vector<T, N> &history, const T &value)
+{
+    if (history.size() == history.capacity())
+    {
+        history.erase(history.begin());
+    }
+    history.push_back(value);
+}
 
 World::World(const Field &field, const Ball &ball, const Team &friendly_team,
              const Team &enemy_team, unsigned int buffer_size)
@@ -12,9 +27,10 @@ World::World(const Field &field, const Ball &ball, const Team &friendly_team,
       current_referee_stage_(),
       last_update_timestamp_(),
       // Store a small buffer of previous referee commands so we can filter out noise
-      referee_command_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      referee_stage_history_(REFEREE_COMMAND_BUFFER_SIZE),
-      team_with_possesion_(TeamSide::ENEMY)
+      referee_command_history_(),
+      referee_stage_history_(),
+      team_with_possesion_(TeamSide::ENEMY),
+      latency_trace_()
 {
     updateTimestamp(getMostRecentTimestampFromMembers());
 }
@@ -73,7 +89,7 @@ const Team &World::enemyTeam() const
 
 void World::updateRefereeCommand(const RefereeCommand &command)
 {
-    referee_command_history_.push_back(command);
+    pushToHistory(referee_command_history_, command);
     // Take the consensus of the previous referee messages
     if (!referee_command_history_.empty() &&
         std::all_of(referee_command_history_.begin(), referee_command_history_.end(),
@@ -94,7 +110,7 @@ void World::updateRefereeCommand(const RefereeCommand &command,
 
 void World::updateRefereeStage(const RefereeStage &stage)
 {
-    referee_stage_history_.push_back(stage);
+    pushToHistory(referee_stage_history_, stage);
     // Take the consensus of the previous referee messages
     if (!referee_stage_history_.empty() &&
         std::all_of(referee_stage_history_.begin(), referee_stage_history_.end(),
@@ -167,3 +183,13 @@ TeamSide World::getTeamWithPossession() const
 {
     return team_with_possesion_;
 }
+
+void World::setLatencyTrace(const WorldLatencyTrace &latency_trace)
+{
+    latency_trace_ = latency_trace;
+}
+
+const WorldLatencyTrace &World::getLatencyTrace() const
+{
+    return latency_trace_;
+}
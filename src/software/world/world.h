@@ -1,12 +1,13 @@
 #pragma once
 
 
-#include <boost/circular_buffer.hpp>
+#include <boost/container/static_vector.hpp>
 
 #include "software/world/ball.h"
 #include "software/world/field.h"
 #include "software/world/game_state.h"
 #include "software/world/team.h"
+#include "software/world/world_latency_trace.h"
 
 /**
  * The world object describes the entire state of the world, which for us is all the
@@ -167,10 +168,25 @@ class World final
      */
     TeamSide getTeamWithPossession() const;
 
+    /**
+     * Sets the latency trace of the vision data this World was last updated with
+     *
+     * @param latency_trace The latency trace of the vision data
+     */
+    void setLatencyTrace(const WorldLatencyTrace& latency_trace);
+
+    /**
+     * Gets the latency trace of the vision data this World was last updated with. The
+     * trace is empty if the World was not created from traced vision data.
+     *
+     * @return The latency trace of the vision data
+     */
+    const WorldLatencyTrace& getLatencyTrace() const;
+
     /**
      * Defines the equality operator for a World. Worlds are equal if their field, ball
      * friendly_team, enemy_team and game_state are equal. The last update
-     * timestamp and histories are not part of the equality.
+     * timestamp, histories and latency trace are not part of the equality.
      *
      * @param other The world to compare against for equality
      * @return True if the other robot is equal to this world, and false otherwise
@@ -202,10 +218,15 @@ class World final
     GameState current_game_state_;
     RefereeStage current_referee_stage_;
     Timestamp last_update_timestamp_;
-    // A small buffer that stores previous referee command
-    boost::circular_buffer<RefereeCommand> referee_command_history_;
+    // A small buffer that stores previous referee command. This is stored inline
+    // (rather than in a heap-allocated circular buffer) so copying a World never
+    // allocates
+    boost::container::static_vector<RefereeCommand, REFEREE_COMMAND_BUFFER_SIZE>
+        referee_command_history_;
     // A small buffer that stores previous referee stage
-    boost::circular_buffer<RefereeStage> referee_stage_history_;
+    boost::container::static_vector<RefereeStage, REFEREE_COMMAND_BUFFER_SIZE>
+        referee_stage_history_;
     // which team has possession of the ball
     TeamSide team_with_possesion_;
+    WorldLatencyTrace latency_trace_;
 };
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "shared/constants.h"
+#include "software/world/world.h"
+
+// Count every heap allocation made by the benchmarked code so the cost of copying a
+// World can be reported in allocations as well as in time
+static std::atomic<size_t> num_allocations(0);
+
+void *operator new(std::size_t size)
+{
+    num_allocations++;
+    if (void *ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * Creates a team with the given number of robots spread along the x-axis, some of
+ * which are missing capabilities
+ *
+ * @param num_robots The number of robots on the team
+ * @param timestamp The timestamp of every robot on the team
+ *
+ * @return a team with num_robots robots
+ */
+static Team createTeam(unsigned int num_robots, const Timestamp &timestamp)
+{
+    std::vector<Robot> robots;
+    for (unsigned int id = 0; id < num_robots; id++)
+    {
+        std::set<RobotCapability> unavailable_capabilities;
+        if (id % 3 == 0)
+        {
+            unavailable_capabilities = {RobotCapability::Chip, RobotCapability::Kick};
+        }
+        robots.emplace_back(id, Point(-4.0 + id * 0.5, 1.0), Vector(0.5, -0.25),
+                            Angle::fromDegrees(id * 30), AngularVelocity::zero(),
+                            timestamp, unavailable_capabilities);
+    }
+    Team team(robots);
+    team.assignGoalie(0);
+    return team;
+}
+
+/**
+ * Creates a World with a full division A team on each side
+ *
+ * @return a populated World
+ */
+static World createWorld()
+{
+    Timestamp timestamp = Timestamp::fromSeconds(10);
+    World world(
+        Field::createSSLDivisionAField(), Ball(Point(0, 0), Vector(1, 0), timestamp),
+        createTeam(DIV_A_NUM_ROBOTS, timestamp), createTeam(DIV_A_NUM_ROBOTS, timestamp));
+    world.updateRefereeCommand(RefereeCommand::FORCE_START);
+    world.updateRefereeStage(RefereeStage::NORMAL_FIRST_HALF);
+    return world;
+}
+
+static void BM_copyWorld(benchmark::State &state)
+{
+    World world             = createWorld();
+    size_t allocations_seen = num_allocations;
+    for (auto _ : state)
+    {
+        World world_copy = world;
+        benchmark::DoNotOptimize(world_copy);
+    }
+    state.counters["allocs_per_copy"] =
+        benchmark::Counter(static_cast<double>(num_allocations - allocations_seen),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_copyWorld);
+
+static void BM_constructWorld(benchmark::State &state)
+{
+    Timestamp timestamp = Timestamp::fromSeconds(10);
+    Field field         = Field::createSSLDivisionAField();
+    Ball ball(Point(0, 0), Vector(1, 0), timestamp);
+    Team friendly_team      = createTeam(DIV_A_NUM_ROBOTS, timestamp);
+    Team enemy_team         = createTeam(DIV_A_NUM_ROBOTS, timestamp);
+    size_t allocations_seen = num_allocations;
+    for (auto _ : state)
+    {
+        World world(field, ball, friendly_team, enemy_team);
+        benchmark::DoNotOptimize(world);
+    }
+    state.counters["allocs_per_construction"] =
+        benchmark::Counter(static_cast<double>(num_allocations - allocations_seen),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_constructWorld);
+
+static void BM_updateTeamState(benchmark::State &state)
+{
+    World world             = createWorld();
+    Team new_team_state     = world.friendlyTeam();
+    size_t allocations_seen = num_allocations;
+    for (auto _ : state)
+    {
+        world.updateFriendlyTeamState(new_team_state);
+        benchmark::ClobberMemory();
+    }
+    state.counters["allocs_per_update"] =
+        benchmark::Counter(static_cast<double>(num_allocations - allocations_seen),
+                           benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_updateTeamState);
+
+static void BM_getAvailableCapabilities(benchmark::State &state)
+{
+    World world = createWorld();
+    for (auto _ : state)
+    {
+        for (const Robot &robot : world.friendlyTeam().getAllRobots())
+        {
+            benchmark::DoNotOptimize(robot.getAvailableCapabilities());
+        }
+    }
+}
+BENCHMARK(BM_getAvailableCapabilities);
+
+static void BM_getAvailableCapabilityMask(benchmark::State &state)
+{
+    World world = createWorld();
+    for (auto _ : state)
+    {
+        for (const Robot &robot : world.friendlyTeam().getAllRobots())
+        {
+            benchmark::DoNotOptimize(robot.getAvailableCapabilityMask());
+        }
+    }
+}
+BENCHMARK(BM_getAvailableCapabilityMask);
@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+ * The times at which the vision data that a World was created from reached each stage
+ * of the full system before the AI, in seconds since the Unix epoch. The times of stages
+ * the data has not reached are 0.
+ *
+ * This is a plain struct rather than a TbotsProto::LatencyTrace so that the World does
+ * not depend on protobuf. It is converted to a TbotsProto::LatencyTrace, along with the
+ * times of the later stages, in the PrimitiveSet the AI creates from the World.
+ */
+struct WorldLatencyTrace
+{
+    // When the camera captured the frame, according to SSL Vision
+    double camera_capture_time_seconds = 0;
+    // When the backend received the frame
+    double backend_received_time_seconds = 0;
+    // When SensorFusion created a World from the frame
+    double sensor_fusion_time_seconds = 0;
+};
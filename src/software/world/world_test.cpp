@@ -193,3 +193,15 @@ TEST_F(WorldTest, set_team_with_possession)
     world.setTeamWithPossession(TeamSide::ENEMY);
     EXPECT_EQ(world.getTeamWithPossession(), TeamSide::ENEMY);
 }
+
+TEST_F(WorldTest, set_latency_trace)
+{
+    EXPECT_EQ(world.getLatencyTrace().backend_received_time_seconds, 0);
+
+    world.setLatencyTrace(WorldLatencyTrace{.camera_capture_time_seconds   = 10.0,
+                                            .backend_received_time_seconds = 10.5});
+
+    World world_copy = world;
+    EXPECT_EQ(world_copy.getLatencyTrace().camera_capture_time_seconds, 10.0);
+    EXPECT_EQ(world_copy.getLatencyTrace().backend_received_time_seconds, 10.5);
+}